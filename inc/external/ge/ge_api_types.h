@@ -41,6 +41,9 @@ const char *const OPTION_EXEC_DUMP_PATH = "ge.exec.dumpPath";
 // Hccl flag, if ge.exec.hcclFlag =1, it means load plugin for opskernel, else:ge.exec.hcclFlag =0
 const char *const OPTION_EXEC_HCCL_FLAG = "ge.exec.hcclFlag";
 const char *const OPTION_EXEC_ATOMIC_FLAG = "ge.exec.enable_atomic";
+// Number of requests a loaded model keeps in flight, its value should be int32_t type, default value is "1".
+// When it is greater than 1, input copy, execution and result return of consecutive requests are pipelined.
+const char *const OPTION_EXEC_PIPELINE_DEPTH = "ge.exec.pipelineDepth";
 
 // Option key: memory init
 const char *const GRAPH_MEMORY_MAX_SIZE = "ge.graphMemoryMaxSize";
@@ -138,6 +141,16 @@ const std::string GE_FE_FLAG = "ge.feFlag";
 // this option is to obtain stream max parallel num
 const std::string STREAM_MAX_PARALLEL_NUM = "ge.streamMaxParallelNum";
 
+// Configure build work running at the same time per engine by Session constructor options param,
+// its value should be engine:int, such as "AIcoreEngine:8,DNN_VM_AICPU:2".
+// Subgraphs of an engine not listed are optimized without limit, its op running params one node at a time
+const std::string BUILD_MAX_PARALLEL_NUM = "ge.buildMaxParallelNum";
+
+// Configure estimated execution time of op types by Session constructor options param, such as from profiling data,
+// its value should be op_type:int, such as "Conv2D:120,Relu:5", op types not listed cost 1.
+// When it is set, logical streams are assigned by critical path over these costs instead of by dependency
+const std::string STREAM_OP_COST = "ge.streamOpCost";
+
 // configure outputDatatype to setting net output type
 const std::string OUTPUT_DATATYPE = "ge.outputDatatype";
 
@@ -161,6 +174,9 @@ const std::string SAVE_ORIGINAL_MODEL = "ge.saveOriginalModel";
 // Save original model file name
 const std::string ORIGINAL_MODEL_FILE = "ge.originalModelFile";
 
+// Directory of the on disk compile cache, built models are reused from it when the same graph is built again
+const std::string GRAPH_COMPILE_CACHE_DIR = "ge.graphCompileCacheDir";
+
 const char *const OPTION_GE_MAX_DUMP_FILE_NUM = "ge.maxDumpFileNum";
 const char *const OPTION_GE_MAX_DUMP_FILE_SIZE = "ge.maxDumpFileSize";
 const char *const OPTION_GE_MAX_DUMP_OP_NUM = "ge.maxDumpOpNum";
@@ -86,6 +86,23 @@ class GE_FUNC_DEV_VISIBILITY GE_FUNC_HOST_VISIBILITY GeExecutor {
   ///
   ge::Status LoadDataFromFile(const std::string &path, ge::ModelData &model_data);
 
+  ///
+  /// @ingroup ge
+  /// @brief Map model file instead of reading it to memory, partitions are paged in on demand
+  /// @param [in] const std::string &path: Offline model file path
+  /// @param [out] ModelData &model_data: Offline model data, must be released by ReleaseModelData
+  /// @return SUCCESS handle successfully / others handle failed
+  ///
+  ge::Status MapDataFromFile(const std::string &path, ge::ModelData &model_data);
+
+  ///
+  /// @ingroup ge
+  /// @brief Release model data got from LoadDataFromFile or MapDataFromFile
+  /// @param [in] ModelData &model_data: Offline model data
+  /// @return SUCCESS handle successfully / others handle failed
+  ///
+  ge::Status ReleaseModelData(ge::ModelData &model_data);
+
   ///
   /// @ingroup ge
   /// @brief Load model from offline model memory data
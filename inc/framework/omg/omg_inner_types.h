@@ -125,6 +125,30 @@ namespace domi {
 /// @return OmgContext context
 ///
 ge::OmgContext &GetContext();
+
+///
+/// @ingroup domi_omg
+/// @brief make GetContext of the calling thread return context, nullptr restores the process wide context
+/// @param [in] context context owned by the caller, must outlive the binding
+/// @return OmgContext the context bound before, nullptr for the process wide one
+///
+ge::OmgContext *SetThreadContext(ge::OmgContext *context);
+
+///
+/// @ingroup domi_omg
+/// @brief bind a context to the calling thread for the lifetime of the scope and restore the previous one on exit,
+///        threads shared by sessions or graph managers never keep a context of a finished task
+///
+class OmgContextScope {
+ public:
+  explicit OmgContextScope(ge::OmgContext *context) : prev_context_(SetThreadContext(context)) {}
+  ~OmgContextScope() { (void)SetThreadContext(prev_context_); }
+  OmgContextScope(const OmgContextScope &) = delete;
+  OmgContextScope &operator=(const OmgContextScope &) = delete;
+
+ private:
+  ge::OmgContext *prev_context_;
+};
 }  // namespace domi
 
 #endif  // INC_FRAMEWORK_OMG_OMG_INNER_TYPES_H_
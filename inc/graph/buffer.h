@@ -17,6 +17,7 @@
 #ifndef INC_GRAPH_BUFFER_H_
 #define INC_GRAPH_BUFFER_H_
 
+#include <functional>
 #include <memory>
 #include <string>
 #include <vector>
@@ -38,6 +39,36 @@ namespace ge {
 
 using std::shared_ptr;
 
+/// Refcounted payload of a tensor that is not backed by a protobuf message.
+/// Memory allocated here is aligned to kAlignment, adopted memory keeps the alignment of its allocator.
+class GE_FUNC_DEV_VISIBILITY GE_FUNC_HOST_VISIBILITY TensorData {
+ public:
+  using Deleter = std::function<void(std::uint8_t *)>;
+  static const std::size_t kAlignment = 64;
+
+  TensorData() = default;
+  ~TensorData() = default;
+  TensorData(const TensorData &) = delete;
+  TensorData &operator=(const TensorData &) = delete;
+
+  graphStatus SetData(const std::uint8_t *data, std::size_t size);
+  // Keep the first min(size, GetSize()) bytes, zero fill the rest
+  graphStatus Resize(std::size_t size);
+  // Take over the storage of data without copying it
+  void Adopt(std::vector<std::uint8_t> &&data);
+  void Adopt(std::uint8_t *data, std::size_t size, const Deleter &deleter);
+  void Clear();
+
+  const std::uint8_t *GetData() const { return data_.get(); }
+  std::uint8_t *GetData() { return data_.get(); }
+  std::size_t GetSize() const { return size_; }
+
+ private:
+  std::shared_ptr<std::uint8_t> data_;
+  std::size_t size_ = 0;
+  std::size_t capacity_ = 0;
+};
+
 class GE_FUNC_DEV_VISIBILITY GE_FUNC_HOST_VISIBILITY Buffer {
  public:
   Buffer();
@@ -62,6 +93,9 @@ class GE_FUNC_DEV_VISIBILITY GE_FUNC_HOST_VISIBILITY Buffer {
   inline std::size_t size() const { return GetSize(); }
   inline void clear() { return ClearBuffer(); }
   uint8_t operator[](size_t index) const {
+    if (tensor_data_ != nullptr) {
+      return index < tensor_data_->GetSize() ? tensor_data_->GetData()[index] : 0xff;
+    }
     if (buffer_ != nullptr && index < buffer_->size()) {
       return (uint8_t)(*buffer_)[index];
     }
@@ -71,10 +105,14 @@ class GE_FUNC_DEV_VISIBILITY GE_FUNC_HOST_VISIBILITY Buffer {
  private:
   GeIrProtoHelper<proto::AttrDef> data_;
   std::string *buffer_ = nullptr;
+  // Set when the buffer aliases the payload of a native GeTensor
+  std::shared_ptr<TensorData> tensor_data_;
 
   // Create buffer from protobuf obj
   Buffer(const ProtoMsgOwner &protoOnwer, proto::AttrDef *buffer);
   Buffer(const ProtoMsgOwner &protoOnwer, std::string *buffer);
+  // Create buffer that shares the payload of a native tensor
+  explicit Buffer(const std::shared_ptr<TensorData> &tensor_data);
 
   friend class GeAttrValueImp;
   friend class GeTensor;
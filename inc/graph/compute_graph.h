@@ -17,10 +17,13 @@
 #ifndef INC_GRAPH_COMPUTE_GRAPH_H_
 #define INC_GRAPH_COMPUTE_GRAPH_H_
 
+#include <cstdint>
 #include <deque>
 #include <map>
 #include <memory>
+#include <mutex>
 #include <string>
+#include <unordered_map>
 #include <utility>
 #include <vector>
 
@@ -55,6 +58,79 @@ using ConstComputeGraph = const ComputeGraph;
 class OperatorImpl;
 using OperatorImplPtr = std::shared_ptr<OperatorImpl>;
 
+///
+/// Read only snapshot of a node list and the edges among the nodes. A node is numbered by its position in the list
+/// and the in and out nodes of all nodes are kept as ids in a few contiguous arrays, so that analysis passes walk the
+/// graph without locking anchors or copying node vectors. Edges to nodes out of the list are left out.
+/// The snapshot is not updated when the graph changes, build it from the node list where it is walked.
+///
+class CompactGraph {
+ public:
+  static const uint32_t kInvalidNodeId = UINT32_MAX;
+
+  class IdRange {
+   public:
+    IdRange(const uint32_t *begin, const uint32_t *end) : begin_(begin), end_(end) {}
+    const uint32_t *begin() const { return begin_; }
+    const uint32_t *end() const { return end_; }
+    size_t size() const { return static_cast<size_t>(end_ - begin_); }
+    bool empty() const { return begin_ == end_; }
+
+   private:
+    const uint32_t *begin_;
+    const uint32_t *end_;
+  };
+
+  explicit CompactGraph(const std::vector<NodePtr> &nodes);
+  ~CompactGraph() = default;
+  CompactGraph(const CompactGraph &) = delete;
+  CompactGraph &operator=(const CompactGraph &) = delete;
+
+  size_t GetNodesSize() const { return nodes_.size(); }
+  size_t GetEdgesSize() const { return out_all_.ids.size(); }
+  const std::vector<NodePtr> &GetNodes() const { return nodes_; }
+  const NodePtr &GetNode(uint32_t id) const { return nodes_[id]; }
+  // kInvalidNodeId if the node is not in the snapshot
+  uint32_t GetNodeId(const Node *node) const;
+
+  // Peers of all anchors, a node is repeated once per edge. Out nodes are in the order of Node::GetOutAllNodes,
+  // the peers of every out data anchor followed by the peers of the out control anchor
+  IdRange GetOutAllNodes(uint32_t id) const { return GetRange(out_all_, id); }
+  // Peers of the in data anchors followed by the peers of the in control anchor
+  IdRange GetInAllNodes(uint32_t id) const { return GetRange(in_all_, id); }
+  // Only the edges from an out data anchor to an in data anchor, as Node::GetOutDataNodes and GetInDataNodes
+  IdRange GetOutDataNodes(uint32_t id) const { return GetRange(out_data_, id); }
+  IdRange GetInDataNodes(uint32_t id) const { return GetRange(in_data_, id); }
+  // Only the edges between control anchors, as Node::GetInControlNodes
+  IdRange GetOutControlNodes(uint32_t id) const { return GetRange(out_control_, id); }
+  IdRange GetInControlNodes(uint32_t id) const { return GetRange(in_control_, id); }
+  // Number of the peers of the in anchors that are not in the snapshot
+  uint32_t GetOutsideInNum(uint32_t id) const { return outside_in_nums_[id]; }
+
+ private:
+  struct Adjacency {
+    // Peers of node i are ids[offsets[i]] to ids[offsets[i + 1]]
+    std::vector<uint32_t> offsets;
+    std::vector<uint32_t> ids;
+  };
+
+  static IdRange GetRange(const Adjacency &adjacency, uint32_t id) {
+    const uint32_t *ids = adjacency.ids.data();
+    return IdRange(ids + adjacency.offsets[id], ids + adjacency.offsets[id + 1]);
+  }
+  uint32_t AddPeers(const Anchor &anchor, bool is_data, Adjacency &all, Adjacency &data, Adjacency &control) const;
+
+  std::vector<NodePtr> nodes_;
+  std::unordered_map<const Node *, uint32_t> node_ids_;
+  Adjacency out_all_;
+  Adjacency in_all_;
+  Adjacency out_data_;
+  Adjacency in_data_;
+  Adjacency out_control_;
+  Adjacency in_control_;
+  std::vector<uint32_t> outside_in_nums_;
+};
+
 class ComputeGraph : public std::enable_shared_from_this<ComputeGraph>, public AttrHolder {
   friend class GraphUtils;
 
@@ -64,6 +140,8 @@ class ComputeGraph : public std::enable_shared_from_this<ComputeGraph>, public A
 
   explicit ComputeGraph(const std::string &name);
   virtual ~ComputeGraph();
+  // The node index is rebuilt for the copied node list
+  ComputeGraph &operator=(const ComputeGraph &compute_graph);
 
   std::string GetName() const;
   void SetName(const std::string &name);
@@ -80,7 +158,13 @@ class ComputeGraph : public std::enable_shared_from_this<ComputeGraph>, public A
   Vistor<NodePtr> GetInputNodes() const;
   Vistor<NodePtr> GetOutputNodes() const;
 
+  // A direct node with the name, nullptr if there is none
   NodePtr FindNode(const std::string &name) const;
+  ///
+  /// Rename a direct node and its index entry. A node renamed through its OpDesc is found by a scan of the node list
+  /// on the first lookup of the new name, and indexed by it from then on.
+  ///
+  graphStatus RenameNode(const NodePtr &node, const std::string &name);
   // Add node
   NodePtr AddNode(NodePtr node);
   NodePtr AddNode(OpDescPtr op);
@@ -99,6 +183,7 @@ class ComputeGraph : public std::enable_shared_from_this<ComputeGraph>, public A
 
   graphStatus TopologicalSorting();
   bool IsValid() const;
+
   void Dump() const;
 
   graphStatus IsolateNode(const NodePtr &node);
@@ -195,27 +280,39 @@ class ComputeGraph : public std::enable_shared_from_this<ComputeGraph>, public A
   ConstProtoAttrMapHelper GetAttrMap() const override;
 
  private:
-  graphStatus DFSTopologicalSorting(std::vector<NodePtr> &node_vec, std::map<NodePtr, uint32_t> &map_in_edge_num,
-                                    std::vector<NodePtr> &stack);
-  graphStatus BFSTopologicalSorting(std::vector<NodePtr> &node_vec, std::map<NodePtr, uint32_t> &map_in_edge_num,
-                                    std::deque<NodePtr> &stack);
-  graphStatus CollectBreadthOutNode(const NodePtr &node, std::map<NodePtr, uint32_t> &map_in_edge_num,
-                                    std::map<string, NodePtr> &breadth_node_map);
-  graphStatus SortNodes(std::vector<NodePtr> &stack, std::map<NodePtr, uint32_t> &mapInEdgeNum);
-  size_t GetInEdgeSize(const NodePtr &node);
+  graphStatus DFSTopologicalSorting(const CompactGraph &graph, std::vector<NodePtr> &node_vec,
+                                    std::vector<uint32_t> &in_edge_nums, std::vector<uint32_t> &stack);
+  graphStatus BFSTopologicalSorting(const CompactGraph &graph, std::vector<NodePtr> &node_vec,
+                                    std::vector<uint32_t> &in_edge_nums, std::deque<uint32_t> &stack);
+  graphStatus CollectBreadthOutNode(const CompactGraph &graph, uint32_t id, std::vector<uint32_t> &in_edge_nums,
+                                    std::map<string, uint32_t> &breadth_node_map);
+  graphStatus SortNodes(const CompactGraph &graph, std::vector<uint32_t> &stack, std::vector<uint32_t> &in_edge_nums);
   size_t GetOutEdgeSize(const NodePtr &node);
   graphStatus RemoveExtraOutEdge(const NodePtr &node);
   bool GraphMembersAreEqual(const ComputeGraph &r_graph) const;
   bool GraphAttrsAreEqual(const ComputeGraph &r_graph) const;
   bool VectorInputNodePtrIsEqual(const std::vector<NodePtr> &r_node_ptr_vector,
                                  const std::vector<NodePtr> &l_node_ptr_vector) const;
+  std::vector<NodePtr> GetDirectNodeVec() const;
+  void InsertNodeToList(size_t pos, const NodePtr &node);
+  bool EraseNodeFromList(const NodePtr &node);
+  void EraseNodeName(const std::string &name, const Node *node);
+  void CompactNodeList();
+  void ClearNodeList();
 
   ProtoAttrMapHelper attrs_;
 
   friend class ModelSerializeImp;
   friend class GraphDebugImp;
   friend class OnnxUtils;
+  // Direct nodes in order. A removed node leaves a nullptr that is squeezed out once half of the vector is removed
+  // nodes, node_indexes_ and node_names_ index the nodes so that lookup and removal do not scan the vector
   std::vector<NodePtr> nodes_;
+  size_t removed_node_num_;
+  std::unordered_map<const Node *, size_t> node_indexes_;
+  // Nodes sharing a name are kept in the order they were indexed, FindNode adds nodes renamed through their OpDesc
+  mutable std::unordered_map<std::string, std::vector<const Node *>> node_names_;
+  mutable std::mutex node_names_mutex_;
   std::vector<NodePtr> input_nodes_;
   std::vector<std::shared_ptr<ComputeGraph>> sub_graph_;
   std::string name_;
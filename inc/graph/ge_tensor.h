@@ -49,12 +49,15 @@ class GE_FUNC_DEV_VISIBILITY GE_FUNC_HOST_VISIBILITY GeShape {
   GeShape &operator=(GeShape &&other);
 
  private:
+  // Set when the shape is a view of the ShapeDef inside a proto owned tensor, dims_ is used otherwise
   GeIrProtoHelper<proto::ShapeDef> shape_def_;
+  std::vector<int64_t> dims_;
   friend class GeTensorDesc;
   // Create geshape from proto obj
   GeShape(const ProtoMsgOwner &protoOnwer, proto::ShapeDef *protoMsg);
 
   void RefTo(const GeShape &shape) { shape_def_ = shape.shape_def_; }
+  void SetDims(const std::vector<int64_t> &dims);
 };
 
 class GE_FUNC_DEV_VISIBILITY GE_FUNC_HOST_VISIBILITY GeTensorDesc : public AttrHolder {
@@ -110,8 +113,6 @@ class GE_FUNC_DEV_VISIBILITY GE_FUNC_HOST_VISIBILITY GeTensorDesc : public AttrH
   using AttrHolder::HasAttr;
   using AttrHolder::SetAttr;
 
-  void Init();
-
   // Create getensordesc from proto obj
   GeTensorDesc(const ProtoMsgOwner &protoOnwer, proto::TensorDescriptor *protoMsg);
   friend class GeTensor;
@@ -119,8 +120,39 @@ class GE_FUNC_DEV_VISIBILITY GE_FUNC_HOST_VISIBILITY GeTensorDesc : public AttrH
   friend class ModelSerializeImp;
   friend class OnnxUtils;
 
+  // Protobuf is only produced and parsed at serialization time
+  void ToProto(proto::TensorDescriptor &proto_msg) const;
+  void FromProto(const proto::TensorDescriptor &proto_msg);
+  void CopyFrom(const GeTensorDesc &desc);
+  void MoveFrom(GeTensorDesc &&desc);
+
+  // Typed fields of a desc that is not a view of a proto message
+  struct Fields {
+    Format format = FORMAT_ND;
+    Format origin_format = FORMAT_ND;
+    DataType data_type = DT_FLOAT;
+    DataType origin_data_type = DT_UNDEFINED;
+    std::vector<int64_t> origin_shape;
+    int64_t size = 0;
+    int64_t weight_size = 0;
+    bool reuse_input = false;
+    bool output_tensor = false;
+    DeviceType device_type = NPU;
+    bool input_tensor = false;
+    int64_t real_dim_cnt = 0;
+    int64_t reuse_input_index = 0;
+    int64_t data_offset = 0;
+    int64_t cmps_size = 0;
+    std::string cmps_tab;
+    int64_t cmps_tab_offset = 0;
+  };
+  Fields fields_;
+  // Attributes of a native desc, allocated on first write
+  ProtoAttrMapHelper attr_map_;
+
+  // Set only when the desc is a view of the TensorDescriptor inside a proto owned tensor
   GeIrProtoHelper<proto::TensorDescriptor> tensor_descriptor_;
-  // Reference from tensorDescriptor_, do not direct use
+  // Shape of a native desc, or a reference into tensor_descriptor_ for views
   mutable GeShape __shape_;
 
   void RefTo(const GeTensorDesc &tensorDesc) { tensor_descriptor_ = tensorDesc.tensor_descriptor_; }
@@ -143,10 +175,13 @@ class GE_FUNC_DEV_VISIBILITY GE_FUNC_HOST_VISIBILITY GeTensor {
 
   const Buffer GetData() const;
   Buffer MutableData();
+  // Takes over the storage of data without copying it
   graphStatus SetData(std::vector<uint8_t> &&data);
   graphStatus SetData(const std::vector<uint8_t> &data);
   graphStatus SetData(const Buffer &data);
   graphStatus SetData(const uint8_t *data, size_t size);
+  // Resize data in place without a source to copy from, for producers that fill MutableData directly
+  graphStatus ResizeData(size_t size);
 
   GeTensor Clone() const;
 
@@ -159,11 +194,18 @@ class GE_FUNC_DEV_VISIBILITY GE_FUNC_HOST_VISIBILITY GeTensor {
   friend class GeAttrValueImp;
   friend class ModelSerializeImp;
   friend class OnnxUtils;
+  friend class TensorUtils;
   // Create getensor from proto obj
   GeTensor(const ProtoMsgOwner &protoOnwer, proto::TensorDef *protoMsg);
+  void ToProto(proto::TensorDef &proto_msg) const;
+
+  // Set only when the tensor is a view of a TensorDef owned by an attribute or a serialized model
   GeIrProtoHelper<proto::TensorDef> tensor_def_;
   // Reference from tensorDef_, cab not use it directly
   mutable GeTensorDesc __desc_;
+  // Desc and payload of a native tensor, shared between copies
+  std::shared_ptr<GeTensorDesc> desc_;
+  std::shared_ptr<TensorData> data_;
   GeTensorDesc &DescReference() const;
 };
 }  // namespace ge
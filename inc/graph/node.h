@@ -73,6 +73,7 @@ typedef std::vector<std::multimap<std::string, ge::AnchorPtr>> kFusionDataFlowVe
 // Node is a component of ComputeGraph
 class Node : public std::enable_shared_from_this<Node> {
   friend class ComputeGraph;
+  friend class CompactGraph;
   friend class ModelSerializeImp;
 
  public:
@@ -17,6 +17,7 @@
 #ifndef INC_GRAPH_RANGE_VISTOR_H_
 #define INC_GRAPH_RANGE_VISTOR_H_
 
+#include <utility>
 #include <vector>
 
 template <class E, class O>
@@ -27,6 +28,8 @@ class RangeVistor {
 
   RangeVistor(O owner, const std::vector<E> &vs) : owner_(owner), elements_(vs) {}
 
+  RangeVistor(O owner, std::vector<E> &&vs) : owner_(owner), elements_(std::move(vs)) {}
+
   ~RangeVistor() {}
 
   Iterator begin() { return elements_.begin(); }
@@ -16,10 +16,101 @@
 
 #include "graph/buffer.h"
 
+#include <cstring>
+#include <new>
+
 #include "proto/ge_ir.pb.h"
 #include "framework/common/debug/ge_log.h"
 
 namespace ge {
+namespace {
+std::shared_ptr<std::uint8_t> AllocAligned(std::size_t size) {
+  std::shared_ptr<std::uint8_t> raw(new (std::nothrow) std::uint8_t[size + TensorData::kAlignment - 1],
+                                    std::default_delete<std::uint8_t[]>());
+  if (raw == nullptr) {
+    return nullptr;
+  }
+  auto addr = reinterpret_cast<uintptr_t>(raw.get());
+  addr = (addr + TensorData::kAlignment - 1) & ~static_cast<uintptr_t>(TensorData::kAlignment - 1);
+  // Share ownership with raw so that the unaligned address is the one released
+  return std::shared_ptr<std::uint8_t>(raw, reinterpret_cast<std::uint8_t *>(addr));
+}
+
+// Returned for empty native buffers, keeps GetData() const non null like an empty proto string
+const std::uint8_t kEmptyData[1] = {0};
+}  // namespace
+
+const std::size_t TensorData::kAlignment;
+
+graphStatus TensorData::SetData(const std::uint8_t *data, std::size_t size) {
+  if (data == nullptr) {
+    size = 0;
+  }
+  if (size <= capacity_) {
+    if (size > 0) {
+      (void)memmove(data_.get(), data, size);
+    }
+    size_ = size;
+    return GRAPH_SUCCESS;
+  }
+  auto new_data = AllocAligned(size);
+  if (new_data == nullptr) {
+    GELOGE(MEMALLOC_FAILED, "Failed to alloc tensor memory, size %zu", size);
+    return GRAPH_FAILED;
+  }
+  (void)memcpy(new_data.get(), data, size);
+  data_ = new_data;
+  size_ = size;
+  capacity_ = size;
+  return GRAPH_SUCCESS;
+}
+
+graphStatus TensorData::Resize(std::size_t size) {
+  if (size <= capacity_) {
+    if (size > size_) {
+      (void)memset(data_.get() + size_, 0, size - size_);
+    }
+    size_ = size;
+    return GRAPH_SUCCESS;
+  }
+  auto new_data = AllocAligned(size);
+  if (new_data == nullptr) {
+    GELOGE(MEMALLOC_FAILED, "Failed to alloc tensor memory, size %zu", size);
+    return GRAPH_FAILED;
+  }
+  if (size_ > 0) {
+    (void)memcpy(new_data.get(), data_.get(), size_);
+  }
+  (void)memset(new_data.get() + size_, 0, size - size_);
+  data_ = new_data;
+  size_ = size;
+  capacity_ = size;
+  return GRAPH_SUCCESS;
+}
+
+void TensorData::Adopt(std::vector<std::uint8_t> &&data) {
+  if (data.empty()) {
+    Clear();
+    return;
+  }
+  auto holder = std::make_shared<std::vector<std::uint8_t>>(std::move(data));
+  data_ = std::shared_ptr<std::uint8_t>(holder, holder->data());
+  size_ = holder->size();
+  capacity_ = size_;
+}
+
+void TensorData::Adopt(std::uint8_t *data, std::size_t size, const Deleter &deleter) {
+  data_ = std::shared_ptr<std::uint8_t>(data, deleter);
+  size_ = (data == nullptr) ? 0 : size;
+  capacity_ = size_;
+}
+
+void TensorData::Clear() {
+  data_ = nullptr;
+  size_ = 0;
+  capacity_ = 0;
+}
+
 Buffer::Buffer() {
   data_.InitDefault();
   if (data_.GetProtoMsg()) {
@@ -31,6 +122,7 @@ Buffer::Buffer(const Buffer &other) {
   // Share data
   data_ = other.data_;
   buffer_ = other.buffer_;
+  tensor_data_ = other.tensor_data_;
 }
 
 // default
@@ -74,16 +166,22 @@ Buffer::Buffer(const std::shared_ptr<google::protobuf::Message> &proto_owner, st
   buffer_ = buffer;
 }
 
+Buffer::Buffer(const std::shared_ptr<TensorData> &tensor_data) : tensor_data_(tensor_data) {}
+
 Buffer &Buffer::operator=(const Buffer &other) {
   if (&other != this) {
     // Share data
     data_ = other.data_;
     buffer_ = other.buffer_;
+    tensor_data_ = other.tensor_data_;
   }
   return *this;
 }
 
 const std::uint8_t *Buffer::GetData() const {
+  if (tensor_data_ != nullptr) {
+    return (tensor_data_->GetData() != nullptr) ? tensor_data_->GetData() : kEmptyData;
+  }
   if (buffer_ != nullptr) {
     return (const std::uint8_t *)buffer_->data();
   }
@@ -91,6 +189,9 @@ const std::uint8_t *Buffer::GetData() const {
 }
 
 std::uint8_t *Buffer::GetData() {
+  if (tensor_data_ != nullptr) {
+    return (tensor_data_->GetSize() > 0) ? tensor_data_->GetData() : nullptr;
+  }
   if (buffer_ != nullptr && !buffer_->empty()) {
     // Avoid copy on write
     (void)(*buffer_)[0];
@@ -100,6 +201,9 @@ std::uint8_t *Buffer::GetData() {
 }
 
 std::size_t Buffer::GetSize() const {
+  if (tensor_data_ != nullptr) {
+    return tensor_data_->GetSize();
+  }
   if (buffer_ != nullptr) {
     return buffer_->size();
   }
@@ -107,6 +211,10 @@ std::size_t Buffer::GetSize() const {
 }
 
 void Buffer::ClearBuffer() {
+  if (tensor_data_ != nullptr) {
+    tensor_data_->Clear();
+    return;
+  }
   if (buffer_ != nullptr) {
     buffer_->clear();
   }
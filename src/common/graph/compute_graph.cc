@@ -36,26 +36,132 @@
 namespace ge {
 namespace {
 const size_t OUTPUT_PARAM_SIZE = 2;
+// In edge number of a node left out of topological sorting
+const uint32_t kNotSortedNode = UINT32_MAX;
 }  // namespace
 
+const uint32_t CompactGraph::kInvalidNodeId;
+
+CompactGraph::CompactGraph(const std::vector<NodePtr> &nodes) : nodes_(nodes) {
+  node_ids_.reserve(nodes_.size());
+  for (size_t i = 0; i < nodes_.size(); ++i) {
+    (void)node_ids_.emplace(nodes_[i].get(), static_cast<uint32_t>(i));
+  }
+  for (Adjacency *adjacency : {&out_all_, &in_all_, &out_data_, &in_data_, &out_control_, &in_control_}) {
+    adjacency->offsets.reserve(nodes_.size() + 1);
+    adjacency->offsets.push_back(0);
+  }
+  outside_in_nums_.assign(nodes_.size(), 0);
+  for (size_t i = 0; i < nodes_.size(); ++i) {
+    const NodePtr &node = nodes_[i];
+    if (node != nullptr) {
+      for (const auto &anchor : node->out_data_anchors_) {
+        GE_IF_BOOL_EXEC(anchor != nullptr, (void)AddPeers(*anchor, true, out_all_, out_data_, out_control_));
+      }
+      GE_IF_BOOL_EXEC(node->out_control_anchor_ != nullptr,
+                      (void)AddPeers(*node->out_control_anchor_, false, out_all_, out_data_, out_control_));
+      for (const auto &anchor : node->in_data_anchors_) {
+        GE_IF_BOOL_EXEC(anchor != nullptr,
+                        outside_in_nums_[i] += AddPeers(*anchor, true, in_all_, in_data_, in_control_));
+      }
+      if (node->in_control_anchor_ != nullptr) {
+        outside_in_nums_[i] += AddPeers(*node->in_control_anchor_, false, in_all_, in_data_, in_control_);
+      }
+    }
+    for (Adjacency *adjacency : {&out_all_, &in_all_, &out_data_, &in_data_, &out_control_, &in_control_}) {
+      adjacency->offsets.push_back(static_cast<uint32_t>(adjacency->ids.size()));
+    }
+  }
+}
+
+uint32_t CompactGraph::AddPeers(const Anchor &anchor, bool is_data, Adjacency &all, Adjacency &data,
+                                Adjacency &control) const {
+  // Data peers of a data anchor go first, as GetPeerInDataAnchors followed by GetPeerInControlAnchors
+  std::vector<uint32_t> control_ids;
+  uint32_t outside_num = 0;
+  for (const auto &weak_peer : anchor.peer_anchors_) {
+    AnchorPtr peer = weak_peer.lock();
+    uint32_t peer_id = (peer == nullptr) ? kInvalidNodeId : GetNodeId(peer->GetOwnerNode().get());
+    if (peer_id == kInvalidNodeId) {
+      outside_num++;
+      continue;
+    }
+    bool is_data_peer = peer->IsTypeOf<DataAnchor>();
+    if (is_data && is_data_peer) {
+      all.ids.push_back(peer_id);
+      data.ids.push_back(peer_id);
+    } else if (is_data) {
+      control_ids.push_back(peer_id);
+    } else {
+      all.ids.push_back(peer_id);
+      GE_IF_BOOL_EXEC(!is_data_peer, control.ids.push_back(peer_id));
+    }
+  }
+  all.ids.insert(all.ids.end(), control_ids.begin(), control_ids.end());
+  return outside_num;
+}
+
+uint32_t CompactGraph::GetNodeId(const Node *node) const {
+  auto iter = node_ids_.find(node);
+  return (iter == node_ids_.end()) ? kInvalidNodeId : iter->second;
+}
+
 GE_FUNC_DEV_VISIBILITY GE_FUNC_HOST_VISIBILITY ComputeGraph::ComputeGraph(const std::string &name)
-    : nodes_(), input_nodes_(), sub_graph_(), name_(name), is_valid_flag_(false), need_iteration_(false) {
+    : nodes_(),
+      removed_node_num_(0),
+      node_indexes_(),
+      node_names_(),
+      input_nodes_(),
+      sub_graph_(),
+      name_(name),
+      is_valid_flag_(false),
+      need_iteration_(false) {
   attrs_.InitDefault();
 }
 ComputeGraph::~ComputeGraph() {}
+ComputeGraph &ComputeGraph::operator=(const ComputeGraph &compute_graph) {
+  if (this == &compute_graph) {
+    return *this;
+  }
+  AttrHolder::operator=(compute_graph);
+  origGraph_ = compute_graph.origGraph_;
+  attrs_ = compute_graph.attrs_;
+  ClearNodeList();
+  for (const auto &node : compute_graph.GetDirectNodeVec()) {
+    InsertNodeToList(nodes_.size(), node);
+  }
+  input_nodes_ = compute_graph.input_nodes_;
+  sub_graph_ = compute_graph.sub_graph_;
+  name_ = compute_graph.name_;
+  is_valid_flag_ = compute_graph.is_valid_flag_;
+  is_summary_graph_ = compute_graph.is_summary_graph_;
+  need_iteration_ = compute_graph.need_iteration_;
+  params_share_map_ = compute_graph.params_share_map_;
+  out_nodes_map_ = compute_graph.out_nodes_map_;
+  op_name_map_ = compute_graph.op_name_map_;
+  inputs_order_ = compute_graph.inputs_order_;
+  output_size_ = compute_graph.output_size_;
+  input_size_ = compute_graph.input_size_;
+  all_nodes_infos_ = compute_graph.all_nodes_infos_;
+  output_nodes_info_ = compute_graph.output_nodes_info_;
+  target_nodes_info_ = compute_graph.target_nodes_info_;
+  session_id_ = compute_graph.session_id_;
+  graph_id_ = compute_graph.graph_id_;
+  data_format_ = compute_graph.data_format_;
+  return *this;
+}
 GE_FUNC_DEV_VISIBILITY GE_FUNC_HOST_VISIBILITY string ComputeGraph::GetName() const { return name_; }
 GE_FUNC_DEV_VISIBILITY GE_FUNC_HOST_VISIBILITY void ComputeGraph::SetName(const string &name) { name_ = name; }
 
 GE_FUNC_DEV_VISIBILITY GE_FUNC_HOST_VISIBILITY size_t ComputeGraph::GetAllNodesSize() const {
-  size_t s = nodes_.size();
+  size_t s = GetDirectNodesSize();
   for (const auto &sub_graph : sub_graph_) {
     s += sub_graph->GetAllNodesSize();
   }
   return s;
 }
 GE_FUNC_DEV_VISIBILITY GE_FUNC_HOST_VISIBILITY ComputeGraph::Vistor<NodePtr> ComputeGraph::GetAllNodes() const {
-  vector<NodePtr> all_nodes(nodes_.size());
-  (void)std::copy(nodes_.begin(), nodes_.end(), all_nodes.begin());
+  vector<NodePtr> all_nodes = GetDirectNodeVec();
   for (const auto &sub_graph : sub_graph_) {
     if (sub_graph == nullptr) {
       GELOGW("sub graph is nullptr");
@@ -65,11 +171,24 @@ GE_FUNC_DEV_VISIBILITY GE_FUNC_HOST_VISIBILITY ComputeGraph::Vistor<NodePtr> Com
       all_nodes.push_back(node);
     }
   }
-  return Vistor<NodePtr>(shared_from_this(), all_nodes);
+  return Vistor<NodePtr>(shared_from_this(), std::move(all_nodes));
 }
-size_t ComputeGraph::GetDirectNodesSize() const { return nodes_.size(); }
+size_t ComputeGraph::GetDirectNodesSize() const { return nodes_.size() - removed_node_num_; }
 GE_FUNC_DEV_VISIBILITY GE_FUNC_HOST_VISIBILITY ComputeGraph::Vistor<NodePtr> ComputeGraph::GetDirectNode() const {
-  return Vistor<NodePtr>(shared_from_this(), nodes_);
+  return Vistor<NodePtr>(shared_from_this(), GetDirectNodeVec());
+}
+std::vector<NodePtr> ComputeGraph::GetDirectNodeVec() const {
+  if (removed_node_num_ == 0) {
+    return nodes_;
+  }
+  std::vector<NodePtr> direct_nodes;
+  direct_nodes.reserve(GetDirectNodesSize());
+  for (const auto &node : nodes_) {
+    if (node != nullptr) {
+      direct_nodes.push_back(node);
+    }
+  }
+  return direct_nodes;
 }
 ComputeGraph::Vistor<NodePtr> ComputeGraph::GetInputNodes() const {
   return Vistor<NodePtr>(shared_from_this(), input_nodes_);
@@ -83,11 +202,24 @@ ComputeGraph::Vistor<NodePtr> ComputeGraph::GetOutputNodes() const {
   return Vistor<NodePtr>(shared_from_this(), result);
 }
 GE_FUNC_DEV_VISIBILITY GE_FUNC_HOST_VISIBILITY NodePtr ComputeGraph::FindNode(const std::string &name) const {
-  for (const auto &node : nodes_) {
-    if (node == nullptr) {
-      continue;
+  std::lock_guard<std::mutex> lock(node_names_mutex_);
+  auto name_iter = node_names_.find(name);
+  if (name_iter != node_names_.end()) {
+    auto &name_nodes = name_iter->second;
+    for (auto iter = name_nodes.begin(); iter != name_nodes.end();) {
+      auto index_iter = node_indexes_.find(*iter);
+      if ((index_iter != node_indexes_.end()) && (nodes_[index_iter->second]->GetName() == name)) {
+        return nodes_[index_iter->second];
+      }
+      // Renamed through its OpDesc, it is indexed by its new name when that is looked up
+      iter = name_nodes.erase(iter);
     }
-    if (node->GetName() == name) {
+    (void)node_names_.erase(name_iter);
+  }
+
+  for (const auto &node : nodes_) {
+    if ((node != nullptr) && (node->GetName() == name)) {
+      node_names_[name].push_back(node.get());
       return node;
     }
   }
@@ -153,7 +285,7 @@ GE_FUNC_DEV_VISIBILITY GE_FUNC_HOST_VISIBILITY bool ComputeGraph::VectorInputNod
 GE_FUNC_DEV_VISIBILITY GE_FUNC_HOST_VISIBILITY bool ComputeGraph::GraphMembersAreEqual(
     const ComputeGraph &r_graph) const {
   return (IsEqual(this->sub_graph_.size(), r_graph.sub_graph_.size(), "graph.sub_graph_.size()") &&
-          IsEqual(this->nodes_.size(), r_graph.nodes_.size(), "graph.nodes_.size()") &&
+          IsEqual(this->GetDirectNodesSize(), r_graph.GetDirectNodesSize(), "graph.nodes_.size()") &&
           VectorInputNodePtrIsEqual(this->input_nodes_, r_graph.input_nodes_) &&
           IsEqual(this->name_, r_graph.name_, "graph.name_") &&
           IsEqual(this->is_valid_flag_, r_graph.is_valid_flag_, "graph.is_valid_flag_") &&
@@ -173,7 +305,7 @@ GE_FUNC_DEV_VISIBILITY GE_FUNC_HOST_VISIBILITY bool ComputeGraph::operator==(con
   }
 
   // Secondly: Node equal means the link relationship between node and node itself equal
-  for (const auto &left_node : nodes_) {
+  for (const auto &left_node : GetDirectNodeVec()) {
     if (left_node == nullptr) {
       GELOGE(GRAPH_FAILED, "left_node is nullptr");
       return false;
@@ -202,15 +334,16 @@ NodePtr ComputeGraph::AddNodeFront(NodePtr node) {
     GELOGE(GRAPH_FAILED, "The node ptr or op desc should not be null.");
     return nullptr;
   }
+  CompactNodeList();
   node->GetOpDesc()->SetId(nodes_.size());
-  if (nodes_[0] == nullptr) {
+  if (!nodes_.empty() && (nodes_[0] == nullptr)) {
     GELOGE(GRAPH_FAILED, "nodes_ size or nodes_[0] is nullptr");
     return nullptr;
   }
-  if (nodes_.size() > 0 && nodes_[0]->GetType() == DATA) {
-    (void)nodes_.insert(nodes_.begin() + 1, node);
+  if (!nodes_.empty() && (nodes_[0]->GetType() == DATA)) {
+    InsertNodeToList(1, node);
   } else {
-    (void)nodes_.insert(nodes_.begin(), node);
+    InsertNodeToList(0, node);
   }
   return node;
 }
@@ -220,7 +353,7 @@ NodePtr ComputeGraph::AddNodeFront(const OpDescPtr &op) {
     GELOGE(GRAPH_FAILED, "The OpDesc ptr should be not null.");
     return nullptr;
   }
-  op->SetId(nodes_.size());
+  op->SetId(GetDirectNodesSize());
   NodePtr node_ptr = shared_ptr<Node>(new (std::nothrow) Node(op, shared_from_this()));
   GE_IF_BOOL_EXEC(node_ptr == nullptr, GELOGE(GRAPH_FAILED, "node_ptr is NULL!!!"); return nullptr);
   GE_IF_BOOL_EXEC(node_ptr->Init() != GRAPH_SUCCESS, GELOGE(GRAPH_FAILED, "node init fail."); return nullptr);
@@ -233,7 +366,7 @@ GE_FUNC_DEV_VISIBILITY GE_FUNC_HOST_VISIBILITY NodePtr ComputeGraph::AddNode(Nod
     return nullptr;
   }
   node->GetOpDesc()->SetId((int64_t)GetDirectNodesSize());
-  nodes_.push_back(node);
+  InsertNodeToList(nodes_.size(), node);
   return node;
 }
 
@@ -254,7 +387,7 @@ NodePtr ComputeGraph::AddInputNode(NodePtr node) {
     return nullptr;
   }
   input_nodes_.push_back(node);
-  if (std::find(nodes_.begin(), nodes_.end(), node) == nodes_.end()) {
+  if (node_indexes_.count(node.get()) == 0) {
     GE_CHK_BOOL_EXEC(AddNode(node) != nullptr, return nullptr, "add node failed");
   }
   return node;
@@ -280,7 +413,7 @@ NodePtr ComputeGraph::AddOutputNode(NodePtr node) {
     output_nodes_info_.emplace_back(std::make_pair(node, 0));
   }
 
-  if (std::find(nodes_.begin(), nodes_.end(), node) == nodes_.end()) {
+  if (node_indexes_.count(node.get()) == 0) {
     GE_CHK_BOOL_EXEC(AddNode(node) != nullptr, return nullptr, "add node failed");
   }
   return result;
@@ -299,10 +432,7 @@ graphStatus ComputeGraph::RemoveConstInput(const NodePtr &node) {
                              "Remove edge from const op failed.");
       if (out_anchor->GetOwnerNode()->GetOutDataNodes().size() == 0) {
         GELOGI("Remove const op %s.", out_anchor->GetOwnerNode()->GetName().c_str());
-        auto iter = find(nodes_.begin(), nodes_.end(), out_anchor->GetOwnerNode());
-        if (iter != nodes_.end()) {
-          (void)nodes_.erase(iter);
-        }
+        (void)EraseNodeFromList(out_anchor->GetOwnerNode());
       }
     }
   }
@@ -329,13 +459,97 @@ GE_FUNC_DEV_VISIBILITY GE_FUNC_HOST_VISIBILITY graphStatus ComputeGraph::RemoveN
     return GRAPH_FAILED;
   }
 
-  auto iter = find(nodes_.begin(), nodes_.end(), node);
-  if (iter != nodes_.end()) {
-    (void)nodes_.erase(iter);
+  if (EraseNodeFromList(node)) {
     return GRAPH_SUCCESS;
   }
   return GRAPH_FAILED;
 }
+void ComputeGraph::InsertNodeToList(size_t pos, const NodePtr &node) {
+  if (pos >= nodes_.size()) {
+    nodes_.push_back(node);
+  } else {
+    // Only done on a list without removed nodes, the nodes behind pos move one place back
+    (void)nodes_.insert(nodes_.begin() + pos, node);
+    for (size_t i = pos + 1; i < nodes_.size(); ++i) {
+      node_indexes_[nodes_[i].get()] = i;
+    }
+  }
+  node_indexes_[node.get()] = std::min(pos, nodes_.size() - 1);
+  node_names_[node->GetName()].push_back(node.get());
+}
+
+bool ComputeGraph::EraseNodeFromList(const NodePtr &node) {
+  if (node == nullptr) {
+    return false;
+  }
+  auto index_iter = node_indexes_.find(node.get());
+  size_t index = 0;
+  if (index_iter != node_indexes_.end()) {
+    index = index_iter->second;
+    node_indexes_.erase(index_iter);
+  } else {
+    // A node added twice is only indexed by its last position
+    auto iter = std::find(nodes_.begin(), nodes_.end(), node);
+    if (iter == nodes_.end()) {
+      return false;
+    }
+    index = static_cast<size_t>(iter - nodes_.begin());
+  }
+  nodes_[index] = nullptr;
+  ++removed_node_num_;
+  EraseNodeName(node->GetName(), node.get());
+  if (removed_node_num_ * 2 > nodes_.size()) {
+    CompactNodeList();
+  }
+  return true;
+}
+
+void ComputeGraph::CompactNodeList() {
+  if (removed_node_num_ == 0) {
+    return;
+  }
+  nodes_.erase(std::remove(nodes_.begin(), nodes_.end(), nullptr), nodes_.end());
+  removed_node_num_ = 0;
+  for (size_t i = 0; i < nodes_.size(); ++i) {
+    node_indexes_[nodes_[i].get()] = i;
+  }
+}
+
+void ComputeGraph::EraseNodeName(const std::string &name, const Node *node) {
+  auto name_iter = node_names_.find(name);
+  if (name_iter == node_names_.end()) {
+    return;
+  }
+  auto &name_nodes = name_iter->second;
+  auto node_iter = std::find(name_nodes.begin(), name_nodes.end(), node);
+  if (node_iter != name_nodes.end()) {
+    (void)name_nodes.erase(node_iter);
+  }
+  if (name_nodes.empty()) {
+    (void)node_names_.erase(name_iter);
+  }
+}
+
+graphStatus ComputeGraph::RenameNode(const NodePtr &node, const std::string &name) {
+  GE_CHECK_NOTNULL(node);
+  GE_CHECK_NOTNULL(node->GetOpDesc());
+  if (node_indexes_.count(node.get()) == 0) {
+    GELOGE(GRAPH_FAILED, "Node %s is not in graph %s.", node->GetName().c_str(), name_.c_str());
+    return GRAPH_FAILED;
+  }
+  EraseNodeName(node->GetName(), node.get());
+  node->GetOpDesc()->SetName(name);
+  node_names_[name].push_back(node.get());
+  return GRAPH_SUCCESS;
+}
+
+void ComputeGraph::ClearNodeList() {
+  nodes_.clear();
+  removed_node_num_ = 0;
+  node_indexes_.clear();
+  node_names_.clear();
+}
+
 // Used in sub_graph scenes
 graphStatus ComputeGraph::RemoveInputNode(const NodePtr &node) {
   if (node == nullptr) {
@@ -397,7 +611,7 @@ graphStatus ComputeGraph::RemoveSubGraph(const std::shared_ptr<ComputeGraph> &su
 }
 
 GE_FUNC_DEV_VISIBILITY GE_FUNC_HOST_VISIBILITY graphStatus ComputeGraph::InsertEventNodes() {
-  std::vector<NodePtr> node_vec = nodes_;
+  std::vector<NodePtr> node_vec = GetDirectNodeVec();
   for (const auto &node : GetAllNodes()) {
     if (node == nullptr || node->GetOpDesc() == nullptr) {
       GELOGW("node or OpDescPtr is nullptr.");
@@ -427,88 +641,68 @@ GE_FUNC_DEV_VISIBILITY GE_FUNC_HOST_VISIBILITY graphStatus ComputeGraph::InsertE
       (void)node_vec.insert(src_iter + 1, node);
     }
   }
-  nodes_.clear();
+  ClearNodeList();
   for (size_t i = 0; i < node_vec.size(); ++i) {
     NodePtr node = node_vec[i];
     if (node == nullptr || node->GetOpDesc() == nullptr) {
       GELOGW("node or OpDescPtr is nullptr.");
     } else {
       node->GetOpDesc()->SetId((int64_t)i);
-      nodes_.push_back(node);
+      InsertNodeToList(nodes_.size(), node);
     }
   }
   return GRAPH_SUCCESS;
 }
 
-graphStatus ComputeGraph::DFSTopologicalSorting(std::vector<NodePtr> &node_vec,
-                                                std::map<NodePtr, uint32_t> &map_in_edge_num,
-                                                std::vector<NodePtr> &stack) {
+graphStatus ComputeGraph::DFSTopologicalSorting(const CompactGraph &graph, std::vector<NodePtr> &node_vec,
+                                                std::vector<uint32_t> &in_edge_nums, std::vector<uint32_t> &stack) {
   GELOGI("Runing_Dfs_Sort");
   // Record the number of non data nodes but no input nodes
-  GE_CHK_BOOL_EXEC(SortNodes(stack, map_in_edge_num) == GRAPH_SUCCESS, return GRAPH_FAILED, "sort nodes failed");
+  GE_CHK_BOOL_EXEC(SortNodes(graph, stack, in_edge_nums) == GRAPH_SUCCESS, return GRAPH_FAILED, "sort nodes failed");
 
   // Only data nodes here
   while (!stack.empty()) {
-    NodePtr node = stack.back();
+    uint32_t id = stack.back();
     stack.pop_back();
+    const NodePtr &node = graph.GetNode(id);
     node_vec.push_back(node);
     GE_CHECK_NOTNULL(node->GetOpDesc());
     GELOGD("node_vec.push_back %s", node->GetOpDesc()->GetName().c_str());
-    for (const auto &anchor : node->GetAllOutDataAnchors()) {
-      GE_CHECK_NOTNULL(anchor);
-      for (const auto &peer_in_anchor : anchor->GetPeerInDataAnchors()) {
-        GE_CHECK_NOTNULL(peer_in_anchor);
-        auto iter = map_in_edge_num.find(peer_in_anchor->GetOwnerNode());
-        if (iter != map_in_edge_num.end() && --iter->second == 0) {
-          stack.push_back(peer_in_anchor->GetOwnerNode());
-        }
-      }
-      for (const auto &peer_in_anchor : anchor->GetPeerInControlAnchors()) {
-        GE_CHECK_NOTNULL(peer_in_anchor);
-        auto iter = map_in_edge_num.find(peer_in_anchor->GetOwnerNode());
-        if (iter != map_in_edge_num.end() && --iter->second == 0) {
-          stack.push_back(peer_in_anchor->GetOwnerNode());
-        }
+    for (uint32_t out_id : graph.GetOutAllNodes(id)) {
+      if ((in_edge_nums[out_id] != kNotSortedNode) && (--in_edge_nums[out_id] == 0)) {
+        stack.push_back(out_id);
       }
     }
-    GE_IF_BOOL_EXEC(
-        node->GetOutControlAnchor() != nullptr, for (AnchorPtr peer_in_anchor
-                                                     : node->GetOutControlAnchor()->GetPeerAnchors()) {
-          GE_CHECK_NOTNULL(peer_in_anchor);
-          auto iter = map_in_edge_num.find(peer_in_anchor->GetOwnerNode());
-          if (iter != map_in_edge_num.end() && --iter->second == 0) {
-            stack.push_back(peer_in_anchor->GetOwnerNode());
-          }
-        })
   }
 
   return GRAPH_SUCCESS;
 }
 
-graphStatus ComputeGraph::BFSTopologicalSorting(std::vector<NodePtr> &node_vec,
-                                                std::map<NodePtr, uint32_t> &map_in_edge_num,
-                                                std::deque<NodePtr> &stack) {
+graphStatus ComputeGraph::BFSTopologicalSorting(const CompactGraph &graph, std::vector<NodePtr> &node_vec,
+                                                std::vector<uint32_t> &in_edge_nums, std::deque<uint32_t> &stack) {
   GELOGI("Runing_Bfs_Sort");
-  std::vector<NodePtr> stack_input;
-  std::map<string, NodePtr> breadth_node_map;
+  std::vector<uint32_t> stack_input;
+  std::map<string, uint32_t> breadth_node_map;
   // Record the number of non data nodes but no input nodes
-  GE_CHK_BOOL_EXEC(SortNodes(stack_input, map_in_edge_num) == GRAPH_SUCCESS, return GRAPH_FAILED, "sort nodes failed");
+  GE_CHK_BOOL_EXEC(SortNodes(graph, stack_input, in_edge_nums) == GRAPH_SUCCESS, return GRAPH_FAILED,
+                   "sort nodes failed");
 
   // Only data nodes here
   while (!stack_input.empty() || !stack.empty()) {
-    NodePtr node = nullptr;
+    uint32_t id = 0;
     if (!stack.empty()) {
-      node = stack.back();
+      id = stack.back();
       stack.pop_back();
     } else {
-      node = stack_input.back();
+      id = stack_input.back();
       stack_input.pop_back();
     }
+    const NodePtr &node = graph.GetNode(id);
     node_vec.push_back(node);
     GE_CHECK_NOTNULL(node->GetOpDesc());
     GELOGD("node_vec.push_back %s", node->GetOpDesc()->GetName().c_str());
 
-    CollectBreadthOutNode(node, map_in_edge_num, breadth_node_map);
+    CollectBreadthOutNode(graph, id, in_edge_nums, breadth_node_map);
 
     for (const auto &name_node : breadth_node_map) {
       (void)stack.push_front(name_node.second);
@@ -519,36 +713,19 @@ graphStatus ComputeGraph::BFSTopologicalSorting(std::vector<NodePtr> &node_vec,
   return GRAPH_SUCCESS;
 }
 
-graphStatus ComputeGraph::CollectBreadthOutNode(const NodePtr &node, std::map<NodePtr, uint32_t> &map_in_edge_num,
-                                                std::map<string, NodePtr> &breadth_node_map) {
-    for (const auto &anchor : node->GetAllOutDataAnchors()) {
-      for (const auto &peer_in_anchor : anchor->GetPeerInDataAnchors()) {
-        auto iter = map_in_edge_num.find(peer_in_anchor->GetOwnerNode());
-        if (iter != map_in_edge_num.end() && --iter->second == 0) {
-          (void)breadth_node_map.emplace(peer_in_anchor->GetOwnerNode()->GetName(), peer_in_anchor->GetOwnerNode());
-        }
-      }
-      for (const auto &peer_in_anchor : anchor->GetPeerInControlAnchors()) {
-        auto iter = map_in_edge_num.find(peer_in_anchor->GetOwnerNode());
-        if (iter != map_in_edge_num.end() && --iter->second == 0) {
-          (void)breadth_node_map.emplace(peer_in_anchor->GetOwnerNode()->GetName(), peer_in_anchor->GetOwnerNode());
-        }
-      }
+graphStatus ComputeGraph::CollectBreadthOutNode(const CompactGraph &graph, uint32_t id,
+                                                std::vector<uint32_t> &in_edge_nums,
+                                                std::map<string, uint32_t> &breadth_node_map) {
+  for (uint32_t out_id : graph.GetOutAllNodes(id)) {
+    if ((in_edge_nums[out_id] != kNotSortedNode) && (--in_edge_nums[out_id] == 0)) {
+      (void)breadth_node_map.emplace(graph.GetNode(out_id)->GetName(), out_id);
     }
-    GE_IF_BOOL_EXEC(
-        node->GetOutControlAnchor() != nullptr, for (AnchorPtr peer_in_anchor
-                                                     : node->GetOutControlAnchor()->GetPeerAnchors()) {
-          auto iter = map_in_edge_num.find(peer_in_anchor->GetOwnerNode());
-          if (iter != map_in_edge_num.end() && --iter->second == 0) {
-            (void)breadth_node_map.emplace(peer_in_anchor->GetOwnerNode()->GetName(), peer_in_anchor->GetOwnerNode());
-          }
-        })
+  }
   return GRAPH_SUCCESS;
 }
 
 GE_FUNC_DEV_VISIBILITY GE_FUNC_HOST_VISIBILITY graphStatus ComputeGraph::TopologicalSorting() {
   std::vector<NodePtr> node_vec;
-  std::map<NodePtr, uint32_t> map_in_edge_num;
   bool use_BFS = false;
   string run_mode;
   const int base = 10;
@@ -560,27 +737,31 @@ GE_FUNC_DEV_VISIBILITY GE_FUNC_HOST_VISIBILITY graphStatus ComputeGraph::Topolog
     GELOGW("Get OPTION_GRAPH_RUN_MODE failed, use BFSTopologicalSorting by default.");
   }
 
+  // The node list is rebuilt below, so the snapshot is not cached. It also covers the nodes of the sub graphs
+  auto all_nodes = GetAllNodes();
+  CompactGraph graph(std::vector<NodePtr>(all_nodes.begin(), all_nodes.end()));
+  std::vector<uint32_t> in_edge_nums;
   if (use_BFS) {
-    std::deque<NodePtr> stack;
-    if (BFSTopologicalSorting(node_vec, map_in_edge_num, stack) != GRAPH_SUCCESS) {
+    std::deque<uint32_t> stack;
+    if (BFSTopologicalSorting(graph, node_vec, in_edge_nums, stack) != GRAPH_SUCCESS) {
       return GRAPH_FAILED;
     }
   } else {
-    std::vector<NodePtr> stack;
-    if (DFSTopologicalSorting(node_vec, map_in_edge_num, stack) != GRAPH_SUCCESS) {
+    std::vector<uint32_t> stack;
+    if (DFSTopologicalSorting(graph, node_vec, in_edge_nums, stack) != GRAPH_SUCCESS) {
       return GRAPH_FAILED;
     }
   }
 
   // If they are not equal, there is a closed loop
-  if (node_vec.size() != nodes_.size()) {
+  if (node_vec.size() != GetDirectNodesSize()) {
     std::set<Node *> itered_nodes_set;
     for (auto &node : node_vec) {
       itered_nodes_set.insert(node.get());
     }
-    GE_LOGE("Failed to do topo sorting total %zu, itered %zu, exist closed loop in graph.", nodes_.size(),
+    GE_LOGE("Failed to do topo sorting total %zu, itered %zu, exist closed loop in graph.", GetDirectNodesSize(),
             node_vec.size());
-    for (auto &node : nodes_) {
+    for (auto &node : GetDirectNodeVec()) {
       if (itered_nodes_set.count(node.get()) == 0) {
         GE_LOGE("The node %s does not itered when topological sorting", node->GetName().c_str());
       }
@@ -588,17 +769,19 @@ GE_FUNC_DEV_VISIBILITY GE_FUNC_HOST_VISIBILITY graphStatus ComputeGraph::Topolog
     return GRAPH_FAILED;
   }
 
-  nodes_.clear();
+  ClearNodeList();
   for (size_t i = 0; i < node_vec.size(); i++) {
     NodePtr node = node_vec[i];   // [node: should not be null]
     node->GetOpDesc()->SetId(i);  // [node->GetOpDesc(): should not be null]
-    nodes_.push_back(node);
+    InsertNodeToList(nodes_.size(), node);
   }
   is_valid_flag_ = true;
   return GRAPH_SUCCESS;
 }
 
-graphStatus ComputeGraph::SortNodes(std::vector<NodePtr> &stack, std::map<NodePtr, uint32_t> &map_in_edge_num) {
+
+graphStatus ComputeGraph::SortNodes(const CompactGraph &graph, std::vector<uint32_t> &stack,
+                                    std::vector<uint32_t> &in_edge_nums) {
   // Record the number of non data nodes but no input nodes
   uint32_t spec_node_size = 0;
   bool verify_isolated = false;
@@ -610,10 +793,22 @@ graphStatus ComputeGraph::SortNodes(std::vector<NodePtr> &stack, std::map<NodePt
       verify_isolated = true;
     }
   }
-  for (const auto &node : GetAllNodes()) {
+  // Break flow control data loop, the data edges from NextIteration are not waited for
+  std::vector<bool> is_next_iteration(graph.GetNodesSize(), false);
+  for (uint32_t id = 0; id < graph.GetNodesSize(); ++id) {
+    std::string type = graph.GetNode(id)->GetType();
+    is_next_iteration[id] = (type == NEXTITERATION) || (type == REFNEXTITERATION);
+  }
+  in_edge_nums.assign(graph.GetNodesSize(), kNotSortedNode);
+  for (uint32_t id = 0; id < graph.GetNodesSize(); ++id) {
+    const NodePtr &node = graph.GetNode(id);
     GE_IF_BOOL_EXEC(node->GetOpDesc() == nullptr, continue);
-    map_in_edge_num[node] = static_cast<uint32_t>(GetInEdgeSize(node));
-    if (map_in_edge_num[node] == 0) {
+    uint32_t in_edge_num = static_cast<uint32_t>(graph.GetInAllNodes(id).size()) + graph.GetOutsideInNum(id);
+    for (uint32_t in_id : graph.GetInDataNodes(id)) {
+      GE_IF_BOOL_EXEC(is_next_iteration[in_id], in_edge_num--);
+    }
+    in_edge_nums[id] = in_edge_num;
+    if (in_edge_nums[id] == 0) {
       if ((node->GetOpDesc()->GetType() != kDataType) && (node->GetOpDesc()->GetType() != kAippDataType) &&
           (node->GetOpDesc()->GetType() != kInputType) && (node->GetOpDesc()->GetType() != kAnnDataType)) {
         // At present, can only judge the isolated point without input and output.
@@ -622,12 +817,12 @@ graphStatus ComputeGraph::SortNodes(std::vector<NodePtr> &stack, std::map<NodePt
           GELOGE(GRAPH_FAILED, "May has isolated nodes in graph, node name: %s.", node->GetName().c_str());
           return GRAPH_FAILED;
         }
-        (void)stack.insert(stack.begin(), node);
+        (void)stack.insert(stack.begin(), id);
         spec_node_size++;
         continue;
       }
       // Need to insert the data nodes in reverse order
-      (void)stack.insert(stack.begin() + spec_node_size, node);
+      (void)stack.insert(stack.begin() + spec_node_size, id);
     }
   }
 
@@ -636,12 +831,11 @@ graphStatus ComputeGraph::SortNodes(std::vector<NodePtr> &stack, std::map<NodePt
   /// 2. Compare two indices, if not match, swap the positions of two inputs
   /// *: Remind: stack is reverse-order
   for (size_t i = 0; i < stack.size(); ++i) {
-    // [stack: should not be null]
     for (size_t j = i + 1; j < stack.size(); ++j) {
       // If not found in 'inputs_order_', skip it
-      auto it_i = std::find(inputs_order_.begin(), inputs_order_.end(), stack[i]->GetName());
+      auto it_i = std::find(inputs_order_.begin(), inputs_order_.end(), graph.GetNode(stack[i])->GetName());
       GE_IF_BOOL_EXEC(it_i == inputs_order_.end(), continue);
-      auto it_j = std::find(inputs_order_.begin(), inputs_order_.end(), stack[j]->GetName());
+      auto it_j = std::find(inputs_order_.begin(), inputs_order_.end(), graph.GetNode(stack[j])->GetName());
       GE_IF_BOOL_EXEC(it_j == inputs_order_.end(), continue);
 
       // Compare index, swap them if it should be
@@ -653,33 +847,6 @@ graphStatus ComputeGraph::SortNodes(std::vector<NodePtr> &stack, std::map<NodePt
 
   return GRAPH_SUCCESS;
 }
-size_t ComputeGraph::GetInEdgeSize(const NodePtr &node) {
-  size_t in_edge_size = 0;
-  if (node == nullptr) {
-    return in_edge_size;
-  }
-  for (const auto &anchor : node->GetAllInDataAnchors()) {
-    in_edge_size = in_edge_size + anchor->GetPeerAnchors().size();
-    // Break flow control data loop.
-    OutDataAnchorPtr out_anchor = anchor->GetPeerOutAnchor();
-    if ((out_anchor != nullptr) && (out_anchor->GetOwnerNode() != nullptr)) {
-      NodePtr out_node = out_anchor->GetOwnerNode();
-      if (out_node == nullptr) {
-        GELOGW("out node is nullptr");
-        continue;
-      }
-      if ((out_node->GetType() == NEXTITERATION) || (out_node->GetType() == REFNEXTITERATION)) {
-        GE_IF_BOOL_EXEC(in_edge_size == 0, GELOGE(GRAPH_FAILED, "If [in_edge_size = 0], the result will be reversed");
-                        return in_edge_size);
-        in_edge_size -= 1;
-      }
-    }
-  }
-  if (node->GetInControlAnchor() != nullptr) {
-    in_edge_size = in_edge_size + node->GetInControlAnchor()->GetPeerAnchors().size();
-  }
-  return in_edge_size;
-}
 size_t ComputeGraph::GetOutEdgeSize(const NodePtr &node) {
   size_t out_edge_size = 0;
   if (node == nullptr) {
@@ -630,6 +630,8 @@ const std::string ATTR_MODEL_VAR_SIZE = "variable_size";
 
 const std::string ATTR_MODEL_TASK_INDEX_OP_NAME = "task_index_op_name";
 
+const std::string ATTR_MODEL_ESTIMATED_MAKESPAN = "estimated_makespan";
+
 // Public attribute
 const std::string ATTR_NAME_IMPLY_TYPE = "imply_type";
 
@@ -394,11 +394,7 @@ bool GeAttrValueImp::SetValue(proto::AttrDef &proto_attr_val, const GeTensorDesc
   if (!AttrUtilsHelper::SetValueCheckType(proto_attr_val, proto::AttrDef::kTd)) {
     return false;
   }
-  auto proto_msg = value.tensor_descriptor_.GetProtoMsg();
-  if (proto_msg == nullptr) {
-    return false;
-  }
-  *proto_attr_val.mutable_td() = *proto_msg;
+  value.ToProto(*proto_attr_val.mutable_td());
   return true;
 }
 
@@ -411,12 +407,7 @@ bool GeAttrValueImp::SetValue(proto::AttrDef &proto_attr_val, const vector<GeTen
   GE_CHECK_NOTNULL_EXEC(list, return false);
   list->clear_td();
   for (const auto &item : value) {
-    auto proto_msg = item.tensor_descriptor_.GetProtoMsg();
-    if (proto_msg == nullptr) {
-      proto_attr_val.clear_list();
-      return false;
-    }
-    *list->add_td() = *proto_msg;
+    item.ToProto(*list->add_td());
   }
   return true;
 }
@@ -433,12 +424,7 @@ bool GeAttrValueImp::SetValue(proto::AttrDef &proto_attr_val, const GeTensor &va
   if (!AttrUtilsHelper::SetValueCheckType(proto_attr_val, proto::AttrDef::kT)) {
     return false;
   }
-  auto proto_msg = val.tensor_def_.GetProtoMsg();
-  if (proto_msg == nullptr) {
-    GELOGE(FAILED, "Proto msg is nullptr");
-    return false;
-  }
-  *proto_attr_val.mutable_t() = *proto_msg;
+  val.ToProto(*proto_attr_val.mutable_t());
   return true;
 }
 
@@ -462,13 +448,7 @@ bool GeAttrValueImp::SetValue(proto::AttrDef &proto_attr_val, const vector<Const
       proto_attr_val.clear_list();
       return false;
     }
-    auto proto_msg = item->tensor_def_.GetProtoMsg();
-    if (proto_msg == nullptr) {
-      GELOGE(FAILED, "Proto msg is nullptr");
-      proto_attr_val.clear_list();
-      return false;
-    }
-    *list->add_t() = *proto_msg;
+    item->ToProto(*list->add_t());
   }
   return true;
 }
@@ -482,13 +462,7 @@ bool GeAttrValueImp::SetValue(proto::AttrDef &proto_attr_val, const vector<GeTen
   GE_CHECK_NOTNULL_EXEC(list, return false);
   list->clear_t();
   for (const auto &item : value) {
-    auto proto_msg = item.tensor_def_.GetProtoMsg();
-    if (proto_msg == nullptr) {
-      GELOGE(FAILED, "Proto msg is nullptr");
-      proto_attr_val.clear_list();
-      return false;
-    }
-    *list->add_t() = *proto_msg;
+    item.ToProto(*list->add_t());
   }
   return true;
 }
@@ -662,11 +636,7 @@ bool GeAttrValueImp::GetValue(const proto::AttrDef &proto_attr_val, const ProtoM
   if (!AttrUtilsHelper::GetValueCheckType(proto_attr_val, proto::AttrDef::kTd)) {
     return false;
   }
-  auto proto_msg = value.tensor_descriptor_.GetProtoMsg();
-  if (proto_msg == nullptr) {
-    return false;
-  }
-  *proto_msg = proto_attr_val.td();
+  value.FromProto(proto_attr_val.td());
   return true;
 }
 
@@ -679,11 +649,7 @@ bool GeAttrValueImp::GetValue(const proto::AttrDef &proto_attr_val, const ProtoM
   auto &list = proto_attr_val.list();
   for (const auto &item : list.td()) {
     value.emplace_back(GeTensorDesc());
-    auto proto_msg = value.back().tensor_descriptor_.GetProtoMsg();
-    if (proto_msg == nullptr) {
-      return false;
-    }
-    *proto_msg = item;
+    value.back().FromProto(item);
   }
   return true;
 }
@@ -873,7 +839,9 @@ GE_FUNC_HOST_VISIBILITY bool GeAttrValueImp::SetZeroCopyBytes(proto::AttrDef &pr
   }
   auto proto_msg = buffer.data_.GetProtoMsg();
   if (proto_msg == nullptr) {
-    return false;
+    // Payload of a native tensor, it is shared with the tensor and can not be moved
+    proto_attr_val.set_bt(buffer.GetData(), buffer.GetSize());
+    return true;
   }
   proto_attr_val.set_bt(std::move(*proto_msg->mutable_bt()));
   return true;
@@ -900,7 +868,8 @@ bool GeAttrValueImp::SetZeroCopyListBytes(proto::AttrDef &proto_attr_val, const
   for (auto &item : list_buffer) {
     auto proto_msg = item.data_.GetProtoMsg();
     if (proto_msg == nullptr) {
-      return false;
+      list->add_bt(item.GetData(), item.GetSize());
+      continue;
     }
     list->add_bt(std::move(*proto_msg->mutable_bt()));
   }
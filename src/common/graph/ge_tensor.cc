@@ -20,6 +20,7 @@
 #include <cstring>
 #include <iostream>
 #include <map>
+#include <new>
 
 #include "debug/ge_attr_define.h"
 #include "debug/ge_util.h"
@@ -69,17 +70,10 @@ static const std::map<DataType, int> kDataTypeSelfDefinedMap = {
     {DT_QINT8, 18}, {DT_QINT16, 19},        {DT_QINT32, 20},         {DT_QUINT8, 21},    {DT_QUINT16, 22},
 };
 
-GeShape::GeShape() { shape_def_.InitDefault(); }
+GeShape::GeShape() {}
 
 // Default
-GeShape::GeShape(std::vector<int64_t> s) : GeShape() {
-  auto proto_msg = shape_def_.GetProtoMsg();
-  if (proto_msg != nullptr) {
-    for (auto i : s) {
-      proto_msg->add_dim(i);
-    }
-  }
-}
+GeShape::GeShape(std::vector<int64_t> s) : dims_(std::move(s)) {}
 
 size_t GeShape::GetDimNum() const {
   auto proto_msg = shape_def_.GetProtoMsg();
@@ -90,7 +84,7 @@ size_t GeShape::GetDimNum() const {
       return 0;
     }
   }
-  return 0;
+  return dims_.size();
 }
 
 int64_t GeShape::GetDim(size_t idx) const {
@@ -99,8 +93,9 @@ int64_t GeShape::GetDim(size_t idx) const {
     if (proto_msg->dim_size() > static_cast<int>(idx)) {
       return proto_msg->dim(static_cast<int>(idx));
     }
+    return 0;
   }
-  return 0;
+  return (idx < dims_.size()) ? dims_[idx] : 0;
 }
 
 graphStatus GeShape::SetDim(size_t idx, int64_t value) {
@@ -117,30 +112,44 @@ graphStatus GeShape::SetDim(size_t idx, int64_t value) {
       return GRAPH_FAILED;
     }
     proto_msg->set_dim(static_cast<int>(idx), value);
+    return GRAPH_SUCCESS;
   }
+  if (dims_.empty()) {
+    GELOGE(GRAPH_FAILED, "shape is empty");
+    return GRAPH_FAILED;
+  }
+  if (idx >= dims_.size()) {
+    GELOGE(GRAPH_FAILED, "idx is out of range");
+    return GRAPH_FAILED;
+  }
+  dims_[idx] = value;
   return GRAPH_SUCCESS;
 }
 
 std::vector<int64_t> GeShape::GetDims() const {
-  vector<int64_t> dims;
   auto proto_msg = shape_def_.GetProtoMsg();
   if (proto_msg != nullptr) {
-    for (auto i : proto_msg->dim()) {
-      dims.push_back(i);
-    }
+    return std::vector<int64_t>(proto_msg->dim().begin(), proto_msg->dim().end());
   }
-  return dims;
+  return dims_;
 }
 
-std::string GeShape::ToString() const {
+void GeShape::SetDims(const std::vector<int64_t> &dims) {
   auto proto_msg = shape_def_.GetProtoMsg();
-  if (proto_msg == nullptr) {
-    return "";
+  if (proto_msg != nullptr) {
+    proto_msg->clear_dim();
+    for (auto dim : dims) {
+      proto_msg->add_dim(dim);
+    }
+    return;
   }
+  dims_ = dims;
+}
 
+std::string GeShape::ToString() const {
   std::stringstream ss;
   bool first = true;
-  for (auto i : proto_msg->dim()) {
+  for (auto i : GetDims()) {
     if (first) {
       first = false;
     } else {
@@ -161,6 +170,13 @@ int64_t GeShape::GetShapeSize() const {
     for (auto i : proto_msg->dim()) {
       res *= i;
     }
+    return res;
+  }
+  if (dims_.empty()) {
+    return 0;
+  }
+  for (auto i : dims_) {
+    res *= i;
   }
   return res;
 }
@@ -184,48 +200,66 @@ const string TENSOR_UTILS_ORIGIN_SHAPE = "origin_shape";
 const string TENSOR_UTILS_ORIGIN_FORMAT = "origin_format";
 const string TENSOR_UTILS_ORIGIN_DATA_TYPE = "origin_data_type";
 
+static const std::map<uint32_t, string> device_to_str_map{
+    {0, "NPU"}, {1, "CPU"},
+};
+static const std::map<string, uint32_t> str_to_device_map{
+    {"NPU", 0}, {"CPU", 1},
+};
+
+static string DeviceTypeToStr(DeviceType type) {
+  auto it = device_to_str_map.find(type);
+  return (it != device_to_str_map.end()) ? it->second : "";
+}
+
+static DeviceType StrToDeviceType(const string &type_str) {
+  auto it = str_to_device_map.find(type_str);
+  return DeviceType((it != str_to_device_map.end()) ? it->second : 0);
+}
+
 GeShape::GeShape(const ProtoMsgOwner &proto_owner, proto::ShapeDef *proto_msg) : shape_def_(proto_owner, proto_msg) {}
 
-GeShape::GeShape(const GeShape &other) : GeShape() { shape_def_.CopyValueFrom(other.shape_def_); }
+// Copies never reference the proto of other
+GeShape::GeShape(const GeShape &other) : dims_(other.GetDims()) {}
 
-GeShape::GeShape(GeShape &&other) : GeShape() { shape_def_.MoveValueFrom(std::move(other.shape_def_)); }
+GeShape::GeShape(GeShape &&other) {
+  if (other.shape_def_.GetProtoMsg() != nullptr) {
+    dims_ = other.GetDims();
+  } else {
+    dims_ = std::move(other.dims_);
+  }
+}
 
 GeShape &GeShape::operator=(const GeShape &other) {
   if (&other != this) {
-    shape_def_.CopyValueFrom(other.shape_def_);
+    if (other.shape_def_.GetProtoMsg() == nullptr) {
+      SetDims(other.dims_);
+    } else {
+      SetDims(other.GetDims());
+    }
   }
   return *this;
 }
 
 GeShape &GeShape::operator=(GeShape &&other) {
-  if (&other != this) {
-    shape_def_.CopyValueFrom(std::move(other.shape_def_));
-  }
-  return *this;
+  // Keeps other intact like the copy assignment, callers rely on it
+  return *this = static_cast<const GeShape &>(other);
 }
 
-GeTensorDesc::GeTensorDesc() {
-  tensor_descriptor_.InitDefault();
-  SetDataType(DT_FLOAT);
-  Init();
-}
+GeTensorDesc::GeTensorDesc() {}
 
 // Default
 GeTensorDesc::GeTensorDesc(GeShape shape, Format format, DataType dt) : GeTensorDesc() {
-  SetFormat(format);
-  SetDataType(dt);
-  ShapeReference() = std::move(shape);
+  fields_.format = format;
+  fields_.data_type = dt;
+  __shape_ = std::move(shape);
 }
 
 // Default
-GeTensorDesc::GeTensorDesc(const GeTensorDesc &desc) : GeTensorDesc() {
-  tensor_descriptor_.CopyValueFrom(desc.tensor_descriptor_);
-}
+GeTensorDesc::GeTensorDesc(const GeTensorDesc &desc) : GeTensorDesc() { CopyFrom(desc); }
 
 // Default
-GeTensorDesc::GeTensorDesc(GeTensorDesc &&desc) : GeTensorDesc() {
-  tensor_descriptor_.MoveValueFrom(std::move(desc.tensor_descriptor_));
-}
+GeTensorDesc::GeTensorDesc(GeTensorDesc &&desc) : GeTensorDesc() { MoveFrom(std::move(desc)); }
 
 GeTensorDesc::GeTensorDesc(const ProtoMsgOwner &proto_owner, proto::TensorDescriptor *proto_msg)
     : tensor_descriptor_(proto_owner, proto_msg) {
@@ -282,45 +316,206 @@ GeTensorDesc::GeTensorDesc(const ProtoMsgOwner &proto_owner, proto::TensorDescri
   }
 }
 
-bool GeTensorDesc::GeTensorDescAttrsAreEqual(const GeTensorDesc &r_ge_tensor_desc) const {
-  const auto &tensor_descriptor = this->tensor_descriptor_.GetProtoMsg();
-  const auto &r_tensor_descriptor = r_ge_tensor_desc.tensor_descriptor_.GetProtoMsg();
-  if ((tensor_descriptor != nullptr) && (r_tensor_descriptor != nullptr)) {
-    // Message TensorDescriptor in ge_ir.proto
-    return (IsEqual(tensor_descriptor->name(), r_tensor_descriptor->name(), "TensorDescriptor.name()") &&
-            IsEqual(tensor_descriptor->dtype(), r_tensor_descriptor->dtype(), "TensorDescriptor.dtype()") &&
-            // Message ShapeDef in ge_ir.proto
-            IsEqual(ToString(tensor_descriptor->shape().dim()), ToString(r_tensor_descriptor->shape().dim()),
-                    "TensorDescriptor.shape().dim()") &&
-            IsEqual(tensor_descriptor->layout(), r_tensor_descriptor->layout(), "TensorDescriptor.layout()") &&
-            IsEqual(tensor_descriptor->has_out_attr(), r_tensor_descriptor->has_out_attr(),
-                    "TensorDescriptor.has_out_attr()") &&
-            IsEqual(tensor_descriptor->size(), r_tensor_descriptor->size(), "TensorDescriptor.size()") &&
-            IsEqual(tensor_descriptor->weight_size(), r_tensor_descriptor->weight_size(),
-                    "TensorDescriptor.weight_size()") &&
-            IsEqual(tensor_descriptor->reuse_input(), r_tensor_descriptor->reuse_input(),
-                    "TensorDescriptor.reuse_input()") &&
-            IsEqual(tensor_descriptor->output_tensor(), r_tensor_descriptor->output_tensor(),
-                    "TensorDescriptor.output_tensor()") &&
-            IsEqual(tensor_descriptor->device_type(), r_tensor_descriptor->device_type(),
-                    "TensorDescriptor.device_type()") &&
-            IsEqual(tensor_descriptor->input_tensor(), r_tensor_descriptor->input_tensor(),
-                    "TensorDescriptor.input_tensor()") &&
-            IsEqual(tensor_descriptor->real_dim_cnt(), r_tensor_descriptor->real_dim_cnt(),
-                    "TensorDescriptor.real_dim_cnt()") &&
-            IsEqual(tensor_descriptor->reuse_input_index(), r_tensor_descriptor->reuse_input_index(),
-                    "TensorDescriptor.reuse_input_index()") &&
-            IsEqual(tensor_descriptor->data_offset(), r_tensor_descriptor->data_offset(),
-                    "TensorDescriptor.data_offset()") &&
-            IsEqual(tensor_descriptor->cmps_size(), r_tensor_descriptor->cmps_size(), "TensorDescriptor.cmps_size()") &&
-            IsEqual(tensor_descriptor->cmps_tab(), r_tensor_descriptor->cmps_tab(), "TensorDescriptor.cmps_tab()") &&
-            IsEqual(tensor_descriptor->cmps_tab_offset(), r_tensor_descriptor->cmps_tab_offset(),
-                    "TensorDescriptor.cmps_tab_offset()"));
+void GeTensorDesc::ToProto(proto::TensorDescriptor &proto_msg) const {
+  auto tensor_descriptor_msg = tensor_descriptor_.GetProtoMsg();
+  if (tensor_descriptor_msg != nullptr) {
+    if (tensor_descriptor_msg != &proto_msg) {
+      proto_msg = *tensor_descriptor_msg;
+    }
+    return;
+  }
+  proto_msg.Clear();
+  if (attr_map_.GetProtoMsg() != nullptr) {
+    *proto_msg.mutable_attr() = *attr_map_.GetProtoMsg();
+  }
+  auto &attr_map = *proto_msg.mutable_attr();
+  auto it = kDataTypeMap.find(fields_.data_type);
+  if (it != kDataTypeMap.end()) {
+    proto_msg.set_dtype(it->second);
+  } else {
+    auto it2 = kDataTypeSelfDefinedMap.find(fields_.data_type);
+    if (it2 != kDataTypeSelfDefinedMap.end()) {
+      attr_map[kKeyDataTypeSelfDefined].set_i(it2->second);
+    }
+  }
+  for (auto dim : __shape_.dims_) {
+    proto_msg.mutable_shape()->add_dim(dim);
+  }
+  proto_msg.set_layout(TypeUtils::FormatToSerialString(fields_.format));
+  attr_map[TENSOR_UTILS_ORIGIN_FORMAT].set_s(
+      fields_.origin_format == FORMAT_RESERVED ? "RESERVED" : TypeUtils::FormatToSerialString(fields_.origin_format));
+  if (!fields_.origin_shape.empty()) {
+    auto origin_shape = attr_map[TENSOR_UTILS_ORIGIN_SHAPE].mutable_list();
+    origin_shape->set_val_type(proto::AttrDef_ListValue_ListValueType_VT_LIST_INT);
+    for (auto dim : fields_.origin_shape) {
+      origin_shape->add_i(dim);
+    }
+  }
+  if (fields_.origin_data_type != DT_UNDEFINED) {
+    attr_map[TENSOR_UTILS_ORIGIN_DATA_TYPE].set_s(TypeUtils::DataTypeToSerialString(fields_.origin_data_type));
+  }
+  proto_msg.set_has_out_attr(true);
+  proto_msg.set_size(fields_.size);
+  proto_msg.set_weight_size(fields_.weight_size);
+  proto_msg.set_reuse_input(fields_.reuse_input);
+  proto_msg.set_output_tensor(fields_.output_tensor);
+  proto_msg.set_device_type(DeviceTypeToStr(fields_.device_type));
+  proto_msg.set_input_tensor(fields_.input_tensor);
+  proto_msg.set_real_dim_cnt(fields_.real_dim_cnt);
+  proto_msg.set_reuse_input_index(fields_.reuse_input_index);
+  proto_msg.set_data_offset(fields_.data_offset);
+  proto_msg.set_cmps_size(fields_.cmps_size);
+  proto_msg.set_cmps_tab(fields_.cmps_tab);
+  proto_msg.set_cmps_tab_offset(fields_.cmps_tab_offset);
+}
+
+void GeTensorDesc::FromProto(const proto::TensorDescriptor &proto_msg) {
+  if (tensor_descriptor_.GetProtoMsg() != nullptr) {
+    if (tensor_descriptor_.GetProtoMsg() != &proto_msg) {
+      *tensor_descriptor_.GetProtoMsg() = proto_msg;
+    }
+    return;
+  }
+  // Parse through a view so that descs written before has_out_attr existed are migrated the same way
+  auto proto_owner = ComGraphMakeShared<proto::TensorDescriptor>(proto_msg);
+  if (proto_owner == nullptr) {
+    GELOGE(GRAPH_FAILED, "proto::TensorDescriptor make shared failed");
+    return;
+  }
+  GeTensorDesc view(proto_owner, proto_owner.get());
+  fields_ = Fields();
+  fields_.format = view.GetFormat();
+  fields_.origin_format = view.GetOriginFormat();
+  fields_.data_type = view.GetDataType();
+  fields_.origin_data_type = view.GetOriginDataType();
+  fields_.origin_shape = view.GetOriginShape().GetDims();
+  fields_.size = proto_owner->size();
+  fields_.weight_size = proto_owner->weight_size();
+  fields_.reuse_input = proto_owner->reuse_input();
+  fields_.output_tensor = proto_owner->output_tensor();
+  fields_.device_type = StrToDeviceType(proto_owner->device_type());
+  fields_.input_tensor = proto_owner->input_tensor();
+  fields_.real_dim_cnt = proto_owner->real_dim_cnt();
+  fields_.reuse_input_index = proto_owner->reuse_input_index();
+  fields_.data_offset = proto_owner->data_offset();
+  fields_.cmps_size = proto_owner->cmps_size();
+  fields_.cmps_tab = proto_owner->cmps_tab();
+  fields_.cmps_tab_offset = proto_owner->cmps_tab_offset();
+  __shape_.dims_.assign(proto_owner->shape().dim().begin(), proto_owner->shape().dim().end());
+
+  // The typed fields above own these keys
+  auto &attr_map = *proto_owner->mutable_attr();
+  (void)attr_map.erase(kKeyDataTypeSelfDefined);
+  (void)attr_map.erase(TENSOR_UTILS_ORIGIN_FORMAT);
+  (void)attr_map.erase(TENSOR_UTILS_ORIGIN_SHAPE);
+  (void)attr_map.erase(TENSOR_UTILS_ORIGIN_DATA_TYPE);
+  if (attr_map.empty()) {
+    attr_map_ = ProtoAttrMapHelper();
   } else {
-    return ((tensor_descriptor == nullptr) && (r_tensor_descriptor == nullptr));
+    attr_map_ = ProtoAttrMapHelper(proto_owner, &attr_map);
   }
 }
 
+void GeTensorDesc::CopyFrom(const GeTensorDesc &desc) {
+  auto desc_msg = desc.tensor_descriptor_.GetProtoMsg();
+  if (tensor_descriptor_.GetProtoMsg() != nullptr) {
+    // Write through to the proto this desc is a view of
+    desc.ToProto(*tensor_descriptor_.GetProtoMsg());
+    return;
+  }
+  if (desc_msg != nullptr) {
+    FromProto(*desc_msg);
+    return;
+  }
+  fields_ = desc.fields_;
+  __shape_.dims_ = desc.__shape_.dims_;
+  auto attr_msg = desc.attr_map_.GetProtoMsg();
+  if (attr_msg == nullptr || attr_msg->empty()) {
+    attr_map_ = ProtoAttrMapHelper();
+  } else {
+    attr_map_.InitDefault();
+    if (attr_map_.GetProtoMsg() != nullptr) {
+      *attr_map_.GetProtoMsg() = *attr_msg;
+    }
+  }
+}
+
+void GeTensorDesc::MoveFrom(GeTensorDesc &&desc) {
+  if (tensor_descriptor_.GetProtoMsg() != nullptr || desc.tensor_descriptor_.GetProtoMsg() != nullptr) {
+    CopyFrom(desc);
+    return;
+  }
+  fields_ = std::move(desc.fields_);
+  __shape_.dims_ = std::move(desc.__shape_.dims_);
+  // A native attr map is owned by its desc only, so it can be handed over
+  attr_map_ = desc.attr_map_;
+  desc.attr_map_ = ProtoAttrMapHelper();
+}
+
+bool GeTensorDesc::GeTensorDescAttrsAreEqual(const GeTensorDesc &r_ge_tensor_desc) const {
+  proto::TensorDescriptor l_proto;
+  proto::TensorDescriptor r_proto;
+  const proto::TensorDescriptor *tensor_descriptor = tensor_descriptor_.GetProtoMsg();
+  const proto::TensorDescriptor *r_tensor_descriptor = r_ge_tensor_desc.tensor_descriptor_.GetProtoMsg();
+  if (tensor_descriptor == nullptr && r_tensor_descriptor == nullptr) {
+    const Fields &l = fields_;
+    const Fields &r = r_ge_tensor_desc.fields_;
+    return (IsEqual(l.data_type, r.data_type, "GeTensorDesc.data_type") &&
+            IsEqual(__shape_.dims_, r_ge_tensor_desc.__shape_.dims_, "GeTensorDesc.shape") &&
+            IsEqual(l.format, r.format, "GeTensorDesc.format") && IsEqual(l.size, r.size, "GeTensorDesc.size") &&
+            IsEqual(l.weight_size, r.weight_size, "GeTensorDesc.weight_size") &&
+            IsEqual(l.reuse_input, r.reuse_input, "GeTensorDesc.reuse_input") &&
+            IsEqual(l.output_tensor, r.output_tensor, "GeTensorDesc.output_tensor") &&
+            IsEqual(l.device_type, r.device_type, "GeTensorDesc.device_type") &&
+            IsEqual(l.input_tensor, r.input_tensor, "GeTensorDesc.input_tensor") &&
+            IsEqual(l.real_dim_cnt, r.real_dim_cnt, "GeTensorDesc.real_dim_cnt") &&
+            IsEqual(l.reuse_input_index, r.reuse_input_index, "GeTensorDesc.reuse_input_index") &&
+            IsEqual(l.data_offset, r.data_offset, "GeTensorDesc.data_offset") &&
+            IsEqual(l.cmps_size, r.cmps_size, "GeTensorDesc.cmps_size") &&
+            IsEqual(l.cmps_tab, r.cmps_tab, "GeTensorDesc.cmps_tab") &&
+            IsEqual(l.cmps_tab_offset, r.cmps_tab_offset, "GeTensorDesc.cmps_tab_offset"));
+  }
+  // Mixed or view descs compare through their serialized form
+  if (tensor_descriptor == nullptr) {
+    ToProto(l_proto);
+    tensor_descriptor = &l_proto;
+  }
+  if (r_tensor_descriptor == nullptr) {
+    r_ge_tensor_desc.ToProto(r_proto);
+    r_tensor_descriptor = &r_proto;
+  }
+  // Message TensorDescriptor in ge_ir.proto
+  return (IsEqual(tensor_descriptor->name(), r_tensor_descriptor->name(), "TensorDescriptor.name()") &&
+          IsEqual(tensor_descriptor->dtype(), r_tensor_descriptor->dtype(), "TensorDescriptor.dtype()") &&
+          // Message ShapeDef in ge_ir.proto
+          IsEqual(ToString(tensor_descriptor->shape().dim()), ToString(r_tensor_descriptor->shape().dim()),
+                  "TensorDescriptor.shape().dim()") &&
+          IsEqual(tensor_descriptor->layout(), r_tensor_descriptor->layout(), "TensorDescriptor.layout()") &&
+          IsEqual(tensor_descriptor->has_out_attr(), r_tensor_descriptor->has_out_attr(),
+                  "TensorDescriptor.has_out_attr()") &&
+          IsEqual(tensor_descriptor->size(), r_tensor_descriptor->size(), "TensorDescriptor.size()") &&
+          IsEqual(tensor_descriptor->weight_size(), r_tensor_descriptor->weight_size(),
+                  "TensorDescriptor.weight_size()") &&
+          IsEqual(tensor_descriptor->reuse_input(), r_tensor_descriptor->reuse_input(),
+                  "TensorDescriptor.reuse_input()") &&
+          IsEqual(tensor_descriptor->output_tensor(), r_tensor_descriptor->output_tensor(),
+                  "TensorDescriptor.output_tensor()") &&
+          IsEqual(tensor_descriptor->device_type(), r_tensor_descriptor->device_type(),
+                  "TensorDescriptor.device_type()") &&
+          IsEqual(tensor_descriptor->input_tensor(), r_tensor_descriptor->input_tensor(),
+                  "TensorDescriptor.input_tensor()") &&
+          IsEqual(tensor_descriptor->real_dim_cnt(), r_tensor_descriptor->real_dim_cnt(),
+                  "TensorDescriptor.real_dim_cnt()") &&
+          IsEqual(tensor_descriptor->reuse_input_index(), r_tensor_descriptor->reuse_input_index(),
+                  "TensorDescriptor.reuse_input_index()") &&
+          IsEqual(tensor_descriptor->data_offset(), r_tensor_descriptor->data_offset(),
+                  "TensorDescriptor.data_offset()") &&
+          IsEqual(tensor_descriptor->cmps_size(), r_tensor_descriptor->cmps_size(), "TensorDescriptor.cmps_size()") &&
+          IsEqual(tensor_descriptor->cmps_tab(), r_tensor_descriptor->cmps_tab(), "TensorDescriptor.cmps_tab()") &&
+          IsEqual(tensor_descriptor->cmps_tab_offset(), r_tensor_descriptor->cmps_tab_offset(),
+                  "TensorDescriptor.cmps_tab_offset()"));
+}
+
 bool GeTensorDesc::operator==(const GeTensorDesc &r_ge_tensor_desc) const {
   return GeTensorDescAttrsAreEqual(r_ge_tensor_desc);
 }
@@ -329,29 +524,18 @@ GeShape &GeTensorDesc::ShapeReference() const {
   if (tensor_descriptor_.GetProtoMsg() != nullptr) {
     GeShape refShape(tensor_descriptor_.GetProtoOwner(), tensor_descriptor_.GetProtoMsg()->mutable_shape());
     __shape_.RefTo(refShape);
-  } else {
-    GeShape refShape(tensor_descriptor_.GetProtoOwner(), nullptr);
-    __shape_.RefTo(refShape);
   }
   return __shape_;
 }
 
-void GeTensorDesc::Init() {
-  SetFormat(FORMAT_ND);
-  SetOriginFormat(FORMAT_ND);
-  TensorUtils::SetDeviceType(*this, DeviceType::NPU);
-  if (tensor_descriptor_.GetProtoMsg() == nullptr) {
-    GELOGE(GRAPH_FAILED, "ProtoType nullptr.");
-    return;
-  }
-  tensor_descriptor_.GetProtoMsg()->set_has_out_attr(true);
-}
-
 ProtoAttrMapHelper GeTensorDesc::MutableAttrMap() {
   if (tensor_descriptor_.GetProtoMsg() != nullptr) {
     return ProtoAttrMapHelper(tensor_descriptor_.GetProtoOwner(), tensor_descriptor_.GetProtoMsg()->mutable_attr());
   }
-  return ProtoAttrMapHelper(tensor_descriptor_.GetProtoOwner(), nullptr);
+  if (attr_map_.GetProtoMsg() == nullptr) {
+    attr_map_.InitDefault();
+  }
+  return attr_map_;
 }
 
 ConstProtoAttrMapHelper GeTensorDesc::GetAttrMap() const {
@@ -359,7 +543,16 @@ ConstProtoAttrMapHelper GeTensorDesc::GetAttrMap() const {
     return ConstProtoAttrMapHelper(tensor_descriptor_.GetProtoOwner(),
                                    tensor_descriptor_.GetProtoMsg()->mutable_attr());
   }
-  return ConstProtoAttrMapHelper(tensor_descriptor_.GetProtoOwner(), nullptr);
+  if (attr_map_.GetProtoMsg() != nullptr) {
+    return ConstProtoAttrMapHelper(attr_map_.GetProtoOwner(), attr_map_.GetProtoMsg());
+  }
+  // Reading attributes of a desc that has none does not allocate
+  static const ConstProtoAttrMapHelper kEmptyAttrMap = []() {
+    ConstProtoAttrMapHelper attr_map;
+    attr_map.InitDefault();
+    return attr_map;
+  }();
+  return kEmptyAttrMap;
 }
 
 void GeTensorDesc::Update(GeShape shape, Format format, DataType dt) {
@@ -374,6 +567,9 @@ GeShape &GeTensorDesc::MutableShape() { return ShapeReference(); }
 void GeTensorDesc::SetShape(GeShape shape) { ShapeReference() = std::move(shape); }
 
 GeShape GeTensorDesc::GetOriginShape() const {
+  if (tensor_descriptor_.GetProtoMsg() == nullptr) {
+    return GeShape(fields_.origin_shape);
+  }
   vector<int64_t> origin_shape;
   if (!AttrUtils::GetListInt(this, TENSOR_UTILS_ORIGIN_SHAPE, origin_shape)) {
     return GeShape();
@@ -382,6 +578,10 @@ GeShape GeTensorDesc::GetOriginShape() const {
 }
 
 void GeTensorDesc::SetOriginShape(const GeShape &origin_shape) {
+  if (tensor_descriptor_.GetProtoMsg() == nullptr) {
+    fields_.origin_shape = origin_shape.GetDims();
+    return;
+  }
   std::vector<int64_t> origin_shape_tmp = origin_shape.GetDims();
   (void)AttrUtils::SetListInt(this, TENSOR_UTILS_ORIGIN_SHAPE, origin_shape_tmp);
 }
@@ -391,17 +591,22 @@ Format GeTensorDesc::GetFormat() const {
   if (tensor_descriptor_msg != nullptr) {
     return TypeUtils::SerialStringToFormat(tensor_descriptor_msg->layout());
   }
-  return FORMAT_RESERVED;
+  return fields_.format;
 }
 
 void GeTensorDesc::SetFormat(Format format) {
   auto tensor_descriptor_msg = tensor_descriptor_.GetProtoMsg();
   if (tensor_descriptor_msg != nullptr) {
     tensor_descriptor_msg->set_layout(TypeUtils::FormatToSerialString(format));
+    return;
   }
+  fields_.format = format;
 }
 
 Format GeTensorDesc::GetOriginFormat() const {
+  if (tensor_descriptor_.GetProtoMsg() == nullptr) {
+    return fields_.origin_format;
+  }
   std::string origin_format_str;
   if (!AttrUtils::GetStr(this, TENSOR_UTILS_ORIGIN_FORMAT, origin_format_str)) {
     // Can not get the certificate and it's not set, return directly
@@ -414,6 +619,10 @@ Format GeTensorDesc::GetOriginFormat() const {
 }
 
 void GeTensorDesc::SetOriginFormat(Format origin_format) {
+  if (tensor_descriptor_.GetProtoMsg() == nullptr) {
+    fields_.origin_format = origin_format;
+    return;
+  }
   std::string origin_format_str = "RESERVED";
   if (origin_format != FORMAT_RESERVED) {
     origin_format_str = TypeUtils::FormatToSerialString(origin_format);
@@ -424,7 +633,7 @@ void GeTensorDesc::SetOriginFormat(Format origin_format) {
 DataType GeTensorDesc::GetDataType() const {
   auto tensor_descriptor_msg = tensor_descriptor_.GetProtoMsg();
   if (tensor_descriptor_msg == nullptr) {
-    return DT_UNDEFINED;
+    return fields_.data_type;
   }
   auto &attr_map = *(tensor_descriptor_msg->mutable_attr());
   // Data type
@@ -450,6 +659,7 @@ DataType GeTensorDesc::GetDataType() const {
 void GeTensorDesc::SetDataType(DataType dataType) {
   auto tensor_descriptor_msg = tensor_descriptor_.GetProtoMsg();
   if (tensor_descriptor_msg == nullptr) {
+    fields_.data_type = dataType;
     return;
   }
   auto &attr_maps = *(tensor_descriptor_msg->mutable_attr());
@@ -468,6 +678,10 @@ void GeTensorDesc::SetDataType(DataType dataType) {
 }
 
 void GeTensorDesc::SetOriginDataType(DataType origin_data_type) {
+  if (tensor_descriptor_.GetProtoMsg() == nullptr) {
+    fields_.origin_data_type = origin_data_type;
+    return;
+  }
   std::string origin_data_type_str = "RESERVED";
   if (origin_data_type != DT_UNDEFINED) {
     origin_data_type_str = TypeUtils::DataTypeToSerialString(origin_data_type);
@@ -476,6 +690,9 @@ void GeTensorDesc::SetOriginDataType(DataType origin_data_type) {
 }
 
 DataType GeTensorDesc::GetOriginDataType() const {
+  if (tensor_descriptor_.GetProtoMsg() == nullptr) {
+    return fields_.origin_data_type;
+  }
   std::string origin_data_type_str;
   if (!AttrUtils::GetStr(this, TENSOR_UTILS_ORIGIN_DATA_TYPE, origin_data_type_str)) {
     return DT_UNDEFINED;
@@ -499,66 +716,72 @@ GeTensorDesc GeTensorDesc::Clone() const { return *this; }
 
 GeTensorDesc &GeTensorDesc::operator=(const GeTensorDesc &desc) {
   if (&desc != this) {
-    tensor_descriptor_.CopyValueFrom(desc.tensor_descriptor_);
+    CopyFrom(desc);
   }
   return *this;
 }
 
 GeTensorDesc &GeTensorDesc::operator=(GeTensorDesc &&desc) {
   if (&desc != this) {
-    tensor_descriptor_.CopyValueFrom(std::move(desc.tensor_descriptor_));
+    MoveFrom(std::move(desc));
   }
   return *this;
 }
 
-GeTensor::GeTensor::GeTensor() {
-  tensor_def_.InitDefault();
-  // Default init desc
-  DescReference() = GeTensorDesc();
-}
+GeTensor::GeTensor::GeTensor()
+    : desc_(ComGraphMakeShared<GeTensorDesc>()), data_(ComGraphMakeShared<TensorData>()) {}
 
 GeTensor::GeTensor(const GeTensorDesc &tensor_desc) : GeTensor() { DescReference() = tensor_desc; }
 
 GeTensor::GeTensor(const GeTensorDesc &tensor_desc, const vector<uint8_t> &data) : GeTensor() {
   DescReference() = tensor_desc;
-  auto proto_msg = tensor_def_.GetProtoMsg();
-  if (proto_msg != nullptr) {
-    proto_msg->set_data(data.data(), data.size());
-  }
+  (void)SetData(data);
 }
 
 GeTensor::GeTensor(const GeTensorDesc &tensor_desc, const uint8_t *data, size_t size) : GeTensor() {
   DescReference() = tensor_desc;
-  auto proto_msg = tensor_def_.GetProtoMsg();
-  if (proto_msg != nullptr && data != nullptr) {
-    proto_msg->set_data(data, size);
+  if (data != nullptr) {
+    (void)SetData(data, size);
   }
 }
 
 GeTensor::GeTensor(GeTensorDesc &&tensor_desc, vector<uint8_t> &&data) : GeTensor() {
   DescReference() = std::move(tensor_desc);
-  auto proto_msg = tensor_def_.GetProtoMsg();
-  if (proto_msg != nullptr) {
-    proto_msg->set_data(data.data(), data.size());
-  }
+  (void)SetData(std::move(data));
 }
 
 GeTensor::GeTensor(const GeTensorDesc &tensor_desc, const Buffer &data) : GeTensor() {
   DescReference() = tensor_desc;
-  auto proto_msg = tensor_def_.GetProtoMsg();
-  if (proto_msg != nullptr) {
-    if (data.size() == 0) {
-      GELOGI("GetSize res is 0.");
-    }
-    if (data.data() == nullptr) {
-      GELOGI("data addr is null.");
-    }
-    proto_msg->set_data(data.GetData(), data.GetSize());
+  if (data.size() == 0) {
+    GELOGI("GetSize res is 0.");
+  }
+  if (data.data() == nullptr) {
+    GELOGI("data addr is null.");
   }
+  (void)SetData(data);
 }
 
 GeTensor::GeTensor(const ProtoMsgOwner &proto_owner, proto::TensorDef *proto_msg)
-    : tensor_def_(proto_owner, proto_msg) {}
+    : tensor_def_(proto_owner, proto_msg) {
+  if (proto_msg == nullptr) {
+    desc_ = ComGraphMakeShared<GeTensorDesc>();
+    data_ = ComGraphMakeShared<TensorData>();
+  }
+}
+
+void GeTensor::ToProto(proto::TensorDef &proto_msg) const {
+  auto tensor_def_msg = tensor_def_.GetProtoMsg();
+  if (tensor_def_msg != nullptr) {
+    proto_msg = *tensor_def_msg;
+    return;
+  }
+  DescReference().ToProto(*proto_msg.mutable_desc());
+  if (data_ != nullptr && data_->GetSize() > 0) {
+    proto_msg.set_data(data_->GetData(), data_->GetSize());
+  } else {
+    proto_msg.clear_data();
+  }
+}
 
 GeTensorDesc GeTensor::GetTensorDesc() const { return DescReference(); }
 
@@ -568,22 +791,21 @@ GeTensorDesc &GeTensor::DescReference() const {
   if (tensor_def_.GetProtoMsg() != nullptr) {
     GeTensorDesc tensor_desc(tensor_def_.GetProtoOwner(), tensor_def_.GetProtoMsg()->mutable_desc());
     __desc_.RefTo(tensor_desc);
-  } else {
-    GeTensorDesc tensor_desc(tensor_def_.GetProtoOwner(), nullptr);
-    __desc_.RefTo(tensor_desc);
+    return __desc_;
   }
-  return __desc_;
+  return (desc_ != nullptr) ? *desc_ : __desc_;
 }
 
-void GeTensor::SetTensorDesc(const GeTensorDesc &tensor_desc) {
-  DescReference() = tensor_desc;
-}
+void GeTensor::SetTensorDesc(const GeTensorDesc &tensor_desc) { DescReference() = tensor_desc; }
 
 const Buffer GeTensor::GetData() const {
   auto proto_msg = tensor_def_.GetProtoMsg();
   if (proto_msg != nullptr) {
     return Buffer(tensor_def_.GetProtoOwner(), proto_msg->mutable_data());
   }
+  if (data_ != nullptr) {
+    return Buffer(data_);
+  }
   return Buffer();
 }
 
@@ -592,55 +814,89 @@ Buffer GeTensor::MutableData() {
   if (proto_msg != nullptr) {
     return Buffer(tensor_def_.GetProtoOwner(), proto_msg->mutable_data());
   }
+  if (data_ != nullptr) {
+    return Buffer(data_);
+  }
   return Buffer();
 }
 
 graphStatus GeTensor::SetData(vector<uint8_t> &&data) {
   auto proto_msg = tensor_def_.GetProtoMsg();
-  GE_CHECK_NOTNULL(proto_msg);
-  proto_msg->set_data(data.data(), data.size());
+  if (proto_msg != nullptr) {
+    proto_msg->set_data(data.data(), data.size());
+    return GRAPH_SUCCESS;
+  }
+  GE_CHECK_NOTNULL(data_);
+  data_->Adopt(std::move(data));
   return GRAPH_SUCCESS;
 }
 
 graphStatus GeTensor::SetData(const vector<uint8_t> &data) {
   auto proto_msg = tensor_def_.GetProtoMsg();
-  GE_CHECK_NOTNULL(proto_msg);
-  proto_msg->set_data(data.data(), data.size());
-  return GRAPH_SUCCESS;
+  if (proto_msg != nullptr) {
+    proto_msg->set_data(data.data(), data.size());
+    return GRAPH_SUCCESS;
+  }
+  GE_CHECK_NOTNULL(data_);
+  return data_->SetData(data.data(), data.size());
 }
 
 graphStatus GeTensor::SetData(const uint8_t *data, size_t size) {
   GE_CHECK_NOTNULL(data);
   auto proto_msg = tensor_def_.GetProtoMsg();
-  GE_CHECK_NOTNULL(proto_msg);
-  proto_msg->set_data(data, size);
+  if (proto_msg != nullptr) {
+    proto_msg->set_data(data, size);
+    return GRAPH_SUCCESS;
+  }
+  GE_CHECK_NOTNULL(data_);
+  return data_->SetData(data, size);
+}
+
+graphStatus GeTensor::ResizeData(size_t size) {
+  auto proto_msg = tensor_def_.GetProtoMsg();
+  if (proto_msg == nullptr) {
+    GE_CHECK_NOTNULL(data_);
+    return data_->Resize(size);
+  }
+  try {
+    proto_msg->mutable_data()->resize(size);
+  } catch (std::bad_alloc &e) {
+    GELOGE(GRAPH_FAILED, "Failed to alloc tensor memory, size %zu", size);
+    return GRAPH_FAILED;
+  }
   return GRAPH_SUCCESS;
 }
 
 graphStatus GeTensor::SetData(const Buffer &data) {
-  auto proto_msg = tensor_def_.GetProtoMsg();
-  GE_CHECK_NOTNULL(proto_msg);
   if (data.size() == 0) {
     GELOGI("GetSize res is 0.");
   }
   if (data.data() == nullptr) {
     GELOGI("data addr is null.");
   }
-  proto_msg->set_data(data.data(), data.size());
-  return GRAPH_SUCCESS;
+  auto proto_msg = tensor_def_.GetProtoMsg();
+  if (proto_msg != nullptr) {
+    proto_msg->set_data(data.data(), data.size());
+    return GRAPH_SUCCESS;
+  }
+  GE_CHECK_NOTNULL(data_);
+  return data_->SetData(data.data(), data.size());
 }
 
 GeTensor GeTensor::Clone() const {
-  GeTensor tensor;
-  tensor.tensor_def_.CopyValueFrom(tensor_def_);
+  GeTensor tensor(DescReference());
+  (void)tensor.SetData(GetData());
   return tensor;
 }
 
-GeTensor::GeTensor(const GeTensor &other) { tensor_def_ = other.tensor_def_; }
+GeTensor::GeTensor(const GeTensor &other)
+    : tensor_def_(other.tensor_def_), desc_(other.desc_), data_(other.data_) {}
 
 GeTensor &GeTensor::operator=(const GeTensor &other) {
   if (&other != this) {
     tensor_def_ = other.tensor_def_;
+    desc_ = other.desc_;
+    data_ = other.data_;
   }
   return *this;
 }
@@ -648,8 +904,8 @@ GeTensor &GeTensor::operator=(const GeTensor &other) {
 GE_FUNC_DEV_VISIBILITY GE_FUNC_HOST_VISIBILITY graphStatus TensorUtils::GetSize(const GeTensorDesc &tensor_desc,
                                                                                 uint32_t &size) {
   auto tensor_descriptor_msg = tensor_desc.tensor_descriptor_.GetProtoMsg();
-  GE_CHECK_NOTNULL(tensor_descriptor_msg);
-  size = static_cast<uint32_t>(tensor_descriptor_msg->size());
+  size = static_cast<uint32_t>((tensor_descriptor_msg != nullptr) ? tensor_descriptor_msg->size()
+                                                                  : tensor_desc.fields_.size);
   return GRAPH_SUCCESS;
 }
 
@@ -657,7 +913,9 @@ GE_FUNC_DEV_VISIBILITY GE_FUNC_HOST_VISIBILITY void TensorUtils::SetSize(GeTenso
   auto tensor_descriptor_msg = tensor_desc.tensor_descriptor_.GetProtoMsg();
   if (tensor_descriptor_msg != nullptr) {
     tensor_descriptor_msg->set_size(size);
+    return;
   }
+  tensor_desc.fields_.size = size;
 }
 
 uint32_t TensorUtils::GetWeightSize(const GeTensorDesc &tensor_desc) {
@@ -665,10 +923,10 @@ uint32_t TensorUtils::GetWeightSize(const GeTensorDesc &tensor_desc) {
   if (tensor_descriptor_msg != nullptr) {
     return static_cast<uint32_t>(tensor_descriptor_msg->weight_size());
   }
-  return 0;
+  return static_cast<uint32_t>(tensor_desc.fields_.weight_size);
 }
 
-uint32_t TensorUtils::GetWeightSize(const GeTensor &tensor) { return GetWeightSize(tensor.GetTensorDesc()); }
+uint32_t TensorUtils::GetWeightSize(const GeTensor &tensor) { return GetWeightSize(tensor.DescReference()); }
 
 GE_FUNC_DEV_VISIBILITY GE_FUNC_HOST_VISIBILITY uint32_t TensorUtils::GetWeightSize(const ConstGeTensorPtr &tensor_ptr) {
   if (tensor_ptr == nullptr) {
@@ -692,7 +950,7 @@ uint8_t *TensorUtils::GetWeightAddr(const GeTensor &tensor, uint8_t *base) {
     return nullptr;
   }
   int64_t weight_data_offset = 0;
-  if (GetDataOffset(tensor.GetTensorDesc(), weight_data_offset) != GRAPH_SUCCESS) return nullptr;
+  if (GetDataOffset(tensor.DescReference(), weight_data_offset) != GRAPH_SUCCESS) return nullptr;
 
   if (weight_data_offset == 0) {
     // The weight of offset 0 is still in const op, still get from ATTR_NAME_WEIGHTS.
@@ -707,14 +965,15 @@ GE_FUNC_DEV_VISIBILITY GE_FUNC_HOST_VISIBILITY void TensorUtils::SetWeightSize(G
   auto tensor_descriptor_msg = tensor_desc.tensor_descriptor_.GetProtoMsg();
   if (tensor_descriptor_msg != nullptr) {
     tensor_descriptor_msg->set_weight_size(size);
+    return;
   }
+  tensor_desc.fields_.weight_size = size;
 }
 
 GE_FUNC_DEV_VISIBILITY GE_FUNC_HOST_VISIBILITY graphStatus TensorUtils::GetReuseInput(const GeTensorDesc &tensor_desc,
                                                                                       bool &flag) {
   auto tensor_descriptor_msg = tensor_desc.tensor_descriptor_.GetProtoMsg();
-  GE_CHECK_NOTNULL(tensor_descriptor_msg);
-  flag = tensor_descriptor_msg->reuse_input();
+  flag = (tensor_descriptor_msg != nullptr) ? tensor_descriptor_msg->reuse_input() : tensor_desc.fields_.reuse_input;
   return GRAPH_SUCCESS;
 }
 
@@ -722,14 +981,16 @@ GE_FUNC_DEV_VISIBILITY GE_FUNC_HOST_VISIBILITY void TensorUtils::SetReuseInput(G
   auto tensor_descriptor_msg = tensor_desc.tensor_descriptor_.GetProtoMsg();
   if (tensor_descriptor_msg != nullptr) {
     tensor_descriptor_msg->set_reuse_input(flag);
+    return;
   }
+  tensor_desc.fields_.reuse_input = flag;
 }
 
 GE_FUNC_DEV_VISIBILITY GE_FUNC_HOST_VISIBILITY graphStatus TensorUtils::GetOutputTensor(const GeTensorDesc &tensor_desc,
                                                                                         bool &flag) {
   auto tensor_descriptor_msg = tensor_desc.tensor_descriptor_.GetProtoMsg();
-  GE_CHECK_NOTNULL(tensor_descriptor_msg);
-  flag = tensor_descriptor_msg->output_tensor();
+  flag =
+      (tensor_descriptor_msg != nullptr) ? tensor_descriptor_msg->output_tensor() : tensor_desc.fields_.output_tensor;
   return GRAPH_SUCCESS;
 }
 
@@ -737,39 +998,36 @@ GE_FUNC_DEV_VISIBILITY GE_FUNC_HOST_VISIBILITY void TensorUtils::SetOutputTensor
   auto tensor_descriptor_msg = tensor_desc.tensor_descriptor_.GetProtoMsg();
   if (tensor_descriptor_msg != nullptr) {
     tensor_descriptor_msg->set_output_tensor(flag);
+    return;
   }
+  tensor_desc.fields_.output_tensor = flag;
 }
 
-static map<uint32_t, string> device_to_str_map{
-    {0, "NPU"}, {1, "CPU"},
-};
-static map<string, uint32_t> str_to_device_map{
-    {"NPU", 0}, {"CPU", 1},
-};
-
 GE_FUNC_DEV_VISIBILITY GE_FUNC_HOST_VISIBILITY graphStatus TensorUtils::GetDeviceType(const GeTensorDesc &tensor_desc,
                                                                                       DeviceType &type) {
   auto tensor_descriptor_msg = tensor_desc.tensor_descriptor_.GetProtoMsg();
-  GE_CHECK_NOTNULL(tensor_descriptor_msg);
-  string type_str = tensor_descriptor_msg->device_type();
-  type = DeviceType(str_to_device_map[type_str]);
+  if (tensor_descriptor_msg == nullptr) {
+    type = tensor_desc.fields_.device_type;
+    return GRAPH_SUCCESS;
+  }
+  type = StrToDeviceType(tensor_descriptor_msg->device_type());
   return GRAPH_SUCCESS;
 }
 
 GE_FUNC_DEV_VISIBILITY GE_FUNC_HOST_VISIBILITY void TensorUtils::SetDeviceType(GeTensorDesc &tensor_desc,
                                                                                DeviceType type) {
-  auto type_str = device_to_str_map[type];
   auto tensor_descriptor_msg = tensor_desc.tensor_descriptor_.GetProtoMsg();
   if (tensor_descriptor_msg != nullptr) {
-    tensor_descriptor_msg->set_device_type(type_str);
+    tensor_descriptor_msg->set_device_type(DeviceTypeToStr(type));
+    return;
   }
+  tensor_desc.fields_.device_type = type;
 }
 
 GE_FUNC_DEV_VISIBILITY GE_FUNC_HOST_VISIBILITY graphStatus TensorUtils::GetInputTensor(const GeTensorDesc &tensor_desc,
                                                                                        bool &flag) {
   auto tensor_descriptor_msg = tensor_desc.tensor_descriptor_.GetProtoMsg();
-  GE_CHECK_NOTNULL(tensor_descriptor_msg);
-  flag = tensor_descriptor_msg->input_tensor();
+  flag = (tensor_descriptor_msg != nullptr) ? tensor_descriptor_msg->input_tensor() : tensor_desc.fields_.input_tensor;
   return GRAPH_SUCCESS;
 }
 
@@ -777,14 +1035,16 @@ GE_FUNC_DEV_VISIBILITY GE_FUNC_HOST_VISIBILITY void TensorUtils::SetInputTensor(
   auto tensor_descriptor_msg = tensor_desc.tensor_descriptor_.GetProtoMsg();
   if (tensor_descriptor_msg != nullptr) {
     tensor_descriptor_msg->set_input_tensor(flag);
+    return;
   }
+  tensor_desc.fields_.input_tensor = flag;
 }
 
 GE_FUNC_DEV_VISIBILITY GE_FUNC_HOST_VISIBILITY graphStatus TensorUtils::GetRealDimCnt(const GeTensorDesc &tensor_desc,
                                                                                       uint32_t &cnt) {
   auto tensor_descriptor_msg = tensor_desc.tensor_descriptor_.GetProtoMsg();
-  GE_CHECK_NOTNULL(tensor_descriptor_msg);
-  cnt = static_cast<uint32_t>(tensor_descriptor_msg->real_dim_cnt());
+  cnt = static_cast<uint32_t>((tensor_descriptor_msg != nullptr) ? tensor_descriptor_msg->real_dim_cnt()
+                                                                 : tensor_desc.fields_.real_dim_cnt);
   return GRAPH_SUCCESS;
 }
 
@@ -793,15 +1053,16 @@ GE_FUNC_DEV_VISIBILITY GE_FUNC_HOST_VISIBILITY void TensorUtils::SetRealDimCnt(G
   auto tensor_descriptor_msg = tensor_desc.tensor_descriptor_.GetProtoMsg();
   if (tensor_descriptor_msg != nullptr) {
     tensor_descriptor_msg->set_real_dim_cnt(cnt);
+    return;
   }
+  tensor_desc.fields_.real_dim_cnt = cnt;
 }
 
 GE_FUNC_DEV_VISIBILITY GE_FUNC_HOST_VISIBILITY graphStatus
 TensorUtils::GetReuseInputIndex(const GeTensorDesc &tensor_desc, uint32_t &idx) {
   auto tensor_descriptor_msg = tensor_desc.tensor_descriptor_.GetProtoMsg();
-  GE_CHECK_NOTNULL(tensor_descriptor_msg);
-
-  idx = static_cast<uint32_t>(tensor_descriptor_msg->reuse_input_index());
+  idx = static_cast<uint32_t>((tensor_descriptor_msg != nullptr) ? tensor_descriptor_msg->reuse_input_index()
+                                                                 : tensor_desc.fields_.reuse_input_index);
   return GRAPH_SUCCESS;
 }
 
@@ -810,19 +1071,16 @@ GE_FUNC_DEV_VISIBILITY GE_FUNC_HOST_VISIBILITY void TensorUtils::SetReuseInputIn
   auto tensor_descriptor_msg = tensor_desc.tensor_descriptor_.GetProtoMsg();
   if (tensor_descriptor_msg != nullptr) {
     tensor_descriptor_msg->set_reuse_input_index(idx);
+    return;
   }
+  tensor_desc.fields_.reuse_input_index = idx;
 }
 
 GE_FUNC_DEV_VISIBILITY GE_FUNC_HOST_VISIBILITY graphStatus TensorUtils::GetDataOffset(const GeTensorDesc &tensor_desc,
                                                                                       int64_t &offset) {
   auto tensor_descriptor_msg = tensor_desc.tensor_descriptor_.GetProtoMsg();
-  if (tensor_descriptor_msg != nullptr) {
-    offset = tensor_descriptor_msg->data_offset();
-    return GRAPH_SUCCESS;
-  } else {
-    GELOGW("tensor_descriptor_msg is nullptr.");
-    return GRAPH_FAILED;
-  }
+  offset = (tensor_descriptor_msg != nullptr) ? tensor_descriptor_msg->data_offset() : tensor_desc.fields_.data_offset;
+  return GRAPH_SUCCESS;
 }
 
 GE_FUNC_DEV_VISIBILITY GE_FUNC_HOST_VISIBILITY void TensorUtils::SetDataOffset(GeTensorDesc &tensor_desc,
@@ -830,15 +1088,16 @@ GE_FUNC_DEV_VISIBILITY GE_FUNC_HOST_VISIBILITY void TensorUtils::SetDataOffset(G
   auto tensor_descriptor_msg = tensor_desc.tensor_descriptor_.GetProtoMsg();
   if (tensor_descriptor_msg != nullptr) {
     tensor_descriptor_msg->set_data_offset(offset);
+    return;
   }
+  tensor_desc.fields_.data_offset = offset;
 }
 
 GE_FUNC_DEV_VISIBILITY GE_FUNC_HOST_VISIBILITY graphStatus TensorUtils::GetCmpsSize(const GeTensorDesc &tensor_desc,
                                                                                     uint32_t &cmp_size) {
   auto tensor_descriptor_msg = tensor_desc.tensor_descriptor_.GetProtoMsg();
-  if (tensor_descriptor_msg != nullptr) {
-    cmp_size = static_cast<uint32_t>(tensor_descriptor_msg->cmps_size());
-  }
+  cmp_size = static_cast<uint32_t>((tensor_descriptor_msg != nullptr) ? tensor_descriptor_msg->cmps_size()
+                                                                      : tensor_desc.fields_.cmps_size);
   return GRAPH_SUCCESS;
 }
 
@@ -847,35 +1106,37 @@ GE_FUNC_DEV_VISIBILITY GE_FUNC_HOST_VISIBILITY void TensorUtils::SetCmpsSize(GeT
   auto tensor_descriptor_msg = tensor_desc.tensor_descriptor_.GetProtoMsg();
   if (tensor_descriptor_msg != nullptr) {
     tensor_descriptor_msg->set_cmps_size(cmp_size);
+    return;
   }
+  tensor_desc.fields_.cmps_size = cmp_size;
 }
 
 GE_FUNC_DEV_VISIBILITY GE_FUNC_HOST_VISIBILITY graphStatus TensorUtils::GetCmpsTab(const GeTensorDesc &tensor_desc,
                                                                                    vector<uint8_t> &vec) {
   auto tensor_descriptor_msg = tensor_desc.tensor_descriptor_.GetProtoMsg();
-  if (tensor_descriptor_msg != nullptr) {
-    string str = tensor_descriptor_msg->cmps_tab();
-    vec.assign(str.begin(), str.end());
-  }
+  const string &str =
+      (tensor_descriptor_msg != nullptr) ? tensor_descriptor_msg->cmps_tab() : tensor_desc.fields_.cmps_tab;
+  vec.assign(str.begin(), str.end());
   return GRAPH_SUCCESS;
 }
 
 GE_FUNC_DEV_VISIBILITY GE_FUNC_HOST_VISIBILITY void TensorUtils::SetCmpsTab(GeTensorDesc &tensor_desc,
                                                                             const uint8_t *data, size_t size) {
+  GE_CHK_BOOL_EXEC(data != nullptr, return, "data is null.");
+  string str((const char *)data, size);
   auto tensor_descriptor_msg = tensor_desc.tensor_descriptor_.GetProtoMsg();
   if (tensor_descriptor_msg != nullptr) {
-    GE_CHK_BOOL_EXEC(data != nullptr, return, "data is null.");
-    string str((const char *)data, size);
     tensor_descriptor_msg->set_cmps_tab(str);
+    return;
   }
+  tensor_desc.fields_.cmps_tab = std::move(str);
 }
 
 GE_FUNC_DEV_VISIBILITY GE_FUNC_HOST_VISIBILITY graphStatus
 TensorUtils::GetCmpsTabOffset(const GeTensorDesc &tensor_desc, int64_t &tab_offset) {
   auto tensor_descriptor_msg = tensor_desc.tensor_descriptor_.GetProtoMsg();
-  if (tensor_descriptor_msg != nullptr) {
-    tab_offset = tensor_descriptor_msg->cmps_tab_offset();
-  }
+  tab_offset = (tensor_descriptor_msg != nullptr) ? tensor_descriptor_msg->cmps_tab_offset()
+                                                  : tensor_desc.fields_.cmps_tab_offset;
   return GRAPH_SUCCESS;
 }
 
@@ -884,7 +1145,9 @@ GE_FUNC_DEV_VISIBILITY GE_FUNC_HOST_VISIBILITY void TensorUtils::SetCmpsTabOffse
   auto tensor_descriptor_msg = tensor_desc.tensor_descriptor_.GetProtoMsg();
   if (tensor_descriptor_msg != nullptr) {
     tensor_descriptor_msg->set_cmps_tab_offset(tab_offset);
+    return;
   }
+  tensor_desc.fields_.cmps_tab_offset = tab_offset;
 }
 
 graphStatus TensorUtils::GetCmpsInfo(const GeTensorDesc &tensor_desc, CompressInfo &info) {
@@ -47,11 +47,8 @@ GE_FUNC_DEV_VISIBILITY GE_FUNC_HOST_VISIBILITY bool ModelSerializeImp::Serialize
   GE_CHK_BOOL_EXEC(tensor != nullptr, return false, "tensor is null.");
   GE_CHK_BOOL_EXEC(tensor_proto != nullptr, return false, "tensor_proto is null.");
 
-  if (tensor->tensor_def_.GetProtoMsg() != nullptr) {
-    *tensor_proto = *tensor->tensor_def_.GetProtoMsg();
-    return true;
-  }
-  return false;
+  tensor->ToProto(*tensor_proto);
+  return true;
 }
 
 bool ModelSerializeImp::SerializeEdge(const NodePtr &node, proto::OpDef *op_def_proto) {
@@ -98,8 +95,8 @@ bool ModelSerializeImp::SerializeOpDesc(const ConstOpDescPtr &op_desc, proto::Op
       auto size = static_cast<uint32_t>(op_desc->GetInputsSize());
       for (uint32_t i = 0; i < size; i++) {
         auto tensor_desc = op_desc->GetInputDescPtr(i);
-        if (tensor_desc != nullptr && tensor_desc->tensor_descriptor_.GetProtoMsg() != nullptr) {
-          *op_def_proto->add_input_desc() = *(tensor_desc->tensor_descriptor_.GetProtoMsg());
+        if (tensor_desc != nullptr) {
+          tensor_desc->ToProto(*op_def_proto->add_input_desc());
         }
       }
     }
@@ -108,8 +105,8 @@ bool ModelSerializeImp::SerializeOpDesc(const ConstOpDescPtr &op_desc, proto::Op
       auto size = static_cast<uint32_t>(op_desc->GetOutputsSize());
       for (uint32_t i = 0; i < size; i++) {
         auto tensor_desc = op_desc->GetOutputDescPtr(i);
-        if (tensor_desc != nullptr && tensor_desc->tensor_descriptor_.GetProtoMsg() != nullptr) {
-          *op_def_proto->add_output_desc() = *(tensor_desc->tensor_descriptor_.GetProtoMsg());
+        if (tensor_desc != nullptr) {
+          tensor_desc->ToProto(*op_def_proto->add_output_desc());
         }
       }
     }
@@ -205,20 +202,22 @@ bool ModelSerializeImp::UnserializeOpDesc(OpDescPtr &op_desc, proto::OpDef &op_d
   op_desc = std::shared_ptr<OpDesc>(new (std::nothrow) OpDesc(protobuf_owner_, &op_def_proto));
   GE_CHK_BOOL_EXEC(op_desc != nullptr, return false, "op_desc is nullptr.");
 
-  // Input tensor
+  // Input tensor, parsed into native descs so that the proto copies can be released
   for (auto &input_desc : *op_def_proto.mutable_input_desc()) {
-    std::shared_ptr<GeTensorDesc> temp_value =
-        std::shared_ptr<GeTensorDesc>(new (std::nothrow) GeTensorDesc(protobuf_owner_, &input_desc));
+    std::shared_ptr<GeTensorDesc> temp_value = std::shared_ptr<GeTensorDesc>(new (std::nothrow) GeTensorDesc());
     GE_CHK_BOOL_RET_STATUS(temp_value != nullptr, false, "temp_value is nullptr");
+    temp_value->FromProto(input_desc);
     op_desc->inputs_desc_.push_back(temp_value);
   }
   // Output tensor
   for (auto &output_desc : *op_def_proto.mutable_output_desc()) {
-    std::shared_ptr<GeTensorDesc> temp_value =
-        std::shared_ptr<GeTensorDesc>(new (std::nothrow) GeTensorDesc(protobuf_owner_, &output_desc));
+    std::shared_ptr<GeTensorDesc> temp_value = std::shared_ptr<GeTensorDesc>(new (std::nothrow) GeTensorDesc());
     GE_CHK_BOOL_RET_STATUS(temp_value != nullptr, false, "temp_value is nullptr");
+    temp_value->FromProto(output_desc);
     op_desc->outputs_desc_.push_back(temp_value);
   }
+  op_def_proto.clear_input_desc();
+  op_def_proto.clear_output_desc();
   return true;
 }
 
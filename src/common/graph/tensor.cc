@@ -387,7 +387,7 @@ size_t Tensor::GetSize() const {
 
 graphStatus Tensor::SetData(std::vector<uint8_t> &&data) {
   if (impl != nullptr) {
-    (void)impl->ge_tensor.SetData(data);
+    (void)impl->ge_tensor.SetData(std::move(data));
     return GRAPH_SUCCESS;
   }
   return GRAPH_FAILED;
@@ -282,45 +282,45 @@ void OnnxUtils::AddAttrProtoForOpInAndOutDesc(onnx::NodeProto *node_proto, const
         auto layout_origin = TypeUtils::FormatToSerialString(input_desc->GetOriginFormat());
         AddAttrProto(node_proto, onnx::AttributeProto_AttributeType_STRING,
                      "input_desc_origin_layout:" + std::to_string(i), &layout_origin);
-        auto tensor_descriptor = input_desc->tensor_descriptor_.GetProtoMsg();
-        if (tensor_descriptor != nullptr) {
-          auto size = tensor_descriptor->size();
-          AddAttrProto(node_proto, onnx::AttributeProto_AttributeType_INT, "input_desc_size:" + std::to_string(i),
-                       &size);
-          auto weight_size = tensor_descriptor->weight_size();
-          AddAttrProto(node_proto, onnx::AttributeProto_AttributeType_INT,
-                       "input_desc_weight_size:" + std::to_string(i), &weight_size);
-          auto reuse_input = tensor_descriptor->reuse_input();
-          auto reuse_input_int = static_cast<int64_t>(reuse_input);
-          AddAttrProto(node_proto, onnx::AttributeProto_AttributeType_INT,
-                       "input_desc_reuse_input:" + std::to_string(i), &reuse_input_int);
-          auto output_tensor = tensor_descriptor->output_tensor();
-          auto output_tensor_int = static_cast<int64_t>(output_tensor);
-          AddAttrProto(node_proto, onnx::AttributeProto_AttributeType_INT,
-                       "input_desc_output_tensor:" + std::to_string(i), &output_tensor_int);
-          auto device_type = tensor_descriptor->device_type();
-          AddAttrProto(node_proto, onnx::AttributeProto_AttributeType_STRING,
-                       "input_desc_device_type:" + std::to_string(i), &device_type);
-          auto input_tensor = tensor_descriptor->input_tensor();
-          auto input_tensor_int = static_cast<int64_t>(input_tensor);
-          AddAttrProto(node_proto, onnx::AttributeProto_AttributeType_INT,
-                       "input_desc_input_tensor:" + std::to_string(i), &input_tensor_int);
-          auto real_dim_cnt = tensor_descriptor->real_dim_cnt();
-          AddAttrProto(node_proto, onnx::AttributeProto_AttributeType_INT,
-                       "input_desc_real_dim_cnt:" + std::to_string(i), &real_dim_cnt);
-          auto data_offset = tensor_descriptor->data_offset();
-          AddAttrProto(node_proto, onnx::AttributeProto_AttributeType_INT,
-                       "input_desc_data_offset:" + std::to_string(i), &data_offset);
-          auto cmps_size = tensor_descriptor->cmps_size();
-          AddAttrProto(node_proto, onnx::AttributeProto_AttributeType_INT, "input_desc_cmps_size:" + std::to_string(i),
-                       &cmps_size);
-          auto cmps_tab = tensor_descriptor->cmps_tab();
-          AddAttrProto(node_proto, onnx::AttributeProto_AttributeType_STRING,
-                       "input_desc_cmps_tab:" + std::to_string(i), &cmps_tab);
-          auto cmps_tab_offset = tensor_descriptor->cmps_tab_offset();
-          AddAttrProto(node_proto, onnx::AttributeProto_AttributeType_INT,
-                       "input_desc_cmps_tab_offset:" + std::to_string(i), &cmps_tab_offset);
-        }
+        proto::TensorDescriptor tensor_descriptor_msg;
+        input_desc->ToProto(tensor_descriptor_msg);
+        auto tensor_descriptor = &tensor_descriptor_msg;
+        auto size = tensor_descriptor->size();
+        AddAttrProto(node_proto, onnx::AttributeProto_AttributeType_INT, "input_desc_size:" + std::to_string(i),
+                     &size);
+        auto weight_size = tensor_descriptor->weight_size();
+        AddAttrProto(node_proto, onnx::AttributeProto_AttributeType_INT,
+                     "input_desc_weight_size:" + std::to_string(i), &weight_size);
+        auto reuse_input = tensor_descriptor->reuse_input();
+        auto reuse_input_int = static_cast<int64_t>(reuse_input);
+        AddAttrProto(node_proto, onnx::AttributeProto_AttributeType_INT,
+                     "input_desc_reuse_input:" + std::to_string(i), &reuse_input_int);
+        auto output_tensor = tensor_descriptor->output_tensor();
+        auto output_tensor_int = static_cast<int64_t>(output_tensor);
+        AddAttrProto(node_proto, onnx::AttributeProto_AttributeType_INT,
+                     "input_desc_output_tensor:" + std::to_string(i), &output_tensor_int);
+        auto device_type = tensor_descriptor->device_type();
+        AddAttrProto(node_proto, onnx::AttributeProto_AttributeType_STRING,
+                     "input_desc_device_type:" + std::to_string(i), &device_type);
+        auto input_tensor = tensor_descriptor->input_tensor();
+        auto input_tensor_int = static_cast<int64_t>(input_tensor);
+        AddAttrProto(node_proto, onnx::AttributeProto_AttributeType_INT,
+                     "input_desc_input_tensor:" + std::to_string(i), &input_tensor_int);
+        auto real_dim_cnt = tensor_descriptor->real_dim_cnt();
+        AddAttrProto(node_proto, onnx::AttributeProto_AttributeType_INT,
+                     "input_desc_real_dim_cnt:" + std::to_string(i), &real_dim_cnt);
+        auto data_offset = tensor_descriptor->data_offset();
+        AddAttrProto(node_proto, onnx::AttributeProto_AttributeType_INT,
+                     "input_desc_data_offset:" + std::to_string(i), &data_offset);
+        auto cmps_size = tensor_descriptor->cmps_size();
+        AddAttrProto(node_proto, onnx::AttributeProto_AttributeType_INT, "input_desc_cmps_size:" + std::to_string(i),
+                     &cmps_size);
+        auto cmps_tab = tensor_descriptor->cmps_tab();
+        AddAttrProto(node_proto, onnx::AttributeProto_AttributeType_STRING,
+                     "input_desc_cmps_tab:" + std::to_string(i), &cmps_tab);
+        auto cmps_tab_offset = tensor_descriptor->cmps_tab_offset();
+        AddAttrProto(node_proto, onnx::AttributeProto_AttributeType_INT,
+                     "input_desc_cmps_tab_offset:" + std::to_string(i), &cmps_tab_offset);
       }
     }
   }
@@ -346,21 +346,21 @@ void OnnxUtils::AddAttrProtoForOpInAndOutDesc(onnx::NodeProto *node_proto, const
         auto layout_origin = TypeUtils::FormatToSerialString(output_desc->GetOriginFormat());
         AddAttrProto(node_proto, onnx::AttributeProto_AttributeType_STRING,
                      "output_desc_origin_layout:" + std::to_string(i), &layout_origin);
-        auto tensor_descriptor = output_desc->tensor_descriptor_.GetProtoMsg();
-        if (tensor_descriptor != nullptr) {
-          auto size = tensor_descriptor->size();
-          AddAttrProto(node_proto, onnx::AttributeProto_AttributeType_INT, "output_desc_size:" + std::to_string(i),
-                       &size);
-          auto weight_size = tensor_descriptor->weight_size();
-          AddAttrProto(node_proto, onnx::AttributeProto_AttributeType_INT,
-                       "output_desc_weight_size:" + std::to_string(i), &weight_size);
-          auto device_type = tensor_descriptor->device_type();
-          AddAttrProto(node_proto, onnx::AttributeProto_AttributeType_STRING,
-                       "output_desc_device_type:" + std::to_string(i), &device_type);
-          auto real_dim_cnt = tensor_descriptor->real_dim_cnt();
-          AddAttrProto(node_proto, onnx::AttributeProto_AttributeType_INT,
-                       "output_desc_real_dim_cnt:" + std::to_string(i), &real_dim_cnt);
-        }
+        proto::TensorDescriptor tensor_descriptor_msg;
+        output_desc->ToProto(tensor_descriptor_msg);
+        auto tensor_descriptor = &tensor_descriptor_msg;
+        auto size = tensor_descriptor->size();
+        AddAttrProto(node_proto, onnx::AttributeProto_AttributeType_INT, "output_desc_size:" + std::to_string(i),
+                     &size);
+        auto weight_size = tensor_descriptor->weight_size();
+        AddAttrProto(node_proto, onnx::AttributeProto_AttributeType_INT,
+                     "output_desc_weight_size:" + std::to_string(i), &weight_size);
+        auto device_type = tensor_descriptor->device_type();
+        AddAttrProto(node_proto, onnx::AttributeProto_AttributeType_STRING,
+                     "output_desc_device_type:" + std::to_string(i), &device_type);
+        auto real_dim_cnt = tensor_descriptor->real_dim_cnt();
+        AddAttrProto(node_proto, onnx::AttributeProto_AttributeType_INT,
+                     "output_desc_real_dim_cnt:" + std::to_string(i), &real_dim_cnt);
       }
     }
   }
@@ -203,9 +203,7 @@ GraphUtils::RemoveNodeWithoutRelink(const ComputeGraphPtr &compute_graph, const
   // If the node save as output node, delete it
   (void)compute_graph->RemoveOutputNode(node);
 
-  auto iter = find(compute_graph->nodes_.begin(), compute_graph->nodes_.end(), node);
-  if (iter != compute_graph->nodes_.end()) {
-    compute_graph->nodes_.erase(iter);
+  if (compute_graph->EraseNodeFromList(node)) {
     return GRAPH_SUCCESS;
   }
   return GRAPH_FAILED;
@@ -313,9 +311,7 @@ GE_FUNC_DEV_VISIBILITY GE_FUNC_HOST_VISIBILITY graphStatus GraphUtils::RemoveJus
     GELOGE(GRAPH_FAILED, "The node ptr should be not null.");
     return GRAPH_FAILED;
   }
-  auto iter = find(compute_graph.nodes_.begin(), compute_graph.nodes_.end(), node);
-  if (iter != compute_graph.nodes_.end()) {
-    compute_graph.nodes_.erase(iter);
+  if (compute_graph.EraseNodeFromList(node)) {
     return GRAPH_SUCCESS;
   }
   return GRAPH_FAILED;
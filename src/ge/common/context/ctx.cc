@@ -18,8 +18,18 @@
 
 using ge::OmgContext;
 namespace domi {
+namespace {
+thread_local OmgContext *thread_context = nullptr;
+}  // namespace
+
 FMK_FUNC_HOST_VISIBILITY FMK_FUNC_DEV_VISIBILITY OmgContext &GetContext() {
   static OmgContext context;
-  return context;
+  return (thread_context != nullptr) ? *thread_context : context;
+}
+
+FMK_FUNC_HOST_VISIBILITY FMK_FUNC_DEV_VISIBILITY OmgContext *SetThreadContext(OmgContext *context) {
+  OmgContext *prev_context = thread_context;
+  thread_context = context;
+  return prev_context;
 }
 }  // namespace domi
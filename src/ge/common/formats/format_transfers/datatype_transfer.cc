@@ -64,32 +64,45 @@ std::map<std::pair<DataType, DataType>, DataTypeTransMode> trans_mode_map{
 
 template <typename SrcT, typename DstT>
 Status TransDataSrc2Dst(const CastArgs &args, uint8_t *dst, const size_t data_size) {
-  SrcT src_data;
+  // Hoisted typed pointers keep the loop body a plain element cast the compiler can vectorize
+  const SrcT *src_data = reinterpret_cast<const SrcT *>(args.data);
+  DstT *dst_data = reinterpret_cast<DstT *>(dst);
   for (size_t idx = 0; idx != data_size; idx++) {
-    src_data = reinterpret_cast<const SrcT *>(args.data)[idx];
-    reinterpret_cast<DstT *>(dst)[idx] = static_cast<DstT>(src_data);
+    dst_data[idx] = static_cast<DstT>(src_data[idx]);
   }
   return SUCCESS;
 }
 
 template <typename SrcT>
 Status TransDataSrc2Fp16(const CastArgs &args, uint8_t *dst, const size_t data_size) {
-  fp16_t src_data;
+  const SrcT *src_data = reinterpret_cast<const SrcT *>(args.data);
+  uint16_t *dst_data = reinterpret_cast<uint16_t *>(dst);
+  fp16_t fp16_data;
   for (size_t idx = 0; idx != data_size; idx++) {
-    src_data = reinterpret_cast<const SrcT *>(args.data)[idx];
-    reinterpret_cast<uint16_t *>(dst)[idx] = src_data.val;
+    fp16_data = src_data[idx];
+    dst_data[idx] = fp16_data.val;
   }
   return SUCCESS;
 }
 
+Status TransDataFloat2Fp16(const CastArgs &args, uint8_t *dst, const size_t data_size) {
+  FloatToFp16Array(reinterpret_cast<const float *>(args.data), reinterpret_cast<uint16_t *>(dst), data_size);
+  return SUCCESS;
+}
+
+Status TransDataFp162Float(const CastArgs &args, uint8_t *dst, const size_t data_size) {
+  Fp16ToFloatArray(reinterpret_cast<const uint16_t *>(args.data), reinterpret_cast<float *>(dst), data_size);
+  return SUCCESS;
+}
+
 Status CastKernel(const CastArgs &args, uint8_t *dst, const size_t data_size, const DataTypeTransMode trans_mode) {
   switch (trans_mode) {
     case kTransferWithDatatypeFloatToFloat16:
-      return TransDataSrc2Fp16<float>(args, dst, data_size);
+      return TransDataFloat2Fp16(args, dst, data_size);
     case kTransferWithDatatypeFloatToInt32:
       return TransDataSrc2Dst<float, int32_t>(args, dst, data_size);
     case kTransferWithDatatypeFloat16ToFloat:
-      return TransDataSrc2Dst<fp16_t, float>(args, dst, data_size);
+      return TransDataFp162Float(args, dst, data_size);
     case kTransferWithDatatypeFloat16ToInt32:
       return TransDataSrc2Dst<fp16_t, int32_t>(args, dst, data_size);
     case kTransferWithDatatypeInt32ToFloat:
@@ -153,7 +166,13 @@ Status DataTypeTransfer::TransDataType(const CastArgs &args, TransResult &result
     return OUT_OF_MEMORY;
   }
 
-  if (CastKernel(args, dst.get(), args.src_data_size, trans_mode) != SUCCESS) {
+  int src_size = GetSizeByDataType(args.src_data_type);
+  auto cast_chunk = [&](int64_t begin, int64_t end) -> Status {
+    CastArgs chunk_args = args;
+    chunk_args.data = args.data + begin * src_size;
+    return CastKernel(chunk_args, dst.get() + begin * size, static_cast<size_t>(end - begin), trans_mode);
+  };
+  if (ParallelFor(static_cast<int64_t>(args.src_data_size), src_size + size, cast_chunk) != SUCCESS) {
     GELOGE(INTERNAL_ERROR, "Failed to cast data from %s to %s, data size %zu",
            TypeUtils::DataTypeToSerialString(args.src_data_type).c_str(),
            TypeUtils::DataTypeToSerialString(args.dst_data_type).c_str(), args.src_data_size);
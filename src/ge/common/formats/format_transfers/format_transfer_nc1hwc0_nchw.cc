@@ -17,6 +17,7 @@
 #include "common/formats/format_transfers/format_transfer_nc1hwc0_nchw.h"
 
 #include <securec.h>
+#include <algorithm>
 #include <memory>
 
 #include "common/formats/utils/formats_definitions.h"
@@ -27,6 +28,8 @@
 namespace ge {
 namespace formats {
 namespace {
+const int64_t kHwTileSize = 512;
+
 bool CheckDataTypeSupported(const DataType &data_type) { return GetSizeByDataType(data_type) > 0; }
 
 Status CheckArgsForNc1hwc0ToNchw(const TransArgs &args) {
@@ -84,38 +87,32 @@ Status GetDstDataAfterTrans(const TransArgs &args, TransResult &result, const in
   auto c = args.dst_shape.at(kNchwC);
   int64_t hw = h * w;
   int64_t chw = c * hw;
-  int64_t wc0 = w * c0;
-  int64_t hwc0 = h * wc0;
+  int64_t hwc0 = hw * c0;
   int64_t c1hwc0 = c1 * hwc0;
 
-  for (int64_t n_idx = 0; n_idx < n; n_idx++) {
-    int64_t n_head_addr = n_idx * chw;
-    for (int64_t c_idx = 0; c_idx < c; c_idx++) {
-      int64_t c_head_addr = n_head_addr + c_idx * hw;
-      for (int64_t h_idx = 0; h_idx < h; h_idx++) {
-        int64_t h_head_addr = c_head_addr + h_idx * w;
-        for (int64_t w_idx = 0; w_idx < w; w_idx++) {
-          int64_t dst_idx = h_head_addr + w_idx;
-          int64_t c1_idx = c_idx / c0;
-          int64_t c0_idx = c_idx % c0;
-          int64_t src_idx = n_idx * c1hwc0 + c1_idx * hwc0 + h_idx * wc0 + w_idx * c0 + c0_idx;
-          auto src_offset = src_idx * size;
-          auto dst_offset = dst_idx * size;
-          auto protected_size = total_size - dst_offset < static_cast<int64_t>(SECUREC_MEM_MAX_LEN)
-                                    ? total_size - dst_offset
-                                    : static_cast<int64_t>(SECUREC_MEM_MAX_LEN);
-          auto ret = memcpy_s(dst.get() + dst_offset, static_cast<size_t>(protected_size), args.data + src_offset,
-                              static_cast<size_t>(size));
-          if (ret != EOK) {
-            GELOGE(INTERNAL_ERROR,
-                   "Failed to copy data from NC1HWC0[%ld, %ld, %ld, %ld, %ld] offset %ld to NCHW[%ld, %ld, %ld, %ld]"
-                   " offset %ld, err-code %d",
-                   n_idx, c1_idx, h_idx, w_idx, c0_idx, src_offset, n_idx, c_idx, h_idx, w_idx, dst_offset, ret);
-            return INTERNAL_ERROR;
-          }
+  // Every (n, c1) block of src holds the H*W planes of up to c0 channels, each plane is contiguous in dst
+  // and is gathered from its c0 lane of the block.
+  auto trans_blocks = [&](int64_t begin, int64_t end) -> Status {
+    for (int64_t block_idx = begin; block_idx < end; block_idx++) {
+      int64_t n_idx = block_idx / c1;
+      int64_t c1_idx = block_idx % c1;
+      int64_t c0_num = std::min(c0, c - c1_idx * c0);
+      int64_t src_offset = (n_idx * c1hwc0 + c1_idx * hwc0) * size;
+      // Walk the block in tiles so that the c0 lanes of a tile are read while it is still in cache
+      for (int64_t hw_idx = 0; hw_idx < hw; hw_idx += kHwTileSize) {
+        int64_t hw_num = std::min(kHwTileSize, hw - hw_idx);
+        for (int64_t c0_idx = 0; c0_idx < c0_num; c0_idx++) {
+          int64_t dst_offset = (n_idx * chw + (c1_idx * c0 + c0_idx) * hw + hw_idx) * size;
+          CopyStrided(args.data + src_offset + (hw_idx * c0 + c0_idx) * size, c0, dst.get() + dst_offset, 1, hw_num,
+                      size);
         }
       }
     }
+    return SUCCESS;
+  };
+  auto ret = ParallelFor(n * c1, hwc0 * size, trans_blocks);
+  if (ret != SUCCESS) {
+    return ret;
   }
   result.data = dst;
   result.length = static_cast<size_t>(total_size);
@@ -17,6 +17,7 @@
 #include "common/formats/format_transfers/format_transfer_nc1hwc0_nhwc.h"
 
 #include <securec.h>
+#include <algorithm>
 #include <memory>
 
 #include "common/formats/utils/formats_definitions.h"
@@ -82,40 +83,34 @@ Status GetDstDataAfterTrans(const TransArgs &args, TransResult &result, const in
   auto c1 = args.src_shape.at(kNc1hwc0C1);
   auto c0 = args.src_shape.at(kNc1hwc0C0);
   auto c = args.dst_shape.at(kNhwcC);
-  int64_t wc = w * c;
-  int64_t hwc = h * wc;
-  int64_t wc0 = w * c0;
-  int64_t hwc0 = h * wc0;
+  int64_t hw = h * w;
+  int64_t hwc = hw * c;
+  int64_t hwc0 = hw * c0;
   int64_t c1hwc0 = c1 * hwc0;
 
-  for (int64_t n_idx = 0; n_idx < n; n_idx++) {
-    int64_t n_head_addr = n_idx * hwc;
-    for (int64_t h_idx = 0; h_idx < h; h_idx++) {
-      int64_t h_head_addr = n_head_addr + h_idx * wc;
-      for (int64_t w_idx = 0; w_idx < w; w_idx++) {
-        int64_t w_head_addr = h_head_addr + w_idx * c;
-        for (int64_t c_idx = 0; c_idx < c; c_idx++) {
-          int64_t dst_idx = w_head_addr + c_idx;
-          int64_t c1_idx = c_idx / c0;
-          int64_t c0_idx = c_idx % c0;
-          int64_t src_idx = n_idx * c1hwc0 + c1_idx * hwc0 + h_idx * wc0 + w_idx * c0 + c0_idx;
-          auto src_offset = src_idx * size;
-          auto dst_offset = dst_idx * size;
-          auto protected_size = total_size - dst_offset < static_cast<int64_t>(SECUREC_MEM_MAX_LEN)
-                                    ? total_size - dst_offset
-                                    : static_cast<int64_t>(SECUREC_MEM_MAX_LEN);
-          auto ret = memcpy_s(dst.get() + dst_offset, static_cast<size_t>(protected_size), args.data + src_offset,
-                              static_cast<size_t>(size));
-          if (ret != EOK) {
-            GELOGE(INTERNAL_ERROR,
-                   "Failed to copy data from NC1HWC0[%ld, %ld, %ld, %ld, %ld] offset %ld to NHWC[%ld, %ld, %ld, %ld]"
-                   " offset %ld, err-code %d",
-                   n_idx, c1_idx, h_idx, w_idx, c0_idx, src_offset, n_idx, c_idx, h_idx, w_idx, dst_offset, ret);
-            return INTERNAL_ERROR;
-          }
+  // Every (n, h, w) owns the contiguous C run of dst, gathered from one c0 run of each c1 block
+  auto trans_pixels = [&](int64_t begin, int64_t end) -> Status {
+    for (int64_t pixel_idx = begin; pixel_idx < end; pixel_idx++) {
+      int64_t n_idx = pixel_idx / hw;
+      int64_t hw_idx = pixel_idx % hw;
+      uint8_t *dst_run = dst.get() + (n_idx * hwc + hw_idx * c) * size;
+      const uint8_t *src = args.data + (n_idx * c1hwc0 + hw_idx * c0) * size;
+      for (int64_t c1_idx = 0; c1_idx < c1; c1_idx++) {
+        auto copy_size = static_cast<size_t>(std::min(c0, c - c1_idx * c0) * size);
+        auto ret = memcpy_s(dst_run + c1_idx * c0 * size, copy_size, src + c1_idx * hwc0 * size, copy_size);
+        if (ret != EOK) {
+          GELOGE(INTERNAL_ERROR,
+                 "Failed to copy data from NC1HWC0[%ld, %ld, %ld] to NHWC[%ld, %ld, %ld] size %zu, err-code %d", n_idx,
+                 c1_idx, hw_idx, n_idx, hw_idx, c1_idx * c0, copy_size, ret);
+          return INTERNAL_ERROR;
         }
       }
     }
+    return SUCCESS;
+  };
+  auto ret = ParallelFor(n * hw, c * size, trans_pixels);
+  if (ret != SUCCESS) {
+    return ret;
   }
   result.data = dst;
   result.length = static_cast<size_t>(total_size);
@@ -17,6 +17,7 @@
 #include "common/formats/format_transfers/format_transfer_nchw_nc1hwc0.h"
 
 #include <securec.h>
+#include <algorithm>
 #include <memory>
 
 #include "common/formats/utils/formats_definitions.h"
@@ -27,6 +28,8 @@
 namespace ge {
 namespace formats {
 namespace {
+const int64_t kHwTileSize = 512;
+
 Status TransShapeNchwToNc1hwc0(const std::vector<int64_t> &src_shape, DataType data_type,
                                std::vector<int64_t> &dst_shape) {
   int64_t c0 = GetCubeSizeByDataType(data_type);
@@ -118,51 +121,42 @@ Status FormatTransferNchwNc1hwc0::TransFormat(const TransArgs &args, TransResult
   int64_t chw = c * hw;
   int64_t hwc0 = hw * c0;
   int64_t c1hwc0 = c1 * hwc0;
-  int64_t wc0 = w * c0;
-
-  for (int64_t n_idx = 0; n_idx < n; n_idx++) {
-    int64_t n_head_addr = n_idx * c1hwc0;
-    for (int64_t c1_idx = 0; c1_idx < c1; c1_idx++) {
-      int64_t c1_head_addr = n_head_addr + c1_idx * hwc0;
-      for (int64_t h_idx = 0; h_idx < h; h_idx++) {
-        int64_t h_head_addr = c1_head_addr + h_idx * wc0;
-        for (int64_t w_idx = 0; w_idx < w; w_idx++) {
-          int64_t w_head_addr = h_head_addr + w_idx * c0;
-          for (int64_t c0_idx = 0; c0_idx < c0; c0_idx++) {
-            int64_t dst_index = c0_idx + w_head_addr;
-            int64_t dst_offset = dst_index * size;
-            auto protected_size = total_size - dst_offset < static_cast<int64_t>(SECUREC_MEM_MAX_LEN)
-                                      ? total_size - dst_offset
-                                      : static_cast<int64_t>(SECUREC_MEM_MAX_LEN);
-            int64_t cIdx = c0_idx + c1_idx * c0;
-            int64_t srcIdx = n_idx * chw + cIdx * hw + h_idx * w + w_idx;
-            auto src_offset = srcIdx * size;
 
-            if (cIdx < c) {
-              auto ret = memcpy_s(dst.get() + dst_offset, static_cast<size_t>(protected_size), args.data + src_offset,
-                                  static_cast<size_t>(size));
-              if (ret != EOK) {
-                GELOGE(INTERNAL_ERROR,
-                       "Failed to copy data from NCHW[%ld] offset %ld to "
-                       "NC1HWC0[%ld, %ld, %ld, %ld, %ld] offset %ld, err-code %d",
-                       srcIdx, src_offset, n_idx, c1_idx, h_idx, w_idx, c0_idx, dst_offset, ret);
-                return INTERNAL_ERROR;
-              }
-            } else {
-              auto ret =
-                  memset_s(dst.get() + dst_offset, static_cast<size_t>(protected_size), 0, static_cast<size_t>(size));
-              if (ret != EOK) {
-                GELOGE(INTERNAL_ERROR,
-                       "Failed to set to 0 to "
-                       "NC1HWC0[%ld, %ld, %ld, %ld, %ld] offset %ld, err-code %d",
-                       n_idx, c1_idx, h_idx, w_idx, c0_idx, dst_offset, ret);
-                return INTERNAL_ERROR;
-              }
-            }
-          }
+  // Every (n, c1) owns one contiguous HWC0 block of dst, the H*W plane of each channel is contiguous in src
+  // and is scattered into its c0 lane of the block.
+  auto trans_blocks = [&](int64_t begin, int64_t end) -> Status {
+    for (int64_t block_idx = begin; block_idx < end; block_idx++) {
+      int64_t n_idx = block_idx / c1;
+      int64_t c1_idx = block_idx % c1;
+      int64_t dst_offset = (n_idx * c1hwc0 + c1_idx * hwc0) * size;
+      int64_t c0_num = std::min(c0, c - c1_idx * c0);
+      if (c0_num < c0) {
+        auto protected_size = total_size - dst_offset < static_cast<int64_t>(SECUREC_MEM_MAX_LEN)
+                                  ? total_size - dst_offset
+                                  : static_cast<int64_t>(SECUREC_MEM_MAX_LEN);
+        auto ret = memset_s(dst.get() + dst_offset, static_cast<size_t>(protected_size), 0,
+                            static_cast<size_t>(hwc0 * size));
+        if (ret != EOK) {
+          GELOGE(INTERNAL_ERROR, "Failed to set to 0 to NC1HWC0[%ld, %ld] offset %ld, err-code %d", n_idx, c1_idx,
+                 dst_offset, ret);
+          return INTERNAL_ERROR;
+        }
+      }
+      // Walk the block in tiles so that the c0 lanes of a tile are filled while it is still in cache
+      for (int64_t hw_idx = 0; hw_idx < hw; hw_idx += kHwTileSize) {
+        int64_t hw_num = std::min(kHwTileSize, hw - hw_idx);
+        for (int64_t c0_idx = 0; c0_idx < c0_num; c0_idx++) {
+          int64_t src_offset = (n_idx * chw + (c1_idx * c0 + c0_idx) * hw + hw_idx) * size;
+          CopyStrided(args.data + src_offset, 1, dst.get() + dst_offset + (hw_idx * c0 + c0_idx) * size, c0, hw_num,
+                      size);
         }
       }
     }
+    return SUCCESS;
+  };
+  auto ret = ParallelFor(n * c1, hwc0 * size, trans_blocks);
+  if (ret != SUCCESS) {
+    return ret;
   }
 
   result.data = dst;
@@ -17,6 +17,7 @@
 #include "common/formats/format_transfers/format_transfer_nhwc_nc1hwc0.h"
 
 #include <securec.h>
+#include <algorithm>
 #include <memory>
 
 #include "common/formats/utils/formats_definitions.h"
@@ -101,52 +102,45 @@ Status GetDstDataAfterTrans(const TransArgs &args, TransResult &result, const in
   auto c = args.src_shape.at(kNhwcC);
   auto c1 = args.dst_shape.at(kNc1hwc0C1);
   auto c0 = args.dst_shape.at(kNc1hwc0C0);
-  int64_t wc = w * c;
-  int64_t hwc = h * wc;
-  int64_t wc0 = w * c0;
-  int64_t hwc0 = h * wc0;
+  int64_t hw = h * w;
+  int64_t hwc = hw * c;
+  int64_t hwc0 = hw * c0;
   int64_t c1hwc0 = c1 * hwc0;
 
-  for (int64_t n_idx = 0; n_idx < n; n_idx++) {
-    int64_t n_head_addr = n_idx * c1hwc0;
-    for (int64_t c1_idx = 0; c1_idx < c1; c1_idx++) {
-      int64_t c1_head_addr = n_head_addr + c1_idx * hwc0;
-      for (int64_t h_idx = 0; h_idx < h; h_idx++) {
-        int64_t h_head_addr = c1_head_addr + h_idx * wc0;
-        for (int64_t w_idx = 0; w_idx < w; w_idx++) {
-          int64_t w_head_addr = h_head_addr + w_idx * c0;
-          for (int64_t c0_idx = 0; c0_idx < c0; c0_idx++) {
-            int64_t dst_idx = c0_idx + w_head_addr;
-            int64_t dst_offset = dst_idx * size;
-            auto protected_size = total_size - dst_offset < static_cast<int64_t>(SECUREC_MEM_MAX_LEN)
-                                      ? total_size - dst_offset
-                                      : static_cast<int64_t>(SECUREC_MEM_MAX_LEN);
-            int64_t c_idx = c0_idx + c1_idx * c0;
-            int64_t src_idx = n_idx * hwc + h_idx * wc + w_idx * c + c_idx;
-            auto src_offset = src_idx * size;
-
-            if (c_idx < c) {
-              auto ret = memcpy_s(dst.get() + dst_offset, protected_size, args.data + src_offset, size);
-              if (ret != EOK) {
-                GELOGE(INTERNAL_ERROR,
-                       "Failed to copy data from NHWC[%ld, %ld, %ld, %ld] offset %ld to "
-                       "NC1HWC0[%ld, %ld, %ld, %ld, %ld] offset %ld err-code %d",
-                       n_idx, h_idx, w_idx, c_idx, src_offset, n_idx, c1_idx, h_idx, w_idx, c0_idx, dst_offset, ret);
-                return INTERNAL_ERROR;
-              }
-            } else {
-              auto ret = memset_s(dst.get() + dst_offset, protected_size, 0, size);
-              if (ret != EOK) {
-                GELOGE(INTERNAL_ERROR,
-                       "Failed to set 0 to NC1HWC0[%ld, %ld, %ld, %ld, %ld] offset %ld base err-code %d", n_idx, c1_idx,
-                       h_idx, w_idx, c0_idx, dst_offset, ret);
-                return INTERNAL_ERROR;
-              }
-            }
+  // Every (n, c1) owns one contiguous HWC0 block of dst, each of its c0 lanes is a contiguous run of src channels
+  auto trans_blocks = [&](int64_t begin, int64_t end) -> Status {
+    for (int64_t block_idx = begin; block_idx < end; block_idx++) {
+      int64_t n_idx = block_idx / c1;
+      int64_t c1_idx = block_idx % c1;
+      int64_t c0_num = std::min(c0, c - c1_idx * c0);
+      auto copy_size = static_cast<size_t>(c0_num * size);
+      auto pad_size = static_cast<size_t>((c0 - c0_num) * size);
+      const uint8_t *src = args.data + (n_idx * hwc + c1_idx * c0) * size;
+      uint8_t *dst_block = dst.get() + (n_idx * c1hwc0 + c1_idx * hwc0) * size;
+      for (int64_t hw_idx = 0; hw_idx < hw; hw_idx++) {
+        uint8_t *dst_run = dst_block + hw_idx * c0 * size;
+        auto ret = memcpy_s(dst_run, copy_size, src + hw_idx * c * size, copy_size);
+        if (ret != EOK) {
+          GELOGE(INTERNAL_ERROR,
+                 "Failed to copy data from NHWC[%ld, %ld, %ld] to NC1HWC0[%ld, %ld, %ld] size %zu, err-code %d", n_idx,
+                 hw_idx, c1_idx * c0, n_idx, c1_idx, hw_idx, copy_size, ret);
+          return INTERNAL_ERROR;
+        }
+        if (pad_size > 0) {
+          ret = memset_s(dst_run + copy_size, pad_size, 0, pad_size);
+          if (ret != EOK) {
+            GELOGE(INTERNAL_ERROR, "Failed to set 0 to NC1HWC0[%ld, %ld, %ld] size %zu, err-code %d", n_idx, c1_idx,
+                   hw_idx, pad_size, ret);
+            return INTERNAL_ERROR;
           }
         }
       }
     }
+    return SUCCESS;
+  };
+  auto ret = ParallelFor(n * c1, hwc0 * size, trans_blocks);
+  if (ret != SUCCESS) {
+    return ret;
   }
   result.data = dst;
   result.length = static_cast<size_t>(total_size);
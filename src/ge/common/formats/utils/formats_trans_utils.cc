@@ -16,15 +16,41 @@
 
 #include "common/formats/utils/formats_trans_utils.h"
 
+#include <securec.h>
+#include <algorithm>
 #include <cstdint>
+#include <thread>
 
 #include "common/formats/utils/formats_definitions.h"
+#include "common/task_executor.h"
 #include "framework/common/debug/ge_log.h"
 #include "framework/common/ge_inner_error_codes.h"
 #include "graph/utils/type_utils.h"
 
 namespace ge {
 namespace formats {
+namespace {
+const int64_t kParallelMinBytes = 1024 * 1024;
+const uint32_t kMaxTransThreadNum = 8;
+
+uint32_t GetTransThreadNum() {
+  uint32_t thread_num = std::thread::hardware_concurrency();
+  if (thread_num == 0) {
+    return 1;
+  }
+  return std::min(thread_num, kMaxTransThreadNum);
+}
+
+template <typename T>
+void CopyStridedByType(const uint8_t *src, int64_t src_stride, uint8_t *dst, int64_t dst_stride, int64_t num) {
+  auto src_data = reinterpret_cast<const T *>(src);
+  auto dst_data = reinterpret_cast<T *>(dst);
+  for (int64_t idx = 0; idx < num; idx++) {
+    dst_data[idx * dst_stride] = src_data[idx * src_stride];
+  }
+}
+}  // namespace
+
 int64_t GetCubeSizeByDataType(DataType data_type) {
   // Current cube does not support 4 bytes and longer data
   auto size = GetSizeByDataType(data_type);
@@ -82,6 +108,54 @@ bool IsShapeValid(const std::vector<int64_t> &shape) {
   return true;
 }
 
+Status ParallelFor(int64_t num, int64_t item_bytes, const std::function<Status(int64_t, int64_t)> &func) {
+  if (num <= 0) {
+    return SUCCESS;
+  }
+  // Each chunk should move at least kParallelMinBytes, otherwise the dispatch costs more than the copy
+  // Items per chunk is computed first so that a large num can not overflow
+  int64_t chunk_num = 0;
+  if (item_bytes >= kParallelMinBytes) {
+    chunk_num = num;
+  } else if (item_bytes > 0) {
+    chunk_num = num / (kParallelMinBytes / item_bytes);
+  }
+  chunk_num = std::min(chunk_num, static_cast<int64_t>(GetTransThreadNum()));
+  if (chunk_num <= 1) {
+    return func(0, num);
+  }
+
+  int64_t chunk_size = Ceil(num, chunk_num);
+  return TaskExecutor::Instance().ParallelFor(
+      0, static_cast<size_t>(num), static_cast<size_t>(chunk_size), [&func](size_t begin, size_t end) -> Status {
+        return func(static_cast<int64_t>(begin), static_cast<int64_t>(end));
+      });
+}
+
+void CopyStrided(const uint8_t *src, int64_t src_stride, uint8_t *dst, int64_t dst_stride, int64_t num,
+                 int64_t elem_size) {
+  switch (elem_size) {
+    case sizeof(uint8_t):
+      CopyStridedByType<uint8_t>(src, src_stride, dst, dst_stride, num);
+      break;
+    case sizeof(uint16_t):
+      CopyStridedByType<uint16_t>(src, src_stride, dst, dst_stride, num);
+      break;
+    case sizeof(uint32_t):
+      CopyStridedByType<uint32_t>(src, src_stride, dst, dst_stride, num);
+      break;
+    case sizeof(uint64_t):
+      CopyStridedByType<uint64_t>(src, src_stride, dst, dst_stride, num);
+      break;
+    default:
+      for (int64_t idx = 0; idx < num; idx++) {
+        (void)memcpy_s(dst + idx * dst_stride * elem_size, static_cast<size_t>(elem_size),
+                       src + idx * src_stride * elem_size, static_cast<size_t>(elem_size));
+      }
+      break;
+  }
+}
+
 bool IsShapeEqual(const GeShape &src, const GeShape &dst) {
   if (src.GetDims().size() != dst.GetDims().size()) {
     return false;
@@ -18,10 +18,12 @@
 #define GE_COMMON_FORMATS_UTILS_FORMATS_TRANS_UTILS_H_
 
 #include <cstdint>
+#include <functional>
 #include <sstream>
 #include <string>
 #include <vector>
 
+#include "external/ge/ge_api_error_codes.h"
 #include "external/graph/types.h"
 #include "graph/ge_tensor.h"
 
@@ -67,6 +69,23 @@ T Ceil(T n1, T n2) {
   return (n2 != 0) ? (n1 - 1) / n2 + 1 : 0;
 }
 
+/**
+ * Split [0, num) into contiguous chunks and run them on the format transfer thread pool,
+ * the calling thread runs the first chunk. Transfers smaller than 1MB run on the calling thread only.
+ * @param num item count of the outer dimension to split
+ * @param item_bytes bytes written per item, decides how many chunks are worth dispatching
+ * @param func called with [begin, end), chunks must write disjoint parts of the dst buffer
+ * @return the first failed status of the chunks, SUCCESS if all succeeded
+ */
+Status ParallelFor(int64_t num, int64_t item_bytes, const std::function<Status(int64_t, int64_t)> &func);
+
+/**
+ * Copy num elements of elem_size bytes, the i-th element goes from src[i * src_stride] to dst[i * dst_stride].
+ * Strides are counted in elements, 1/2/4/8 bytes elements are moved as scalars instead of memcpy_s calls.
+ */
+void CopyStrided(const uint8_t *src, int64_t src_stride, uint8_t *dst, int64_t dst_stride, int64_t num,
+                 int64_t elem_size);
+
 }  // namespace formats
 }  // namespace ge
 #endif  // GE_COMMON_FORMATS_UTILS_FORMATS_TRANS_UTILS_H_
@@ -16,6 +16,13 @@
 
 #include "common/fp16_t.h"
 
+#include <vector>
+
+#if defined(__x86_64__) && defined(__GNUC__)
+#include <immintrin.h>
+#define FP16_F16C_SUPPORTED
+#endif
+
 #include "external/register/register_types.h"
 
 namespace {
@@ -23,6 +30,20 @@ const int32_t kInt32SymbolShift = 31;
 const int32_t kBitShift_32 = 32;
 const int32_t kDim_2 = 2;
 const int32_t kDim_11 = 11;
+const size_t kFp16ValueNum = 65536;
+// fp32 bits of 65520, the midpoint between FP16_MAX and 2^16, it and all above round out of fp16 range
+const uint32_t kFp32Fp16OverflowBits = 0x477FF000u;
+// fp32 bits of 2^-14, the smallest normal fp16
+const uint32_t kFp32Fp16MinNormalBits = 0x38800000u;
+// fp32 exponent 127 - 15, rebias of a normal value
+const uint32_t kFp32Fp16ExpRebias = 0x38000000u;
+// fp32 exponent of 2^-25, half of the smallest denormal fp16, anything below rounds to zero
+const uint32_t kFp32Fp16MinExp = 102;
+// fp16 denormal mantissa is fp32 mantissa with hide bit shifted by this minus the fp32 exponent
+const uint32_t kFp32Fp16DenormalShift = 126;
+// fp32 exponent fp16 inf and nan convert to, 31 - 15 + 127
+const uint32_t kFp16InvalidFp32Exp = 143;
+const size_t kF16cBatch = 8;
 }  // namespace
 
 namespace ge {
@@ -101,7 +122,13 @@ fp16_t &fp16_t::operator=(const fp16_t &fp) {
   return *this;
 }
 
-fp16_t &fp16_t::operator=(const float &f_val) {
+///
+/// @ingroup fp16_t math conversion static method
+/// @param [in] f_val float/fp32 value
+/// @brief   Convert float/fp32 to fp16_t bit by bit
+/// @return  Return uint16_t value of fp16_t object
+///
+uint16_t FloatToFp16(const float &f_val) {
   uint16_t s_ret, m_ret;
   int16_t e_ret;
   uint32_t e_f, m_f;
@@ -148,8 +175,7 @@ fp16_t &fp16_t::operator=(const float &f_val) {
   }
 
   Fp16Normalize(e_ret, m_ret);
-  val = FP16_CONSTRUCTOR(s_ret, static_cast<uint16_t>(e_ret), m_ret);
-  return *this;
+  return static_cast<uint16_t>(FP16_CONSTRUCTOR(s_ret, static_cast<uint16_t>(e_ret), m_ret));
 }
 
 fp16_t &fp16_t::operator=(const int32_t &i_val) {
@@ -298,12 +324,147 @@ int32_t Fp16ToInt32(const uint16_t &fp_val) {
   return ret;
 }
 
-FMK_FUNC_HOST_VISIBILITY FMK_FUNC_DEV_VISIBILITY float fp16_t::toFloat() const { return Fp16ToFloat(val); }
+///
+/// @ingroup fp16_t math conversion static method
+/// @brief   Results of Fp16ToFloat for all fp16_t values, built on first use
+/// @return  Return table indexed by the uint16_t value of fp16_t object
+///
+static const float *GetFp16ToFloatTable() {
+  static const std::vector<float> table = []() {
+    std::vector<float> values(kFp16ValueNum);
+    for (size_t i = 0; i < kFp16ValueNum; ++i) {
+      values[i] = Fp16ToFloat(static_cast<uint16_t>(i));
+    }
+    return values;
+  }();
+  return table.data();
+}
+
+///
+/// @ingroup fp16_t math conversion static method
+/// @param [in] f_bits bits of a float/fp32 value
+/// @brief   Branch light version of the float evaluation of fp16_t, same rounding and saturation
+/// @return  Return uint16_t value of fp16_t object
+///
+static uint16_t FloatBitsToFp16(uint32_t f_bits) {
+  uint16_t s_ret = static_cast<uint16_t>((f_bits & FP32_SIGN_MASK) >> (FP32_SIGN_INDEX - FP16_SIGN_INDEX));
+  uint32_t abs_bits = f_bits & FP32_ABS_MAX;
+  if (abs_bits >= kFp32Fp16OverflowBits) {
+    return static_cast<uint16_t>(s_ret | FP16_MAX);
+  }
+  uint32_t m_len_delta = FP32_MAN_LEN - FP16_MAN_LEN;
+  if (abs_bits >= kFp32Fp16MinNormalBits) {
+    // Round to nearest even, a carry out of the mantissa goes on into the exponent
+    uint32_t rebias_bits = abs_bits - kFp32Fp16ExpRebias;
+    uint32_t round_bits = ((1u << (m_len_delta - 1)) - 1) + ((rebias_bits >> m_len_delta) & 1u);
+    return static_cast<uint16_t>(s_ret | ((rebias_bits + round_bits) >> m_len_delta));
+  }
+  uint32_t e_f = abs_bits >> FP32_MAN_LEN;
+  if (e_f < kFp32Fp16MinExp) {
+    return s_ret;
+  }
+  // Denormal, rounding up the largest one gives the smallest normal
+  uint32_t m_f = (abs_bits & FP32_MAN_MASK) | FP32_MAN_HIDE_BIT;
+  uint32_t shift_out = kFp32Fp16DenormalShift - e_f;
+  uint32_t half = 1u << (shift_out - 1);
+  uint32_t trunc = m_f & ((1u << shift_out) - 1);
+  uint32_t m_ret = m_f >> shift_out;
+  if ((trunc > half) || ((trunc == half) && ((m_ret & 1u) != 0))) {
+    m_ret++;
+  }
+  return static_cast<uint16_t>(s_ret | m_ret);
+}
+
+fp16_t &fp16_t::operator=(const float &f_val) {
+  val = FloatBitsToFp16(*(reinterpret_cast<const uint32_t *>(&f_val)));
+  return *this;
+}
+
+#ifdef FP16_F16C_SUPPORTED
+static bool IsF16cSupported() {
+  static const bool supported = (__builtin_cpu_supports("f16c") != 0) && (__builtin_cpu_supports("avx2") != 0);
+  return supported;
+}
+
+///
+/// @ingroup fp16_t math conversion static method
+/// @brief   Convert whole batches of 8 with F16C, fp16 inf and nan are patched to what Fp16ToFloat returns
+/// @return  Return number of values converted
+///
+__attribute__((target("avx2,f16c"))) static size_t Fp16ToFloatF16c(const uint16_t *src, float *dst, size_t count) {
+  const __m256i exp_mask = _mm256_set1_epi32(FP16_EXP_MASK);
+  const __m256i sign_mask = _mm256_set1_epi32(1 << FP16_SIGN_INDEX);
+  const __m256i man_mask = _mm256_set1_epi32(FP16_MAN_MASK);
+  const __m256i invalid_exp = _mm256_set1_epi32(static_cast<int>(kFp16InvalidFp32Exp << FP32_MAN_LEN));
+  size_t idx = 0;
+  for (; idx + kF16cBatch <= count; idx += kF16cBatch) {
+    __m128i half = _mm_loadu_si128(reinterpret_cast<const __m128i *>(src + idx));
+    __m256 ret = _mm256_cvtph_ps(half);
+    __m256i half_32 = _mm256_cvtepu16_epi32(half);
+    __m256i is_invalid = _mm256_cmpeq_epi32(_mm256_and_si256(half_32, exp_mask), exp_mask);
+    __m256i invalid_ret = _mm256_or_si256(
+        _mm256_or_si256(_mm256_slli_epi32(_mm256_and_si256(half_32, sign_mask), FP32_SIGN_INDEX - FP16_SIGN_INDEX),
+                        invalid_exp),
+        _mm256_slli_epi32(_mm256_and_si256(half_32, man_mask), FP32_MAN_LEN - FP16_MAN_LEN));
+    ret = _mm256_blendv_ps(ret, _mm256_castsi256_ps(invalid_ret), _mm256_castsi256_ps(is_invalid));
+    _mm256_storeu_ps(dst + idx, ret);
+  }
+  return idx;
+}
+
+///
+/// @ingroup fp16_t math conversion static method
+/// @brief   Convert whole batches of 8 with F16C round to nearest even, inf and nan results saturate to FP16_MAX
+/// @return  Return number of values converted
+///
+__attribute__((target("avx2,f16c"))) static size_t FloatToFp16F16c(const float *src, uint16_t *dst, size_t count) {
+  const __m128i exp_mask = _mm_set1_epi16(static_cast<int16_t>(FP16_EXP_MASK));
+  const __m128i sign_mask = _mm_set1_epi16(static_cast<int16_t>(1u << FP16_SIGN_INDEX));
+  const __m128i max_val = _mm_set1_epi16(static_cast<int16_t>(FP16_MAX));
+  size_t idx = 0;
+  for (; idx + kF16cBatch <= count; idx += kF16cBatch) {
+    __m128i half = _mm256_cvtps_ph(_mm256_loadu_ps(src + idx), _MM_FROUND_TO_NEAREST_INT);
+    __m128i is_invalid = _mm_cmpeq_epi16(_mm_and_si128(half, exp_mask), exp_mask);
+    __m128i saturated = _mm_or_si128(_mm_and_si128(half, sign_mask), max_val);
+    half = _mm_blendv_epi8(half, saturated, is_invalid);
+    _mm_storeu_si128(reinterpret_cast<__m128i *>(dst + idx), half);
+  }
+  return idx;
+}
+#endif
+
+void Fp16ToFloatArray(const uint16_t *src, float *dst, size_t count) {
+  size_t idx = 0;
+#ifdef FP16_F16C_SUPPORTED
+  if (IsF16cSupported()) {
+    idx = Fp16ToFloatF16c(src, dst, count);
+  }
+#endif
+  const float *table = GetFp16ToFloatTable();
+  for (; idx < count; ++idx) {
+    dst[idx] = table[src[idx]];
+  }
+}
+
+void FloatToFp16Array(const float *src, uint16_t *dst, size_t count) {
+  size_t idx = 0;
+#ifdef FP16_F16C_SUPPORTED
+  if (IsF16cSupported()) {
+    idx = FloatToFp16F16c(src, dst, count);
+  }
+#endif
+  const uint32_t *src_bits = reinterpret_cast<const uint32_t *>(src);
+  for (; idx < count; ++idx) {
+    dst[idx] = FloatBitsToFp16(src_bits[idx]);
+  }
+}
+
+FMK_FUNC_HOST_VISIBILITY FMK_FUNC_DEV_VISIBILITY float fp16_t::toFloat() const { return GetFp16ToFloatTable()[val]; }
 
 int32_t fp16_t::toInt32() const { return Fp16ToInt32(val); }
 
 // Convert
-fp16_t::operator float() const { return Fp16ToFloat(val); }
+fp16_t::operator float() const { return GetFp16ToFloatTable()[val]; }
 
 fp16_t::operator int32_t() const { return Fp16ToInt32(val); }
 }  // namespace ge
@@ -18,6 +18,7 @@
 #define GE_COMMON_FP16_T_H_
 
 #include <cmath>
+#include <cstddef>
 #include <cstdint>
 
 #include <algorithm>
@@ -324,6 +325,42 @@ int16_t GetManBitLength(T man) {
   }
   return len;
 }
+
+/**
+ *@ingroup fp16_t math conversion
+ *@param [in] fp_val uint16_t value of fp16_t object
+ *@brief   Convert fp16_t to float/fp32 bit by bit, the reference of the array conversions
+ *@return  Return float/fp32 value of fp_val
+ */
+float Fp16ToFloat(const uint16_t &fp_val);
+
+/**
+ *@ingroup fp16_t math conversion
+ *@param [in] f_val float/fp32 value
+ *@brief   Convert float/fp32 to fp16_t bit by bit, the reference of the float evaluation and the array conversions
+ *@return  Return uint16_t value of fp16_t object
+ */
+uint16_t FloatToFp16(const float &f_val);
+
+/**
+ *@ingroup fp16_t math conversion
+ *@param [in]  src   values of fp16_t objects
+ *@param [out] dst   float/fp32 values
+ *@param [in]  count number of values
+ *@brief   Convert an array of fp16_t to float/fp32, with F16C where the cpu supports it and a lookup table
+ *         otherwise. Results equal fp16_t::toFloat bit for bit, so fp16 inf and nan keep converting to 2^16 values
+ */
+void Fp16ToFloatArray(const uint16_t *src, float *dst, size_t count);
+
+/**
+ *@ingroup fp16_t math conversion
+ *@param [in]  src   float/fp32 values
+ *@param [out] dst   values of fp16_t objects
+ *@param [in]  count number of values
+ *@brief   Convert an array of float/fp32 to fp16_t, with F16C where the cpu supports it. Results equal the fp16_t
+ *         float evaluation bit for bit: round to nearest even, values out of range, inf and nan saturate to FP16_MAX
+ */
+void FloatToFp16Array(const float *src, uint16_t *dst, size_t count);
 };  // namespace ge
 
 #endif  // GE_COMMON_FP16_T_H_
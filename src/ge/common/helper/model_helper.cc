@@ -326,8 +326,13 @@ Status ModelHelper::LoadWeights(OmFileLoadHelper &om_load_helper) {
     GELOGE(FAILED, "Get weight model partition failed.");
     return FAILED;
   }
-  ge::Buffer weight = ge::Buffer::CopyFrom(partition.data, partition.size);
-  model_->SetWeight(weight);
+  if (DavinciModelParser::IsMappedModelData(partition.data)) {
+    // The mapped file outlives the load, weights are paged in when they are copied to device
+    model_->SetWeightDataAddr(partition.data, partition.size);
+  } else {
+    ge::Buffer weight = ge::Buffer::CopyFrom(partition.data, partition.size);
+    model_->SetWeight(weight);
+  }
 
   GELOGI("GetWeight size:%u", partition.size);
   return SUCCESS;
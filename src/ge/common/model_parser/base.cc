@@ -16,10 +16,15 @@
 
 #include "common/model_parser/base.h"
 
+#include <fcntl.h>
 #include <securec.h>
+#include <sys/mman.h>
 #include <sys/sysinfo.h>
+#include <unistd.h>
 #include <fstream>
+#include <map>
 #include <memory>
+#include <mutex>
 #include <string>
 
 #include "framework/common/debug/ge_log.h"
@@ -27,6 +32,12 @@
 #include "framework/common/util.h"
 
 namespace ge {
+namespace {
+std::mutex mapped_models_mutex;
+// Start address to length of every model file mapped by MapFromFile
+std::map<const uint8_t *, size_t> mapped_models;
+}  // namespace
+
 FMK_FUNC_HOST_VISIBILITY FMK_FUNC_DEV_VISIBILITY ModelParserBase::ModelParserBase() {}
 FMK_FUNC_HOST_VISIBILITY FMK_FUNC_DEV_VISIBILITY ModelParserBase::~ModelParserBase() {}
 
@@ -71,6 +82,83 @@ FMK_FUNC_HOST_VISIBILITY FMK_FUNC_DEV_VISIBILITY Status ModelParserBase::LoadFro
   return SUCCESS;
 }
 
+FMK_FUNC_HOST_VISIBILITY FMK_FUNC_DEV_VISIBILITY Status ModelParserBase::MapFromFile(const char *model_path,
+                                                                                     const char *key, int32_t priority,
+                                                                                     ge::ModelData &model_data) {
+  std::string real_path = RealPath(model_path);
+  if (real_path.empty()) {
+    GELOGE(PARAM_INVALID, "Model file path '%s' is invalid", model_path);
+    return PARAM_INVALID;
+  }
+
+  GE_CHK_BOOL_TRUE_EXEC_WITH_LOG(GetFileLength(model_path) == -1, return FAILED, "File size not valid.");
+
+  int fd = open(real_path.c_str(), O_RDONLY);
+  GE_CHK_BOOL_RET_STATUS(fd >= 0, FAILED, "Open file failed! path:%s", model_path);
+
+  off_t len = lseek(fd, 0, SEEK_END);
+  if (len < 1 || static_cast<uint64_t>(len) > UINT32_MAX) {
+    GELOGE(PARAM_INVALID, "Model file %s length %ld is invalid.", model_path, static_cast<int64_t>(len));
+    (void)close(fd);
+    return PARAM_INVALID;
+  }
+
+  // Pages of a private mapping stay shared with the page cache of the file until somebody writes to them
+  void *data = mmap(nullptr, static_cast<size_t>(len), PROT_READ | PROT_WRITE, MAP_PRIVATE, fd, 0);
+  (void)close(fd);
+  if (data == MAP_FAILED) {
+    GELOGE(MEMALLOC_FAILED, "Map model file %s failed, length %ld.", model_path, static_cast<int64_t>(len));
+    return MEMALLOC_FAILED;
+  }
+
+  {
+    std::lock_guard<std::mutex> lock(mapped_models_mutex);
+    mapped_models[static_cast<const uint8_t *>(data)] = static_cast<size_t>(len);
+  }
+
+  model_data.model_data = data;
+  model_data.model_len = static_cast<uint32_t>(len);
+  model_data.priority = priority;
+  model_data.key = (key == nullptr) ? "" : key;
+  GELOGI("Map model file %s, length %ld.", model_path, static_cast<int64_t>(len));
+  return SUCCESS;
+}
+
+FMK_FUNC_HOST_VISIBILITY FMK_FUNC_DEV_VISIBILITY void ModelParserBase::ReleaseModelData(ge::ModelData &model_data) {
+  if (model_data.model_data == nullptr) {
+    return;
+  }
+  size_t mapped_len = 0;
+  {
+    std::lock_guard<std::mutex> lock(mapped_models_mutex);
+    auto iter = mapped_models.find(static_cast<const uint8_t *>(model_data.model_data));
+    if (iter != mapped_models.end()) {
+      mapped_len = iter->second;
+      mapped_models.erase(iter);
+    }
+  }
+  if (mapped_len > 0) {
+    if (munmap(model_data.model_data, mapped_len) != 0) {
+      GELOGW("Unmap model data failed, length %zu.", mapped_len);
+    }
+  } else {
+    delete[] static_cast<char *>(model_data.model_data);
+  }
+  model_data.model_data = nullptr;
+  model_data.model_len = 0;
+}
+
+FMK_FUNC_HOST_VISIBILITY FMK_FUNC_DEV_VISIBILITY bool ModelParserBase::IsMappedModelData(const void *addr) {
+  auto ptr = static_cast<const uint8_t *>(addr);
+  std::lock_guard<std::mutex> lock(mapped_models_mutex);
+  auto iter = mapped_models.upper_bound(ptr);
+  if (iter == mapped_models.begin()) {
+    return false;
+  }
+  --iter;
+  return ptr < iter->first + iter->second;
+}
+
 FMK_FUNC_HOST_VISIBILITY FMK_FUNC_DEV_VISIBILITY Status ModelParserBase::ParseModelContent(const ge::ModelData &model,
                                                                                            uint8_t *&model_data,
                                                                                            uint32_t &model_len) {
@@ -50,6 +50,34 @@ class ModelParserBase {
   static Status LoadFromFile(const char *model_file, const char *model_key, int32_t priority,
                              ge::ModelData &model_data);
 
+  ///
+  /// @ingroup hiai
+  /// @brief Map a model file copy-on-write instead of reading it into a heap buffer.
+  ///        Partitions are paged in on first access and the page cache is shared by every process mapping the file.
+  /// @param [in] model_file  model path
+  /// @param [in] model_key   model secret key
+  /// @param [in] priority    modle priority
+  /// @param [out] model_data model data, must be released by ReleaseModelData
+  /// @return Status  result
+  ///
+  static Status MapFromFile(const char *model_file, const char *model_key, int32_t priority,
+                            ge::ModelData &model_data);
+
+  ///
+  /// @ingroup hiai
+  /// @brief Release model data got from LoadFromFile or MapFromFile
+  /// @param [in|out] model_data model data, reset to empty
+  ///
+  static void ReleaseModelData(ge::ModelData &model_data);
+
+  ///
+  /// @ingroup hiai
+  /// @brief Check whether the address lies in a model file mapped by MapFromFile
+  /// @param [in] addr address to check
+  /// @return true if the address stays valid until the mapping is released
+  ///
+  static bool IsMappedModelData(const void *addr);
+
   ///
   /// @ingroup domi_ome
   /// @brief Parse model contents from the ModelData
@@ -34,6 +34,8 @@ const char *const kConf = "conf";
 const char *const kEvents = "events";
 const char *const kAiCoreEvents = "ai_core_events";
 const char *const kName = "name";
+// Upper bound of one report, the op records are never split between reports
+const size_t kReportMaxLen = 64 * 1024;
 }  // namespace
 
 namespace ge {
@@ -237,6 +239,7 @@ FMK_FUNC_HOST_VISIBILITY FMK_FUNC_DEV_VISIBILITY ge::Status ProfilingManager::St
       GELOGW("ProfMgrStartUp failed.");
       return FAILED;
     }
+    UpdateReportEpoch();
   }
 #endif
   return SUCCESS;
@@ -264,6 +267,7 @@ FMK_FUNC_HOST_VISIBILITY FMK_FUNC_DEV_VISIBILITY void ProfilingManager::StopProf
   }
   is_load_ = false;
   recv_profiling_config_ = "";
+  UpdateReportEpoch();
   GELOGI("Stop Profiling success.");
 #endif
 }
@@ -276,25 +280,39 @@ FMK_FUNC_HOST_VISIBILITY FMK_FUNC_DEV_VISIBILITY void ProfilingManager::ReportPr
     GELOGI("Profiling report is nullptr!");
     return;
   }
+  Msprof::Engine::ReporterData reporter_data{};
+  reporter_data.deviceId = device_id_;
+  int ret = memcpy_s(reporter_data.tag, MSPROF_ENGINE_MAX_TAG_LEN + 1, "framework", sizeof("framework"));
+  if (ret != EOK) {
+    GELOGE(ret, "Report data tag memcpy error!");
+    return;
+  }
+
+  // Records keep the "name task_id;" layout, so one buffer holds any number of them
   std::string data;
-  for (const auto &iter : op_task_id_map) {
-    data = iter.second + ' ' + std::to_string(iter.first) + ';';
-    Msprof::Engine::ReporterData reporter_data{};
-    reporter_data.deviceId = device_id_;
+  data.reserve(kReportMaxLen);
+  size_t report_times = 0;
+  auto iter = op_task_id_map.begin();
+  while (iter != op_task_id_map.end() || !data.empty()) {
+    if (iter != op_task_id_map.end()) {
+      std::string record = iter->second + ' ' + std::to_string(iter->first) + ';';
+      if (data.empty() || (data.size() + record.size() <= kReportMaxLen)) {
+        data += record;
+        ++iter;
+        continue;
+      }
+    }
     reporter_data.data = (unsigned char *)data.c_str();
     reporter_data.dataLen = data.size();
-    int ret = memcpy_s(reporter_data.tag, MSPROF_ENGINE_MAX_TAG_LEN + 1, "framework", sizeof("framework"));
-    if (ret != EOK) {
-      GELOGE(ret, "Report data tag memcpy error!");
-      return;
-    }
     ret = reporter->Report(&reporter_data);
     if (ret != SUCCESS) {
       GELOGE(ret, "Reporter data fail!");
       return;
     }
+    ++report_times;
+    data.clear();
   }
-  GELOGI("Report profiling data for GE end.");
+  GELOGI("Report profiling data for GE end, %zu ops in %zu reports.", op_task_id_map.size(), report_times);
 #endif
 }
 
@@ -314,6 +332,7 @@ PluginImpl::PluginImpl(const std::string &module) : module_(module) { GELOGI("Cr
 int PluginImpl::Init(const Msprof::Engine::Reporter *reporter) {
   GELOGI("PluginImpl init");
   reporter_ = const_cast<Msprof::Engine::Reporter *>(reporter);
+  ProfilingManager::Instance().UpdateReportEpoch();
   return 0;
 }
 
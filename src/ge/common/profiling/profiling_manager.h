@@ -17,6 +17,7 @@
 #ifndef GE_COMMON_PROFILING_PROFILING_MANAGER_H_
 #define GE_COMMON_PROFILING_PROFILING_MANAGER_H_
 
+#include <atomic>
 #include <map>
 #include <string>
 #include <vector>
@@ -46,8 +47,18 @@ class FMK_FUNC_HOST_VISIBILITY FMK_FUNC_DEV_VISIBILITY ProfilingManager {
   bool ProfilingLoadFlag() const { return is_load_; }
   bool ProfilingOn() const { return is_profiling_; }
   int32_t GetOpTraceIterNum() const { return op_trace_iter_num_; }
+  ///
+  /// @brief report the task id to op name relation packed into as few buffers as possible
+  /// @param [in] op_task_id_map task id to op name
+  ///
   void ReportProfilingData(const std::map<uint32_t, std::string> &op_task_id_map);
   void SetProfilingConfig(const string &profiling_cfg);
+  ///
+  /// @brief changes whenever a new profiling session or reporter begins, data reported under an older
+  ///        epoch has to be reported again
+  ///
+  uint64_t GetReportEpoch() const { return report_epoch_; }
+  void UpdateReportEpoch() { ++report_epoch_; }
 
  private:
   bool is_profiling_ = false;
@@ -61,6 +72,7 @@ class FMK_FUNC_HOST_VISIBILITY FMK_FUNC_DEV_VISIBILITY ProfilingManager {
   void *prof_handle = nullptr;
   string recv_profiling_config_;
   string send_profiling_config_;
+  std::atomic<uint64_t> report_epoch_{0};
 };
 
 ///
@@ -0,0 +1,368 @@
+/**
+ * Copyright 2019-2020 Huawei Technologies Co., Ltd
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "common/task_executor.h"
+
+#include <algorithm>
+#include <utility>
+
+#include "framework/common/debug/ge_log.h"
+#include "framework/common/util.h"
+
+namespace ge {
+namespace {
+const uint32_t kMinWorkerNum = 2;
+
+// Executor and deque index of the worker running on this thread
+thread_local TaskExecutor *tls_executor = nullptr;
+thread_local size_t tls_worker_index = 0;
+}  // namespace
+
+TaskExecutor &TaskExecutor::Instance() {
+  static TaskExecutor executor(std::max(std::thread::hardware_concurrency(), kMinWorkerNum));
+  return executor;
+}
+
+TaskExecutor::TaskExecutor(uint32_t worker_num)
+    : next_queue_(0), queued_num_(0), sleeping_num_(0), is_stopped_(false) {
+  worker_num = std::max(worker_num, 1U);
+  for (uint32_t i = 0; i < worker_num; ++i) {
+    queues_.emplace_back(new WorkQueue());
+  }
+  for (uint32_t i = 0; i < worker_num; ++i) {
+    workers_.emplace_back(&TaskExecutor::WorkerFunc, this, i);
+  }
+  GELOGI("Task executor started with %u workers.", worker_num);
+}
+
+TaskExecutor::~TaskExecutor() {
+  is_stopped_.store(true);
+  {
+    std::lock_guard<std::mutex> lock(idle_mutex_);
+    idle_cv_.notify_all();
+  }
+  for (std::thread &worker : workers_) {
+    if (worker.joinable()) {
+      try {
+        worker.join();
+      } catch (const std::system_error &) {
+        GELOGW("system_error");
+      } catch (...) {
+        GELOGW("exception");
+      }
+    }
+  }
+}
+
+Status TaskExecutor::ParallelFor(size_t begin, size_t end, size_t grain,
+                                 const std::function<Status(size_t, size_t)> &func) {
+  if (end <= begin) {
+    return SUCCESS;
+  }
+  size_t num = end - begin;
+  grain = std::max<size_t>(grain, 1);
+  size_t chunk_num = std::min<size_t>((num + grain - 1) / grain, workers_.size() + 1);
+  if (chunk_num <= 1) {
+    return func(begin, end);
+  }
+
+  size_t chunk_size = (num + chunk_num - 1) / chunk_num;
+  TaskGroup group(*this);
+  for (size_t chunk_begin = begin + chunk_size; chunk_begin < end; chunk_begin += chunk_size) {
+    size_t chunk_end = std::min(chunk_begin + chunk_size, end);
+    group.Submit([&func, chunk_begin, chunk_end]() -> Status { return func(chunk_begin, chunk_end); });
+  }
+  Status ret = func(begin, begin + chunk_size);
+  if (ret != SUCCESS) {
+    group.Cancel();
+    (void)group.Wait();
+    return ret;
+  }
+  return group.Wait();
+}
+
+void TaskExecutor::Push(TaskGroup *group, std::function<void()> func) {
+  size_t index = (tls_executor == this) ? tls_worker_index : (next_queue_++ % queues_.size());
+  {
+    std::lock_guard<std::mutex> lock(queues_[index]->mutex);
+    ++queued_num_;
+    queues_[index]->tasks.push_back({group, std::move(func)});
+  }
+  // A worker going to sleep counts itself before checking queued_num_, so one of both sides sees the other
+  if (sleeping_num_.load() > 0) {
+    std::lock_guard<std::mutex> lock(idle_mutex_);
+    idle_cv_.notify_one();
+  }
+}
+
+bool TaskExecutor::PopTask(size_t queue_index, bool from_back, const TaskGroup *group, Task &task) {
+  WorkQueue &queue = *queues_[queue_index];
+  std::lock_guard<std::mutex> lock(queue.mutex);
+  if (queue.tasks.empty()) {
+    return false;
+  }
+  if (group == nullptr) {
+    if (from_back) {
+      task = std::move(queue.tasks.back());
+      queue.tasks.pop_back();
+    } else {
+      task = std::move(queue.tasks.front());
+      queue.tasks.pop_front();
+    }
+    --queued_num_;
+    return true;
+  }
+
+  auto match = [group](const Task &item) { return item.group == group; };
+  if (from_back) {
+    auto iter = std::find_if(queue.tasks.rbegin(), queue.tasks.rend(), match);
+    if (iter == queue.tasks.rend()) {
+      return false;
+    }
+    task = std::move(*iter);
+    queue.tasks.erase(std::next(iter).base());
+  } else {
+    auto iter = std::find_if(queue.tasks.begin(), queue.tasks.end(), match);
+    if (iter == queue.tasks.end()) {
+      return false;
+    }
+    task = std::move(*iter);
+    queue.tasks.erase(iter);
+  }
+  --queued_num_;
+  return true;
+}
+
+bool TaskExecutor::RunOne(const TaskGroup *group) {
+  if (queued_num_.load() == 0) {
+    return false;
+  }
+  Task task;
+  bool found = false;
+  size_t start = 0;
+  if (tls_executor == this) {
+    // own deque first, newest task is the most likely to be hot in cache
+    found = PopTask(tls_worker_index, true, group, task);
+    start = tls_worker_index + 1;
+  } else {
+    start = next_queue_.load();
+  }
+  for (size_t i = 0; !found && i < queues_.size(); ++i) {
+    found = PopTask((start + i) % queues_.size(), false, group, task);
+  }
+  if (!found) {
+    return false;
+  }
+  task.func();
+  return true;
+}
+
+void TaskExecutor::WorkerFunc(size_t index) {
+  tls_executor = this;
+  tls_worker_index = index;
+  while (!is_stopped_.load()) {
+    if (RunOne(nullptr)) {
+      continue;
+    }
+    std::unique_lock<std::mutex> lock(idle_mutex_);
+    ++sleeping_num_;
+    idle_cv_.wait(lock, [this] { return is_stopped_.load() || queued_num_.load() > 0; });
+    --sleeping_num_;
+  }
+}
+
+TaskGroup::~TaskGroup() {
+  Cancel();
+  (void)Wait();
+}
+
+void TaskGroup::Submit(std::function<Status()> task) {
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    ++pending_num_;
+  }
+  executor_.Push(this, [this, task]() {
+    Status ret = SUCCESS;
+    if (!IsCancelled()) {
+      try {
+        ret = task();
+      } catch (...) {
+        GELOGE(FAILED, "Task of group threw an exception.");
+        ret = FAILED;
+      }
+    }
+    Finish(ret);
+  });
+  // the task is queued now, let a waiting thread run it
+  std::lock_guard<std::mutex> lock(mutex_);
+  ++submit_seq_;
+  done_cv_.notify_all();
+}
+
+void TaskGroup::Finish(Status ret) {
+  // notify under the lock, Wait may return and the group be destroyed as soon as it is released
+  std::lock_guard<std::mutex> lock(mutex_);
+  if (ret != SUCCESS && status_ == SUCCESS) {
+    status_ = ret;
+    is_cancelled_.store(true);
+  }
+  if (--pending_num_ == 0) {
+    done_cv_.notify_all();
+  }
+}
+
+Status TaskGroup::Wait() {
+  while (true) {
+    size_t seq = 0;
+    {
+      std::lock_guard<std::mutex> lock(mutex_);
+      if (pending_num_ == 0) {
+        break;
+      }
+      seq = submit_seq_;
+    }
+    if (executor_.RunOne(this)) {
+      continue;
+    }
+    // every task of the group is running elsewhere, sleep until they finish or a new one is submitted
+    std::unique_lock<std::mutex> lock(mutex_);
+    done_cv_.wait(lock, [this, seq] { return pending_num_ == 0 || submit_seq_ != seq; });
+  }
+
+  std::lock_guard<std::mutex> lock(mutex_);
+  if (status_ != SUCCESS) {
+    return status_;
+  }
+  return IsCancelled() ? FAILED : SUCCESS;
+}
+
+void TaskGraph::SetBudget(const std::string &tag, uint32_t budget) {
+  std::lock_guard<std::mutex> lock(mutex_);
+  budgets_[tag] = budget;
+}
+
+size_t TaskGraph::AddTask(const std::string &name, std::function<Status()> func, const std::vector<size_t> &deps,
+                          const std::string &tag) {
+  std::lock_guard<std::mutex> lock(mutex_);
+  size_t id = tasks_.size();
+  for (size_t dep : deps) {
+    if (dep >= id) {
+      GELOGE(PARAM_INVALID, "Task %s depends on task %zu which is not added before it.", name.c_str(), dep);
+      has_invalid_dep_ = true;
+      continue;
+    }
+    tasks_[dep].successors.emplace_back(id);
+  }
+  tasks_.emplace_back();
+  Task &task = tasks_.back();
+  task.name = name;
+  task.tag = tag;
+  task.func = std::move(func);
+  task.dep_num = deps.size();
+  return id;
+}
+
+void TaskGraph::Schedule(size_t id, std::vector<size_t> &ready) {
+  const std::string &tag = tasks_[id].tag;
+  if (!tag.empty()) {
+    auto iter = budgets_.find(tag);
+    uint32_t &running_num = running_num_[tag];
+    if ((iter != budgets_.end()) && (iter->second > 0) && (running_num >= iter->second)) {
+      waiting_[tag].emplace_back(id);
+      return;
+    }
+    ++running_num;
+  }
+  ready.emplace_back(id);
+}
+
+void TaskGraph::Submit(TaskGroup &group, size_t id) {
+  group.Submit([this, &group, id]() -> Status {
+    uint64_t start_us = GetCurrentTimestap();
+    Status ret = tasks_[id].func();
+    uint64_t end_us = GetCurrentTimestap();
+
+    std::vector<size_t> ready;
+    {
+      std::lock_guard<std::mutex> lock(mutex_);
+      Task &task = tasks_[id];
+      task.has_run = true;
+      task.start_us = start_us - run_start_us_;
+      task.cost_us = end_us - start_us;
+      if (!task.tag.empty()) {
+        --running_num_[task.tag];
+        auto &waiting = waiting_[task.tag];
+        if (!waiting.empty()) {
+          ++running_num_[task.tag];
+          ready.emplace_back(waiting.front());
+          waiting.pop_front();
+        }
+      }
+      if (ret == SUCCESS) {
+        for (size_t successor : task.successors) {
+          if (--tasks_[successor].pending_dep_num == 0) {
+            Schedule(successor, ready);
+          }
+        }
+      }
+    }
+    // a failure has cancelled the group already, whatever is submitted now is skipped
+    for (size_t ready_id : ready) {
+      Submit(group, ready_id);
+    }
+    return ret;
+  });
+}
+
+Status TaskGraph::Run() {
+  TaskGroup group(executor_);
+  std::vector<size_t> ready;
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    if (has_invalid_dep_) {
+      GELOGE(PARAM_INVALID, "Task graph has invalid dependencies.");
+      return PARAM_INVALID;
+    }
+    run_start_us_ = GetCurrentTimestap();
+    running_num_.clear();
+    waiting_.clear();
+    for (size_t id = 0; id < tasks_.size(); ++id) {
+      tasks_[id].pending_dep_num = tasks_[id].dep_num;
+      tasks_[id].has_run = false;
+    }
+    for (size_t id = 0; id < tasks_.size(); ++id) {
+      if (tasks_[id].dep_num == 0) {
+        Schedule(id, ready);
+      }
+    }
+  }
+  for (size_t id : ready) {
+    Submit(group, id);
+  }
+  return group.Wait();
+}
+
+std::vector<TaskGraph::TaskCost> TaskGraph::GetCosts() const {
+  std::lock_guard<std::mutex> lock(mutex_);
+  std::vector<TaskCost> costs;
+  for (const auto &task : tasks_) {
+    if (task.has_run) {
+      costs.push_back({task.name, task.start_us, task.cost_us});
+    }
+  }
+  return costs;
+}
+}  // namespace ge
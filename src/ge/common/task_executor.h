@@ -0,0 +1,202 @@
+/**
+ * Copyright 2019-2020 Huawei Technologies Co., Ltd
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef GE_COMMON_TASK_EXECUTOR_H_
+#define GE_COMMON_TASK_EXECUTOR_H_
+
+#include <atomic>
+#include <condition_variable>
+#include <deque>
+#include <functional>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "framework/common/ge_inner_error_codes.h"
+#include "graph/types.h"
+
+namespace ge {
+class TaskGroup;
+
+///
+/// @ingroup ge
+/// @brief Long lived workers shared by the whole process. Every worker owns a deque: tasks submitted from a
+/// worker go to its own deque and run LIFO, idle workers steal FIFO from the others. Threads waiting for a
+/// TaskGroup run the queued tasks of that group meanwhile, so groups may be waited from inside tasks.
+///
+class GE_FUNC_DEV_VISIBILITY GE_FUNC_HOST_VISIBILITY TaskExecutor {
+ public:
+  static TaskExecutor &Instance();
+
+  explicit TaskExecutor(uint32_t worker_num);
+  ~TaskExecutor();
+  TaskExecutor(const TaskExecutor &) = delete;
+  TaskExecutor &operator=(const TaskExecutor &) = delete;
+
+  uint32_t GetWorkerNum() const { return static_cast<uint32_t>(workers_.size()); }
+
+  ///
+  /// @ingroup ge
+  /// @brief Run func over [begin, end) split in chunks of at least grain items, the caller runs chunks too.
+  /// @param [in] func: called with the bounds of one chunk.
+  /// @return SUCCESS / first failed status of a chunk, the chunks not started yet are skipped then.
+  ///
+  Status ParallelFor(size_t begin, size_t end, size_t grain, const std::function<Status(size_t, size_t)> &func);
+
+ private:
+  friend class TaskGroup;
+
+  struct Task {
+    TaskGroup *group;
+    std::function<void()> func;
+  };
+
+  struct WorkQueue {
+    std::mutex mutex;
+    std::deque<Task> tasks;
+  };
+
+  void Push(TaskGroup *group, std::function<void()> func);
+  // Run one queued task, of group only when it is not null, returns false when there is none
+  bool RunOne(const TaskGroup *group);
+  bool PopTask(size_t queue_index, bool from_back, const TaskGroup *group, Task &task);
+  void WorkerFunc(size_t index);
+
+  std::vector<std::unique_ptr<WorkQueue>> queues_;
+  std::vector<std::thread> workers_;
+  std::atomic<size_t> next_queue_;
+  std::atomic<size_t> queued_num_;
+  std::atomic<size_t> sleeping_num_;
+  std::atomic<bool> is_stopped_;
+  std::mutex idle_mutex_;
+  std::condition_variable idle_cv_;
+};
+
+///
+/// @ingroup ge
+/// @brief Tasks submitted to a TaskExecutor and waited for together. The first failure cancels the group:
+/// tasks of the group that have not started yet are skipped.
+///
+class GE_FUNC_DEV_VISIBILITY GE_FUNC_HOST_VISIBILITY TaskGroup {
+ public:
+  explicit TaskGroup(TaskExecutor &executor = TaskExecutor::Instance()) : executor_(executor) {}
+  // Cancels and waits for the tasks still queued or running
+  ~TaskGroup();
+  TaskGroup(const TaskGroup &) = delete;
+  TaskGroup &operator=(const TaskGroup &) = delete;
+
+  void Submit(std::function<Status()> task);
+
+  // Skip the tasks that have not started, running ones may poll IsCancelled to stop early
+  void Cancel() { is_cancelled_.store(true); }
+  bool IsCancelled() const { return is_cancelled_.load(); }
+
+  ///
+  /// @ingroup ge
+  /// @brief Wait for all submitted tasks, running the queued ones on the calling thread meanwhile.
+  /// @return SUCCESS / first failed status, FAILED when cancelled by the caller.
+  ///
+  Status Wait();
+
+ private:
+  void Finish(Status ret);
+
+  TaskExecutor &executor_;
+  std::atomic<bool> is_cancelled_{false};
+  std::mutex mutex_;
+  size_t pending_num_ = 0;
+  // Bumped by Submit, wakes up Wait to run the new task
+  size_t submit_seq_ = 0;
+  std::condition_variable done_cv_;
+  Status status_ = SUCCESS;
+};
+
+///
+/// @ingroup ge
+/// @brief Tasks with dependencies, each one is submitted to a TaskExecutor as soon as the tasks it depends on are
+/// done. A task may carry a tag, e.g. the engine it works for, and at most the budget of that tag run at the same
+/// time. The wall-clock of every task that ran is kept for the caller to report.
+///
+class GE_FUNC_DEV_VISIBILITY GE_FUNC_HOST_VISIBILITY TaskGraph {
+ public:
+  struct TaskCost {
+    std::string name;
+    // micro seconds since Run was called
+    uint64_t start_us;
+    uint64_t cost_us;
+  };
+
+  explicit TaskGraph(TaskExecutor &executor = TaskExecutor::Instance()) : executor_(executor) {}
+  ~TaskGraph() = default;
+  TaskGraph(const TaskGraph &) = delete;
+  TaskGraph &operator=(const TaskGraph &) = delete;
+
+  ///
+  /// @ingroup ge
+  /// @brief Limit the tasks of tag running at the same time, 0 leaves them limited by the executor only.
+  ///
+  void SetBudget(const std::string &tag, uint32_t budget);
+
+  ///
+  /// @ingroup ge
+  /// @brief Add a task, it may only depend on tasks added before.
+  /// @return id of the task, used as dependency of later tasks.
+  ///
+  size_t AddTask(const std::string &name, std::function<Status()> func, const std::vector<size_t> &deps = {},
+                 const std::string &tag = "");
+
+  ///
+  /// @ingroup ge
+  /// @brief Run all tasks, the calling thread runs tasks too while waiting.
+  /// @return SUCCESS / first failed status, tasks depending on a failed one never run.
+  ///
+  Status Run();
+
+  // Costs of the tasks that ran, in the order they were added
+  std::vector<TaskCost> GetCosts() const;
+
+ private:
+  struct Task {
+    std::string name;
+    std::string tag;
+    std::function<Status()> func;
+    std::vector<size_t> successors;
+    size_t dep_num = 0;
+    size_t pending_dep_num = 0;
+    bool has_run = false;
+    uint64_t start_us = 0;
+    uint64_t cost_us = 0;
+  };
+
+  // Called under mutex_, moves the task to ready unless its tag is out of budget
+  void Schedule(size_t id, std::vector<size_t> &ready);
+  void Submit(TaskGroup &group, size_t id);
+
+  TaskExecutor &executor_;
+  std::vector<Task> tasks_;
+  std::map<std::string, uint32_t> budgets_;
+  std::map<std::string, uint32_t> running_num_;
+  std::map<std::string, std::deque<size_t>> waiting_;
+  bool has_invalid_dep_ = false;
+  uint64_t run_start_us_ = 0;
+  mutable std::mutex mutex_;
+};
+}  // namespace ge
+
+#endif  // GE_COMMON_TASK_EXECUTOR_H_
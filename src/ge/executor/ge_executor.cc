@@ -350,15 +350,47 @@ Status GeExecutor::LoadDataFromFile(const std::string &path, ModelData &model_da
   int32_t priority = 0;
   Status ret = GraphLoader::LoadDataFromFile(path, key_path, priority, model_data);
   if (ret != SUCCESS) {
-    if (model_data.model_data != nullptr) {
-      delete[] static_cast<char *>(model_data.model_data);
-      model_data.model_data = nullptr;
-    }
+    GraphLoader::ReleaseModelData(model_data);
   }
 
   return ret;
 }
 
+///
+/// @ingroup ge
+/// @brief Map model file instead of reading it to memory
+/// @param [in] const std::string &path: Offline model file path
+/// @param [out] domi::ModelData &model_data: Offline model data
+/// @return SUCCESS handle successfully / others handle failed
+///
+Status GeExecutor::MapDataFromFile(const std::string &path, ModelData &model_data) {
+  string file_path = RealPath(path.c_str());
+  if (file_path.empty()) {
+    GELOGE(ge::FAILED, "file_path is invalid. please check your text file '%s'.", path.c_str());
+    return ge::FAILED;
+  }
+  GELOGI("map model_data from file: %s.", path.c_str());
+  std::string key_path;
+  int32_t priority = 0;
+  Status ret = GraphLoader::LoadDataFromFile(path, key_path, priority, model_data, true);
+  if (ret != SUCCESS) {
+    GraphLoader::ReleaseModelData(model_data);
+  }
+
+  return ret;
+}
+
+///
+/// @ingroup ge
+/// @brief Release model data got from LoadDataFromFile or MapDataFromFile
+/// @param [in] domi::ModelData &model_data: Offline model data
+/// @return SUCCESS handle successfully / others handle failed
+///
+Status GeExecutor::ReleaseModelData(ModelData &model_data) {
+  GraphLoader::ReleaseModelData(model_data);
+  return SUCCESS;
+}
+
 ///
 /// @ingroup ge
 /// @brief Load model from offline model memory data
@@ -426,7 +458,8 @@ Status GeExecutor::ExecModel(uint32_t model_id, void *stream, const ge::RunModel
 Status GeExecutor::GetMemAndWeightSize(const std::string &path, size_t &mem_size, size_t &weight_size) {
   ModelData model;
   std::string key;
-  Status ret = ge::GraphLoader::LoadDataFromFile(path, key, 0, model);
+  // Only the task partition is parsed, mapping keeps the weights from being read at all
+  Status ret = ge::GraphLoader::LoadDataFromFile(path, key, 0, model, true);
   if ((ret != SUCCESS) || (model.model_data == nullptr)) {
     GELOGE(ret, "Load data from file failed. ret = %d", ret);
     return ret;
@@ -434,8 +467,7 @@ Status GeExecutor::GetMemAndWeightSize(const std::string &path, size_t &mem_size
 
   ret = ge::ModelManager::GetModelMemAndWeightSize(model, mem_size, weight_size);
 
-  delete[] static_cast<char *>(model.model_data);
-  model.model_data = nullptr;
+  ge::GraphLoader::ReleaseModelData(model);
 
   return ret;
 }
@@ -16,16 +16,22 @@
 
 #include "graph/build/graph_build.h"
 
+#include <set>
+#include <unordered_map>
+
 #include "common/ge/ge_util.h"
 #include "common/helper/model_helper.h"
 #include "common/opskernel/ops_kernel_info_types.h"
+#include "common/task_executor.h"
 #include "graph/build/optimize_stream_graph.h"
 #include "graph/build/run_context.h"
+#include "graph/ge_local_context.h"
 #include "graph/manager/graph_var_manager.h"
 #include "graph/utils/node_utils.h"
 #include "graph/utils/type_utils.h"
 #include "init/gelib.h"
 #include "model/ge_model.h"
+#include "omg/omg_inner_types.h"
 
 using domi::BuildMode;
 
@@ -37,6 +43,8 @@ GraphBuilder::GraphBuilder() : build_mode_(BuildMode::GEN_TASK_WITH_FUSION), hco
 
 void GraphBuilder::SetOptions(const ge::GraphManagerOptions &options) {
   stream_max_parallel_num_ = options.stream_max_parallel_num;
+  build_max_parallel_num_ = options.build_max_parallel_num;
+  stream_op_cost_ = options.stream_op_cost;
   hcom_parallel_ = options.hcom_parallel;
 
   if (options.perf_level == kInvalidPerfLevel) {
@@ -54,6 +62,15 @@ Status GraphBuilder::CalcOpParam(const ge::ComputeGraphPtr &graph) {
     GELOGE(GE_CLI_GE_NOT_INITIALIZED, "GraphBuilder: GE is not initialized");
     return GE_CLI_GE_NOT_INITIALIZED;
   }
+
+  // A node only needs the output sizes of its inputs, so nodes of different engines run in parallel as soon as
+  // their inputs are done. Nodes of one engine run one at a time unless the engine has a build budget.
+  auto ge_context = MakeShared<GEThreadLocalContext>(GetThreadLocalContext());
+  GE_CHECK_NOTNULL(ge_context);
+  OmgContext *omg_context = &domi::GetContext();
+  TaskGraph calc_tasks;
+  std::unordered_map<const Node *, size_t> task_ids;
+  std::set<std::string> engine_names;
   for (const auto &node_ptr : graph->GetDirectNode()) {
     GE_CHECK_NOTNULL(node_ptr->GetOpDesc());
     std::string kernel_lib_name = node_ptr->GetOpDesc()->GetOpKernelLibName();
@@ -69,21 +86,50 @@ Status GraphBuilder::CalcOpParam(const ge::ComputeGraphPtr &graph) {
     }
 
     OpsKernelInfoStorePtr kernel_info = instance_ptr->OpsKernelManagerObj().GetOpsKernelInfoStore(kernel_lib_name);
-    if (kernel_info != nullptr) {
-      auto ret = SetInputSize(node_ptr);
-      if (ret != SUCCESS) {
-        GELOGE(ret, "Set node inputDesc size failed, node name is %s", node_ptr->GetName().c_str());
-        return ret;
-      }
-      ret = kernel_info->CalcOpRunningParam(*node_ptr);
-      if (ret != SUCCESS) {
-        GELOGE(ret, "Calculate op running param failed, node name is %s", node_ptr->GetName().c_str());
-        return ret;
-      }
-    } else {
+    if (kernel_info == nullptr) {
       GELOGE(GE_GRAPH_PARAM_NULLPTR, "Get op %s ops kernel info store failed", node_ptr->GetName().c_str());
       return INTERNAL_ERROR;
     }
+
+    std::vector<size_t> deps;
+    for (const auto &in_node : node_ptr->GetInAllNodes()) {
+      auto iter = task_ids.find(in_node.get());
+      if (iter != task_ids.end()) {
+        deps.emplace_back(iter->second);
+      }
+    }
+    std::string engine_name = node_ptr->GetOpDesc()->GetOpEngineName();
+    if (engine_name.empty()) {
+      engine_name = kernel_lib_name;
+    }
+    engine_names.insert(engine_name);
+    task_ids[node_ptr.get()] = calc_tasks.AddTask(
+        node_ptr->GetName(),
+        [this, node_ptr, kernel_info, ge_context, omg_context]() -> Status {
+          GetThreadLocalContext() = *ge_context;
+          domi::OmgContextScope omg_context_scope(omg_context);
+          Status ret = SetInputSize(node_ptr);
+          if (ret != SUCCESS) {
+            GELOGE(ret, "Set node inputDesc size failed, node name is %s", node_ptr->GetName().c_str());
+            return ret;
+          }
+          ret = kernel_info->CalcOpRunningParam(*node_ptr);
+          if (ret != SUCCESS) {
+            GELOGE(ret, "Calculate op running param failed, node name is %s", node_ptr->GetName().c_str());
+          }
+          return ret;
+        },
+        deps, engine_name);
+  }
+  for (const auto &engine_name : engine_names) {
+    auto iter = build_max_parallel_num_.find(engine_name);
+    calc_tasks.SetBudget(engine_name, (iter == build_max_parallel_num_.end()) ? 1 : iter->second);
+  }
+
+  Status ret = calc_tasks.Run();
+  if (ret != SUCCESS) {
+    GELOGE(ret, "Calculate op running param failed.");
+    return ret;
   }
   GELOGI("Success to calculate op running param.");
   return SUCCESS;
@@ -102,6 +148,7 @@ Status GraphBuilder::Build(ComputeGraphPtr &comp_graph, std::vector<SubGraphInfo
 
   GE_TIMESTAMP_START(BuildSubgraph);
   ge::ModelBuilder builder(comp_graph, subgraph_ptr_list, stream_max_parallel_num_, hcom_parallel_, build_mode_);
+  builder.SetStreamOpCost(stream_op_cost_);
 
   GELOGI("[Build] invoke the other opskernel to generate task.");
 
@@ -202,6 +249,7 @@ Status GraphBuilder::GetTaskInfo(const ge::ModelBuilder &builder, const ModelPtr
                           ? ge::VarManager::Instance(0)->GetVarMemMaxSize()
                           : 0;
   TaskGenerator task_generator(get_var_mem_base, var_size);
+  task_generator.SetBuildMaxParallelNum(build_max_parallel_num_);
   ret = task_generator.GetTaskInfo(*model_ptr, comp_graph, session_id, run_context.GetRunContext());
 
   return ret;
@@ -63,6 +63,10 @@ class GraphBuilder {
   int build_mode_;
 
   std::map<std::string, int> stream_max_parallel_num_;
+  // nodes of one engine whose op running params are calculated at the same time, 1 when the engine is not listed
+  std::map<std::string, int> build_max_parallel_num_;
+  // estimated execution time of op types, streams are assigned by dependency when it is empty
+  std::map<std::string, int> stream_op_cost_;
   bool hcom_parallel_;
 
   GraphPartitioner graph_partitioner_;
@@ -15,6 +15,8 @@
  */
 
 #include "graph/build/logical_stream_allocator.h"
+#include <algorithm>
+#include <queue>
 #include "common/ge/ge_util.h"
 #include "framework/common/debug/ge_log.h"
 #include "framework/common/fmk_error_codes.h"
@@ -26,6 +28,12 @@ using std::vector;
 using std::map;
 using std::set;
 
+namespace {
+const size_t kInvalidSlot = SIZE_MAX;
+// Cost of the op types not in the cost table
+const int64_t kDefaultOpCost = 1;
+}  // namespace
+
 namespace ge {
 LogicalStreamPass::LogicalStreamPass(const string &name) : name_(name) {}
 
@@ -104,6 +112,200 @@ Status IndependentStreamPass::Run(ComputeGraphPtr whole_graph, const vector<Subg
   return changed ? SUCCESS : NOT_CHANGED;
 }
 
+Status AssignByCostPass::Run(ComputeGraphPtr whole_graph, const vector<SubgraphPtr> &subgraphs, Context &context) {
+  if (context.op_costs.empty()) {
+    return NOT_CHANGED;
+  }
+
+  size_t subgraph_num = subgraphs.size();
+  vector<vector<size_t>> preds;
+  InitPredecessors(subgraphs, preds);
+  vector<vector<size_t>> succs(subgraph_num);
+  vector<size_t> in_nums(subgraph_num, 0);
+  vector<size_t> order;
+  for (size_t i = 0; i < subgraph_num; ++i) {
+    for (size_t pred : preds[i]) {
+      succs[pred].emplace_back(i);
+    }
+    in_nums[i] = preds[i].size();
+    if (in_nums[i] == 0) {
+      order.emplace_back(i);
+    }
+  }
+  for (size_t k = 0; k < order.size(); ++k) {
+    for (size_t succ : succs[order[k]]) {
+      if (--in_nums[succ] == 0) {
+        order.emplace_back(succ);
+      }
+    }
+  }
+  if (order.size() != subgraph_num) {
+    GELOGW("Subgraphs are in a cycle, streams are not assigned by cost.");
+    return NOT_CHANGED;
+  }
+
+  // Rank of a subgraph is the cost of the longest path from it to the end of the graph.
+  vector<int64_t> costs(subgraph_num, 0);
+  vector<int64_t> ranks(subgraph_num, 0);
+  for (auto iter = order.rbegin(); iter != order.rend(); ++iter) {
+    size_t i = *iter;
+    costs[i] = GetCost(*subgraphs[i], context.op_costs);
+    int64_t succ_rank = 0;
+    for (size_t succ : succs[i]) {
+      succ_rank = std::max(succ_rank, ranks[succ]);
+    }
+    ranks[i] = costs[i] + succ_rank;
+  }
+
+  auto lower_rank = [&ranks](size_t lhs, size_t rhs) {
+    return (ranks[lhs] != ranks[rhs]) ? (ranks[lhs] < ranks[rhs]) : (lhs > rhs);
+  };
+  std::priority_queue<size_t, vector<size_t>, decltype(lower_rank)> ready_subgraphs(lower_rank);
+  for (size_t i = 0; i < subgraph_num; ++i) {
+    in_nums[i] = preds[i].size();
+    if (in_nums[i] == 0) {
+      ready_subgraphs.push(i);
+    }
+  }
+
+  slot_free_times_.clear();
+  engine_slots_.clear();
+  subgraph_slots_.assign(subgraph_num, kInvalidSlot);
+  // <stream assigned by the passes before, time it is free from>
+  map<int64_t, int64_t> assigned_free_times;
+  vector<int64_t> finish_times(subgraph_num, 0);
+  int64_t makespan = 0;
+  while (!ready_subgraphs.empty()) {
+    size_t i = ready_subgraphs.top();
+    ready_subgraphs.pop();
+    int64_t ready_time = 0;
+    for (size_t pred : preds[i]) {
+      ready_time = std::max(ready_time, finish_times[pred]);
+    }
+
+    int64_t *free_time = nullptr;
+    if (HasAssignedStream(*subgraphs[i])) {
+      free_time = &assigned_free_times[subgraphs[i]->stream_id];
+    } else {
+      subgraph_slots_[i] = SelectSlot(subgraphs, i, preds[i], ready_time);
+      free_time = &slot_free_times_[subgraph_slots_[i]];
+    }
+    finish_times[i] = std::max(ready_time, *free_time) + costs[i];
+    *free_time = finish_times[i];
+    makespan = std::max(makespan, finish_times[i]);
+
+    for (size_t succ : succs[i]) {
+      if (--in_nums[succ] == 0) {
+        ready_subgraphs.push(succ);
+      }
+    }
+  }
+
+  // The streams of an engine are numbered together.
+  int64_t &next_stream = context.next_stream;
+  vector<int64_t> slot_streams(slot_free_times_.size(), kInvalidStream);
+  for (const auto &item : engine_slots_) {
+    for (size_t slot : item.second) {
+      slot_streams[slot] = next_stream;
+      ++next_stream;
+    }
+  }
+
+  bool changed = false;
+  for (size_t i = 0; i < subgraph_num; ++i) {
+    if (subgraph_slots_[i] != kInvalidSlot) {
+      subgraphs[i]->stream_id = slot_streams[subgraph_slots_[i]];
+      changed = true;
+      GELOGI("Subgraph %s (engine: %s, cost: %ld, rank: %ld) is assigned stream %ld, it finishes at %ld.",
+             subgraphs[i]->name.c_str(), subgraphs[i]->engine_conf.id.c_str(), costs[i], ranks[i],
+             subgraphs[i]->stream_id, finish_times[i]);
+    }
+  }
+
+  context.makespan = makespan;
+  GELOGI("Estimated makespan of %zu subgraphs on %zu streams assigned by cost: %ld.", subgraph_num,
+         slot_free_times_.size(), makespan);
+
+  return changed ? SUCCESS : NOT_CHANGED;
+}
+
+int64_t AssignByCostPass::GetCost(const Subgraph &subgraph, const map<string, int> &op_costs) const {
+  ComputeGraphPtr compute_graph = subgraph.subgraph_info.GetSubGraph();
+  if ((compute_graph == nullptr) || IsEngineSkip(subgraph)) {
+    return 0;
+  }
+
+  int64_t cost = 0;
+  for (const NodePtr &node : compute_graph->GetDirectNode()) {
+    const string &type = node->GetType();
+    if ((type == PLACEHOLDER) || (type == END)) {
+      continue;
+    }
+    auto iter = op_costs.find(type);
+    cost += (iter != op_costs.end()) ? iter->second : kDefaultOpCost;
+  }
+  return cost;
+}
+
+void AssignByCostPass::InitPredecessors(const vector<SubgraphPtr> &subgraphs, vector<vector<size_t>> &preds) const {
+  map<NodePtr, size_t> end_subgraph_map;
+  for (size_t i = 0; i < subgraphs.size(); ++i) {
+    for (const auto &item : subgraphs[i]->subgraph_info.GetEnd2PldMap()) {
+      end_subgraph_map.emplace(item.first, i);
+    }
+  }
+
+  preds.assign(subgraphs.size(), vector<size_t>());
+  for (size_t i = 0; i < subgraphs.size(); ++i) {
+    set<size_t> pred_set;
+    for (const auto &pld_2_end : subgraphs[i]->subgraph_info.GetPld2EndMap()) {
+      auto iter = end_subgraph_map.find(pld_2_end.second);
+      if ((iter != end_subgraph_map.end()) && (iter->second != i)) {
+        pred_set.emplace(iter->second);
+      }
+    }
+    preds[i].assign(pred_set.begin(), pred_set.end());
+  }
+}
+
+size_t AssignByCostPass::SelectSlot(const vector<SubgraphPtr> &subgraphs, size_t index, const vector<size_t> &preds,
+                                    int64_t ready_time) {
+  const Subgraph &subgraph = *subgraphs[index];
+  // An attached engine runs on the stream of its predecessor, as AssignByDependencyPass reuses it.
+  if (IsEngineAttach(subgraph)) {
+    for (size_t pred : preds) {
+      if ((subgraph_slots_[pred] != kInvalidSlot) &&
+          (subgraphs[pred]->engine_conf.scheduler_id == subgraph.engine_conf.scheduler_id)) {
+        return subgraph_slots_[pred];
+      }
+    }
+  }
+
+  // The stream where the subgraph starts the earliest, a stream of a predecessor saves an event on a tie.
+  vector<size_t> &slots = engine_slots_[subgraph.engine_conf.id];
+  size_t best_slot = kInvalidSlot;
+  int64_t best_start = 0;
+  bool best_on_pred = false;
+  for (size_t slot : slots) {
+    int64_t start = std::max(ready_time, slot_free_times_[slot]);
+    bool on_pred = std::any_of(preds.begin(), preds.end(),
+                               [this, slot](size_t pred) { return subgraph_slots_[pred] == slot; });
+    if ((best_slot == kInvalidSlot) || (start < best_start) || ((start == best_start) && on_pred && !best_on_pred)) {
+      best_slot = slot;
+      best_start = start;
+      best_on_pred = on_pred;
+    }
+  }
+
+  size_t max_slot_num = static_cast<size_t>(std::max<int64_t>(subgraph.max_parallel_num, 1));
+  if (((best_slot == kInvalidSlot) || (best_start > ready_time)) && (slots.size() < max_slot_num)) {
+    best_slot = slot_free_times_.size();
+    slot_free_times_.emplace_back(0);
+    slots.emplace_back(best_slot);
+  }
+  return best_slot;
+}
+
 Status AssignByDependencyPass::Run(ComputeGraphPtr whole_graph, const vector<SubgraphPtr> &subgraphs,
                                    Context &context) {
   bool changed = false;
@@ -535,6 +737,7 @@ Status LogicalStreamAllocator::RunPasses(const ComputeGraphPtr &whole_graph, con
   vector<LogicalStreamPassPtr> passes;
   passes.emplace_back(MakeShared<AssignByLabelPass>());
   passes.emplace_back(MakeShared<IndependentStreamPass>());
+  passes.emplace_back(MakeShared<AssignByCostPass>());
   passes.emplace_back(MakeShared<AssignByDependencyPass>());
   passes.emplace_back(MakeShared<NodeStreamUpdatePass>());
   passes.emplace_back(MakeShared<AllReduceParallelPass>());
@@ -63,6 +63,10 @@ class LogicalStreamPass {
     // Next stream id.
     int64_t next_stream = 0;
     bool hcom_parallel = false;
+    // <op type, estimated execution time>, streams are assigned by cost when it is not empty.
+    std::map<std::string, int> op_costs;
+    // Estimated execution time of the whole graph on the streams assigned by cost.
+    int64_t makespan = 0;
   };
 
   explicit LogicalStreamPass(const std::string &name);
@@ -100,6 +104,28 @@ class IndependentStreamPass : public LogicalStreamPass {
   Status Run(ComputeGraphPtr whole_graph, const std::vector<SubgraphPtr> &subgraphs, Context &context) override;
 };
 
+/// Assign streams by critical path list scheduling over the estimated op costs.
+/// The subgraph with the longest path to the end of the graph among the ready ones is scheduled first, on the stream
+/// of its engine where it starts the earliest. An engine uses at most max_parallel_num streams.
+class AssignByCostPass : public LogicalStreamPass {
+ public:
+  STREAM_PASS_DEFAULT_FUNC(AssignByCostPass);
+  Status Run(ComputeGraphPtr whole_graph, const std::vector<SubgraphPtr> &subgraphs, Context &context) override;
+
+ private:
+  int64_t GetCost(const Subgraph &subgraph, const std::map<std::string, int> &op_costs) const;
+  void InitPredecessors(const std::vector<SubgraphPtr> &subgraphs, std::vector<std::vector<size_t>> &preds) const;
+  size_t SelectSlot(const std::vector<SubgraphPtr> &subgraphs, size_t index, const std::vector<size_t> &preds,
+                    int64_t ready_time);
+
+  // Time each temp stream is free from, the streams are numbered by engine at the end
+  std::vector<int64_t> slot_free_times_;
+  // <engine, temp streams of the engine>
+  std::map<std::string, std::vector<size_t>> engine_slots_;
+  // Temp stream of each subgraph, kInvalidSlot for the ones assigned by the passes before
+  std::vector<size_t> subgraph_slots_;
+};
+
 // Reuse streams or assign new streams based on dependencies.
 class AssignByDependencyPass : public LogicalStreamPass {
  public:
@@ -175,6 +201,10 @@ class LogicalStreamAllocator {
 
   Status Assign(const ComputeGraphPtr &whole_graph, const std::vector<SubGraphInfoPtr> &subgraphs, int64_t &stream_num);
 
+  // Op costs to assign streams by, the streams are assigned by dependency when there are none.
+  void SetOpCosts(const std::map<std::string, int> &op_costs) { context_.op_costs = op_costs; }
+  int64_t GetMakespan() const { return context_.makespan; }
+
  private:
   Status ConvertSubgraphs(const std::vector<SubGraphInfoPtr> &subgraph_infos,
                           const std::map<std::string, EngineConfPtr> &engine_confs,
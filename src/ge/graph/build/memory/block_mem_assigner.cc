@@ -39,6 +39,9 @@ const char *const kAttrNameWorkspaceReuseFlag = "workspace_reuse_flag";
 const char *const kL2FusionDynamicConvergeOp = "l2fusion_dynamic_converge_op";
 const char *const kDisableReuseMemory = "ge.exec.disableReuseMemory";
 const int kReuseMaxCount = 10;
+const int64_t kInvalidStream = -1;
+// Row of a node not ordered yet
+const size_t kNoRow = SIZE_MAX;
 }  // namespace
 
 namespace ge {
@@ -50,6 +53,101 @@ using std::unordered_map;
 using std::unordered_set;
 using std::vector;
 
+void StreamOrderIndex::Build(const ComputeGraphPtr &graph) {
+  valid_ = false;
+  stream_num_ = 0;
+  rows_.clear();
+  row_streams_.clear();
+  row_positions_.clear();
+  clocks_.clear();
+  GE_CHK_BOOL_TRUE_EXEC_WITH_LOG(graph == nullptr, return, "Input parameter graph is null.");
+
+  // Walked by node id in a snapshot of the graph as it is now
+  auto direct_nodes = graph->GetDirectNode();
+  CompactGraph compact_graph(vector<NodePtr>(direct_nodes.begin(), direct_nodes.end()));
+  map<int64_t, size_t> stream_indexes;
+  for (const NodePtr &n : compact_graph.GetNodes()) {
+    auto node_op_desc = n->GetOpDesc();
+    GE_IF_BOOL_EXEC(node_op_desc == nullptr, return);
+    string stream_label;
+    string type = node_op_desc->GetType();
+    if ((ge::AttrUtils::GetStr(node_op_desc, ATTR_NAME_STREAM_LABEL, stream_label) && !stream_label.empty()) ||
+        (type == STREAMSWITCH) || (type == STREAMSWITCHN) || (type == STREAMACTIVE) || (type == STREAMMERGE)) {
+      GELOGI("Node %s runs on or activates a stream started at runtime, no stream order index.", n->GetName().c_str());
+      return;
+    }
+    int64_t stream_id = node_op_desc->GetStreamId();
+    if (stream_id != kInvalidStream) {
+      stream_indexes.emplace(stream_id, 0);
+    }
+  }
+  for (auto &stream_index : stream_indexes) {
+    stream_index.second = stream_num_++;
+  }
+
+  vector<int64_t> stream_positions(stream_num_, 0);
+  vector<size_t> stream_last_rows(stream_num_, 0);
+  vector<bool> stream_started(stream_num_, false);
+  vector<size_t> node_rows(compact_graph.GetNodesSize(), kNoRow);
+  for (uint32_t id = 0; id < compact_graph.GetNodesSize(); ++id) {
+    const NodePtr &n = compact_graph.GetNode(id);
+    int64_t stream_id = n->GetOpDesc()->GetStreamId();
+    if (stream_id == kInvalidStream) {
+      continue;
+    }
+    size_t stream = stream_indexes[stream_id];
+    size_t row = row_streams_.size();
+    clocks_.resize((row + 1) * stream_num_, -1);
+    auto merge = [this, row](size_t pre_row) {
+      for (size_t i = 0; i < stream_num_; ++i) {
+        clocks_[row * stream_num_ + i] = std::max(clocks_[row * stream_num_ + i], clocks_[pre_row * stream_num_ + i]);
+      }
+    };
+
+    if (stream_started[stream]) {
+      merge(stream_last_rows[stream]);
+    }
+    // The in nodes of Node::GetInAllNodes. No event is sent after a node without stream, so it orders nothing
+    for (const auto &in_ids : {compact_graph.GetInDataNodes(id), compact_graph.GetInControlNodes(id)}) {
+      for (uint32_t in_id : in_ids) {
+        const NodePtr &in_node = compact_graph.GetNode(in_id);
+        if ((in_node->GetOpDesc() == nullptr) || (in_node->GetOpDesc()->GetStreamId() == kInvalidStream)) {
+          continue;
+        }
+        if (node_rows[in_id] == kNoRow) {
+          GELOGW("Node %s is placed before its input %s, no stream order index.", n->GetName().c_str(),
+                 in_node->GetName().c_str());
+          return;
+        }
+        merge(node_rows[in_id]);
+      }
+    }
+
+    clocks_[row * stream_num_ + stream] = stream_positions[stream];
+    rows_[n.get()] = row;
+    node_rows[id] = row;
+    row_streams_.emplace_back(stream);
+    row_positions_.emplace_back(stream_positions[stream]++);
+    stream_last_rows[stream] = row;
+    stream_started[stream] = true;
+  }
+  valid_ = true;
+  GELOGI("Stream order index built, %zu nodes on %zu streams.", row_streams_.size(), stream_num_);
+}
+
+bool StreamOrderIndex::HappensBefore(const Node *src, const Node *dst) const {
+  if (!valid_ || (src == dst)) {
+    return false;
+  }
+  auto src_iter = rows_.find(src);
+  auto dst_iter = rows_.find(dst);
+  if ((src_iter == rows_.end()) || (dst_iter == rows_.end())) {
+    return false;
+  }
+  size_t src_row = src_iter->second;
+  return row_positions_[src_row] <= clocks_[dst_iter->second * stream_num_ + row_streams_[src_row]];
+}
+
 void MemoryBlock::Resize() {
   auto iter = std::max_element(real_size_list_.begin(), real_size_list_.end());
   if (iter == real_size_list_.end()) {
@@ -272,7 +370,7 @@ MemoryBlock *BlockMemAssigner::ApplyMemory(size_t block_size, size_t real_size,
             (op_type != ANN_DATA_TYPE) && (op_type != ZEROSLIKE) && (op_type != CONSTANTOP);
         auto stream_id = node_op_desc->GetStreamId();
         auto map_iter = reusable_streams_map_.find(stream_id);
-        if (is_reuse_memory && map_iter != reusable_streams_map_.end()) {
+        if (is_reuse_memory && (stream_order_.IsValid() || (map_iter != reusable_streams_map_.end()))) {
           for (auto it = reusable_blocks_.begin(); it != reusable_blocks_.end(); ++it) {
             MemoryBlock *reusable_block = *it;
             bool is_data = false;
@@ -286,14 +384,17 @@ MemoryBlock *BlockMemAssigner::ApplyMemory(size_t block_size, size_t real_size,
             GE_IF_BOOL_EXEC(is_data == true, continue);
 
             // A node can reuse blocks of the same stream and preorder streams
-            if (CanReuseBySize(reusable_block_counts_, *reusable_block, block_size) &&
-                CanReuseByStream(map_iter->second, *reusable_block)) {
+            bool can_reuse_by_stream = stream_order_.IsValid() ? IsReleasedBefore(*reusable_block, n)
+                                                               : CanReuseByStream(map_iter->second, *reusable_block);
+            if (CanReuseBySize(reusable_block_counts_, *reusable_block, block_size) && can_reuse_by_stream) {
               GELOGD("Cross stream mem reuse, target stream:%ld, current stream:%ld", reusable_block->stream_id_,
                      stream_id);
               reusable_block->AddNodeTypeIndex({n, mem_type, out_index}, real_size);
               reusable_block->ref_count_++;
               ReduceReusableBlockCount(*reusable_block, reusable_block_counts_);
               reusable_blocks_.erase(it);
+              GE_IF_BOOL_EXEC(stream_order_.IsValid(), reusable_block->stream_id_ = stream_id);
+              reusable_block->last_users_.assign(1, n);
               return reusable_block;
             }
           }
@@ -308,6 +409,7 @@ MemoryBlock *BlockMemAssigner::ApplyMemory(size_t block_size, size_t real_size,
   block->Init(real_size, mem_type, n, out_index);
   block->stream_id_ = node_op_desc->GetStreamId();
   block->ref_count_++;
+  block->last_users_.emplace_back(n);
   memory_blocks_.emplace_back(block);
   return block;
 }
@@ -450,9 +552,11 @@ void BlockMemAssigner::ReleaseInputNodeOutMemory(const NodePtr &n,
       GELOGD("node_type_indexs: %d, %s", node_type_indexs.back().index_,
              node_type_indexs.back().node_->GetName().c_str());
 
+      // Readers on other streams only release the block when the stream order index can tell who runs after them
       if ((node_type_indexs.back().node_ == in_anchor->GetPeerOutAnchor()->GetOwnerNode()) &&
           (node_type_indexs.back().index_ == static_cast<uint32_t>(in_anchor->GetPeerOutAnchor()->GetIdx())) &&
-          n->GetOpDesc()->GetStreamId() == block->stream_id_) {
+          (stream_order_.IsValid() || (n->GetOpDesc()->GetStreamId() == block->stream_id_))) {
+        block->last_users_.emplace_back(n);
         ReleaseMemory(block, reusable_memory);
       }
     }
@@ -468,6 +572,7 @@ void BlockMemAssigner::ReleaseInputNodeOutMemory(const NodePtr &n,
 void BlockMemAssigner::AssignMemoryWithReuse(vector<int64_t> &ranges) {
   // Init reusable streams map
   InitReusableStreamMap();
+  stream_order_.Build(compute_graph_);
   string ge_disable_reuse_mem_env = "0";
   (void)ge::GetContext().GetOption("ge.exec.disableReuseMemory", ge_disable_reuse_mem_env);
 
@@ -519,6 +624,12 @@ void BlockMemAssigner::AssignMemoryWithReuse(vector<int64_t> &ranges) {
       stream_workspace_blocks_[stream_id].emplace_back(mem_block);
     }
     ReleaseInputNodeOutMemory(n, node_out_blocks_, reusable_blocks_);
+    // With the stream order index a workspace is free for any node running after its owner, not only the next
+    // node of the same stream
+    if ((ge_disable_reuse_mem_env != "1") && stream_order_.IsValid()) {
+      ReleaseMemorys(stream_workspace_blocks_[stream_id], reusable_blocks_);
+      stream_workspace_blocks_[stream_id].clear();
+    }
   }
 
   GELOGD("Assigned memory blocks:");
@@ -781,6 +892,20 @@ void BlockMemAssigner::FindDependentStream(map<int64_t, pair<NodePtr, NodePtr>>
   }
 }
 
+bool BlockMemAssigner::IsReleasedBefore(const MemoryBlock &block, const NodePtr &n) const {
+  for (const auto &user : block.last_users_) {
+    if ((user == nullptr) || !stream_order_.HappensBefore(user.get(), n.get())) {
+      return false;
+    }
+  }
+  return true;
+}
+
+bool BlockMemAssigner::IsReusableStream(int64_t stream_id, int64_t reused_stream_id) const {
+  auto iter = reusable_streams_map_.find(stream_id);
+  return (iter != reusable_streams_map_.end()) && (iter->second.count(reused_stream_id) > 0);
+}
+
 bool BlockMemAssigner::CheckIsZeroMemNodeType(const string &node_type) const {
   return (node_type == VARIABLE) || (node_type == CONSTANT) || (node_type == MULTISHAPE) ||
       (node_type == HCOMBROADCAST) || (node_type == HCOMALLREDUCE) || (node_type == CONSTANTOP) ||
@@ -42,6 +42,44 @@ struct NodeTypeIndex {
   uint32_t index_ = 0;
 };
 
+///
+/// @ingroup GE
+/// @brief happens-before order of the nodes of a graph whose logical streams are assigned.
+///        Tasks of one stream run in node order and StreamAllocator::InsertSyncEvents turns every data/control
+///        edge between two streams into a send/recv event, so a node has finished before another one starts when
+///        a path of such edges leads from it to the other. Each node keeps a vector clock with, per stream, the last
+///        position on that stream known to run before it.
+///
+class StreamOrderIndex {
+ public:
+  ///
+  /// @ingroup GE
+  /// @brief build the clocks. The index stays invalid when the graph is not in topological order or has streams
+  ///        activated at runtime, whose tasks may run again in a loop
+  /// @param [in] graph graph with logical streams assigned
+  /// @return void
+  ///
+  void Build(const ge::ComputeGraphPtr &graph);
+
+  bool IsValid() const { return valid_; }
+
+  ///
+  /// @ingroup GE
+  /// @brief whether src has finished on the device before dst starts
+  /// @return bool false when either node runs no task or the order is unknown
+  ///
+  bool HappensBefore(const ge::Node *src, const ge::Node *dst) const;
+
+ private:
+  bool valid_ = false;
+  size_t stream_num_ = 0;
+  std::unordered_map<const ge::Node *, size_t> rows_;
+  std::vector<size_t> row_streams_;
+  std::vector<int64_t> row_positions_;
+  // rows_.size() x stream_num_, -1 when no node of the stream runs before
+  std::vector<int64_t> clocks_;
+};
+
 class MemoryBlock {
  public:
   explicit MemoryBlock(size_t block_size)
@@ -89,6 +127,8 @@ class MemoryBlock {
   int ref_count_;
   int64_t stream_id_;
   bool deleted_block_;
+  // nodes reading or writing the block since it was last applied
+  std::vector<ge::NodePtr> last_users_;
 
  private:
   size_t block_size_;
@@ -98,6 +138,23 @@ class MemoryBlock {
   std::vector<NodeTypeIndex> node_type_index_list_;
 };
 
+///
+/// @ingroup domi
+/// @brief check whether the input idx of node is passed through to the graph output
+/// @param [in] node node to check
+/// @param [in] idx input index of node
+/// @return bool true: direct output; false: not direct output
+///
+bool IsDirectOutputNode(const ge::NodePtr &node, int idx);
+
+///
+/// @ingroup domi
+/// @brief check whether the tensor feeding in_data_anchor is listed in out_nodes_map
+/// @param [in] in_data_anchor consumer anchor of the tensor
+/// @return bool true: is output block; false: is not output block
+///
+bool IsOutputBlock(const ge::InDataAnchorPtr &in_data_anchor);
+
 class BlockMemAssigner : public MemAssigner {
  public:
   explicit BlockMemAssigner(ge::ComputeGraphPtr compute_graph);
@@ -125,7 +182,7 @@ class BlockMemAssigner : public MemAssigner {
   /// @param [in] ranges memory range provided
   /// @author
   ///
-  void AssignMemoryWithReuse(std::vector<int64_t> &ranges);
+  virtual void AssignMemoryWithReuse(std::vector<int64_t> &ranges);
 
   void SetOpMemOffset();
 
@@ -181,6 +238,24 @@ class BlockMemAssigner : public MemAssigner {
   ///
   bool CheckIsZeroMemNodeType(const std::string &node_type) const;
 
+  ///
+  /// @ingroup GE
+  /// @brief Determine whether every user of a released block has finished before node n starts.
+  /// @param [in] block released block
+  /// @param [in] n node to apply memory for
+  /// @return bool true: n may reuse the block
+  ///
+  bool IsReleasedBefore(const MemoryBlock &block, const ge::NodePtr &n) const;
+
+  ///
+  /// @ingroup GE
+  /// @brief Determine whether stream_id may take over blocks released by reused_stream_id, per InitReusableStreamMap.
+  /// @param [in] stream_id stream applying memory
+  /// @param [in] reused_stream_id stream the block was released on
+  /// @return bool true: can reuse
+  ///
+  bool IsReusableStream(int64_t stream_id, int64_t reused_stream_id) const;
+
   size_t mem_offset_;
 
   ge::ComputeGraphPtr compute_graph_;
@@ -189,6 +264,9 @@ class BlockMemAssigner : public MemAssigner {
 
   std::vector<NodeTypeIndex> zero_memory_list_;
 
+  // event order of the nodes, when valid it decides cross stream reuse instead of reusable_streams_map_
+  StreamOrderIndex stream_order_;
+
  private:
   ///
   /// @ingroup GE
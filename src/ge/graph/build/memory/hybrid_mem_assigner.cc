@@ -21,6 +21,7 @@
 
 #include "framework/common/debug/ge_log.h"
 #include "graph/build/memory/binary_block_mem_assigner.h"
+#include "graph/build/memory/lifetime_block_mem_assigner.h"
 #include "graph/build/memory/max_block_mem_assigner.h"
 
 namespace ge {
@@ -49,21 +50,30 @@ Status HybridMemAssigner::Assign() {
   std::unique_ptr<BlockMemAssigner> max_assigner(new (std::nothrow) MaxBlockMemAssigner(compute_graph_));
   GE_CHECK_NOTNULL(max_assigner);
 
+  std::unique_ptr<BlockMemAssigner> lifetime_assigner(new (std::nothrow) LifetimeBlockMemAssigner(compute_graph_));
+  GE_CHECK_NOTNULL(lifetime_assigner);
+
   size_t bin_mem_size = 0;
   size_t max_mem_size = 0;
+  size_t lifetime_mem_size = 0;
 
   GE_CHK_STATUS_RET(AssignMemory(binary_assigner, bin_mem_size), "BinaryBlock Method AssignMemory Fail!");
   GE_CHK_STATUS_RET(AssignMemory(max_assigner, max_mem_size), "MaxBlock Method AssignMemory Fail!");
+  GE_CHK_STATUS_RET(AssignMemory(lifetime_assigner, lifetime_mem_size), "Lifetime Method AssignMemory Fail!");
 
   std::unique_ptr<BlockMemAssigner> priority_assigner;
 
-  GELOGI("Binary-block memory size:%zu, max-block memory size:%zu", bin_mem_size, max_mem_size);
-  if (bin_mem_size <= max_mem_size) {
+  GELOGI("Binary-block memory size:%zu, max-block memory size:%zu, lifetime memory size:%zu", bin_mem_size,
+         max_mem_size, lifetime_mem_size);
+  if ((bin_mem_size <= max_mem_size) && (bin_mem_size <= lifetime_mem_size)) {
     GELOGI("Use binary-block memory assigner method");
     priority_assigner = std::move(binary_assigner);
-  } else {
+  } else if (max_mem_size <= lifetime_mem_size) {
     GELOGI("Use max-block memory assigner method");
     priority_assigner = std::move(max_assigner);
+  } else {
+    GELOGI("Use lifetime memory assigner method");
+    priority_assigner = std::move(lifetime_assigner);
   }
 
   priority_assigner->SetOpMemOffset();
@@ -0,0 +1,377 @@
+/**
+ * Copyright 2019-2020 Huawei Technologies Co., Ltd
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "graph/build/memory/lifetime_block_mem_assigner.h"
+
+#include <algorithm>
+#include <iterator>
+#include <map>
+#include <string>
+
+#include "framework/common/debug/ge_log.h"
+#include "graph/debug/ge_attr_define.h"
+#include "graph/ge_context.h"
+#include "graph/utils/attr_utils.h"
+#include "graph/utils/tensor_utils.h"
+
+namespace {
+const char *const kAttrNameWorkspaceReuseFlag = "workspace_reuse_flag";
+const char *const kL2FusionDynamicConvergeOp = "l2fusion_dynamic_converge_op";
+const char *const kDisableReuseMemory = "ge.exec.disableReuseMemory";
+
+size_t AlignMemSize(size_t size) { return (size + ge::kMemAlignSize - 1) / ge::kMemAlignSize * ge::kMemAlignSize; }
+
+// Live ranges [first, last] over topological indexes, finds the ones overlapping a range without visiting the others
+class LiveRangeIndex {
+ public:
+  explicit LiveRangeIndex(size_t max_index) : max_index_(max_index), tree_(4 * (max_index + 1)) {}
+
+  void Add(size_t first, size_t last, size_t id) {
+    Insert(1, 0, max_index_, first, last, id);
+    (void)by_first_.emplace(first, id);
+  }
+
+  // A range overlaps [first, last] if it holds first or starts after first and not after last
+  void GetOverlaps(size_t first, size_t last, std::vector<size_t> &ids) const {
+    size_t tree_node = 1;
+    size_t low = 0;
+    size_t high = max_index_;
+    while (true) {
+      ids.insert(ids.end(), tree_[tree_node].begin(), tree_[tree_node].end());
+      if (low == high) {
+        break;
+      }
+      size_t mid = low + (high - low) / 2;
+      if (first <= mid) {
+        tree_node = 2 * tree_node;
+        high = mid;
+      } else {
+        tree_node = 2 * tree_node + 1;
+        low = mid + 1;
+      }
+    }
+    for (auto iter = by_first_.upper_bound(first); (iter != by_first_.end()) && (iter->first <= last); ++iter) {
+      ids.emplace_back(iter->second);
+    }
+  }
+
+ private:
+  // A range is kept at the O(log n) segment tree nodes covering it
+  void Insert(size_t tree_node, size_t low, size_t high, size_t first, size_t last, size_t id) {
+    if ((first <= low) && (high <= last)) {
+      tree_[tree_node].emplace_back(id);
+      return;
+    }
+    size_t mid = low + (high - low) / 2;
+    if (first <= mid) {
+      Insert(2 * tree_node, low, mid, first, last, id);
+    }
+    if (last > mid) {
+      Insert(2 * tree_node + 1, mid + 1, high, first, last, id);
+    }
+  }
+
+  size_t max_index_;
+  std::vector<std::vector<size_t>> tree_;
+  std::multimap<size_t, size_t> by_first_;
+};
+
+// Live ranges of one stream, by first and by last index
+struct StreamLiveRanges {
+  std::multimap<size_t, size_t> by_first;
+  std::multimap<size_t, size_t> by_last;
+};
+
+// Best fit: the start of the smallest hole between the address ranges sorted by start, otherwise on top of them
+template <typename Ranges>
+size_t BestFitOffset(const Ranges &ranges, size_t size) {
+  size_t cursor = 0;
+  size_t best_offset = 0;
+  size_t best_gap = 0;
+  bool found = false;
+  for (const auto &range : ranges) {
+    if (range.first > cursor) {
+      size_t gap = range.first - cursor;
+      if ((gap >= size) && (!found || (gap < best_gap))) {
+        best_offset = cursor;
+        best_gap = gap;
+        found = true;
+      }
+    }
+    cursor = std::max(cursor, range.second);
+  }
+  return found ? best_offset : cursor;
+}
+
+// Add [head, end) to the merged address ranges
+void AddOccupied(size_t head, size_t end, std::map<size_t, size_t> &occupied) {
+  auto iter = occupied.upper_bound(head);
+  if (iter != occupied.begin()) {
+    auto prev = std::prev(iter);
+    if (prev->second >= head) {
+      head = prev->first;
+      end = std::max(end, prev->second);
+      iter = occupied.erase(prev);
+    }
+  }
+  while ((iter != occupied.end()) && (iter->first <= end)) {
+    end = std::max(end, iter->second);
+    iter = occupied.erase(iter);
+  }
+  occupied[head] = end;
+}
+}  // namespace
+
+namespace ge {
+using std::map;
+using std::pair;
+using std::string;
+using std::vector;
+
+Status LifetimeBlockMemAssigner::GetMemoryRanges(std::vector<int64_t> &ranges) {
+  // Block sizes are exact, ranges only tell the caller whether there is memory to plan at all
+  GetOutAndWorkSpaceMem(ranges);
+  return SUCCESS;
+}
+
+void LifetimeBlockMemAssigner::AssignMemoryWithReuse(std::vector<int64_t> &ranges) {
+  (void)ranges;
+  InitReusableStreamMap();
+
+  string ge_disable_reuse_mem_env = "0";
+  (void)ge::GetContext().GetOption(kDisableReuseMemory, ge_disable_reuse_mem_env);
+
+  node_index_.clear();
+  size_t index = 0;
+  for (const NodePtr &n : compute_graph_->GetDirectNode()) {
+    node_index_[n.get()] = index++;
+  }
+  GE_IF_BOOL_EXEC(index == 0, return);
+  graph_end_ = index - 1;
+
+  CollectLifetimes(ge_disable_reuse_mem_env == "1");
+  PackLifetimes();
+
+  GELOGD("Lifetime planned memory blocks:");
+  for (auto mem_block : memory_blocks_) {
+    GELOGD("%s", mem_block->String().c_str());
+    (void)mem_block;  // Fix warning
+  }
+}
+
+void LifetimeBlockMemAssigner::CollectLifetimes(bool disable_reuse) {
+  for (const NodePtr &n : compute_graph_->GetDirectNode()) {
+    auto node_op_desc = n->GetOpDesc();
+    GE_IF_BOOL_EXEC(node_op_desc == nullptr, continue);
+    size_t node_index = node_index_[n.get()];
+    int64_t stream_id = node_op_desc->GetStreamId();
+
+    for (uint32_t i = 0; i < static_cast<uint32_t>(node_op_desc->GetOutputsSize()); i++) {
+      uint32_t size = 0;
+      bool reuse_input = false;
+      uint32_t reuse_input_index = 0;
+      auto output_op_desc = node_op_desc->GetOutputDescPtr(i);
+      if (output_op_desc != nullptr) {
+        GE_IF_BOOL_EXEC(ge::TensorUtils::GetSize(*output_op_desc, size) != SUCCESS, GELOGI("Get size failed"));
+        GE_IF_BOOL_EXEC(ge::TensorUtils::GetReuseInput(*output_op_desc, reuse_input) != SUCCESS,
+                        GELOGI("Get reuse_input failed"));
+        GE_IF_BOOL_EXEC(ge::TensorUtils::GetReuseInputIndex(*output_op_desc, reuse_input_index) != SUCCESS,
+                        GELOGI("Get reuse_input_index failed"));
+      }
+      if ((size == 0) || CheckIsZeroMemNodeType(n->GetType())) {
+        zero_memory_list_.emplace_back(n, kOutput, i);
+        continue;
+      }
+
+      // Output written in place of an input shares the input block and extends its lifetime
+      if (reuse_input) {
+        auto in_data_anchor = n->GetInDataAnchor(reuse_input_index);
+        auto peer_out_anchor = (in_data_anchor == nullptr) ? nullptr : in_data_anchor->GetPeerOutAnchor();
+        if (peer_out_anchor != nullptr) {
+          auto src_key = std::make_pair(peer_out_anchor->GetOwnerNode().get(),
+                                        static_cast<uint32_t>(peer_out_anchor->GetIdx()));
+          auto iter = output_lifetime_index_.find(src_key);
+          if (iter != output_lifetime_index_.end()) {
+            TensorLifetime &src = lifetimes_[iter->second];
+            src.block->AddNodeTypeIndex({n, kOutput, i}, src.block->Size());
+            src.last = (src.stream_id == stream_id) ? std::max(src.last, GetLastUse(n, i)) : graph_end_;
+            if (IsPinnedOutput(n, i)) {
+              // A pinned block lives through the whole graph, PackLifetimes relies on it
+              src.pinned = true;
+              src.first = 0;
+              src.last = graph_end_;
+            }
+            output_lifetime_index_[std::make_pair(n.get(), i)] = iter->second;
+            continue;
+          }
+        }
+        GELOGW("Node %s output %u reuse input %u source not found, apply new block.", n->GetName().c_str(), i,
+               reuse_input_index);
+      }
+
+      auto block = new (std::nothrow) MemoryBlock(AlignMemSize(size));
+      GE_CHK_BOOL_TRUE_EXEC_WITH_LOG(block == nullptr, continue, "new an object failed.");
+      block->Init(size, kOutput, n, i);
+      block->stream_id_ = stream_id;
+      memory_blocks_.emplace_back(block);
+
+      bool pinned = disable_reuse || IsPinnedOutput(n, i);
+      output_lifetime_index_[std::make_pair(n.get(), i)] = lifetimes_.size();
+      lifetimes_.push_back({block, stream_id, pinned ? 0 : node_index, pinned ? graph_end_ : GetLastUse(n, i),
+                            pinned});
+    }
+
+    vector<int64_t> temp;
+    GetNodeWorkSpaceSize(n, temp);
+    vector<bool> workspace_reuse_flag;
+    GE_IF_BOOL_EXEC(!ge::AttrUtils::GetListBool(node_op_desc, kAttrNameWorkspaceReuseFlag, workspace_reuse_flag),
+                    GELOGI("OP %s get workspace_reuse_flag attr failed", node_op_desc->GetName().c_str()));
+    for (size_t i = 0; i < temp.size(); i++) {
+      if (temp[i] <= 0) {
+        zero_memory_list_.emplace_back(n, kWorkspace, static_cast<uint32_t>(i));
+        continue;
+      }
+      auto block = new (std::nothrow) MemoryBlock(AlignMemSize(static_cast<size_t>(temp[i])));
+      GE_CHK_BOOL_TRUE_EXEC_WITH_LOG(block == nullptr, continue, "new an object failed.");
+      block->Init(static_cast<size_t>(temp[i]), kWorkspace, n, static_cast<uint32_t>(i));
+      block->stream_id_ = stream_id;
+      memory_blocks_.emplace_back(block);
+
+      bool pinned = disable_reuse || ((workspace_reuse_flag.size() > i) && !workspace_reuse_flag[i]);
+      lifetimes_.push_back({block, stream_id, pinned ? 0 : node_index, pinned ? graph_end_ : node_index, pinned});
+    }
+  }
+}
+
+size_t LifetimeBlockMemAssigner::GetLastUse(const NodePtr &node, uint32_t index) const {
+  auto out_data_anchor = node->GetOutDataAnchor(index);
+  GE_IF_BOOL_EXEC(out_data_anchor == nullptr, return graph_end_);
+  auto peer_in_anchors = out_data_anchor->GetPeerInDataAnchors();
+  GE_IF_BOOL_EXEC(peer_in_anchors.empty(), return graph_end_);
+
+  int64_t stream_id = node->GetOpDesc()->GetStreamId();
+  size_t last_use = node_index_.at(node.get());
+  for (const auto &in_anchor : peer_in_anchors) {
+    auto owner_node = in_anchor->GetOwnerNode();
+    GE_IF_BOOL_EXEC((owner_node == nullptr) || (owner_node->GetOpDesc() == nullptr), return graph_end_);
+    // Reads from another stream are not ordered by the topological index, keep the tensor alive
+    if ((owner_node->GetOpDesc()->GetStreamId() != stream_id) || IsOutputBlock(in_anchor)) {
+      return graph_end_;
+    }
+    auto iter = node_index_.find(owner_node.get());
+    GE_IF_BOOL_EXEC(iter == node_index_.end(), return graph_end_);
+    last_use = std::max(last_use, iter->second);
+  }
+  return last_use;
+}
+
+bool LifetimeBlockMemAssigner::IsPinnedOutput(const NodePtr &node, uint32_t index) const {
+  auto node_op_desc = node->GetOpDesc();
+  int64_t convergence_label = 0;
+  if (ge::AttrUtils::GetInt(node_op_desc, kL2FusionDynamicConvergeOp, convergence_label)) {
+    return true;
+  }
+
+  string type = node_op_desc->GetType();
+  if ((type == DATA_TYPE) || (type == AIPP_DATA_TYPE) || (type == ANN_DATA_TYPE) || (type == CONSTANT) ||
+      (type == CONSTANTOP) || (type == NETOUTPUT) || (type == PROPOSAL) || (type == ZEROSLIKE) ||
+      (type == FASTRCNNPREDICTIONS) || (type == ENTER) || (type == REFENTER) || (type == NEXTITERATION) ||
+      (type == REFNEXTITERATION)) {
+    return true;
+  }
+
+  auto out_data_anchor = node->GetOutDataAnchor(index);
+  GE_IF_BOOL_EXEC(out_data_anchor == nullptr, return true);
+  for (const auto &in_anchor : out_data_anchor->GetPeerInDataAnchors()) {
+    if (IsDirectOutputNode(in_anchor->GetOwnerNode(), in_anchor->GetIdx())) {
+      return true;
+    }
+  }
+  return false;
+}
+
+void LifetimeBlockMemAssigner::PackLifetimes() {
+  vector<size_t> order(lifetimes_.size());
+  for (size_t i = 0; i < order.size(); ++i) {
+    order[i] = i;
+  }
+  std::stable_sort(order.begin(), order.end(), [this](size_t left, size_t right) {
+    size_t left_size = lifetimes_[left].block->Size();
+    size_t right_size = lifetimes_[right].block->Size();
+    if (left_size != right_size) {
+      return left_size > right_size;
+    }
+    return lifetimes_[left].first < lifetimes_[right].first;
+  });
+
+  // Placed lifetimes are indexed so that a block only visits the ones it conflicts with:
+  // the ones overlapping it in time, which include the pinned ones as they span the whole graph,
+  // and on the streams it may not share memory with, the ones before or after it
+  LiveRangeIndex overlap_index(graph_end_);
+  map<int64_t, StreamLiveRanges> stream_ranges;
+  // Merged address ranges of all placed blocks, a pinned block conflicts with every one of them
+  map<size_t, size_t> occupied;
+  vector<size_t> conflict_ids;
+  vector<pair<size_t, size_t>> conflicts;
+  for (size_t current : order) {
+    TensorLifetime &lifetime = lifetimes_[current];
+    size_t size = lifetime.block->Size();
+
+    size_t offset = 0;
+    if (lifetime.pinned) {
+      offset = BestFitOffset(occupied, size);
+    } else {
+      conflict_ids.clear();
+      overlap_index.GetOverlaps(lifetime.first, lifetime.last, conflict_ids);
+      for (const auto &stream_iter : stream_ranges) {
+        if (stream_iter.first == lifetime.stream_id) {
+          continue;
+        }
+        const StreamLiveRanges &ranges = stream_iter.second;
+        if (!IsReusableStream(lifetime.stream_id, stream_iter.first)) {
+          auto end = ranges.by_last.lower_bound(lifetime.first);
+          for (auto iter = ranges.by_last.begin(); iter != end; ++iter) {
+            conflict_ids.emplace_back(iter->second);
+          }
+        }
+        if (!IsReusableStream(stream_iter.first, lifetime.stream_id)) {
+          for (auto iter = ranges.by_first.upper_bound(lifetime.last); iter != ranges.by_first.end(); ++iter) {
+            conflict_ids.emplace_back(iter->second);
+          }
+        }
+      }
+
+      conflicts.clear();
+      for (size_t other : conflict_ids) {
+        MemoryBlock *other_block = lifetimes_[other].block;
+        conflicts.emplace_back(other_block->HeadOffset(), other_block->HeadOffset() + other_block->Size());
+      }
+      std::sort(conflicts.begin(), conflicts.end());
+      offset = BestFitOffset(conflicts, size);
+    }
+
+    lifetime.block->SetHeadOffset(offset);
+    lifetime.block->SetTailOffset(offset + size - 1);
+    mem_offset_ = std::max(mem_offset_, offset + size);
+    overlap_index.Add(lifetime.first, lifetime.last, current);
+    StreamLiveRanges &ranges = stream_ranges[lifetime.stream_id];
+    (void)ranges.by_first.emplace(lifetime.first, current);
+    (void)ranges.by_last.emplace(lifetime.last, current);
+    AddOccupied(offset, offset + size, occupied);
+  }
+  GELOGI("Lifetime planner packed %zu blocks into %zu bytes", lifetimes_.size(), mem_offset_);
+}
+}  // namespace ge
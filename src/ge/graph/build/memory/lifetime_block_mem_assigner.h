@@ -0,0 +1,92 @@
+/**
+ * Copyright 2019-2020 Huawei Technologies Co., Ltd
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef GE_GRAPH_BUILD_MEMORY_LIFETIME_BLOCK_MEM_ASSIGNER_H_
+#define GE_GRAPH_BUILD_MEMORY_LIFETIME_BLOCK_MEM_ASSIGNER_H_
+
+#include <map>
+#include <utility>
+#include <vector>
+
+#include "graph/build/memory/block_mem_assigner.h"
+
+namespace ge {
+///
+/// @ingroup domi
+/// @brief plan feature map memory by tensor lifetime instead of size buckets.
+///        Every output/workspace gets its own block whose live range is taken from the topological order,
+///        blocks are then packed greedy-by-size into the best fitting gap among the blocks they overlap with.
+///
+class LifetimeBlockMemAssigner : public BlockMemAssigner {
+ public:
+  explicit LifetimeBlockMemAssigner(ge::ComputeGraphPtr compute_graph) : BlockMemAssigner(std::move(compute_graph)) {}
+
+  LifetimeBlockMemAssigner(const LifetimeBlockMemAssigner &) = delete;
+
+  LifetimeBlockMemAssigner &operator=(const LifetimeBlockMemAssigner &) = delete;
+
+  ~LifetimeBlockMemAssigner() override = default;
+
+  Status GetMemoryRanges(std::vector<int64_t> &ranges) override;
+
+  void AssignMemoryWithReuse(std::vector<int64_t> &ranges) override;
+
+ private:
+  struct TensorLifetime {
+    MemoryBlock *block;
+    int64_t stream_id;
+    size_t first;
+    size_t last;
+    bool pinned;
+  };
+
+  ///
+  /// @ingroup domi
+  /// @brief collect one lifetime per output/workspace, outputs reusing an input join the source lifetime
+  /// @param [in] disable_reuse all tensors live through the whole graph
+  /// @return void
+  ///
+  void CollectLifetimes(bool disable_reuse);
+
+  ///
+  /// @ingroup domi
+  /// @brief last topological index the output is read at, the graph end when it escapes its stream
+  /// @param [in] node producer node
+  /// @param [in] index output index
+  /// @return size_t last use index
+  ///
+  size_t GetLastUse(const ge::NodePtr &node, uint32_t index) const;
+
+  bool IsPinnedOutput(const ge::NodePtr &node, uint32_t index) const;
+
+  ///
+  /// @ingroup domi
+  /// @brief place blocks largest first at the smallest gap left by the conflicting blocks already placed.
+  ///        Placed blocks are indexed by live range and stream, so a block only visits the ones it conflicts with
+  /// @return void
+  ///
+  void PackLifetimes();
+
+  std::vector<TensorLifetime> lifetimes_;
+
+  std::map<std::pair<const ge::Node *, uint32_t>, size_t> output_lifetime_index_;
+
+  std::map<const ge::Node *, size_t> node_index_;
+
+  size_t graph_end_ = 0;
+};
+}  // namespace ge
+#endif  // GE_GRAPH_BUILD_MEMORY_LIFETIME_BLOCK_MEM_ASSIGNER_H_
@@ -525,6 +525,7 @@ Status ModelBuilder::BuildModelForGetTask(ge::Model &model) {
 
   // Assign logical streams.
   StreamAllocator stream_allocator(compute_graph_, subgraphs_);
+  stream_allocator.SetOpCosts(stream_op_cost_);
   GE_CHK_STATUS_RET(stream_allocator.AssignLogicalStreams(stream_max_parallel_num_, hcom_parallel_),
                     "Assign logical streams failed.");
 
@@ -538,6 +539,11 @@ Status ModelBuilder::BuildModelForGetTask(ge::Model &model) {
 
   GE_CHK_STATUS_RET(MergeWeights(), "MergeWeights Failed!");
   GE_CHK_STATUS_RET(BuildModelDef(model), "BuildModelDef failed!");
+  if (stream_allocator.GetMakespan() > 0) {
+    GE_CHK_BOOL_EXEC(ge::AttrUtils::SetInt(&model, ATTR_MODEL_ESTIMATED_MAKESPAN, stream_allocator.GetMakespan()),
+                     GELOGE(FAILED, "SetInt of ATTR_MODEL_ESTIMATED_MAKESPAN failed.");
+                     return FAILED);
+  }
 
   SetModelVersion(model);
 
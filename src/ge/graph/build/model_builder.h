@@ -54,6 +54,12 @@ class ModelBuilder {
 
   ge::Buffer GetWeightBuffer() const;
 
+  ///
+  /// set the estimated execution time of op types to assign logical streams by.
+  /// @param stream_op_cost op type to cost, streams are assigned by dependency when it is empty
+  ///
+  void SetStreamOpCost(const std::map<std::string, int> &stream_op_cost) { stream_op_cost_ = stream_op_cost; }
+
  protected:
   Status AssignMemory();
 
@@ -95,6 +101,7 @@ class ModelBuilder {
   ge::Buffer weight_buffer_;
 
   std::map<std::string, int> stream_max_parallel_num_;
+  std::map<std::string, int> stream_op_cost_;
   bool hcom_parallel_;
 
   int build_mode_;
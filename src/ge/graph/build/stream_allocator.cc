@@ -16,6 +16,7 @@
 
 #include "graph/build/stream_allocator.h"
 
+#include <algorithm>
 #include <memory>
 
 #include "common/ge/ge_util.h"
@@ -37,6 +38,9 @@ const int64_t kMaxNodeNumInNormalStream = 350;
 const int64_t kMaxNodeNumInHcomStream = 5;
 
 const uint32_t kMaxSwitchStreamNum = 1;
+
+// Clock entry of a stream none of whose nodes is known to be done
+const int64_t kNoPosition = -1;
 }  // namespace
 
 namespace ge {
@@ -55,11 +59,13 @@ Status StreamAllocator::AssignLogicalStreams(const std::map<std::string, int> &m
   const map<string, SchedulerConf> &scheduler_confs = gelib->DNNEngineManagerObj().GetSchedulers();
 
   LogicalStreamAllocator logical_allocator(scheduler_confs, max_parallel_num, hcom_parallel);
+  logical_allocator.SetOpCosts(op_costs_);
   Status status = logical_allocator.Assign(whole_graph_, subgraphs_, stream_num_);
   if (status != SUCCESS) {
     GELOGE(status, "Assign logical streams failed.");
     return status;
   }
+  makespan_ = logical_allocator.GetMakespan();
 
   GraphUtils::DumpGEGraph(whole_graph_, "AfterAssignedLogicalStreams_whole_graph");
   GraphUtils::DumpGEGraphToOnnx(*whole_graph_, "AfterAssignedLogicalStreams_whole_graph");
@@ -426,23 +432,9 @@ Status StreamAllocator::InsertOneEventInTwoNodes(const NodePtr &cur_node, const
 
 // Optimize the event in the graph, delete the redundant sync event according to the stream information
 Status StreamAllocator::OptimizeSyncEvents() {
-  map<int64_t, vector<NodePtr>> stream_nodes;
-
-  for (const auto &node : whole_graph_->GetDirectNode()) {
-    GE_CHECK_NOTNULL(node->GetOpDesc());
-    int64_t stream_id = node->GetOpDesc()->GetStreamId();
-    stream_nodes[stream_id].emplace_back(node);
-  }
-
-  Status status = OptimizeBySendEvents(stream_nodes);
+  Status status = OptimizeByVectorClock();
   if (status != SUCCESS) {
-    GELOGE(status, "OptimizeBySendEvents failed!");
-    return status;
-  }
-
-  status = OptimizeByRecvEvents(stream_nodes);
-  if (status != SUCCESS) {
-    GELOGE(status, "OptimizeByRecvEvents failed!");
+    GELOGE(status, "OptimizeByVectorClock failed!");
     return status;
   }
 
@@ -455,92 +447,102 @@ Status StreamAllocator::OptimizeSyncEvents() {
   return SUCCESS;
 }
 
-/// Optimization scenario: one stream has multiple send events in one node,
-/// and multiple nodes for recv events on another stream
-/// Example:
-/// Stream0            Stream1
+/// Remove the events implied by the stream order and the other events, also through a third stream.
+/// The nodes are visited in graph order, which is the order of their tasks on a stream. Every node gets a vector
+/// clock holding, per stream, the position of the last node of the stream known to be done before the node starts.
+/// An event is redundant when the send node is covered by the clock of the recv node joined with the clocks of the
+/// send nodes of its other kept events. The kept events imply all the removed ones, so the clocks stay the same.
+/// This covers one send node with events to several nodes of a stream, several send nodes of a stream with events
+/// to one node, and events implied through a third stream. Example:
+/// Stream0            Stream1            Stream2
 ///   N1 - - - event - > N1
-///     \                |
-///      \               v
-///        - - event - > N2
-Status StreamAllocator::OptimizeBySendEvents(const map<int64_t, vector<NodePtr>> &stream_nodes) {
-  for (const auto &one_pair : stream_nodes) {
-    // The nodes on a stream in order
-    const vector<NodePtr> &nodes = one_pair.second;
+///   |                  |
+///   |                  v
+///   |                  N2 - - - event - > N1
+///   |                                     |
+///   |                                     v
+///    - - - - - - - - event (removed) - - > N2
+Status StreamAllocator::OptimizeByVectorClock() {
+  int64_t clock_size = 0;
+  for (const auto &node : whole_graph_->GetDirectNode()) {
+    GE_CHECK_NOTNULL(node->GetOpDesc());
+    clock_size = std::max(clock_size, node->GetOpDesc()->GetStreamId() + 1);
+  }
 
-    map<NodePtr, uint32_t> send_node_to_event_id;
+  map<uint32_t, NodePtr> send_event_to_node;
+  size_t event_num = 0;
+  for (const auto &one_pair : node_to_send_events_) {
+    for (const auto &event_id : one_pair.second) {
+      send_event_to_node[event_id] = one_pair.first;
+      ++event_num;
+    }
+  }
 
-    for (const auto &recv_node_ptr : nodes) {
-      GE_CHECK_NOTNULL(recv_node_ptr);
-      // Get all recv events of the current node, then traverse the event
-      vector<uint32_t> recv_events;
-      GetRecvEventIdList(recv_node_ptr, recv_events);
-
-      for (const auto &event_id : recv_events) {
-        NodePtr send_node_ptr = GetNodeFromSendEventId(event_id);
-        GE_CHECK_NOTNULL(send_node_ptr);
-
-        /// If the record to the stream is found in the map,
-        /// and the recv node is the node, then remove sync event
-        if (send_node_to_event_id.find(send_node_ptr) != send_node_to_event_id.end()) {
-          RmvSendEventId(send_node_ptr, event_id);
-          RmvRecvEventId(recv_node_ptr, event_id);
-          GELOGI("Remove send event %u for node: %s", event_id, send_node_ptr->GetName().c_str());
-          GELOGI("Remove recv event %u for node: %s", event_id, recv_node_ptr->GetName().c_str());
-        } else {
-          send_node_to_event_id[send_node_ptr] = event_id;
-        }
+  // The clock after the last visited node of each stream, and the clock after each send node
+  vector<vector<int64_t>> stream_clocks(static_cast<size_t>(clock_size), vector<int64_t>(clock_size, kNoPosition));
+  map<NodePtr, vector<int64_t>> send_node_clocks;
+  size_t removed_num = 0;
+  for (const auto &node : whole_graph_->GetDirectNode()) {
+    int64_t stream_id = node->GetOpDesc()->GetStreamId();
+    if (stream_id < 0) {
+      continue;
+    }
+    vector<int64_t> &clock = stream_clocks[stream_id];
+    int64_t position = clock[stream_id] + 1;
+
+    vector<uint32_t> recv_events;
+    GetRecvEventIdList(node, recv_events);
+    // The send node and clock of each recv event, the clock is null when it is not used to cover the others
+    vector<NodePtr> send_nodes(recv_events.size());
+    vector<const vector<int64_t> *> send_clocks(recv_events.size(), nullptr);
+    for (size_t i = 0; i < recv_events.size(); ++i) {
+      auto send_iter = send_event_to_node.find(recv_events[i]);
+      if (send_iter == send_event_to_node.end()) {
+        GELOGE(FAILED, "Node %s receives event %u which is never sent.", node->GetName().c_str(), recv_events[i]);
+        return FAILED;
+      }
+      send_nodes[i] = send_iter->second;
+      // A send node not visited yet is later in graph order, as in a loop, its event is kept
+      auto clock_iter = send_node_clocks.find(send_nodes[i]);
+      if (clock_iter != send_node_clocks.end()) {
+        send_clocks[i] = &clock_iter->second;
       }
     }
-  }
 
-  return SUCCESS;
-}
+    for (size_t i = 0; i < recv_events.size(); ++i) {
+      if (send_clocks[i] == nullptr) {
+        continue;
+      }
+      int64_t send_stream_id = send_nodes[i]->GetOpDesc()->GetStreamId();
+      int64_t send_position = (*send_clocks[i])[send_stream_id];
+      bool covered = (clock[send_stream_id] >= send_position);
+      for (size_t j = 0; (j < recv_events.size()) && !covered; ++j) {
+        covered = (j != i) && (send_clocks[j] != nullptr) && ((*send_clocks[j])[send_stream_id] >= send_position);
+      }
+      if (covered) {
+        RmvSendEventId(send_nodes[i], recv_events[i]);
+        RmvRecvEventId(node, recv_events[i]);
+        send_clocks[i] = nullptr;
+        ++removed_num;
+        GELOGI("Remove event %u between node %s and node %s.", recv_events[i], send_nodes[i]->GetName().c_str(),
+               node->GetName().c_str());
+      }
+    }
 
-/// Scenario: multiple send nodes on a stream sent to a single recv node on the destination stream
-/// Example:
-/// Stream0            Stream1
-///   N1 - -
-///   |    |
-///   |    - - event - - -
-///   |                  |
-///   V                  V
-///   N2 - - - event - > N2
-Status StreamAllocator::OptimizeByRecvEvents(const map<int64_t, vector<NodePtr>> &stream_nodes) {
-  for (const auto &one_pair : stream_nodes) {
-    // The nodes on a stream in order
-    const vector<NodePtr> &nodes = one_pair.second;
-
-    map<NodePtr, uint32_t> recv_node_to_event_id;
-
-    for (const auto &send_node_ptr : nodes) {
-      GE_CHECK_NOTNULL(send_node_ptr);
-      //  Get all send events of the current node, then traverse the event
-      vector<uint32_t> send_id_list;
-      GetSendEventIdList(send_node_ptr, send_id_list);
-
-      for (const auto &event_id : send_id_list) {
-        NodePtr recv_node_ptr = GetNodeFromRecvEventId(event_id);
-        GE_CHECK_NOTNULL(recv_node_ptr);
-
-        /// If the record to the stream is found in the map,
-        /// and the send node is the node, then remove sync event
-        auto it = recv_node_to_event_id.find(recv_node_ptr);
-        if (it != recv_node_to_event_id.end()) {
-          uint32_t pre_event_id = it->second;
-          NodePtr pre_send_node_ptr = GetNodeFromSendEventId(pre_event_id);
-          GE_CHECK_NOTNULL(pre_send_node_ptr);
-
-          RmvSendEventId(pre_send_node_ptr, pre_event_id);
-          RmvRecvEventId(recv_node_ptr, pre_event_id);
-          GELOGI("Remove event %u between node %s and node %s.", event_id, pre_send_node_ptr->GetName().c_str(),
-                 recv_node_ptr->GetName().c_str());
+    for (const auto &send_clock : send_clocks) {
+      if (send_clock != nullptr) {
+        for (size_t k = 0; k < clock.size(); ++k) {
+          clock[k] = std::max(clock[k], (*send_clock)[k]);
         }
-        recv_node_to_event_id[recv_node_ptr] = event_id;
       }
     }
+    clock[stream_id] = position;
+    if (node_to_send_events_.find(node) != node_to_send_events_.end()) {
+      send_node_clocks[node] = clock;
+    }
   }
 
+  GELOGI("OptimizeByVectorClock removed %zu of %zu events.", removed_num, event_num);
   return SUCCESS;
 }
 
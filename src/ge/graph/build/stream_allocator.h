@@ -37,8 +37,12 @@ class StreamAllocator {
   StreamAllocator &operator=(const StreamAllocator &) = delete;
   ~StreamAllocator() = default;
 
+  // Estimated execution time of op types, the logical streams are assigned by them when there are any
+  void SetOpCosts(const std::map<std::string, int> &op_costs) { op_costs_ = op_costs; }
   Status AssignLogicalStreams(const std::map<std::string, int> &max_parallel_num, bool hcom_parallel);
   Status RefreshRealStream(int64_t &stream_num, int64_t &event_num);
+  // Estimated makespan of the streams assigned by op costs, 0 when no op cost is set
+  int64_t GetMakespan() const { return makespan_; }
 
  private:
   Status SplitStreams();
@@ -51,8 +55,7 @@ class StreamAllocator {
   Status InsertOneEventInTwoNodes(const NodePtr &cur_node_ptr, const NodePtr &next_node_ptr);
 
   Status OptimizeSyncEvents();
-  Status OptimizeBySendEvents(const std::map<int64_t, std::vector<NodePtr>> &stream_nodes);
-  Status OptimizeByRecvEvents(const std::map<int64_t, std::vector<NodePtr>> &stream_nodes);
+  Status OptimizeByVectorClock();
   Status OptimizeByStreamActivate();
 
   Status RefreshContinuousEvents();
@@ -77,6 +80,8 @@ class StreamAllocator {
 
   ComputeGraphPtr whole_graph_;
   const std::vector<SubGraphInfoPtr> &subgraphs_;
+  std::map<std::string, int> op_costs_;
+  int64_t makespan_{0};
 
   int64_t stream_num_{0};
   uint32_t event_num_{0};
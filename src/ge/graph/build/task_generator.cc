@@ -16,20 +16,26 @@
 
 #include "graph/build/task_generator.h"
 
+#include <algorithm>
+#include <set>
 #include <string>
 #include <utility>
 
+#include "common/ge/ge_util.h"
+#include "common/task_executor.h"
 #include "common/types.h"
 #include "common/util.h"
 #include "framework/common/debug/ge_log.h"
 #include "graph/debug/ge_attr_define.h"
 #include "graph/ge_context.h"
+#include "graph/ge_local_context.h"
 #include "graph/manager/graph_var_manager.h"
 #include "graph/model_serialize.h"
 #include "graph/utils/node_utils.h"
 #include "graph/utils/tensor_utils.h"
 #include "graph/utils/type_utils.h"
 #include "init/gelib.h"
+#include "omg/omg_inner_types.h"
 
 using std::string;
 using std::vector;
@@ -60,6 +66,10 @@ TaskGenerator::TaskGenerator(uint8_t *var_mem_base, uint64_t var_mem_size) {
 }
 TaskGenerator::~TaskGenerator() {}
 
+void TaskGenerator::SetBuildMaxParallelNum(const std::map<std::string, int> &build_max_parallel_num) {
+  build_max_parallel_num_ = build_max_parallel_num;
+}
+
 Status TaskGenerator::GetTaskInfo(Model &model, ComputeGraphPtr &graph, uint64_t session_id, RunContext &run_context) {
   GELOGI("Begin to Get TaskInfo. session_id=%lu", session_id);
   // Check params
@@ -200,8 +210,11 @@ Status TaskGenerator::GenerateTask(RunContext &run_context, ComputeGraphPtr &gra
 
   const OpsKernelManager &ops_kernel_manager = ge_lib->OpsKernelManagerObj();
 
+  // Attributes and anchors are updated here in node order, the engines then generate the tasks of the nodes in
+  // parallel, each node into its own list. The lists are merged in node order, so every stream keeps the task order
+  // of the sequential build and the profiling tasks stay around their nodes.
+  std::vector<NodeTaskList> node_task_lists;
   uint32_t node_index = 0;
-  GE_TIMESTAMP_CALLNUM_START(GenerateTask);
   for (auto &node : graph->GetAllNodes()) {
     GE_CHECK_NOTNULL(node->GetOpDesc());
     if (node->GetOpDesc()->GetType() == CONCAT) {
@@ -240,49 +253,112 @@ Status TaskGenerator::GenerateTask(RunContext &run_context, ComputeGraphPtr &gra
              type.c_str(), op_id, run_context.graphStreamList.size());
       return INTERNAL_ERROR;
     }
+    NodeTaskList node_task_list;
+    node_task_list.node = node;
+    node_task_list.kernel_info_store = kernel_info_store;
+    node_task_list.node_index = node_index;
+    node_task_lists.emplace_back(std::move(node_task_list));
+  }
 
-    // Profiling task
-    size_t task_list_size_before = task_def_list.size();
-    GE_CHK_STATUS_RET(InsertProfilingTaskBefore(op_desc, ppoint, ar_ppoint, node_index, task_def_list));
-    run_context.stream = run_context.graphStreamList[stream_id];
-    GELOGD("Call %s to generate node[name:%s(%s), id:%ld, stream_id:%ld] task.", op_kernel_lib_name.c_str(),
-           name.c_str(), type.c_str(), op_id, stream_id);
-    GE_TIMESTAMP_RESTART(GenerateTask);
-    ret = kernel_info_store->GenerateTask(*node, run_context, task_def_list);
-    GE_TIMESTAMP_ADD(GenerateTask);
-    if (ret != SUCCESS) {
-      GELOGE(ret, "Call %s to generate node[name:%s(%s), id:%ld, stream_id:%ld] task failed.",
-             op_kernel_lib_name.c_str(), name.c_str(), type.c_str(), op_id, stream_id);
-      return ret;
-    }
-    // Profiling task
-    GE_CHK_STATUS_RET(InsertProfilingTaskAfter(op_desc, ppoint, ar_ppoint, node_index, task_def_list));
-
-    size_t task_list_size_after = task_def_list.size();
-    // If tasks is reduced
-    if (task_list_size_after < task_list_size_before) {
-      GELOGE(FAILED, "Call %s to generate node[name:%s(%s), id:%ld, stream_id:%ld] task. but task num from %zu to %zu.",
-             op_kernel_lib_name.c_str(), name.c_str(), type.c_str(), op_id, stream_id, task_list_size_before,
-             task_list_size_after);
-      return FAILED;
+  return GenerateNodeTasks(run_context, ppoint, ar_ppoint, node_task_lists, task_def_list, op_name_map);
+}
+
+Status TaskGenerator::GenerateNodeTasks(RunContext &run_context, const ProfilingPoint &ppoint,
+                                        vector<uint32_t> &ar_ppoint, vector<NodeTaskList> &node_task_lists,
+                                        vector<domi::TaskDef> &task_def_list, map<uint32_t, string> &op_name_map) {
+  auto ge_context = MakeShared<GEThreadLocalContext>(GetThreadLocalContext());
+  GE_CHECK_NOTNULL(ge_context);
+  OmgContext *omg_context = &domi::GetContext();
+  TaskGraph gen_tasks;
+  std::set<std::string> engine_names;
+  for (auto &node_task_list : node_task_lists) {
+    OpDescPtr op_desc = node_task_list.node->GetOpDesc();
+    std::string engine_name = op_desc->GetOpEngineName();
+    if (engine_name.empty()) {
+      engine_name = op_desc->GetOpKernelLibName();
     }
+    engine_names.insert(engine_name);
+    NodeTaskList *task_list = &node_task_list;
+    (void)gen_tasks.AddTask(
+        node_task_list.node->GetName(),
+        [this, task_list, &run_context, &ppoint, &ar_ppoint, ge_context, omg_context]() -> Status {
+          GetThreadLocalContext() = *ge_context;
+          domi::OmgContextScope omg_context_scope(omg_context);
+          return GenerateNodeTask(run_context, ppoint, ar_ppoint, *task_list);
+        },
+        {}, engine_name);
+  }
+  for (const auto &engine_name : engine_names) {
+    auto iter = build_max_parallel_num_.find(engine_name);
+    // budget 0 means unlimited to the task graph, a misconfigured engine still generates one node at a time
+    int budget = (iter == build_max_parallel_num_.end()) ? 1 : std::max(iter->second, 1);
+    gen_tasks.SetBudget(engine_name, static_cast<uint32_t>(budget));
+  }
 
+  GE_TIMESTAMP_START(GenerateTask);
+  Status ret = gen_tasks.Run();
+  GE_TIMESTAMP_END(GenerateTask, "GraphBuild::GenerateTask");
+  if (ret != SUCCESS) {
+    GELOGE(ret, "Generate task failed.");
+    return ret;
+  }
+
+  for (auto &node_task_list : node_task_lists) {
+    const string &name = node_task_list.node->GetName();
+    int64_t stream_id = node_task_list.node->GetOpDesc()->GetStreamId();
     // Reset stream id to ge stream id, as graph load must use ge stream to reassign stream
-    void *ops_kernel_info_store_ptr = kernel_info_store.get();
-    for (size_t idx = task_list_size_before; idx < task_list_size_after; ++idx) {
-      task_def_list[idx].set_stream_id(static_cast<uint32_t>(stream_id));
-      op_name_map[idx] = name;
+    void *ops_kernel_info_store_ptr = node_task_list.kernel_info_store.get();
+    for (auto &task_def : node_task_list.task_defs) {
+      task_def.set_stream_id(static_cast<uint32_t>(stream_id));
       // Set opsKernelInfoStorePtr and op_index, the two fields be use in DistributeTask and InitTaskInfo
-      TaskDef *task_def_ptr = &task_def_list[idx];
-      GE_CHECK_NOTNULL(task_def_ptr);
-      task_def_ptr->set_ops_kernel_store_ptr(reinterpret_cast<uintptr_t>(ops_kernel_info_store_ptr));
+      task_def.set_ops_kernel_store_ptr(reinterpret_cast<uintptr_t>(ops_kernel_info_store_ptr));
+      op_name_map[static_cast<uint32_t>(task_def_list.size())] = name;
+      task_def_list.emplace_back(std::move(task_def));
     }
+  }
+  return SUCCESS;
+}
 
-    GELOGD("Call %s to generate node[name:%s(%s), id:%ld, stream_id:%ld] task finished, generate %lu task(s).",
-           op_kernel_lib_name.c_str(), name.c_str(), type.c_str(), op_id, stream_id,
-           task_list_size_after - task_list_size_before);
+Status TaskGenerator::GenerateNodeTask(const RunContext &run_context, const ProfilingPoint &ppoint,
+                                       vector<uint32_t> &ar_ppoint, NodeTaskList &node_task_list) {
+  const NodePtr &node = node_task_list.node;
+  OpDescPtr op_desc = node->GetOpDesc();
+  string name = node->GetName();
+  string type = node->GetType();
+  string op_kernel_lib_name = op_desc->GetOpKernelLibName();
+  int64_t op_id = op_desc->GetId();
+  int64_t stream_id = op_desc->GetStreamId();
+  vector<TaskDef> &task_def_list = node_task_list.task_defs;
+
+  // Profiling task
+  GE_CHK_STATUS_RET(
+      InsertProfilingTaskBefore(op_desc, ppoint, ar_ppoint, node_task_list.node_index, task_def_list));
+  size_t task_list_size_before = task_def_list.size();
+  // Every worker points its own run context at the stream of its node
+  RunContext node_run_context = run_context;
+  node_run_context.stream = run_context.graphStreamList[stream_id];
+  GELOGD("Call %s to generate node[name:%s(%s), id:%ld, stream_id:%ld] task.", op_kernel_lib_name.c_str(),
+         name.c_str(), type.c_str(), op_id, stream_id);
+  Status ret = node_task_list.kernel_info_store->GenerateTask(*node, node_run_context, task_def_list);
+  if (ret != SUCCESS) {
+    GELOGE(ret, "Call %s to generate node[name:%s(%s), id:%ld, stream_id:%ld] task failed.",
+           op_kernel_lib_name.c_str(), name.c_str(), type.c_str(), op_id, stream_id);
+    return ret;
   }
-  GE_TIMESTAMP_CALLNUM_END(GenerateTask, "GraphBuild::GenerateTask");
+  size_t task_list_size_after = task_def_list.size();
+  // If tasks is reduced
+  if (task_list_size_after < task_list_size_before) {
+    GELOGE(FAILED, "Call %s to generate node[name:%s(%s), id:%ld, stream_id:%ld] task. but task num from %zu to %zu.",
+           op_kernel_lib_name.c_str(), name.c_str(), type.c_str(), op_id, stream_id, task_list_size_before,
+           task_list_size_after);
+    return FAILED;
+  }
+  // Profiling task
+  GE_CHK_STATUS_RET(InsertProfilingTaskAfter(op_desc, ppoint, ar_ppoint, node_task_list.node_index, task_def_list));
+
+  GELOGD("Call %s to generate node[name:%s(%s), id:%ld, stream_id:%ld] task finished, generate %zu task(s).",
+         op_kernel_lib_name.c_str(), name.c_str(), type.c_str(), op_id, stream_id,
+         task_list_size_after - task_list_size_before);
   return SUCCESS;
 }
 
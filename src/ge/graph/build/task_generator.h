@@ -23,6 +23,7 @@
 #include <vector>
 
 #include "common/ge_inner_error_codes.h"
+#include "common/opskernel/ops_kernel_info_store.h"
 #include "common/opskernel/ops_kernel_info_types.h"
 #include "framework/common/types.h"
 #include "graph/compute_graph.h"
@@ -37,6 +38,15 @@ struct ProfilingPoint {
   uint32_t end_index = 0;
 };
 
+// Tasks generated for one node, filled by the worker that generates them
+struct NodeTaskList {
+  NodePtr node;
+  std::shared_ptr<OpsKernelInfoStore> kernel_info_store;
+  // position of the node in the graph, used to find the profiling points
+  uint32_t node_index = 0;
+  std::vector<domi::TaskDef> task_defs;
+};
+
 class TaskGenerator {
  public:
   TaskGenerator() = default;
@@ -60,6 +70,12 @@ class TaskGenerator {
   ///
   Status GetTaskInfo(Model &model, ComputeGraphPtr &graph, uint64_t session_id, RunContext &run_context);
 
+  ///
+  /// set the number of nodes an engine generates tasks for at the same time.
+  /// @param build_max_parallel_num engine name to number, engines not in it generate one node at a time
+  ///
+  void SetBuildMaxParallelNum(const std::map<std::string, int> &build_max_parallel_num);
+
  private:
   Status UpdateAnchorStatus(const NodePtr &node);
 
@@ -77,6 +93,29 @@ class TaskGenerator {
   Status GenerateTask(RunContext &run_context, ComputeGraphPtr &graph, std::vector<domi::TaskDef> &task_def_list,
                       std::map<uint32_t, string> &op_name_map);
 
+  ///
+  /// call engines to generate the tasks of the nodes in parallel and merge them in node order.
+  /// @param run_context run context
+  /// @param node_task_lists nodes to generate, in graph order
+  /// @param task_def_list task def list generate by engine
+  /// @param op_name_map relation of task index and op
+  /// @return SUCCESS:seccess
+  /// Other: failed
+  ///
+  Status GenerateNodeTasks(RunContext &run_context, const ProfilingPoint &ppoint, std::vector<uint32_t> &ar_ppoint,
+                           std::vector<NodeTaskList> &node_task_lists, std::vector<domi::TaskDef> &task_def_list,
+                           std::map<uint32_t, string> &op_name_map);
+
+  ///
+  /// call engine to generate the tasks of one node, profiling tasks around it included.
+  /// @param run_context run context, copied to point at the stream of the node
+  /// @param node_task_list node to generate and its generated tasks
+  /// @return SUCCESS:seccess
+  /// Other: failed
+  ///
+  Status GenerateNodeTask(const RunContext &run_context, const ProfilingPoint &ppoint,
+                          std::vector<uint32_t> &ar_ppoint, NodeTaskList &node_task_list);
+
   ///
   /// AddModelTaskToModel
   /// @param model_task_def model task
@@ -102,6 +141,7 @@ class TaskGenerator {
 
   uint8_t *var_mem_base_ = nullptr;
   uint64_t var_mem_size_ = 0;
+  std::map<std::string, int> build_max_parallel_num_;
 };
 }  // namespace ge
 #endif  // GE_GRAPH_BUILD_TASK_GENERATOR_H_
@@ -33,24 +33,9 @@ GraphExecutor::GraphExecutor()
       sync_run_mutex_(nullptr),
       condition_(nullptr),
       graph_run_listener_(nullptr),
-      graph_context_(nullptr),
-      last_graph_id_(UINT32_MAX),
-      malloc_flag_(false) {}
-
-GraphExecutor::~GraphExecutor() {
-  outputs_desc_.clear();
-  if (malloc_flag_) {
-    for (auto &buffer_addr : buffer_addr_) {
-      rtError_t rt_ret;
-      rt_ret = rtFreeHost(buffer_addr);
-      if (rt_ret != RT_ERROR_NONE) {
-        GELOGE(RT_FAILED, "[GraphManager] subgraph free buffer failed, ret: 0x%X", rt_ret);
-      }
-    }
-  }
-  malloc_flag_ = false;
-  buffer_addr_.clear();
-}
+      graph_context_(nullptr) {}
+
+GraphExecutor::~GraphExecutor() { outputs_desc_.clear(); }
 
 Status GraphExecutor::SetCondition(std::mutex *mutex, std::condition_variable *cond,
                                    std::shared_ptr<GraphModelListener> listener) {
@@ -88,123 +73,46 @@ Status GraphExecutor::SetGraphContext(GraphContextPtr graph_context_ptr) {
 
 void GraphExecutor::SetTrainFlag(bool is_train_graph) { train_graph_flag_ = is_train_graph; }
 
-Status GraphExecutor::FreeInOutBuffer() {
-  if (malloc_flag_) {
-    for (auto iter = buffer_addr_.begin(); iter != buffer_addr_.end(); ++iter) {
-      rtError_t rt_ret;
-      rt_ret = rtFreeHost(*iter);
-      if (rt_ret != RT_ERROR_NONE) {
-        GELOGE(RT_FAILED, "[GraphManager] subgraph free buffer failed, ret: 0x%X", rt_ret);
-        (void)buffer_addr_.erase(buffer_addr_.begin(), iter);
-        return GE_GRAPH_FREE_FAILED;
-      }
-    }
-    buffer_addr_.clear();
-
-    malloc_flag_ = false;
-    return SUCCESS;
-  } else {
-    GELOGI("[GraphManager] not malloc buffer.");
-    return SUCCESS;
-  }
-}
-
-Status GraphExecutor::MallocInOutBuffer(const std::vector<uint32_t> &buffer_size, std::vector<void *> &data_addr) {
-  if (malloc_flag_) {
-    auto all_size_same = true;
-    if (buffer_size.size() == buffer_size_.size()) {
-      for (size_t i = 0; i < buffer_size.size(); i++) {
-        if (buffer_size[i] != buffer_size_[i]) {
-          all_size_same = false;
-          break;
-        }
-      }
-    } else {
-      all_size_same = false;
-    }
-    if (all_size_same) {
-      data_addr = buffer_addr_;
-      return SUCCESS;
-    }
-    buffer_size_.clear();
-    auto rt_ret = FreeInOutBuffer();
-    if (rt_ret != SUCCESS) {
-      GELOGE(RT_FAILED, "[SubGraphInfo] MallocInOutBuffer free buffer failed, ret: 0x%X", rt_ret);
-      return RT_FAILED;
-    }
-  }
-
-  rtError_t rt_ret;
-  for (size_t i = 0; i < buffer_size.size(); ++i) {
-    void *tmp_buf = nullptr;
-    rt_ret = rtMallocHost(&tmp_buf, buffer_size[i]);
-    if (rt_ret != RT_ERROR_NONE) {
-      GELOGE(RT_FAILED, "[GraphManager] subgraph malloc buffer failed, ret: 0x%X", rt_ret);
-      return GE_GRAPH_MALLOC_FAILED;
-    }
-    malloc_flag_ = true;
-    data_addr.push_back(tmp_buf);
-    buffer_addr_.push_back(tmp_buf);
-  }
-  buffer_size_ = buffer_size;
-  return SUCCESS;
-}
-
 Status GraphExecutor::PrepareInputData(const std::vector<GeTensor> &input_tensor, InputData &graph_input_data,
-                                       OutputData &graph_output_data, std::vector<InputOutputDescInfo> &output_desc) {
-  // Preprocessing input data
+                                       OutputData &graph_output_data, std::vector<InputOutputDescInfo> &output_desc,
+                                       std::vector<GeTensor> &output_tensor) {
+  // The model copies inputs to device and results back to host synchronously while the caller waits,
+  // so it can read the input tensors and write the output tensors in place instead of staging buffers
   graph_input_data.index = 0;
   graph_input_data.timeout = 0;
   graph_input_data.timestamp = 0;
-  std::size_t inputSize = input_tensor.size();
-  std::size_t output_size = output_desc.size();
-  std::vector<uint32_t> buffer_size_vec;
-  std::vector<void *> addr_vec;
-
-  for (std::size_t i = 0; i < inputSize; ++i) {
-    const GeTensor *InTensor = &input_tensor[i];
-    GE_CHECK_NOTNULL(InTensor);
-    buffer_size_vec.push_back(static_cast<uint32_t &&>(InTensor->GetData().size()));
-  }
-
-  for (const auto &desc : output_desc) {
-    buffer_size_vec.push_back(desc.size);
-  }
-
-  Status ret = MallocInOutBuffer(buffer_size_vec, addr_vec);
-  if (ret != SUCCESS) {
-    GELOGE(GE_GRAPH_MALLOC_FAILED, "[GraphExecutor] Malloc mem failed");
-    return GE_GRAPH_MALLOC_FAILED;
-  }
-
-  for (std::size_t i = 0; i < input_tensor.size() && i < addr_vec.size(); ++i) {
-    const GeTensor *in_tensor = &input_tensor[i];
-    GE_CHECK_NOTNULL(in_tensor);
-    if ((addr_vec[i] != nullptr) && (in_tensor->GetData().data() != nullptr)) {
-      if (memcpy_s(addr_vec[i], buffer_size_vec[i], in_tensor->GetData().data(), in_tensor->GetData().size()) != 0) {
-        GELOGE(GE_GRAPH_EXECUTE_FAILED, "[GraphExecutor] memcpy input data failed.");
-        return GE_GRAPH_EXECUTE_FAILED;
-      }
-    }
-
+  for (const auto &in_tensor : input_tensor) {
+    const Buffer in_data = in_tensor.GetData();
     DataBuffer in_data_buf;
-    in_data_buf.data = reinterpret_cast<uint8_t *>(addr_vec[i]);
-    in_data_buf.length = static_cast<uint32_t>(in_tensor->GetData().size());
+    in_data_buf.data = const_cast<uint8_t *>(in_data.data());
+    in_data_buf.length = static_cast<uint32_t>(in_data.size());
     in_data_buf.isDataSupportMemShare = false;
     graph_input_data.blobs.push_back(in_data_buf);
   }
 
   graph_output_data.index = 0;
-
-  for (std::size_t j = 0; j < output_size; j++) {
-    auto desc = output_desc[j];
-    uint32_t buffer_size = desc.size;
+  output_tensor.reserve(output_tensor.size() + output_desc.size());
+  for (const auto &desc : output_desc) {
+    CHECK_FALSE_EXEC(desc.size != 0, GELOGE(GE_GRAPH_EXECUTE_FAILED, "Failed to allocate memory, length is 0.");
+                     return GE_GRAPH_EXECUTE_FAILED);
+    std::vector<int64_t> shape_dims;
+    for (const auto &dim : desc.shape_info.dims) {
+      shape_dims.push_back(dim);
+    }
+    GeTensor out_tensor;
+    out_tensor.MutableTensorDesc().SetShape(GeShape(shape_dims));
+    out_tensor.MutableTensorDesc().SetDataType(static_cast<DataType>(desc.data_type));
+    if (out_tensor.ResizeData(desc.size) != GRAPH_SUCCESS) {
+      GELOGE(FAILED, "Failed to allocate memory, length is %u.", desc.size);
+      return FAILED;
+    }
 
     DataBuffer out_data_buf;
-    out_data_buf.data = reinterpret_cast<uint8_t *>(addr_vec[inputSize + j]);
-    out_data_buf.length = buffer_size;
+    out_data_buf.data = out_tensor.MutableData().data();
+    out_data_buf.length = desc.size;
     out_data_buf.isDataSupportMemShare = false;
     graph_output_data.blobs.push_back(out_data_buf);
+    output_tensor.push_back(out_tensor);
   }
 
   return SUCCESS;
@@ -227,7 +135,8 @@ Status GraphExecutor::SyncExecuteModel(uint32_t model_id, const std::vector<GeTe
   InputData input_data;
   OutputData output_data;
   input_data.model_id = model_id;
-  ret = PrepareInputData(input_tensor, input_data, output_data, output_desc);
+  std::vector<GeTensor> run_output_tensor;
+  ret = PrepareInputData(input_tensor, input_data, output_data, output_desc, run_output_tensor);
   if (ret != SUCCESS) {
     GELOGE(GE_GRAPH_PREPARE_FAILED, "[GraphExecutor] PrepareInputData failed, modelId=%u.", model_id);
     return GE_GRAPH_PREPARE_FAILED;
@@ -262,36 +171,8 @@ Status GraphExecutor::SyncExecuteModel(uint32_t model_id, const std::vector<GeTe
       return GE_GRAPH_EXECUTE_FAILED;
     }
   }
-  for (size_t i = 0; i < output_data.blobs.size(); ++i) {
-    DataBuffer out_data_tmp = output_data.blobs[i];
-    CHECK_FALSE_EXEC(out_data_tmp.length != 0,
-                     GELOGE(GE_GRAPH_EXECUTE_FAILED, "Failed to allocate memory, length is 0.");
-                     return GE_GRAPH_EXECUTE_FAILED);
-    std::unique_ptr<uint8_t> out_buf_tmp(new (std::nothrow) uint8_t[out_data_tmp.length]);
-    if (out_buf_tmp == nullptr) {
-      GELOGE(FAILED, "Failed to allocate memory.");
-      return FAILED;
-    }
-    rtError_t ret_value = rtMemcpy(out_buf_tmp.get(), out_data_tmp.length, out_data_tmp.data, out_data_tmp.length,
-                                   RT_MEMCPY_DEVICE_TO_HOST);
-    CHECK_FALSE_EXEC(ret_value == RT_ERROR_NONE,
-                     GELOGE(GE_GRAPH_EXECUTE_FAILED, "Call rt api rtMemcpy failed, ret: 0x%X", ret);
-                     return GE_GRAPH_EXECUTE_FAILED);
-    GeTensor out_tensor;
-    std::vector<int64_t> shape_dims;
-    for (const auto &dim : output_desc[i].shape_info.dims) {
-      shape_dims.push_back(dim);
-    }
-
-    GeShape out_shape(shape_dims);
-    out_tensor.MutableTensorDesc().SetShape(out_shape);
-    out_tensor.MutableTensorDesc().SetDataType((DataType)output_desc[i].data_type);
-    if (out_tensor.SetData(out_buf_tmp.get(), out_data_tmp.length) != SUCCESS) {
-      GELOGE(FAILED, "Out tensor set data failed");
-      return FAILED;
-    }
-    output_tensor.push_back(out_tensor);
-  }
+  // Results were written straight into the tensors, hand them over without copying
+  output_tensor.insert(output_tensor.end(), run_output_tensor.begin(), run_output_tensor.end());
 
   GELOGI("[GraphExecutor] execute model success, modelId=%u.", model_id);
 
@@ -309,25 +190,8 @@ void GraphExecutor::InitModelIdInfo(std::vector<uint32_t> &out_model_id_info,
   }
 }
 
-Status GraphExecutor::FreeExecuteMemory() {
-  auto ret = FreeInOutBuffer();
-  if (ret != SUCCESS) {
-    GELOGE(ret, "[FreeExecuteMemory] FreeInOutBuffer Error!");
-    return ret;
-  }
-
-  return SUCCESS;
-}
-
 Status GraphExecutor::ExecuteGraph(GraphId graph_id, const GeModelPtr &ge_model,
                                    const std::vector<GeTensor> &input_tensor, std::vector<GeTensor> &output_tensor) {
-  if (graph_id != last_graph_id_) {
-    auto ret = FreeExecuteMemory();
-    if (ret != SUCCESS) {
-      return ret;
-    }
-  }
-  last_graph_id_ = graph_id;
 
   if (!init_flag_) {
     GELOGE(GE_GRAPH_EXECUTE_NOT_INIT, "[GraphExecutor] AI Core Engine without calling SetCondition!");
@@ -347,13 +211,6 @@ Status GraphExecutor::ExecuteGraphAsync(GraphId graph_id, const GeModelPtr &ge_m
                                         const std::vector<TensorInfo> &input_tensor,
                                         std::vector<TensorInfo> &output_tensor) {
   GELOGI("[GraphExecutor] Start to async execute graph, graph_id=%u", graph_id);
-  if (graph_id != last_graph_id_) {
-    auto ret = FreeExecuteMemory();
-    if (ret != SUCCESS) {
-      return ret;
-    }
-  }
-  last_graph_id_ = graph_id;
   GE_CHECK_NOTNULL_EXEC(ge_model, return FAILED);
   Status ret = AsyncExecuteModel(ge_model->GetModelId(), input_tensor, output_tensor);
   if (ret != SUCCESS) {
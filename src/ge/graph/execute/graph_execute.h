@@ -60,8 +60,6 @@ class GraphExecutor {
 
   const std::vector<InputOutputDescInfo> &GetOutputsDesc() const { return outputs_desc_; }
 
-  Status FreeExecuteMemory();
-
   static Status DataInput(const InputData &input_data, OutputData &output_data);
 
   static Status GetInputOutputDescInfo(const uint32_t model_id, vector<InputOutputDescInfo> &input_desc,
@@ -78,7 +76,8 @@ class GraphExecutor {
 
  private:
   Status PrepareInputData(const std::vector<GeTensor> &input_tensor, InputData &graph_input_data,
-                          OutputData &graph_output_data, std::vector<InputOutputDescInfo> &output_desc);
+                          OutputData &graph_output_data, std::vector<InputOutputDescInfo> &output_desc,
+                          std::vector<GeTensor> &output_tensor);
 
   Status SyncExecuteModel(uint32_t model_id, const std::vector<GeTensor> &input_tensor,
                           std::vector<GeTensor> &output_tensor);
@@ -89,10 +88,6 @@ class GraphExecutor {
   void InitModelIdInfo(std::vector<uint32_t> &out_model_id_info, std::vector<SubGraphInfoPtr> &sub_graph_vec,
                        uint32_t output_size);
 
-  Status FreeInOutBuffer();
-
-  Status MallocInOutBuffer(const std::vector<uint32_t> &buffer_size, std::vector<void *> &data_addr);
-
   bool init_flag_;
 
   bool train_graph_flag_;
@@ -106,11 +101,6 @@ class GraphExecutor {
   GraphContextPtr graph_context_;
 
   std::vector<InputOutputDescInfo> outputs_desc_;
-  GraphId last_graph_id_;
-
-  bool malloc_flag_;
-  std::vector<void *> buffer_addr_;
-  std::vector<uint32_t> buffer_size_;
 };
 }  // namespace ge
 
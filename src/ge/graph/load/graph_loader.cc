@@ -193,7 +193,7 @@ Status GraphLoader::GetMaxUsedMemory(uint32_t model_id, uint64_t &max_size) {
 }
 
 Status GraphLoader::LoadDataFromFile(const std::string &path, const std::string &key_path, int32_t priority,
-                                     ModelData &model_data) {
+                                     ModelData &model_data, bool is_mapped) {
   Status ret;
   try {
     if (!CheckInputPathValid(path)) {
@@ -207,7 +207,8 @@ Status GraphLoader::LoadDataFromFile(const std::string &path, const std::string
       return PARAM_INVALID;
     }
 
-    ret = DavinciModelParser::LoadFromFile(path.c_str(), key_path.c_str(), priority, model_data);
+    ret = is_mapped ? DavinciModelParser::MapFromFile(path.c_str(), key_path.c_str(), priority, model_data)
+                    : DavinciModelParser::LoadFromFile(path.c_str(), key_path.c_str(), priority, model_data);
     if (ret != SUCCESS) {
       GELOGE(ret, "LoadModelFromFile: Load failed. ret = %u", ret);
       return ret;
@@ -222,36 +223,29 @@ Status GraphLoader::LoadDataFromFile(const std::string &path, const std::string
     ret = FAILED;
   }
 
-  if (model_data.model_data != nullptr) {
-    delete[] static_cast<char *>(model_data.model_data);
-    model_data.model_data = nullptr;
-  }
+  ReleaseModelData(model_data);
   return ret;
 }
 
+void GraphLoader::ReleaseModelData(ModelData &model_data) { DavinciModelParser::ReleaseModelData(model_data); }
+
 Status GraphLoader::LoadModelFromFile(const std::string &path, const std::string &key_path, int32_t priority,
                                       const std::shared_ptr<ModelListener> &listener, uint32_t &model_id) {
   Status ret;
   ModelData model_data;
 
   try {
-    ret = LoadDataFromFile(path, key_path, priority, model_data);
+    ret = LoadDataFromFile(path, key_path, priority, model_data, true);
     if (ret != SUCCESS) {
       GELOGE(ret, "LoadModelFromFile: Load failed. ret = %u", ret);
-      if (model_data.model_data != nullptr) {
-        delete[] static_cast<char *>(model_data.model_data);
-        model_data.model_data = nullptr;
-      }
+      ReleaseModelData(model_data);
       return ret;
     }
 
     ret = LoadModel(model_data, listener, model_id);
     if (ret != SUCCESS) {
       GELOGE(ret, "LoadModel: Load failed. ret = %u", ret);
-      if (model_data.model_data != nullptr) {
-        delete[] static_cast<char *>(model_data.model_data);
-        model_data.model_data = nullptr;
-      }
+      ReleaseModelData(model_data);
     }
   } catch (std::bad_alloc &) {
     GELOGE(MEMALLOC_FAILED, "Load model from file failed, bad memory allocation");
@@ -261,10 +255,7 @@ Status GraphLoader::LoadModelFromFile(const std::string &path, const std::string
     ret = FAILED;
   }
 
-  if (model_data.model_data != nullptr) {
-    delete[] static_cast<char *>(model_data.model_data);
-    model_data.model_data = nullptr;
-  }
+  ReleaseModelData(model_data);
 
   return ret;
 }
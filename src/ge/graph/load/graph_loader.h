@@ -60,8 +60,15 @@ class GraphLoader {
 
   static Status GetMemoryInfo(int64_t &free);
 
+  ///
+  /// @ingroup domi_ome
+  /// @brief read or map the model file into model_data, which must be released by ReleaseModelData
+  /// @param [in] is_mapped map the file instead of reading it into a heap buffer
+  ///
   static Status LoadDataFromFile(const std::string &path, const std::string &key_path, int32_t priority,
-                                 ModelData &model_data);
+                                 ModelData &model_data, bool is_mapped = false);
+
+  static void ReleaseModelData(ModelData &model_data);
 
   static Status LoadModelFromData(uint32_t &model_id, const ModelData &model_data, void *dev_ptr, size_t mem_size,
                                   void *weight_ptr, size_t weight_size);
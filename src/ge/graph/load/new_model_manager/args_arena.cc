@@ -0,0 +1,138 @@
+/**
+ * Copyright 2019-2020 Huawei Technologies Co., Ltd
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "graph/load/new_model_manager/args_arena.h"
+
+#include "framework/common/debug/ge_log.h"
+#include "framework/common/debug/log.h"
+#include "securec.h"
+
+namespace ge {
+const size_t ArgsArena::kAlignment;
+
+Status ArgsArena::Reserve(const void *data, size_t size, size_t &offset) {
+  std::lock_guard<std::mutex> lock(mutex_);
+  if (dev_base_ != nullptr) {
+    GELOGE(PARAM_INVALID, "Args arena is already on device, can not reserve %zu bytes.", size);
+    return PARAM_INVALID;
+  }
+
+  offset = (size_ + kAlignment - 1) / kAlignment * kAlignment;
+  host_image_.resize(offset + size, 0);
+  if (data != nullptr && size > 0) {
+    errno_t sec_ret = memcpy_s(host_image_.data() + offset, size, data, size);
+    if (sec_ret != EOK) {
+      GELOGE(FAILED, "memcpy failed, ret: %d", sec_ret);
+      return FAILED;
+    }
+  }
+  size_ = host_image_.size();
+  return SUCCESS;
+}
+
+Status ArgsArena::AddReloc(size_t offset, size_t target_offset) {
+  std::lock_guard<std::mutex> lock(mutex_);
+  if (offset + sizeof(uint64_t) > size_ || target_offset > size_) {
+    GELOGE(PARAM_INVALID, "Reloc at %zu to %zu is out of args arena, size %zu.", offset, target_offset, size_);
+    return PARAM_INVALID;
+  }
+  relocs_.emplace_back(offset, target_offset);
+  return SUCCESS;
+}
+
+Status ArgsArena::Commit() {
+  std::lock_guard<std::mutex> lock(mutex_);
+  if (dev_base_ != nullptr || size_ == 0) {
+    return SUCCESS;
+  }
+
+  void *dev_base = nullptr;
+  rtError_t rt_ret = (mem_type_ == RT_MEMORY_SPM) ? rtMemAllocManaged(&dev_base, size_, RT_MEMORY_SPM)
+                                                  : rtMalloc(&dev_base, size_, mem_type_);
+  if (rt_ret != RT_ERROR_NONE || dev_base == nullptr) {
+    GELOGE(RT_FAILED, "Call rt api failed, size: %zu, ret: 0x%X", size_, rt_ret);
+    return RT_FAILED;
+  }
+
+  // The arena is only marked committed once the device copy is done, a failed commit can be retried
+  auto free_dev_base = [this, dev_base]() {
+    GE_CHK_RT((mem_type_ == RT_MEMORY_SPM) ? rtMemFreeManaged(dev_base) : rtFree(dev_base));
+  };
+  uint8_t *dev_addr = static_cast<uint8_t *>(dev_base);
+  for (const auto &reloc : relocs_) {
+    uint64_t target = static_cast<uint64_t>(reinterpret_cast<uintptr_t>(dev_addr + reloc.second));
+    errno_t sec_ret = memcpy_s(host_image_.data() + reloc.first, sizeof(uint64_t), &target, sizeof(uint64_t));
+    if (sec_ret != EOK) {
+      GELOGE(FAILED, "memcpy failed, ret: %d", sec_ret);
+      free_dev_base();
+      return FAILED;
+    }
+  }
+
+  rt_ret = rtMemcpy(dev_base, size_, host_image_.data(), size_, RT_MEMCPY_HOST_TO_DEVICE);
+  if (rt_ret != RT_ERROR_NONE) {
+    GELOGE(RT_FAILED, "Call rt api failed, size: %zu, ret: 0x%X", size_, rt_ret);
+    free_dev_base();
+    return RT_FAILED;
+  }
+  dev_base_ = dev_addr;
+  GELOGI("Args arena committed, size: %zu, relocs: %zu.", size_, relocs_.size());
+
+  if (!keep_host_image_) {
+    std::vector<uint8_t>().swap(host_image_);
+  }
+  std::vector<std::pair<size_t, size_t>>().swap(relocs_);
+  return SUCCESS;
+}
+
+void *ArgsArena::GetDevAddr(size_t offset) const {
+  if (dev_base_ == nullptr || offset > size_) {
+    return nullptr;
+  }
+  return dev_base_ + offset;
+}
+
+uint8_t *ArgsArena::GetHostAddr(size_t offset) {
+  if (dev_base_ == nullptr || !keep_host_image_ || offset > size_) {
+    return nullptr;
+  }
+  return host_image_.data() + offset;
+}
+
+bool ArgsArena::GetOffset(const void *dev_addr, size_t size, size_t &offset) const {
+  if (dev_base_ == nullptr) {
+    return false;
+  }
+  auto addr = reinterpret_cast<uintptr_t>(dev_addr);
+  auto base = reinterpret_cast<uintptr_t>(dev_base_);
+  if (addr < base || addr - base > size_ || size > size_ - (addr - base)) {
+    return false;
+  }
+  offset = static_cast<size_t>(addr - base);
+  return true;
+}
+
+void ArgsArena::Release() {
+  std::lock_guard<std::mutex> lock(mutex_);
+  if (dev_base_ != nullptr) {
+    GE_CHK_RT((mem_type_ == RT_MEMORY_SPM) ? rtMemFreeManaged(dev_base_) : rtFree(dev_base_));
+    dev_base_ = nullptr;
+  }
+  host_image_.clear();
+  relocs_.clear();
+  size_ = 0;
+}
+}  // namespace ge
@@ -0,0 +1,101 @@
+/**
+ * Copyright 2019-2020 Huawei Technologies Co., Ltd
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef GE_GRAPH_LOAD_NEW_MODEL_MANAGER_ARGS_ARENA_H_
+#define GE_GRAPH_LOAD_NEW_MODEL_MANAGER_ARGS_ARENA_H_
+
+#include <cstdint>
+
+#include <mutex>
+#include <utility>
+#include <vector>
+
+#include "framework/common/ge_inner_error_codes.h"
+#include "runtime/mem.h"
+
+namespace ge {
+///
+/// @ingroup ge
+/// @brief Device memory of the small per task blocks of a model (kernel args, flowtables, L2 descriptors...).
+/// Tasks reserve their blocks while they are initialized, the host image of all blocks is then sent to device
+/// with one allocation and one copy.
+///
+class ArgsArena {
+ public:
+  static const size_t kAlignment = 64;
+
+  // RT_MEMORY_SPM arenas are allocated as managed memory, any other type with rtMalloc.
+  // keep_host_image keeps the host image after Commit, so a span of blocks can be rewritten with one copy.
+  explicit ArgsArena(rtMemType_t mem_type, bool keep_host_image = false)
+      : mem_type_(mem_type), keep_host_image_(keep_host_image) {}
+  ~ArgsArena() { Release(); }
+  ArgsArena(const ArgsArena &) = delete;
+  ArgsArena &operator=(const ArgsArena &) = delete;
+
+  ///
+  /// @ingroup ge
+  /// @brief Reserve a block holding a copy of data, thread safe.
+  /// @param [in] data: initial content of the block, zero filled when null.
+  /// @param [in] size: block size.
+  /// @param [out] offset: block position in the arena.
+  /// @return SUCCESS / PARAM_INVALID when the arena is already on device.
+  ///
+  Status Reserve(const void *data, size_t size, size_t &offset);
+
+  ///
+  /// @ingroup ge
+  /// @brief Store the device address of target_offset as a 64 bit pointer at offset when the arena is committed.
+  /// @param [in] offset: position of the pointer, must lie in a reserved block.
+  /// @param [in] target_offset: arena position the pointer refers to.
+  /// @return SUCCESS / PARAM_INVALID.
+  ///
+  Status AddReloc(size_t offset, size_t target_offset);
+
+  ///
+  /// @ingroup ge
+  /// @brief Allocate the device memory and copy the host image to it.
+  /// @return SUCCESS / RT_FAILED.
+  ///
+  Status Commit();
+
+  // Device address of offset, null before Commit
+  void *GetDevAddr(size_t offset) const;
+
+  // Host image address of offset, null before Commit or when the host image is not kept
+  uint8_t *GetHostAddr(size_t offset);
+
+  // Arena position of the size bytes at dev_addr, false when they are not all in the committed arena
+  bool GetOffset(const void *dev_addr, size_t size, size_t &offset) const;
+
+  size_t GetSize() const { return size_; }
+
+  // Free the device memory and forget all blocks
+  void Release();
+
+ private:
+  rtMemType_t mem_type_;
+  bool keep_host_image_;
+  std::mutex mutex_;
+  // Released once the image is on device, unless keep_host_image_
+  std::vector<uint8_t> host_image_;
+  size_t size_ = 0;
+  // (pointer offset, target offset)
+  std::vector<std::pair<size_t, size_t>> relocs_;
+  uint8_t *dev_base_ = nullptr;
+};
+}  // namespace ge
+
+#endif  // GE_GRAPH_LOAD_NEW_MODEL_MANAGER_ARGS_ARENA_H_
@@ -18,10 +18,16 @@
 
 #include <securec.h>
 
+#include <thread>
+
 #include "common/debug/log.h"
 #include "common/scope_guard.h"
 #include "common/types.h"
 
+namespace {
+const uint32_t kSpinTimes = 64;
+}  // namespace
+
 namespace ge {
 domi::Status InputDataWrapper::Init(const InputData &input, const OutputData &output) {
   GE_CHK_BOOL_RET_STATUS(!is_init, domi::INTERNAL_ERROR, "InputDataWrapper is re-initialized");
@@ -31,4 +37,162 @@ domi::Status InputDataWrapper::Init(const InputData &input, const OutputData &ou
   is_init = true;
   return domi::SUCCESS;
 }
+
+DataInputer::DataInputer(uint32_t capacity)
+    : capacity_(1),
+      mask_(0),
+      enqueue_pos_(0),
+      dequeue_pos_(0),
+      is_stoped_(false),
+      consumer_waiting_(false),
+      producer_waiting_(0) {
+  while (capacity_ < capacity) {
+    capacity_ <<= 1;
+  }
+  mask_ = capacity_ - 1;
+  slots_.reset(new Slot[capacity_]);
+  for (uint64_t i = 0; i < capacity_; ++i) {
+    slots_[i].sequence = i;
+  }
+}
+
+bool DataInputer::IsDataFull() {
+  uint64_t pos = enqueue_pos_.load(std::memory_order_relaxed);
+  return slots_[pos & mask_].sequence.load() < pos;
+}
+
+bool DataInputer::TryPush(const InputData &input, const OutputData &output) {
+  uint64_t pos = enqueue_pos_.load(std::memory_order_relaxed);
+  Slot *slot = nullptr;
+  while (true) {
+    slot = &slots_[pos & mask_];
+    uint64_t sequence = slot->sequence.load();
+    if (sequence == pos) {
+      if (enqueue_pos_.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed)) {
+        break;
+      }
+    } else if (sequence < pos) {
+      // the slot of the previous round is not released yet
+      return false;
+    } else {
+      pos = enqueue_pos_.load(std::memory_order_relaxed);
+    }
+  }
+
+  // assignment keeps the capacity of blobs from the last round
+  slot->data.input_ = input;
+  slot->data.output_ = output;
+  slot->data.is_init = true;
+  slot->sequence.store(pos + 1);
+  return true;
+}
+
+InputDataWrapper *DataInputer::TryPop() {
+  Slot &slot = slots_[dequeue_pos_ & mask_];
+  if (slot.sequence.load() != dequeue_pos_ + 1) {
+    return nullptr;
+  }
+  slot.data.queue_pos_ = dequeue_pos_;
+  ++dequeue_pos_;
+  return &slot.data;
+}
+
+void DataInputer::NotifyConsumer() {
+  if (consumer_waiting_.load()) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    empty_cond_.notify_one();
+  }
+}
+
+domi::Status DataInputer::Push(const InputData &input, const OutputData &output, bool is_wait) {
+  for (uint32_t i = 0; i < kSpinTimes; ++i) {
+    if (is_stoped_) {
+      return domi::INTERNAL_ERROR;
+    }
+    if (TryPush(input, output)) {
+      NotifyConsumer();
+      return domi::SUCCESS;
+    }
+    if (!is_wait) {
+      return domi::INTERNAL_ERROR;
+    }
+    std::this_thread::yield();
+  }
+
+  bool success = false;
+  {
+    std::unique_lock<std::mutex> lock(mutex_);
+    ++producer_waiting_;
+    full_cond_.wait(lock, [&] { return is_stoped_ || (success = TryPush(input, output)); });
+    --producer_waiting_;
+  }
+  if (!success) {
+    return domi::INTERNAL_ERROR;
+  }
+  NotifyConsumer();
+  return domi::SUCCESS;
+}
+
+domi::Status DataInputer::Push(const std::shared_ptr<InputDataWrapper> &data) {
+  GE_CHECK_NOTNULL(data);
+  return Push(data->GetInput(), *data->GetOutput(), false);
+}
+
+domi::Status DataInputer::Pop(InputDataWrapper *&data) {
+  data = nullptr;
+  for (uint32_t i = 0; i < kSpinTimes; ++i) {
+    if (is_stoped_) {
+      return domi::INTERNAL_ERROR;
+    }
+    data = TryPop();
+    if (data != nullptr) {
+      return domi::SUCCESS;
+    }
+    std::this_thread::yield();
+  }
+
+  std::unique_lock<std::mutex> lock(mutex_);
+  consumer_waiting_ = true;
+  empty_cond_.wait(lock, [&] { return is_stoped_ || ((data = TryPop()) != nullptr); });
+  consumer_waiting_ = false;
+  if (data == nullptr) {
+    return domi::INTERNAL_ERROR;
+  }
+  return domi::SUCCESS;
+}
+
+domi::Status DataInputer::PopBatch(std::vector<InputDataWrapper *> &batch, size_t max_num) {
+  batch.clear();
+  InputDataWrapper *data = nullptr;
+  if (Pop(data) != domi::SUCCESS) {
+    return domi::INTERNAL_ERROR;
+  }
+  batch.emplace_back(data);
+  while (batch.size() < max_num) {
+    data = TryPop();
+    if (data == nullptr) {
+      break;
+    }
+    batch.emplace_back(data);
+  }
+  return domi::SUCCESS;
+}
+
+void DataInputer::Release(const InputDataWrapper *data) {
+  if (data == nullptr) {
+    return;
+  }
+  slots_[data->queue_pos_ & mask_].sequence.store(data->queue_pos_ + capacity_);
+  if (producer_waiting_.load() > 0) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    full_cond_.notify_all();
+  }
+}
+
+void DataInputer::Stop() {
+  is_stoped_ = true;
+  std::lock_guard<std::mutex> lock(mutex_);
+  empty_cond_.notify_all();
+  full_cond_.notify_all();
+}
 }  // namespace ge
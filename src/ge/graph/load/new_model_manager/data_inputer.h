@@ -17,7 +17,10 @@
 #ifndef GE_GRAPH_LOAD_NEW_MODEL_MANAGER_DATA_INPUTER_H_
 #define GE_GRAPH_LOAD_NEW_MODEL_MANAGER_DATA_INPUTER_H_
 
+#include <atomic>
+#include <condition_variable>
 #include <memory>
+#include <mutex>
 #include <string>
 #include <vector>
 
@@ -65,14 +68,20 @@ class InputDataWrapper {
   const InputData &GetInput() const { return input_; }
 
  private:
+  friend class DataInputer;
+
   OutputData output_;
   InputData input_;
   bool is_init;
+  // position in the DataInputer ring while the wrapper is handed out to the consumer
+  uint64_t queue_pos_ = 0;
 };
 
 ///
 /// @ingroup domi_ome
-/// @brief manage data input
+/// @brief manage data input, a bounded ring of preallocated InputDataWrapper slots.
+///        Any thread may push, the model run thread is the only one popping. A popped wrapper
+///        stays valid until it is released, so the slot is reused without any allocation.
 /// @author
 ///
 class DataInputer {
@@ -80,8 +89,9 @@ class DataInputer {
   ///
   /// @ingroup domi_ome
   /// @brief constructor
+  /// @param [in] capacity max data num, rounded up to a power of two
   ///
-  DataInputer() {}
+  explicit DataInputer(uint32_t capacity = kDefaultMaxQueueSize);
 
   ///
   /// @ingroup domi_ome
@@ -102,7 +112,18 @@ class DataInputer {
   /// @return true full
   /// @return false not full
   ///
-  bool IsDataFull() { return queue_.IsFull(); }
+  bool IsDataFull();
+
+  ///
+  /// @ingroup domi_ome
+  /// @brief copy input data into a free slot
+  /// @param [in] input input data
+  /// @param [in] output data copy dest address
+  /// @param [in] is_wait block while full instead of failing
+  /// @return SUCCESS add successful
+  /// @return INTERNAL_ERROR  full or stopped
+  ///
+  domi::Status Push(const InputData &input, const OutputData &output, bool is_wait = false);
 
   ///
   /// @ingroup domi_ome
@@ -111,35 +132,67 @@ class DataInputer {
   /// @return SUCCESS add successful
   /// @return INTERNAL_ERROR  add failed
   ///
-  domi::Status Push(const std::shared_ptr<InputDataWrapper> &data) {
-    bool success = queue_.Push(data, false);
-    return success ? domi::SUCCESS : domi::INTERNAL_ERROR;
-  }
+  domi::Status Push(const std::shared_ptr<InputDataWrapper> &data);
 
   ///
   /// @ingroup domi_ome
-  /// @brief pop input data
-  /// @param [out] save popped input data
+  /// @brief pop input data, block while empty
+  /// @param [out] data popped input data, call Release when done with it
   /// @return SUCCESS pop success
   /// @return INTERNAL_ERROR  pop fail
   ///
-  domi::Status Pop(std::shared_ptr<InputDataWrapper> &data) {
-    bool success = queue_.Pop(data);
-    return success ? domi::SUCCESS : domi::INTERNAL_ERROR;
-  }
+  domi::Status Pop(InputDataWrapper *&data);
 
   ///
   /// @ingroup domi_ome
-  /// @brief stop receiving data, invoke thread at Pop
+  /// @brief pop up to max_num input data, block only until the first one arrives
+  /// @param [out] batch popped input data in push order, call Release for each one
+  /// @param [in] max_num max data num to pop
+  /// @return SUCCESS pop success
+  /// @return INTERNAL_ERROR  pop fail
   ///
-  void Stop() { queue_.Stop(); }
+  domi::Status PopBatch(std::vector<InputDataWrapper *> &batch, size_t max_num);
 
- private:
   ///
   /// @ingroup domi_ome
-  /// @brief save input data queue
+  /// @brief give the slot of popped input data back to producers, may be called from any thread
+  /// @param [in] data popped input data
   ///
-  BlockingQueue<std::shared_ptr<InputDataWrapper>> queue_;
+  void Release(const InputDataWrapper *data);
+
+  ///
+  /// @ingroup domi_ome
+  /// @brief stop receiving data, invoke thread at Pop
+  ///
+  void Stop();
+
+ private:
+  struct Slot {
+    // pos: free for the producer of pos, pos + 1: filled for the consumer of pos
+    std::atomic<uint64_t> sequence;
+    InputDataWrapper data;
+  };
+
+  bool TryPush(const InputData &input, const OutputData &output);
+
+  InputDataWrapper *TryPop();
+
+  void NotifyConsumer();
+
+  uint64_t capacity_;
+  uint64_t mask_;
+  std::unique_ptr<Slot[]> slots_;
+  std::atomic<uint64_t> enqueue_pos_;
+  // only the consumer touches it
+  uint64_t dequeue_pos_;
+
+  // producers and consumer spin first, then sleep on the condition variables
+  std::atomic<bool> is_stoped_;
+  std::atomic<bool> consumer_waiting_;
+  std::atomic<uint32_t> producer_waiting_;
+  std::mutex mutex_;
+  std::condition_variable empty_cond_;
+  std::condition_variable full_cond_;
 };
 }  // namespace ge
 
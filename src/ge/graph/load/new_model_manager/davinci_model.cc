@@ -37,7 +37,7 @@
 #include "common/profiling/profiling_manager.h"
 #include "common/properties_manager.h"
 #include "common/scope_guard.h"
-#include "common/thread_pool.h"
+#include "common/task_executor.h"
 #include "framework/common/debug/ge_log.h"
 #include "graph/compute_graph.h"
 #include "graph/debug/ge_attr_define.h"
@@ -79,9 +79,13 @@ namespace ge {
 namespace {
 const uint32_t DEFAULT_DATA_INDEX = 0;
 const uint32_t TRUE_BRANCH_STREAM_NUM = 1;
-const uint32_t THREAD_NUM = 16;
 const int kDecimal = 10;
 const int kBytes = 8;
+const int64_t kMaxPipelineDepth = 8;
+// pushed after the last launched request to stop the pipelined result thread
+const uint32_t kPipelineStopSlot = UINT32_MAX;
+// dirty zero copy regions of the args arena at most this far apart are copied with the bytes between them
+const size_t kZeroCopyMaxGap = 4096;
 
 class RtContextSwitchGuard {
  public:
@@ -267,7 +271,7 @@ Status TransVarOnHost(uint8_t *var_data, const VarTransRoad &trans_road, formats
 
 ///
 /// re-alloc var memory on device using var-manager
-/// free origin var memory(var manager does not support now)
+/// origin var memory is freed by TransVarData once the data has been moved
 /// @param session_id
 /// @param var
 /// @param var_size_bytes
@@ -349,6 +353,11 @@ Status TransVarData(const NodePtr &var, const VarTransRoad &trans_road, uint64_t
     return ret;
   }
 
+  // graphs using the origin layout are rebuilt before their next run, give its memory back
+  if (VarManager::Instance(session_id)->FreeVarLayout(var->GetName(), input_desc) != SUCCESS) {
+    GELOGW("Failed to free the origin layout of var %s", var->GetName().c_str());
+  }
+
   return SUCCESS;
 }
 }  // namespace
@@ -369,9 +378,15 @@ DavinciModel::DavinciModel(int32_t priority, const std::shared_ptr<ModelListener
       version_(0),
       ge_model_(nullptr),
       thread_id_(),
+      pipeline_depth_(1),
+      pipeline_input_stream_(nullptr),
+      pipeline_output_stream_(nullptr),
       listener_(listener),
       run_flg_(false),
       priority_(priority),
+      zero_copy_patch_count_(0),
+      args_arena_(RT_MEMORY_HBM, true),
+      l2_arena_(RT_MEMORY_SPM),
       rt_model_handle_(nullptr),
       rt_model_stream_(nullptr),
       is_inner_model_stream_(false),
@@ -422,6 +437,8 @@ DavinciModel::~DavinciModel() {
       GE_CHK_RT(rtModelDestroy(rt_model_handle_));
       ReleaseTask();
     }
+    args_arena_.Release();
+    l2_arena_.Release();
 
     CleanTbeHandle();
 
@@ -467,10 +484,8 @@ Status DavinciModel::InitModelMem(void *dev_ptr, size_t memsize, void *weight_pt
   }
   is_model_has_inited_ = true;
   std::size_t data_size = TotalMemSize();
-  ge::Buffer weights = ge_model_->GetWeight();
-
-  uint8_t *weights_addr = weights.GetData();
-  std::size_t weights_size = weights.GetSize();
+  const uint8_t *weights_addr = ge_model_->GetWeightData();
+  std::size_t weights_size = ge_model_->GetWeightSize();
 
   GE_CHECK_LE(weights_size, ALLOC_MEMORY_MAX_SIZE);
 
@@ -514,6 +529,8 @@ Status DavinciModel::InitModelMem(void *dev_ptr, size_t memsize, void *weight_pt
     GE_CHK_RT_RET(rtMemcpy(weights_mem_base_, weights_size, weights_addr, weights_size, RT_MEMCPY_HOST_TO_DEVICE))
     GELOGI("copy weights data to device");
   }
+  // Weights referenced in a mapped model file are only valid while loading, they live on device from now on
+  ge_model_->ReleaseWeightDataAddr();
 
   var_mem_base_ = VarManager::Instance(session_id_)->GetVarMemoryBase(RT_MEMORY_HBM);
   if (TotalVarMemSize() && var_mem_base_ == nullptr) {
@@ -605,6 +622,11 @@ Status DavinciModel::DoTaskSink() {
     GE_CHK_STATUS_RET(DistributeTask(), "Distribute failed.");
 
     GE_CHK_RT_RET(rtModelLoadComplete(rt_model_handle_));
+
+    // report task id to op name relation at load time, iterations only report it again for a new session
+    if (ProfilingManager::Instance().ProfilingOn()) {
+      ReportProfilingData();
+    }
   }
   return SUCCESS;
 }
@@ -1447,17 +1469,20 @@ void *DavinciModel::Run(DavinciModel *model) {
       break;
     }
 
-    std::shared_ptr<InputDataWrapper> data_wrapper;
-    Status ret = model->GetDataInputer()->Pop(data_wrapper);
+    DataInputer *data_inputer = model->GetDataInputer();
+    InputDataWrapper *data_wrapper = nullptr;
+    Status ret = data_inputer->Pop(data_wrapper);
     if (data_wrapper == nullptr || ret != SUCCESS) {
       GELOGI("data_wrapper is null!");
       continue;
     }
+    // the input slot is handed back once this request is done
+    GE_MAKE_GUARD(release_data, [&] { data_inputer->Release(data_wrapper); });
     GELOGI("Getting the input data, model_id:%u", model_id);
 
     GE_IF_BOOL_EXEC(!model->RunFlag(), break);
 
-    InputData current_data = data_wrapper->GetInput();
+    const InputData &current_data = data_wrapper->GetInput();
     GELOGI("Model thread Run begin, model id:%u, data index:%d.", model_id, current_data.index);
 
     GE_TIMESTAMP_START(Model_SyncVarData);
@@ -1484,7 +1509,7 @@ void *DavinciModel::Run(DavinciModel *model) {
           (void)ProfilingManager::Instance().StartProfiling(i);  // just profiling, no need to check value
         }
         // collect profiling for ge
-        ProfilingManager::Instance().ReportProfilingData(model->GetTaskIdOpName());
+        model->ReportProfilingData();
         GELOGI("rtModelExecute start.");
         rtError_t rt_ret_prof_on = rtModelExecute(model->rt_model_handle_, model->rt_model_stream_, 0);
         GE_IF_BOOL_EXEC(rt_ret_prof_on != RT_ERROR_NONE, rslt_flg = false; (void)model->ReturnResult(
@@ -1529,7 +1554,7 @@ void *DavinciModel::Run(DavinciModel *model) {
 
       // collect profiling for ge
       if (ProfilingManager::Instance().ProfilingOn()) {
-        ProfilingManager::Instance().ReportProfilingData(model->GetTaskIdOpName());
+        model->ReportProfilingData();
       }
     }
 
@@ -1552,6 +1577,411 @@ void *DavinciModel::Run(DavinciModel *model) {
   return nullptr;
 }
 
+///
+/// @ingroup domi_ome
+/// @brief pipelined model run thread: pop request, stage its inputs into a free slot and
+/// @brief enqueue copy-in, execution and copy-out on model stream without waiting for device.
+/// @param [in] model model to run
+/// @return nullptr
+///
+void *DavinciModel::RunPipelined(DavinciModel *model) {
+  GE_CHK_BOOL_EXEC(model != nullptr,
+                   CsaInteract::GetInstance().WriteErrorCode(FAILED, ERROR_MODULE_FMK, JOBSUBSTATE_GRAPH_EXEC);
+                   return nullptr, "model_pointer is null!")
+  uint32_t model_id = model->Id();
+  uint32_t device_id = model->GetDeviceId();
+
+  GELOGI("Model pipelined run thread start, model_id:%u, depth:%u", model_id, model->PipelineDepth());
+  std::vector<InputDataWrapper *> data_wrappers;
+  rtError_t rt_ret = rtSetDevice(static_cast<int32_t>(device_id));
+  if (rt_ret != RT_ERROR_NONE) {
+    GELOGE(FAILED, "Model run rtsetdevice failed.");
+    return nullptr;
+  }
+  // DeviceReset before thread run finished!
+  GE_MAKE_GUARD(not_used_var, [&] { GE_CHK_RT(rtDeviceReset(device_id)); });
+
+  while (model->RunFlag()) {
+    if (model->GetDataInputer() == nullptr) {
+      GELOGW("Data inputer is nullptr.");
+      CsaInteract::GetInstance().StoreInternalErrorCode(FAILED, ERROR_MODULE_FMK, JOBSUBSTATE_GRAPH_EXEC);
+      break;
+    }
+
+    DataInputer *data_inputer = model->GetDataInputer();
+    Status ret = data_inputer->PopBatch(data_wrappers, model->PipelineDepth());
+    if (ret != SUCCESS) {
+      GELOGI("data_wrapper is null!");
+      continue;
+    }
+
+    size_t launched_num = 0;
+    for (; launched_num < data_wrappers.size(); ++launched_num) {
+      InputDataWrapper *data_wrapper = data_wrappers[launched_num];
+      GE_IF_BOOL_EXEC(!model->RunFlag(), break);
+
+      // blocks while pipeline depth requests are still in flight
+      uint32_t slot_index = 0;
+      GE_IF_BOOL_EXEC(!model->free_slot_queue_.Pop(slot_index), break);
+      model->pipeline_slots_[slot_index].data_wrapper = data_wrapper;
+
+      uint32_t data_index = data_wrapper->GetInput().index;
+      GELOGI("Model pipelined run begin, model id:%u, data index:%u, slot:%u.", model_id, data_index, slot_index);
+      ret = model->LaunchPipelineSlot(slot_index);
+      if (ret != SUCCESS) {
+        GELOGE(ret, "Launch pipeline slot failed, model id:%u, data index:%u.", model_id, data_index);
+        (void)model->ReturnResult(model_id, data_index, false, false, data_wrapper->GetOutput());
+        CsaInteract::GetInstance().StoreInternalErrorCode(ret, ERROR_MODULE_FMK, JOBSUBSTATE_GRAPH_EXEC);
+        // part of the request may already be enqueued, drain streams before the slot buffers are reused
+        model->SyncPipelineStreams();
+        model->pipeline_slots_[slot_index].data_wrapper = nullptr;
+        data_inputer->Release(data_wrapper);
+        (void)model->free_slot_queue_.Push(slot_index);
+        continue;
+      }
+      if (!model->inflight_slot_queue_.Push(slot_index)) {
+        model->pipeline_slots_[slot_index].data_wrapper = nullptr;
+        data_inputer->Release(data_wrapper);
+        ++launched_num;
+        break;
+      }
+    }
+    // requests popped but never launched since the model is stopping
+    for (; launched_num < data_wrappers.size(); ++launched_num) {
+      data_inputer->Release(data_wrappers[launched_num]);
+    }
+  }
+
+  CsaInteract::GetInstance().WriteInternalErrorCode();
+  GEEVENT("Model pipelined run thread end, model_id:%u", model_id);
+  return nullptr;
+}
+
+///
+/// @ingroup domi_ome
+/// @brief pipelined result thread: wait for in-flight slots in launch order, return outputs
+/// @brief to user and recycle the slot. Requests in flight when the model stops are still returned.
+/// @param [in] model model to run
+/// @return nullptr
+///
+void *DavinciModel::ReturnPipelined(DavinciModel *model) {
+  GE_CHK_BOOL_EXEC(model != nullptr, return nullptr, "model_pointer is null!")
+  uint32_t device_id = model->GetDeviceId();
+  rtError_t rt_ret = rtSetDevice(static_cast<int32_t>(device_id));
+  if (rt_ret != RT_ERROR_NONE) {
+    GELOGE(FAILED, "Model return rtsetdevice failed.");
+    return nullptr;
+  }
+  GE_MAKE_GUARD(not_used_var, [&] { GE_CHK_RT(rtDeviceReset(device_id)); });
+
+  uint32_t interator_count = 0;
+  uint32_t slot_index = 0;
+  while (model->inflight_slot_queue_.Pop(slot_index) && (slot_index != kPipelineStopSlot)) {
+    GE_TIMESTAMP_START(ReturnPipelineSlot);
+    (void)model->ReturnPipelineSlot(slot_index);
+    GE_TIMESTAMP_END(ReturnPipelineSlot, "GraphExcute::ReturnPipelineSlot");
+
+    model->GetDataInputer()->Release(model->pipeline_slots_[slot_index].data_wrapper);
+    model->pipeline_slots_[slot_index].data_wrapper = nullptr;
+    // fails once the model is stopping, the run thread takes no more slots then
+    (void)model->free_slot_queue_.Push(slot_index);
+
+    interator_count++;
+    GELOGI("interator_count=%u", interator_count);
+  }
+
+  GELOGI("Model pipelined return thread end, model_id:%u", model->Id());
+  return nullptr;
+}
+
+bool DavinciModel::IsPipelineSupported() {
+  // variable graphs sync broadcast data and zero copy patches task args, both need a quiet stream
+  if (output_op_list_.empty() || !variable_op_list_.empty() || support_mem_shared_flag_) {
+    return false;
+  }
+  if (!input_queue_ids_.empty() || !output_queue_ids_.empty()) {
+    return false;
+  }
+  if (ProfilingManager::Instance().ProfilingOpTraceOn()) {
+    return false;
+  }
+
+  for (const auto &op_desc : data_op_list_) {
+    if (op_desc == nullptr || op_desc->GetInputsSize() != 1 || op_desc->GetOutputsSize() != 1) {
+      return false;
+    }
+    if (ModelUtils::IsInputTensorNeedTrans(op_desc, 0)) {
+      return false;
+    }
+    bool need_memset = false;
+    (void)AttrUtils::GetBool(op_desc, "_need_memset", need_memset);
+    if (need_memset) {
+      return false;
+    }
+  }
+  return true;
+}
+
+Status DavinciModel::InitPipelineSlots(uint32_t depth) {
+  pipeline_input_addrs_.clear();
+  pipeline_output_addrs_.clear();
+
+  for (size_t data_op_index = 0; data_op_index < data_op_list_.size(); ++data_op_index) {
+    const auto &op_desc = data_op_list_[data_op_index];
+    GE_CHECK_NOTNULL(op_desc);
+    uint32_t data_index = static_cast<uint32_t>(data_op_index);
+    (void)AttrUtils::GetInt(op_desc, "index", data_index);
+    GE_CHK_BOOL_RET_STATUS(data_index < data_op_list_.size(), PARAM_INVALID, "index:%u >= size:%zu", data_index,
+                           data_op_list_.size());
+
+    uint32_t input_size = 0;
+    GE_CHK_STATUS_RET(TensorUtils::GetSize(*op_desc->GetInputDescPtr(0), input_size), "get input size failed.");
+    vector<GeAttrValue::INT> outputs = op_desc->GetOutputOffset();
+    GE_CHECK_VECTOR_NOT_EMPTY(outputs);
+
+    void *device_addr = nullptr;
+    if (VarManager::Instance(session_id_)->IsVarAddr(outputs[0])) {
+      device_addr = var_mem_base_ + outputs[0] - runtime_param_.logic_var_base;
+    } else {
+      GE_CHK_BOOL_RET_STATUS(((uint64_t)outputs[0] + (uint64_t)input_size) <= TotalMemSize(), INTERNAL_ERROR,
+                             "input offset add size is large than total memory.");
+      device_addr = mem_base_ + outputs[0];
+    }
+    pipeline_input_addrs_.push_back({data_index, device_addr, input_size});
+  }
+
+  uint32_t data_index = 0;
+  for (auto &op_desc : output_op_list_) {
+    Output model_output(op_desc, this);
+    GE_CHK_STATUS_RET(model_output.Init(), "init model output failed, op name: %s", op_desc->GetName().c_str());
+
+    vector<uint32_t> v_output_size;
+    vector<void *> v_output_data_addr;
+    model_output.GetOutputData(v_output_data_addr, v_output_size);
+    for (size_t i = 0; i < v_output_size.size(); ++i) {
+      uint32_t size = v_output_size[i];
+      GE_CHK_STATUS_RET(TensorUtils::GetTensorSizeInBytes(*op_desc->GetInputDescPtr(static_cast<uint32_t>(i)), size),
+                        "GetTensorSizeInBytes failed!");
+      pipeline_output_addrs_.push_back({data_index++, v_output_data_addr[i], size});
+    }
+  }
+
+  free_slot_queue_.Restart();
+  free_slot_queue_.Clear();
+  inflight_slot_queue_.Restart();
+  inflight_slot_queue_.Clear();
+
+  pipeline_slots_.resize(depth);
+  rtError_t rt_ret = rtStreamCreate(&pipeline_input_stream_, priority_);
+  if (rt_ret == RT_ERROR_NONE) {
+    rt_ret = rtStreamCreate(&pipeline_output_stream_, priority_);
+  }
+  if (rt_ret != RT_ERROR_NONE) {
+    GELOGE(RT_FAILED, "Failed to create pipeline copy streams, error-code 0x%X.", rt_ret);
+    FreePipelineSlots();
+    return RT_FAILED;
+  }
+
+  for (uint32_t slot_index = 0; slot_index < depth; ++slot_index) {
+    PipelineSlot &slot = pipeline_slots_[slot_index];
+    rt_ret = rtEventCreate(&slot.input_event);
+    if (rt_ret == RT_ERROR_NONE) {
+      rt_ret = rtEventCreate(&slot.compute_event);
+    }
+    if (rt_ret == RT_ERROR_NONE) {
+      rt_ret = rtEventCreate(&slot.event);
+    }
+    for (const auto &addr : pipeline_input_addrs_) {
+      void *buffer = nullptr;
+      void *device_buffer = nullptr;
+      if (rt_ret == RT_ERROR_NONE) {
+        rt_ret = rtMallocHost(&buffer, std::max(addr.size, 1U));
+      }
+      if (rt_ret == RT_ERROR_NONE) {
+        rt_ret = rtMalloc(&device_buffer, std::max(addr.size, 1U), RT_MEMORY_HBM);
+      }
+      slot.input_buffers.push_back(buffer);
+      slot.device_input_buffers.push_back(device_buffer);
+    }
+    for (const auto &addr : pipeline_output_addrs_) {
+      void *buffer = nullptr;
+      void *device_buffer = nullptr;
+      if (rt_ret == RT_ERROR_NONE) {
+        rt_ret = rtMallocHost(&buffer, std::max(addr.size, 1U));
+      }
+      if (rt_ret == RT_ERROR_NONE) {
+        rt_ret = rtMalloc(&device_buffer, std::max(addr.size, 1U), RT_MEMORY_HBM);
+      }
+      slot.output_buffers.push_back(buffer);
+      slot.device_output_buffers.push_back(device_buffer);
+    }
+    if (rt_ret != RT_ERROR_NONE) {
+      GELOGE(RT_FAILED, "Failed to create pipeline slot %u, error-code 0x%X.", slot_index, rt_ret);
+      FreePipelineSlots();
+      return RT_FAILED;
+    }
+    (void)free_slot_queue_.Push(slot_index);
+  }
+
+  GELOGI("Init %u pipeline slots, inputs:%zu, outputs:%zu.", depth, pipeline_input_addrs_.size(),
+         pipeline_output_addrs_.size());
+  return SUCCESS;
+}
+
+void DavinciModel::SyncPipelineStreams() {
+  for (rtStream_t stream : {pipeline_input_stream_, rt_model_stream_, pipeline_output_stream_}) {
+    if (stream != nullptr) {
+      GE_LOGW_IF(rtStreamSynchronize(stream) != RT_ERROR_NONE, "Synchronize pipeline stream failed!");
+    }
+  }
+}
+
+void DavinciModel::FreePipelineSlots() {
+  if (pipeline_slots_.empty()) {
+    return;
+  }
+  // slot buffers may still be referenced by enqueued copies
+  SyncPipelineStreams();
+
+  for (auto &slot : pipeline_slots_) {
+    for (auto buffer : slot.input_buffers) {
+      GE_IF_BOOL_EXEC(buffer != nullptr, GE_LOGW_IF(rtFreeHost(buffer) != RT_ERROR_NONE, "Free host memory failed!"));
+    }
+    for (auto buffer : slot.output_buffers) {
+      GE_IF_BOOL_EXEC(buffer != nullptr, GE_LOGW_IF(rtFreeHost(buffer) != RT_ERROR_NONE, "Free host memory failed!"));
+    }
+    for (auto buffer : slot.device_input_buffers) {
+      GE_IF_BOOL_EXEC(buffer != nullptr, GE_LOGW_IF(rtFree(buffer) != RT_ERROR_NONE, "Free device memory failed!"));
+    }
+    for (auto buffer : slot.device_output_buffers) {
+      GE_IF_BOOL_EXEC(buffer != nullptr, GE_LOGW_IF(rtFree(buffer) != RT_ERROR_NONE, "Free device memory failed!"));
+    }
+    for (rtEvent_t event : {slot.input_event, slot.compute_event, slot.event}) {
+      GE_IF_BOOL_EXEC(event != nullptr, GE_LOGW_IF(rtEventDestroy(event) != RT_ERROR_NONE, "Destroy event failed!"));
+    }
+  }
+  for (rtStream_t *stream : {&pipeline_input_stream_, &pipeline_output_stream_}) {
+    if (*stream != nullptr) {
+      GE_LOGW_IF(rtStreamDestroy(*stream) != RT_ERROR_NONE, "Destroy stream failed!");
+      *stream = nullptr;
+    }
+  }
+  pipeline_slots_.clear();
+  pipeline_input_addrs_.clear();
+  pipeline_output_addrs_.clear();
+}
+
+Status DavinciModel::LaunchPipelineSlot(uint32_t slot_index) {
+  PipelineSlot &slot = pipeline_slots_[slot_index];
+  GE_CHECK_NOTNULL(slot.data_wrapper);
+  const InputData &current_data = slot.data_wrapper->GetInput();
+  OutputData *output_data = slot.data_wrapper->GetOutput();
+  GE_CHECK_NOTNULL(output_data);
+  GE_CHK_BOOL_RET_STATUS(current_data.blobs.size() == data_op_list_.size(), PARAM_INVALID,
+                         "The input data list size (%zu) does not match the model input list size (%zu)",
+                         current_data.blobs.size(), data_op_list_.size());
+  GE_CHK_BOOL_RET_STATUS(output_data->blobs.size() == pipeline_output_addrs_.size(), PARAM_INVALID,
+                         "output buffer size[%zu] not equal model output size[%zu]!", output_data->blobs.size(),
+                         pipeline_output_addrs_.size());
+
+  // slot buffers are only reused after the previous request in this slot has been returned. Inputs go to the device
+  // buffers of the slot while the model still runs earlier requests.
+  for (size_t i = 0; i < pipeline_input_addrs_.size(); ++i) {
+    const PipelineAddr &addr = pipeline_input_addrs_[i];
+    const DataBuffer &data_buf = current_data.blobs[addr.data_index];
+    GE_CHK_BOOL_RET_STATUS(data_buf.length <= addr.size, PARAM_INVALID,
+                           "input data size(%u) does not match model required size(%u), ret fail.", data_buf.length,
+                           addr.size);
+    if (data_buf.length == 0) {
+      continue;
+    }
+    GE_CHK_BOOL_RET_STATUS(memcpy_s(slot.input_buffers[i], addr.size, data_buf.data, data_buf.length) == EOK,
+                           INTERNAL_ERROR, "Stage input %zu failed, size %u.", i, data_buf.length);
+    GE_CHK_RT_RET(rtMemcpyAsync(slot.device_input_buffers[i], addr.size, slot.input_buffers[i], data_buf.length,
+                                RT_MEMCPY_HOST_TO_DEVICE, pipeline_input_stream_));
+  }
+  GE_CHK_RT_RET(rtEventRecord(slot.input_event, pipeline_input_stream_));
+
+  // model stream has finished with the model inputs and outputs of the previous request here
+  GE_CHK_RT_RET(rtStreamWaitEvent(rt_model_stream_, slot.input_event));
+  for (size_t i = 0; i < pipeline_input_addrs_.size(); ++i) {
+    const PipelineAddr &addr = pipeline_input_addrs_[i];
+    uint32_t length = current_data.blobs[addr.data_index].length;
+    if (length == 0) {
+      continue;
+    }
+    GE_CHK_RT_RET(rtMemcpyAsync(addr.device_addr, addr.size, slot.device_input_buffers[i], length,
+                                RT_MEMCPY_DEVICE_TO_DEVICE, rt_model_stream_));
+  }
+
+  GE_CHK_RT_RET(rtModelExecute(rt_model_handle_, rt_model_stream_, 0));
+
+  for (size_t i = 0; i < pipeline_output_addrs_.size(); ++i) {
+    const PipelineAddr &addr = pipeline_output_addrs_[i];
+    if (addr.size == 0) {
+      continue;
+    }
+    GE_CHK_RT_RET(rtMemcpyAsync(slot.device_output_buffers[i], addr.size, addr.device_addr, addr.size,
+                                RT_MEMCPY_DEVICE_TO_DEVICE, rt_model_stream_));
+  }
+  GE_CHK_RT_RET(rtEventRecord(slot.compute_event, rt_model_stream_));
+
+  // outputs go back to host while the model runs the next request
+  GE_CHK_RT_RET(rtStreamWaitEvent(pipeline_output_stream_, slot.compute_event));
+  for (size_t i = 0; i < pipeline_output_addrs_.size(); ++i) {
+    const PipelineAddr &addr = pipeline_output_addrs_[i];
+    if (addr.size == 0) {
+      continue;
+    }
+    GE_CHK_RT_RET(rtMemcpyAsync(slot.output_buffers[i], addr.size, slot.device_output_buffers[i], addr.size,
+                                RT_MEMCPY_DEVICE_TO_HOST, pipeline_output_stream_));
+  }
+
+  GE_CHK_RT_RET(rtEventRecord(slot.event, pipeline_output_stream_));
+  return SUCCESS;
+}
+
+Status DavinciModel::ReturnPipelineSlot(uint32_t slot_index) {
+  PipelineSlot &slot = pipeline_slots_[slot_index];
+  GE_CHECK_NOTNULL(slot.data_wrapper);
+  uint32_t data_id = slot.data_wrapper->GetInput().index;
+  OutputData *output_data = slot.data_wrapper->GetOutput();
+  GE_CHECK_NOTNULL(output_data);
+
+  rtError_t rt_ret = rtEventSynchronize(slot.event);
+  if (rt_ret != RT_ERROR_NONE) {
+    GELOGE(RT_FAILED, "Wait pipeline slot %u failed, model id:%u, error-code 0x%X.", slot_index, model_id_, rt_ret);
+    CsaInteract::GetInstance().StoreInternalErrorCode(rt_ret, ERROR_MODULE_RUNTIME, JOBSUBSTATE_GRAPH_EXEC);
+    return ReturnResult(model_id_, data_id, false, rt_ret == RT_ERROR_END_OF_SEQUENCE, output_data);
+  }
+
+  // collect profiling for ge
+  if (ProfilingManager::Instance().ProfilingOn()) {
+    ReportProfilingData();
+  }
+
+  output_data->index = data_id;
+  output_data->model_id = model_id_;
+  for (size_t i = 0; i < pipeline_output_addrs_.size(); ++i) {
+    DataBuffer &data_buf = output_data->blobs[pipeline_output_addrs_[i].data_index];
+    uint32_t size = pipeline_output_addrs_[i].size;
+    if (data_buf.length == 0 || size == 0) {
+      continue;
+    }
+    if (memcpy_s(data_buf.data, data_buf.length, slot.output_buffers[i], size) != EOK) {
+      GELOGE(INTERNAL_ERROR, "Return output %zu failed, size %u, buffer length %u.", i, size, data_buf.length);
+      return ReturnResult(model_id_, data_id, false, false, output_data);
+    }
+  }
+
+  GE_IF_BOOL_EXEC((DumpOpInputOutput(op_list_, model_id_) != SUCCESS),
+                  GELOGW("dump op failed, model_id: %u", model_id_););
+
+  GE_CHK_BOOL_EXEC(listener_ != nullptr, return PARAM_INVALID, "listener_ is null!");
+  GE_CHK_STATUS(listener_->OnComputeDone(model_id_, data_id, SUCCESS), "OnComputeDone failed");
+  return SUCCESS;
+}
+
 ///
 /// @ingroup domi_ome
 /// @brief call API provided by data inputer to destroy thread
@@ -1565,11 +1995,22 @@ Status DavinciModel::DestroyThread() {
   run_flg_ = false;
 
   data_inputer_->Stop();
+  free_slot_queue_.Stop();
 
   if (thread_id_.joinable()) {
     thread_id_.join();
   }
 
+  // no more requests are launched, the result thread returns those in flight before it stops
+  if (return_thread_id_.joinable()) {
+    (void)inflight_slot_queue_.Push(kPipelineStopSlot);
+    return_thread_id_.join();
+  }
+  inflight_slot_queue_.Stop();
+
+  FreePipelineSlots();
+  pipeline_depth_ = 1;
+
   return SUCCESS;
 }
 
@@ -1603,7 +2044,26 @@ Status DavinciModel::ModelRunStart() {
   int64_t maxDumpOpNum = std::strtol(opt.c_str(), nullptr, kDecimal);
   maxDumpOpNum_ = maxDumpOpNum;
 
-  CREATE_STD_THREAD(thread_id_, DavinciModel::Run, this);
+  string depth = "1";
+  (void)ge::GetContext().GetOption(OPTION_EXEC_PIPELINE_DEPTH, depth);  // option may not be set up
+  int64_t pipeline_depth = std::strtol(depth.c_str(), nullptr, kDecimal);
+  if (pipeline_depth > 1) {
+    pipeline_depth = std::min(pipeline_depth, kMaxPipelineDepth);
+    if (!IsPipelineSupported()) {
+      GELOGW("Model %u does not support pipelined execution, run serially.", model_id_);
+    } else if (InitPipelineSlots(static_cast<uint32_t>(pipeline_depth)) != SUCCESS) {
+      GELOGW("Model %u init pipeline slots failed, run serially.", model_id_);
+    } else {
+      pipeline_depth_ = static_cast<uint32_t>(pipeline_depth);
+    }
+  }
+
+  if (pipeline_depth_ > 1) {
+    CREATE_STD_THREAD(return_thread_id_, DavinciModel::ReturnPipelined, this);
+    CREATE_STD_THREAD(thread_id_, DavinciModel::RunPipelined, this);
+  } else {
+    CREATE_STD_THREAD(thread_id_, DavinciModel::Run, this);
+  }
   GELOGI("model tread create success, model id:%u", model_id_);
   return SUCCESS;
 }
@@ -1648,9 +2108,8 @@ void DavinciModel::UnbindTaskSinkStream() {
 Status DavinciModel::InitTaskInfo(ModelTaskDef &model_task_def) {
   GELOGI("InitTaskInfo in,task size %zu", model_task_def.task().size());
   task_list_.resize(model_task_def.task_size());
-  std::vector<std::future<Status>> futures(model_task_def.task_size());
-  constexpr uint32_t thread_num = THREAD_NUM;
-  ThreadPool executor(thread_num);
+  args_arena_.Release();
+  l2_arena_.Release();
   rtContext_t ctx = nullptr;
   rtError_t rt_ret = rtCtxGetCurrent(&ctx);
   if (rt_ret != RT_ERROR_NONE || ctx == nullptr) {
@@ -1658,39 +2117,50 @@ Status DavinciModel::InitTaskInfo(ModelTaskDef &model_task_def) {
     return RT_FAILED;
   }
 
-  for (int32_t i = 0; i < model_task_def.task_size(); ++i) {
-    futures[i] = executor.commit(
-        [](const domi::TaskDef &task, DavinciModel *model, rtContext_t ctx, int32_t idx) -> Status {
-          rtError_t ctx_ret = rtCtxSetCurrent(ctx);
-          if (ctx_ret != RT_ERROR_NONE) {
-            GELOGE(RT_FAILED, "Failed to set context from rt, error-code 0x%X.", ctx_ret);
-            return RT_FAILED;
-          }
-
-          model->task_list_[idx] = TaskInfoFactory::Instance().Create(static_cast<rtModelTaskType_t>(task.type()));
-
-          Status ret = FAILED;
-          if (model->task_list_[idx] != nullptr) {
-            ret = model->task_list_[idx]->Init(task, model);
-          }
-          return ret;
-        },
-        model_task_def.task(i), this, ctx, i);
+  auto init_tasks = [this, &model_task_def, ctx](size_t begin, size_t end) -> Status {
+    rtError_t ctx_ret = rtCtxSetCurrent(ctx);
+    if (ctx_ret != RT_ERROR_NONE) {
+      GELOGE(RT_FAILED, "Failed to set context from rt, error-code 0x%X.", ctx_ret);
+      return RT_FAILED;
+    }
+    for (size_t i = begin; i < end; ++i) {
+      const domi::TaskDef &task = model_task_def.task(static_cast<int32_t>(i));
+      task_list_[i] = TaskInfoFactory::Instance().Create(static_cast<rtModelTaskType_t>(task.type()));
+      Status ret = (task_list_[i] != nullptr) ? task_list_[i]->Init(task, this) : FAILED;
+      if (ret != SUCCESS) {
+        GELOGE(ret, "Task index %zu init fail.", i);
+        return ret;
+      }
+    }
+    return SUCCESS;
+  };
+  Status ret = TaskExecutor::Instance().ParallelFor(0, task_list_.size(), 1, init_tasks);
+  if (ret != SUCCESS) {
+    return ret;
   }
 
-  Status ret;
-  for (size_t i = 0; i < futures.size(); ++i) {
-    ret = futures[i].get();
-    if (ret != SUCCESS) {
-      GELOGE(ret, "Task index %zu init fail.", i);
-      return ret;
+  // tasks only reserved their args while initializing, send all of them to device at once
+  GE_CHK_STATUS_RET(args_arena_.Commit(), "Commit args arena failed.");
+  GE_CHK_STATUS_RET(l2_arena_.Commit(), "Commit l2 arena failed.");
+  for (size_t i = 0; i < task_list_.size(); ++i) {
+    if (task_list_[i] != nullptr) {
+      GE_CHK_STATUS_RET(task_list_[i]->UpdateArgsAddr(), "Task index %zu update args addr fail.", i);
     }
   }
 
-  GELOGI("InitTaskInfo out");
+  GELOGI("InitTaskInfo out, args arena size %zu, l2 arena size %zu", args_arena_.GetSize(), l2_arena_.GetSize());
   return SUCCESS;
 }
 
+void DavinciModel::ReportProfilingData() {
+  uint64_t report_epoch = ProfilingManager::Instance().GetReportEpoch();
+  if (profiling_report_epoch_ == report_epoch) {
+    return;
+  }
+  ProfilingManager::Instance().ReportProfilingData(op_task_id_map_);
+  profiling_report_epoch_ = report_epoch;
+}
+
 Status DavinciModel::DistributeTask() {
   GELOGI("do Distribute.");
 
@@ -1758,7 +2228,8 @@ void DavinciModel::SetOutsideAddr(const std::vector<void *> &outside_addrs) {
       continue;
     }
 
-    (void)outside_addrs_.emplace(std::pair<const void *, std::vector<void *>>(addr, {}));
+    // args hold the model's own address until the first request patches it
+    (void)outside_addrs_.emplace(std::pair<const void *, ZeroCopyTarget>(addr, {addr, {}, {}}));
     GELOGI("SetOutsideAddr success.");
   }
 }
@@ -1771,17 +2242,41 @@ void DavinciModel::SetOutsideAddr(const std::vector<void *> &outside_addrs) {
 /// @return None.
 ///
 void DavinciModel::SetZeroCopyAddr(const std::vector<void *> &outside_addrs, void *args_offset) {
+  std::lock_guard<std::mutex> lock(outside_addrs_mutex_);
   size_t nums = outside_addrs.size();
+  size_t first = nums;
+  size_t last = 0;
   for (size_t i = 0; i < nums; ++i) {
-    std::lock_guard<std::mutex> lock(outside_addrs_mutex_);
+    if (outside_addrs_.find(outside_addrs[i]) != outside_addrs_.end()) {
+      first = std::min(first, i);
+      last = i;
+    }
+  }
+  if (first == nums) {
+    return;
+  }
+
+  // slots between the first and last patched one are copied along, keep their original values in the table
+  size_t region_index = zero_copy_regions_.size();
+  size_t table_offset = zero_copy_table_.size();
+  for (size_t i = first; i <= last; ++i) {
+    zero_copy_table_.push_back(outside_addrs[i]);
     auto it = outside_addrs_.find(outside_addrs[i]);
     if (it == outside_addrs_.end()) {
       continue;
     }
-
-    it->second.push_back(static_cast<char *>(args_offset) + i * sizeof(void *));
-    GELOGI("SetZeroCopyAddr of outside_addrs.");
+    it->second.table_slots.push_back(table_offset + i - first);
+    if (it->second.regions.empty() || it->second.regions.back() != region_index) {
+      it->second.regions.push_back(region_index);
+    }
   }
+
+  ZeroCopyRegion region = {static_cast<char *>(args_offset) + first * sizeof(void *), table_offset, last - first + 1,
+                           false, 0};
+  region.in_arena = args_arena_.GetOffset(region.args_addr, region.slot_num * sizeof(void *), region.arena_offset);
+  zero_copy_regions_.push_back(region);
+  zero_copy_dirty_regions_.push_back(false);
+  GELOGI("SetZeroCopyAddr of outside_addrs, region slots: %zu.", last - first + 1);
 }
 
 ///
@@ -1794,11 +2289,19 @@ void DavinciModel::SetZeroCopyAddr(const std::vector<void *> &outside_addrs, voi
 Status DavinciModel::ModelZeroCopy(const InputData &input_data, OutputData &output_data) {
   if (ZeroCopyInput(input_data) != SUCCESS) {
     GELOGE(PARAM_INVALID, "ZeroCopyInput failed.");
+    ZeroCopyReset();
     return PARAM_INVALID;
   }
 
   if (ZeroCopyOutput(output_data) != SUCCESS) {
     GELOGE(PARAM_INVALID, "ZeroCopyOutput failed.");
+    ZeroCopyReset();
+    return PARAM_INVALID;
+  }
+
+  if (ZeroCopyFlush() != SUCCESS) {
+    GELOGE(PARAM_INVALID, "ZeroCopyFlush failed.");
+    ZeroCopyReset();
     return PARAM_INVALID;
   }
 
@@ -1898,7 +2401,7 @@ Status DavinciModel::ZeroCopyOutput(const OutputData &output_data) {
 
 ///
 /// @ingroup domi_ome
-/// @brief Copy address to args_ space for direct use.
+/// @brief Update address in host image of args, regions are copied to device by ZeroCopyFlush.
 /// @param [in] const void *src_addr: source address of the Op.
 /// @param [in] const void *dst_addr: destination address of user data.
 /// @return SUCCESS handle successfully / others handle failed
@@ -1918,18 +2421,97 @@ Status DavinciModel::ZeroCopyImpl(const void *src_addr, const DataBuffer &data_b
     return FAILED;
   }
 
-  for (auto &addr : it->second) {
-    __builtin_prefetch(addr);
-    rtError_t rt_err = rtMemcpy(addr, sizeof(void *), &dst_addr, sizeof(void *), RT_MEMCPY_HOST_TO_DEVICE);
+  // user buffers are usually reused between requests, skip if device args already hold this address
+  ZeroCopyTarget &target = it->second;
+  if (target.device_addr == dst_addr) {
+    return SUCCESS;
+  }
+
+  for (auto slot : target.table_slots) {
+    zero_copy_table_[slot] = dst_addr;
+  }
+  for (auto region : target.regions) {
+    zero_copy_dirty_regions_[region] = true;
+  }
+  target.device_addr = dst_addr;
+  return SUCCESS;
+}
+
+///
+/// @ingroup domi_ome
+/// @brief Copy every args region changed by this request to device. Regions in the args arena are written to its
+/// host image and copied in spans, regions elsewhere are copied one by one.
+/// @return SUCCESS handle successfully / others handle failed
+///
+Status DavinciModel::ZeroCopyFlush() {
+  uint32_t patch_count = 0;
+  std::vector<const ZeroCopyRegion *> arena_regions;
+  for (size_t i = 0; i < zero_copy_regions_.size(); ++i) {
+    if (!zero_copy_dirty_regions_[i]) {
+      continue;
+    }
+
+    const ZeroCopyRegion &region = zero_copy_regions_[i];
+    uint64_t size = region.slot_num * sizeof(void *);
+    uint8_t *host_addr = region.in_arena ? args_arena_.GetHostAddr(region.arena_offset) : nullptr;
+    if (host_addr != nullptr) {
+      errno_t sec_ret = memcpy_s(host_addr, size, &zero_copy_table_[region.table_offset], size);
+      if (sec_ret != EOK) {
+        GELOGE(FAILED, "ZeroCopyFlush: memcpy failed, region: %zu, ret: %d", i, sec_ret);
+        return FAILED;
+      }
+      arena_regions.push_back(&region);
+      continue;
+    }
+
+    rtError_t rt_err =
+        rtMemcpy(region.args_addr, size, &zero_copy_table_[region.table_offset], size, RT_MEMCPY_HOST_TO_DEVICE);
+    if (rt_err != RT_ERROR_NONE) {
+      GELOGE(FAILED, "ZeroCopyFlush: rtMemcpy failed, region: %zu", i);
+      return FAILED;
+    }
+    patch_count++;
+  }
+
+  // the host image matches the device between regions, so nearby regions go with one copy of the span
+  std::sort(arena_regions.begin(), arena_regions.end(),
+            [](const ZeroCopyRegion *lhs, const ZeroCopyRegion *rhs) { return lhs->arena_offset < rhs->arena_offset; });
+  size_t index = 0;
+  while (index < arena_regions.size()) {
+    size_t begin = arena_regions[index]->arena_offset;
+    size_t end = begin + arena_regions[index]->slot_num * sizeof(void *);
+    for (++index; (index < arena_regions.size()) && (arena_regions[index]->arena_offset <= end + kZeroCopyMaxGap);
+         ++index) {
+      end = std::max(end, arena_regions[index]->arena_offset + arena_regions[index]->slot_num * sizeof(void *));
+    }
+    rtError_t rt_err = rtMemcpy(args_arena_.GetDevAddr(begin), end - begin, args_arena_.GetHostAddr(begin),
+                                end - begin, RT_MEMCPY_HOST_TO_DEVICE);
     if (rt_err != RT_ERROR_NONE) {
-      GELOGE(FAILED, "ZeroCopyImpl: rtMemcpy failed");
+      GELOGE(FAILED, "ZeroCopyFlush: rtMemcpy failed, arena offset: %zu, size: %zu", begin, end - begin);
       return FAILED;
     }
+    patch_count++;
   }
 
+  zero_copy_dirty_regions_.assign(zero_copy_regions_.size(), false);
+  zero_copy_patch_count_ = patch_count;
+  GELOGI("ZeroCopyFlush model id:%u, patch copies: %u, regions: %zu.", model_id_, patch_count,
+         zero_copy_regions_.size());
   return SUCCESS;
 }
 
+///
+/// @ingroup domi_ome
+/// @brief Forget addresses of a failed request, next request patches every region again.
+/// @return None.
+///
+void DavinciModel::ZeroCopyReset() {
+  for (auto &it : outside_addrs_) {
+    it.second.device_addr = nullptr;
+  }
+  zero_copy_dirty_regions_.assign(zero_copy_regions_.size(), false);
+}
+
 ///
 /// @ingroup domi_ome
 /// @brief get unique identification for op when load two or more models
@@ -2234,7 +2816,7 @@ Status DavinciModel::NnExecute(rtStream_t stream, bool async_mode, const InputDa
 
   // collect profiling for ge
   if (ProfilingManager::Instance().ProfilingOn()) {
-    ProfilingManager::Instance().ReportProfilingData(op_task_id_map_);
+    ReportProfilingData();
     GELOGI("Acl Profiling Op name taskId report.");
   }
 
@@ -2317,9 +2899,6 @@ uint32_t DavinciModel::GetGraphID(const std::string &session_graph_id) {
 Status DavinciModel::TransAllVarData(ComputeGraphPtr &graph, uint32_t graph_id) {
   GELOGI("TransAllVarData start: session_id:%lu, graph_id: %u.", session_id_, graph_id);
 
-  ThreadPool executor(THREAD_NUM);
-  std::vector<std::future<Status>> vector_future;
-
   rtContext_t ctx = nullptr;
   rtError_t rt_ret = rtCtxGetCurrent(&ctx);
   if (rt_ret != RT_ERROR_NONE) {
@@ -2327,6 +2906,7 @@ Status DavinciModel::TransAllVarData(ComputeGraphPtr &graph, uint32_t graph_id)
     return RT_FAILED;
   }
 
+  TaskGroup group;
   for (ge::NodePtr &node : graph->GetDirectNode()) {
     if (node == nullptr) {
       continue;
@@ -2334,55 +2914,43 @@ Status DavinciModel::TransAllVarData(ComputeGraphPtr &graph, uint32_t graph_id)
     if (node->GetType() != VARIABLE) {
       continue;
     }
-    vector_future.push_back(executor.commit(
-        [](ge::NodePtr &node, DavinciModel *model, rtContext_t ctx, uint32_t graph_id) -> Status {
-          if (model == nullptr) {
-            GELOGE(FAILED, "DavinciModel is NULL!");
-            return FAILED;
-          }
-          rtError_t rt_ret = rtCtxSetCurrent(ctx);
-          if (rt_ret != RT_ERROR_NONE) {
-            GELOGE(RT_FAILED, "Failed to set context, error_code is: 0x%X.", rt_ret);
-            return RT_FAILED;
-          }
-          uint32_t allocated_graph_id = 0;
-          Status ret =
-              VarManager::Instance(model->session_id_)->GetAllocatedGraphId(node->GetName(), allocated_graph_id);
-          if (ret != SUCCESS) {
-            GELOGE(INTERNAL_ERROR, "var has not been allocated, node:%s, graph_id:%u.", node->GetName().c_str(),
-                   graph_id);
-            return INTERNAL_ERROR;
-          }
-          uint32_t changed_graph_id = 0;
-          ret = VarManager::Instance(model->session_id_)->GetChangedGraphId(node->GetName(), changed_graph_id);
-          bool call_trans_var =
-              (ret == SUCCESS && changed_graph_id == graph_id && changed_graph_id != allocated_graph_id);
-          if (call_trans_var) {
-            GELOGI("VarManager::GetChangedGraphId() success, node:%s, graph_id:%u.", node->GetName().c_str(), graph_id);
-            VarTransRoad *trans_road = VarManager::Instance(model->session_id_)->GetTransRoad(node->GetName());
-            if (trans_road == nullptr) {
-              GELOGI("The variable %s does not have any trans road", node->GetName().c_str());
-              return SUCCESS;
-            }
-            ret = TransVarData(node, *trans_road, model->session_id_, model->device_id_);
-            if (ret != SUCCESS) {
-              GELOGE(INTERNAL_ERROR, "TransVarData failed, node:%s, graph_id:%u.", node->GetName().c_str(), graph_id);
-              return INTERNAL_ERROR;
-            }
-            VarManager::Instance(model->session_id_)->RemoveChangedGraphId(node->GetName());
-          }
+    group.Submit([node, this, ctx, graph_id]() -> Status {
+      rtError_t rt_ret = rtCtxSetCurrent(ctx);
+      if (rt_ret != RT_ERROR_NONE) {
+        GELOGE(RT_FAILED, "Failed to set context, error_code is: 0x%X.", rt_ret);
+        return RT_FAILED;
+      }
+      uint32_t allocated_graph_id = 0;
+      Status ret = VarManager::Instance(session_id_)->GetAllocatedGraphId(node->GetName(), allocated_graph_id);
+      if (ret != SUCCESS) {
+        GELOGE(INTERNAL_ERROR, "var has not been allocated, node:%s, graph_id:%u.", node->GetName().c_str(), graph_id);
+        return INTERNAL_ERROR;
+      }
+      uint32_t changed_graph_id = 0;
+      ret = VarManager::Instance(session_id_)->GetChangedGraphId(node->GetName(), changed_graph_id);
+      bool call_trans_var = (ret == SUCCESS && changed_graph_id == graph_id && changed_graph_id != allocated_graph_id);
+      if (call_trans_var) {
+        GELOGI("VarManager::GetChangedGraphId() success, node:%s, graph_id:%u.", node->GetName().c_str(), graph_id);
+        VarTransRoad *trans_road = VarManager::Instance(session_id_)->GetTransRoad(node->GetName());
+        if (trans_road == nullptr) {
+          GELOGI("The variable %s does not have any trans road", node->GetName().c_str());
           return SUCCESS;
-        },
-        node, this, ctx, graph_id));
+        }
+        ret = TransVarData(node, *trans_road, session_id_, device_id_);
+        if (ret != SUCCESS) {
+          GELOGE(INTERNAL_ERROR, "TransVarData failed, node:%s, graph_id:%u.", node->GetName().c_str(), graph_id);
+          return INTERNAL_ERROR;
+        }
+        VarManager::Instance(session_id_)->RemoveChangedGraphId(node->GetName());
+      }
+      return SUCCESS;
+    });
   }
 
-  Status ret_status;
-  for (size_t i = 0; i < vector_future.size(); ++i) {
-    ret_status = vector_future[i].get();
-    if (ret_status != SUCCESS) {
-      GELOGE(ret_status, "TransAllVarData:: trans %zu vardata failed", i);
-      return ret_status;
-    }
+  Status ret_status = group.Wait();
+  if (ret_status != SUCCESS) {
+    GELOGE(ret_status, "TransAllVarData:: trans vardata failed");
+    return ret_status;
   }
 
   GELOGI("TransAllVarData success.");
@@ -17,6 +17,7 @@
 #ifndef GE_GRAPH_LOAD_NEW_MODEL_MANAGER_DAVINCI_MODEL_H_
 #define GE_GRAPH_LOAD_NEW_MODEL_MANAGER_DAVINCI_MODEL_H_
 
+#include <atomic>
 #include <map>
 #include <memory>
 #include <set>
@@ -35,6 +36,7 @@
 #include "common/types.h"
 #include "framework/common/util.h"
 #include "graph/debug/ge_attr_define.h"
+#include "graph/load/new_model_manager/args_arena.h"
 #include "graph/load/new_model_manager/data_dumper.h"
 #include "graph/load/new_model_manager/data_inputer.h"
 #include "graph/load/new_model_manager/model_utils.h"
@@ -110,6 +112,27 @@ class DavinciModel {
 
   static void *Run(DavinciModel *model_pointer);
 
+  ///
+  /// @ingroup domi_ome
+  /// @brief pipelined model run thread, stage inputs and launch execution without waiting for device.
+  /// @param [in] model_pointer model to run
+  ///
+  static void *RunPipelined(DavinciModel *model_pointer);
+
+  ///
+  /// @ingroup domi_ome
+  /// @brief pipelined result thread, wait for in-flight requests in order and return their outputs.
+  /// @param [in] model_pointer model to run
+  ///
+  static void *ReturnPipelined(DavinciModel *model_pointer);
+
+  ///
+  /// @ingroup domi_ome
+  /// @brief get number of requests allowed in flight, 1 means serial execution
+  /// @return pipeline depth
+  ///
+  uint32_t PipelineDepth() const { return pipeline_depth_; }
+
   ///
   /// @ingroup domi_ome
   /// @brief NnExecute
@@ -229,6 +252,13 @@ class DavinciModel {
   // get taskid to op name
   const map<uint32_t, std::string> &GetTaskIdOpName() const { return op_task_id_map_; }
 
+  ///
+  /// @ingroup ge
+  /// @brief report taskid to op name once for each profiling report epoch
+  /// @return void
+  ///
+  void ReportProfilingData();
+
   // get updated task info list
   std::vector<TaskInfoPtr> GetTaskList() { return task_list_; }
 
@@ -250,6 +280,12 @@ class DavinciModel {
 
   uint64_t GetRtVarAddr() const { return runtime_param_.logic_var_base; }
 
+  // Device memory of kernel args, flowtables and AI CPU custom descs of all tasks
+  ArgsArena &GetArgsArena() { return args_arena_; }
+
+  // Managed device memory of the L2 descriptors of all tasks
+  ArgsArena &GetL2Arena() { return l2_arena_; }
+
   uint32_t GetFlowctrlIndex(uint32_t op_index);
 
   void PushHcclStream(rtStream_t value);
@@ -409,6 +445,13 @@ class DavinciModel {
   ///
   void SetZeroCopyAddr(const std::vector<void *> &outside_addrs_, void *args_offset);
 
+  ///
+  /// @ingroup domi_ome
+  /// @brief Get number of copies of args regions to device by the last zero copy request.
+  /// @return patch copy count
+  ///
+  uint32_t GetZeroCopyPatchCount() const { return zero_copy_patch_count_; }
+
   DavinciModel &operator=(const DavinciModel &model) = delete;
 
   DavinciModel(const DavinciModel &model) = delete;
@@ -437,6 +480,8 @@ class DavinciModel {
   Status ZeroCopyInput(const InputData &input_data);
   Status ZeroCopyOutput(const OutputData &output_data);
   Status ZeroCopyImpl(const void *src_addr, const DataBuffer &data_buf);
+  Status ZeroCopyFlush();
+  void ZeroCopyReset();
 
   Status CopyInputData(const InputData &current_data, bool device_data = false);
 
@@ -452,6 +497,43 @@ class DavinciModel {
 
   Status SyncVarData();
 
+  ///
+  /// @ingroup domi_ome
+  /// @brief check whether requests of this model can be executed in pipelined mode.
+  /// @return true if every input is a plain copy and every output goes through NetOutput
+  ///
+  bool IsPipelineSupported();
+
+  ///
+  /// @ingroup domi_ome
+  /// @brief create the copy streams, and host staging buffers, device buffers and events of every pipeline slot.
+  /// @param [in] depth number of slots
+  /// @return Status
+  ///
+  Status InitPipelineSlots(uint32_t depth);
+
+  void FreePipelineSlots();
+
+  // wait for everything enqueued on the copy streams and the model stream
+  void SyncPipelineStreams();
+
+  ///
+  /// @ingroup domi_ome
+  /// @brief stage inputs of slot, enqueue input copy on the input copy stream, execution on model stream and
+  /// output copy on the output copy stream, ordered by the events of the slot.
+  /// @param [in] slot_index pipeline slot holding the request
+  /// @return Status
+  ///
+  Status LaunchPipelineSlot(uint32_t slot_index);
+
+  ///
+  /// @ingroup domi_ome
+  /// @brief copy staged outputs of a completed slot to user buffers and notify listener.
+  /// @param [in] slot_index pipeline slot holding the request
+  /// @return Status
+  ///
+  Status ReturnPipelineSlot(uint32_t slot_index);
+
   Status SyncDataAndDump();
 
   Status InitModelMem(void *dev_ptr, size_t memsize, void *weight_ptr, size_t weightsize);
@@ -545,6 +627,36 @@ class DavinciModel {
 
   std::thread thread_id_;
 
+  // pipelined execution: in-flight request slots and the thread returning their results
+  struct PipelineAddr {
+    uint32_t data_index;
+    void *device_addr;
+    uint32_t size;
+  };
+
+  struct PipelineSlot {
+    InputDataWrapper *data_wrapper = nullptr;
+    // inputs are on device, outputs are in the device buffers, outputs are on host
+    rtEvent_t input_event = nullptr;
+    rtEvent_t compute_event = nullptr;
+    rtEvent_t event = nullptr;
+    std::vector<void *> input_buffers;
+    std::vector<void *> output_buffers;
+    std::vector<void *> device_input_buffers;
+    std::vector<void *> device_output_buffers;
+  };
+
+  uint32_t pipeline_depth_;
+  // copies between host and the device buffers of slots, so they overlap with execution of other requests
+  rtStream_t pipeline_input_stream_;
+  rtStream_t pipeline_output_stream_;
+  std::vector<PipelineAddr> pipeline_input_addrs_;
+  std::vector<PipelineAddr> pipeline_output_addrs_;
+  std::vector<PipelineSlot> pipeline_slots_;
+  BlockingQueue<uint32_t> free_slot_queue_;
+  BlockingQueue<uint32_t> inflight_slot_queue_;
+  std::thread return_thread_id_;
+
   std::shared_ptr<ModelListener> listener_;
 
   bool run_flg_;
@@ -566,10 +678,32 @@ class DavinciModel {
 
   vector<rtLabel_t> label_list_;
 
+  // zero copy: every args region referencing a Data/NetOutput address, with its host image kept in one table
+  struct ZeroCopyRegion {
+    void *args_addr;
+    size_t table_offset;
+    size_t slot_num;
+    // regions in args_arena_ are copied through its host image, nearby ones together
+    bool in_arena;
+    size_t arena_offset;
+  };
+
+  struct ZeroCopyTarget {
+    const void *device_addr;
+    std::vector<size_t> table_slots;
+    std::vector<size_t> regions;
+  };
+
   std::mutex outside_addrs_mutex_;
-  std::map<const void *, std::vector<void *>> outside_addrs_;
+  std::map<const void *, ZeroCopyTarget> outside_addrs_;
+  std::vector<ZeroCopyRegion> zero_copy_regions_;
+  std::vector<void *> zero_copy_table_;
+  std::vector<bool> zero_copy_dirty_regions_;
+  uint32_t zero_copy_patch_count_;
 
   std::vector<TaskInfoPtr> task_list_;
+  ArgsArena args_arena_;
+  ArgsArena l2_arena_;
   // rt_moodel_handle
   rtModel_t rt_model_handle_;
 
@@ -611,6 +745,7 @@ class DavinciModel {
   // for profiling
   std::map<uint32_t, std::string> op_name_map_;
   std::map<uint32_t, std::string> op_task_id_map_;
+  std::atomic<uint64_t> profiling_report_epoch_{UINT64_MAX};
 
   int64_t maxDumpOpNum_;
   // for data dump
@@ -252,15 +252,6 @@ Status ModelManager::DataInput(const InputData &input_data, OutputData &output_d
     return domi::MODEL_NOT_READY;
   }
 
-  shared_ptr<InputDataWrapper> data_wrap(new (std::nothrow) InputDataWrapper());
-  GE_CHECK_NOTNULL(data_wrap);
-
-  Status status = data_wrap->Init(input_data, output_data);
-  if (status != SUCCESS) {
-    GELOGE(domi::PUSH_DATA_FAILED, "Init InputDataWrapper failed, input data index: %u.", input_data.index);
-    return domi::PUSH_DATA_FAILED;
-  }
-
   uint32_t model_id = input_data.model_id;
   output_data.model_id = model_id;
 
@@ -272,7 +263,8 @@ Status ModelManager::DataInput(const InputData &input_data, OutputData &output_d
 
   DataInputer *inputer = model->GetDataInputer();
   GE_CHECK_NOTNULL(inputer);
-  if (inputer->Push(data_wrap) != SUCCESS) {
+  // copied into a preallocated slot of the inputer ring
+  if (inputer->Push(input_data, output_data) != SUCCESS) {
     GELOGE(domi::DATA_QUEUE_ISFULL, "Data queue is full, please call again later, model_id %u ", model_id);
     return domi::DATA_QUEUE_ISFULL;
   }
@@ -330,18 +322,12 @@ Status ModelManager::DataInputTensor(uint32_t model_id, const std::vector<Tensor
     output_data.blobs.push_back(data);
   }
 
-  shared_ptr<InputDataWrapper> data_wrap(new (std::nothrow) InputDataWrapper());
-  GE_CHECK_NOTNULL(data_wrap);
-
-  GE_CHK_STATUS_EXEC(data_wrap->Init(input_data, output_data), return domi::PUSH_DATA_FAILED,
-                     "Init InputDataWrapper failed,input data model_id is : %u.", model_id);
-
   GE_CHK_BOOL_RET_STATUS(model != nullptr, PARAM_INVALID, "Invalid Model ID %u in InputData! ", model_id);
 
   DataInputer *inputer = model->GetDataInputer();
   GE_CHECK_NOTNULL(inputer);
 
-  GE_CHK_STATUS_EXEC(inputer->Push(data_wrap), return domi::DATA_QUEUE_ISFULL,
+  GE_CHK_STATUS_EXEC(inputer->Push(input_data, output_data), return domi::DATA_QUEUE_ISFULL,
                      "Data queue is full, please call again later, model_id %u ", model_id);
 
   GELOGD("Data input success, model id:%u", model_id);
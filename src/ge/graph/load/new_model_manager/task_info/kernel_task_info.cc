@@ -15,6 +15,7 @@
  */
 
 #include "graph/load/new_model_manager/task_info/kernel_task_info.h"
+#include <algorithm>
 #include <map>
 #include <memory>
 #include <string>
@@ -30,6 +31,28 @@
 namespace ge {
 static constexpr uint8_t kL2LoadToDdr = 1;
 static constexpr uint8_t kL2NotLoadToDdr = 0;
+constexpr size_t KernelTaskInfo::kNotReserved;
+
+namespace {
+// Host image of the kernel args, padded or cut to the size the kernel is launched with
+Status GetArgsImage(const domi::KernelDef &kernel_def, uint32_t args_size, std::vector<uint8_t> &args) {
+  args.assign(args_size, 0);
+  size_t copy_size = std::min(static_cast<size_t>(args_size), kernel_def.args().size());
+  if (copy_size == 0) {
+    return SUCCESS;
+  }
+  errno_t sec_ret = memcpy_s(args.data(), args.size(), kernel_def.args().data(), copy_size);
+  if (sec_ret != EOK) {
+    GELOGE(FAILED, "memcpy failed, ret: %d", sec_ret);
+    return FAILED;
+  }
+  return SUCCESS;
+}
+
+void *GetArenaAddr(const ArgsArena &arena, size_t offset) {
+  return (offset == KernelTaskInfo::kNotReserved) ? nullptr : arena.GetDevAddr(offset);
+}
+}  // namespace
 
 Status KernelTaskInfo::Init(const domi::TaskDef &task_def, DavinciModel *davinci_model) {
   GELOGD("KernelTaskInfo Init Start.");
@@ -111,6 +134,29 @@ Status KernelTaskInfo::Init(const domi::TaskDef &task_def, DavinciModel *davinci
   return ret;
 }
 
+Status KernelTaskInfo::UpdateArgsAddr() {
+  GE_CHECK_NOTNULL(davinci_model_);
+  const ArgsArena &arena = davinci_model_->GetArgsArena();
+  args_ = GetArenaAddr(arena, arena_blocks_.args);
+  if (arena_blocks_.args != kNotReserved && args_ == nullptr) {
+    GELOGE(INTERNAL_ERROR, "Args arena of model %s is not on device.", davinci_model_->Name().c_str());
+    return INTERNAL_ERROR;
+  }
+  flowtable_ = GetArenaAddr(arena, arena_blocks_.flowtable);
+  dump_args_ = GetArenaAddr(arena, arena_blocks_.dump_args);
+  custom_info_.input_descs = GetArenaAddr(arena, arena_blocks_.input_descs);
+  custom_info_.input_addrs = GetArenaAddr(arena, arena_blocks_.input_addrs);
+  custom_info_.output_descs = GetArenaAddr(arena, arena_blocks_.output_descs);
+  custom_info_.output_addrs = GetArenaAddr(arena, arena_blocks_.output_addrs);
+  custom_info_.attr_handle = GetArenaAddr(arena, arena_blocks_.attr_handle);
+  sm_desc_ = GetArenaAddr(davinci_model_->GetL2Arena(), arena_blocks_.sm_desc);
+
+  for (const auto &zero_copy_args : zero_copy_args_) {
+    davinci_model_->SetZeroCopyAddr(zero_copy_args.first, GetArenaAddr(arena, zero_copy_args.second));
+  }
+  return SUCCESS;
+}
+
 Status KernelTaskInfo::Distribute() {
   GELOGD("KernelTaskInfo Distribute Start.");
   rtError_t rt_ret;
@@ -144,26 +190,20 @@ Status KernelTaskInfo::Distribute() {
 }
 
 Status KernelTaskInfo::Release() {
-  FreeRtMem(&args_);
-  FreeRtMem(&flowtable_);
-  FreeRtMem(&custom_info_.input_descs);
-  FreeRtMem(&custom_info_.input_addrs);
-  FreeRtMem(&custom_info_.output_descs);
-  FreeRtMem(&custom_info_.output_addrs);
-  FreeRtMem(&custom_info_.attr_handle);
+  // device memory is owned by the args arenas of the model
+  args_ = nullptr;
+  flowtable_ = nullptr;
+  sm_desc_ = nullptr;
+  dump_args_ = nullptr;
+  custom_info_ = AICPUCustomInfo();
+  arena_blocks_ = ArenaBlocks();
+  zero_copy_args_.clear();
 
   if (ctx_.argsOffset != nullptr) {
     delete[] ctx_.argsOffset;
     ctx_.argsOffset = nullptr;
   }
 
-  rtError_t ret = (sm_desc_ != nullptr) ? rtMemFreeManaged(sm_desc_) : RT_ERROR_NONE;
-  if (ret != RT_ERROR_NONE) {
-    GELOGE(RT_FAILED, "Call rt api failed, ret: 0x%X", static_cast<int>(ret));
-    return FAILED;
-  }
-  sm_desc_ = nullptr;
-
   return SUCCESS;
 }
 
@@ -201,42 +241,32 @@ Status KernelTaskInfo::InitTVMTask(DavinciModel *davinci_model, uint16_t offset,
   tensor_device_addrs.insert(tensor_device_addrs.end(), output_data_addrs.begin(), output_data_addrs.end());
   tensor_device_addrs.insert(tensor_device_addrs.end(), workspace_data_addrs.begin(), workspace_data_addrs.end());
 
-  // malloc args memory
-  rt_ret = rtMalloc(&args_, args_size_, RT_MEMORY_HBM);
-  if (rt_ret != RT_ERROR_NONE) {
-    GELOGE(RT_FAILED, "Call rt api failed, ret: 0x%X", rt_ret);
-    return RT_FAILED;
-  }
-
-  // copy orign args
-  rt_ret = rtMemcpy(args_, args_size_, static_cast<void *>(const_cast<char *>(kernel_def.args().data())), args_size_,
-                    RT_MEMCPY_HOST_TO_DEVICE);
-  if (rt_ret != RT_ERROR_NONE) {
-    GELOGE(RT_FAILED, "Call rt api failed, ret: 0x%X", rt_ret);
-    return RT_FAILED;
-  }
-
   if (args_size_ <= static_cast<uint32_t>(offset) ||
       args_size_ - static_cast<uint32_t>(offset) < static_cast<uint32_t>(sizeof(void *) * tensor_device_addrs.size())) {
     GELOGE(FAILED, "offset >= kernelInfo.argsSize or copy content beyond applied memory.");
     return FAILED;
   }
 
-  // copy args
-  rt_ret = rtMemcpy(static_cast<char *>(args_) + offset, sizeof(void *) * tensor_device_addrs.size(),
-                    tensor_device_addrs.data(), sizeof(void *) * tensor_device_addrs.size(), RT_MEMCPY_HOST_TO_DEVICE);
-  if (rt_ret != RT_ERROR_NONE) {
-    GELOGE(RT_FAILED, "Call rt api failed, ret: 0x%X", rt_ret);
-    return RT_FAILED;
+  // origin args with the tensor addresses at offset
+  std::vector<uint8_t> args;
+  GE_CHK_STATUS_RET(GetArgsImage(kernel_def, args_size_, args), "Get args image failed.");
+  if (!tensor_device_addrs.empty()) {
+    errno_t sec_ret = memcpy_s(args.data() + offset, args.size() - offset, tensor_device_addrs.data(),
+                               sizeof(void *) * tensor_device_addrs.size());
+    if (sec_ret != EOK) {
+      GELOGE(FAILED, "memcpy failed, ret: %d", sec_ret);
+      return FAILED;
+    }
   }
+  ArgsArena &arena = davinci_model->GetArgsArena();
+  GE_CHK_STATUS_RET(arena.Reserve(args.data(), args.size(), arena_blocks_.args), "Reserve args failed.");
 
   if (PropertiesManager::Instance().IsLayerNeedDump(davinci_model->Name(), op_desc->GetName())) {
     dump_flag_ = RT_KERNEL_DUMPFLAG;
-    dump_args_ = reinterpret_cast<void *>(reinterpret_cast<uintptr_t>(args_) + offset +
-        sizeof(void *) * input_data_addrs.size());
+    arena_blocks_.dump_args = arena_blocks_.args + offset + sizeof(void *) * input_data_addrs.size();
   }
 
-  davinci_model_->SetZeroCopyAddr(tensor_device_addrs, static_cast<char *>(args_) + offset);
+  zero_copy_args_.emplace_back(tensor_device_addrs, arena_blocks_.args + offset);
   // update origin l2 data
   string sm_desc = kernel_def.sm_desc();
   char *sm_contrl = nullptr;
@@ -256,17 +286,8 @@ Status KernelTaskInfo::InitTVMTask(DavinciModel *davinci_model, uint16_t offset,
       }
     }
 
-    rt_ret = rtMemAllocManaged(&sm_desc_, sm_desc.size(), RT_MEMORY_SPM);
-    if (rt_ret != RT_ERROR_NONE) {
-      GELOGE(RT_FAILED, "Call rt api failed, ret: 0x%X", rt_ret);
-      return RT_FAILED;
-    }
-
-    rt_ret = rtMemcpy(sm_desc_, sm_desc.size(), sm_desc.data(), sm_desc.size(), RT_MEMCPY_HOST_TO_DEVICE);
-    if (rt_ret != RT_ERROR_NONE) {
-      GELOGE(RT_FAILED, "Call rt api failed, ret: 0x%X", rt_ret);
-      return RT_FAILED;
-    }
+    GE_CHK_STATUS_RET(davinci_model->GetL2Arena().Reserve(sm_desc.data(), sm_desc.size(), arena_blocks_.sm_desc),
+                      "Reserve sm desc failed.");
   }
   GELOGD("Do InitTVMTask end");
   return SUCCESS;
@@ -326,54 +347,33 @@ Status KernelTaskInfo::InitAICPUCustomTask(const std::map<uint32_t, std::shared_
     return PARAM_INVALID;
   }
 
-  rtError_t rt_ret = rtMalloc(&custom_info_.attr_handle, op_attr_size, RT_MEMORY_HBM);
-  if (rt_ret != RT_ERROR_NONE) {
-    GELOGE(RT_FAILED, "Call rt api failed, ret: 0x%X", rt_ret);
-    return RT_FAILED;
-  }
-
-  rt_ret = rtMemcpy(custom_info_.attr_handle, op_attr_size, buffer.GetData(), op_attr_size, RT_MEMCPY_HOST_TO_DEVICE);
-  if (rt_ret != RT_ERROR_NONE) {
-    GELOGE(RT_FAILED, "Call rt api failed, ret: 0x%X", rt_ret);
-    return RT_FAILED;
-  }
+  ArgsArena &arena = davinci_model_->GetArgsArena();
+  GE_CHK_STATUS_RET(arena.Reserve(buffer.GetData(), op_attr_size, arena_blocks_.attr_handle),
+                    "Reserve attr handle failed.");
 
   // args
-  char *args = const_cast<char *>(kernel_def.args().data());
-
   for (uint32_t i = 0; i < kCustomAicpuArgsLen; ++i) {
-    if (kernel_def.args().size() < ((size_t)ctx_.argsOffset[i] + sizeof(uint64_t))) {
+    if (std::min(kernel_def.args().size(), static_cast<size_t>(args_size_)) <
+        ((size_t)ctx_.argsOffset[i] + sizeof(uint64_t))) {
       GELOGE(FAILED, "ctx.argsOffset[%u]: %u + sizeof(uint64_t): %zu >= kernelDef.args().size():%zu", i,
              (uint32_t)ctx_.argsOffset[i], sizeof(uint64_t), kernel_def.args().size());
       return FAILED;
     }
   }
-  *(reinterpret_cast<uint64_t *>(args + ctx_.argsOffset[0])) =
-      reinterpret_cast<uint64_t>(custom_info_.input_descs);  // arg 0
-  *(reinterpret_cast<uint64_t *>(args + ctx_.argsOffset[1])) =
-      reinterpret_cast<uint64_t>(custom_info_.input_addrs);  // arg 1
-  *(reinterpret_cast<uint64_t *>(args + ctx_.argsOffset[2])) =
-      reinterpret_cast<uint64_t>(custom_info_.output_descs);  // arg 2
-  *(reinterpret_cast<uint64_t *>(args + ctx_.argsOffset[3])) =
-      reinterpret_cast<uint64_t>(custom_info_.output_addrs);  // arg 3
-  *(reinterpret_cast<uint64_t *>(args + ctx_.argsOffset[4])) =
-      reinterpret_cast<uint64_t>(custom_info_.attr_handle);  // arg 4
-
-  rt_ret = rtMalloc(&args_, args_size_, RT_MEMORY_HBM);
-  if (rt_ret != RT_ERROR_NONE) {
-    GELOGE(RT_FAILED, "Call rt api failed, ret: 0x%X", rt_ret);
-    return RT_FAILED;
-  }
+  std::vector<uint8_t> args;
+  GE_CHK_STATUS_RET(GetArgsImage(kernel_def, args_size_, args), "Get args image failed.");
+  GE_CHK_STATUS_RET(arena.Reserve(args.data(), args.size(), arena_blocks_.args), "Reserve args failed.");
 
-  rt_ret = rtMemcpy(args_, kernel_def.args_size(), kernel_def.args().data(), kernel_def.args_size(),
-                    RT_MEMCPY_HOST_TO_DEVICE);
-  if (rt_ret != RT_ERROR_NONE) {
-    GELOGE(RT_FAILED, "Call rt api failed, ret: 0x%X", rt_ret);
-    return RT_FAILED;
+  const size_t arg_blocks[kCustomAicpuArgsLen] = {arena_blocks_.input_descs, arena_blocks_.input_addrs,
+                                                  arena_blocks_.output_descs, arena_blocks_.output_addrs,
+                                                  arena_blocks_.attr_handle};
+  for (uint32_t i = 0; i < kCustomAicpuArgsLen; ++i) {
+    GE_CHK_STATUS_RET(arena.AddReloc(arena_blocks_.args + ctx_.argsOffset[i], arg_blocks[i]),
+                      "Set custom aicpu arg %u failed.", i);
   }
 
-  davinci_model_->SetZeroCopyAddr(input_data_addrs, custom_info_.input_addrs);
-  davinci_model_->SetZeroCopyAddr(output_data_addrs, custom_info_.output_addrs);
+  zero_copy_args_.emplace_back(input_data_addrs, arena_blocks_.input_addrs);
+  zero_copy_args_.emplace_back(output_data_addrs, arena_blocks_.output_addrs);
   return SUCCESS;
 }
 
@@ -426,32 +426,24 @@ Status KernelTaskInfo::InitCceTask(DavinciModel *davinci_model, const domi::Kern
   }
 
   // args
-  rtError_t rt_ret = rtMalloc(&args_, kernel_def.args_size(), RT_MEMORY_HBM);
-  if (rt_ret != RT_ERROR_NONE) {
-    GELOGE(RT_FAILED, "Call rt api failed, ret: 0x%X", rt_ret);
-    return RT_FAILED;
-  }
-
-  rt_ret = rtMemcpy(args_, kernel_def.args_size(), kernel_def.args().data(), kernel_def.args_size(),
-                    RT_MEMCPY_HOST_TO_DEVICE);
-  if (rt_ret != RT_ERROR_NONE) {
-    GELOGE(RT_FAILED, "Call rt api failed, ret: 0x%X", rt_ret);
-    return RT_FAILED;
+  std::vector<uint8_t> args;
+  GE_CHK_STATUS_RET(GetArgsImage(kernel_def, args_size_, args), "Get args image failed.");
+  ArgsArena &arena = davinci_model->GetArgsArena();
+  GE_CHK_STATUS_RET(arena.Reserve(args.data(), args.size(), arena_blocks_.args), "Reserve args failed.");
+  if (arena_blocks_.flowtable != kNotReserved) {
+    if (args_size_ < ctx_.argsOffset[0] + sizeof(uint64_t)) {
+      GELOGE(FAILED, "flowtable addr offset %u is beyond args size %u.", (uint32_t)ctx_.argsOffset[0], args_size_);
+      return FAILED;
+    }
+    // modify flowtable addr in args
+    GE_CHK_STATUS_RET(arena.AddReloc(arena_blocks_.args + ctx_.argsOffset[0], arena_blocks_.flowtable),
+                      "Set flowtable addr in args failed.");
   }
 
   // L2
   if (!sm_desc.empty()) {
-    rt_ret = rtMemAllocManaged(&sm_desc_, sm_desc.size(), RT_MEMORY_SPM);
-    if (rt_ret != RT_ERROR_NONE) {
-      GELOGE(RT_FAILED, "Call rt api failed, ret: 0x%X", rt_ret);
-      return RT_FAILED;
-    }
-
-    rt_ret = rtMemcpy(sm_desc_, sm_desc.size(), sm_desc.data(), sm_desc.size(), RT_MEMCPY_HOST_TO_DEVICE);
-    if (rt_ret != RT_ERROR_NONE) {
-      GELOGE(RT_FAILED, "Call rt api failed, ret: 0x%X", rt_ret);
-      return RT_FAILED;
-    }
+    GE_CHK_STATUS_RET(davinci_model->GetL2Arena().Reserve(sm_desc.data(), sm_desc.size(), arena_blocks_.sm_desc),
+                      "Reserve sm desc failed.");
   }
   return SUCCESS;
 }
@@ -495,27 +487,15 @@ Status KernelTaskInfo::InitAicpuTask(const std::map<uint32_t, OpDescPtr> &op_lis
     }
   }
 
-  // malloc device memory for args
-  rtError_t rt_ret = rtMalloc(static_cast<void **>(&args_), args_size_, RT_MEMORY_HBM);
-  if (rt_ret != RT_ERROR_NONE) {
-    GELOGE(RT_FAILED, "Call rt api(rtMalloc) failed, ret: 0x%X", rt_ret);
-    return RT_FAILED;
-  }
-
-  // copy args to device
-  rt_ret = rtMemcpy(args_, args_size_, static_cast<void *>(args_addr.get()), args_size_, RT_MEMCPY_HOST_TO_DEVICE);
-  if (rt_ret != RT_ERROR_NONE) {
-    GELOGE(RT_FAILED, "Call rt api(rtMemcpy) failed, ret: 0x%X", rt_ret);
-    return RT_FAILED;
-  }
+  GE_CHK_STATUS_RET(davinci_model_->GetArgsArena().Reserve(args_addr.get(), args_size_, arena_blocks_.args),
+                    "Reserve args failed.");
 
   if (PropertiesManager::Instance().IsLayerNeedDump(davinci_model_->Name(), op_desc->GetName())) {
     dump_flag_ = RT_KERNEL_DUMPFLAG;
-    dump_args_ = reinterpret_cast<void *>(reinterpret_cast<uintptr_t>(args_) + sizeof(aicpu::AicpuParamHead) +
-        sizeof(void *) * input_addrs.size());
+    arena_blocks_.dump_args = arena_blocks_.args + sizeof(aicpu::AicpuParamHead) + sizeof(void *) * input_addrs.size();
   }
 
-  davinci_model_->SetZeroCopyAddr(io_addrs, static_cast<char *>(args_) + sizeof(aicpu::AicpuParamHead));
+  zero_copy_args_.emplace_back(io_addrs, arena_blocks_.args + sizeof(aicpu::AicpuParamHead));
   return SUCCESS;
 }
 
@@ -523,73 +503,21 @@ Status KernelTaskInfo::StoreInputOutputTensor(const std::vector<void *> &input_d
                                               const std::vector<void *> &output_data_addrs,
                                               const std::vector<::tagCcAICPUTensor> &input_descs,
                                               const std::vector<::tagCcAICPUTensor> &output_descs) {
-  auto input_size = input_descs.size();
-  auto output_size = output_descs.size();
+  GE_CHECK_NOTNULL(davinci_model_);
+  ArgsArena &arena = davinci_model_->GetArgsArena();
 
   // inputDescs
-  rtError_t rt_ret = rtMalloc(&custom_info_.input_descs, sizeof(opTensor_t) * input_size, RT_MEMORY_HBM);
-  if (rt_ret != RT_ERROR_NONE) {
-    GELOGE(RT_FAILED, "Call rt api failed, ret: 0x%X", rt_ret);
-    return RT_FAILED;
-  }
-
-  for (std::size_t i = 0; i < input_size; ++i) {
-    rt_ret = rtMemcpy(static_cast<opTensor_t *>(custom_info_.input_descs) + i, sizeof(opTensor_t),
-                      const_cast<tagOpTensor *>(&input_descs[i]), sizeof(opTensor_t), RT_MEMCPY_HOST_TO_DEVICE);
-    if (rt_ret != RT_ERROR_NONE) {
-      GELOGE(RT_FAILED, "Call rt api failed, ret: 0x%X", rt_ret);
-      return RT_FAILED;
-    }
-  }
-
+  GE_CHK_STATUS_RET(arena.Reserve(input_descs.data(), sizeof(opTensor_t) * input_descs.size(),
+                                  arena_blocks_.input_descs), "Reserve input descs failed.");
   // inputAddrs
-  rt_ret = rtMalloc(&custom_info_.input_addrs, sizeof(opTensor_t) * input_size, RT_MEMORY_HBM);
-  if (rt_ret != RT_ERROR_NONE) {
-    GELOGE(RT_FAILED, "Call rt api failed, ret: 0x%X", rt_ret);
-    return RT_FAILED;
-  }
-
-  if (!input_data_addrs.empty()) {
-    rt_ret = rtMemcpy(custom_info_.input_addrs, sizeof(void *) * input_size, &input_data_addrs[0],
-                      sizeof(void *) * input_size, RT_MEMCPY_HOST_TO_DEVICE);
-    if (rt_ret != RT_ERROR_NONE) {
-      GELOGE(RT_FAILED, "Call rt api failed, ret: 0x%X", rt_ret);
-      return RT_FAILED;
-    }
-  }
-
+  GE_CHK_STATUS_RET(arena.Reserve(input_data_addrs.data(), sizeof(void *) * input_data_addrs.size(),
+                                  arena_blocks_.input_addrs), "Reserve input addrs failed.");
   // outputDescs
-  rt_ret = rtMalloc(&custom_info_.output_descs, sizeof(opTensor_t) * output_size, RT_MEMORY_HBM);
-  if (rt_ret != RT_ERROR_NONE) {
-    GELOGE(RT_FAILED, "Call rt api failed, ret: 0x%X", rt_ret);
-    return RT_FAILED;
-  }
-
-  for (std::size_t i = 0; i < output_size; ++i) {
-    rt_ret = rtMemcpy(static_cast<opTensor_t *>(custom_info_.output_descs) + i, sizeof(opTensor_t),
-                      const_cast<tagOpTensor *>(&input_descs[i]), sizeof(opTensor_t), RT_MEMCPY_HOST_TO_DEVICE);
-    if (rt_ret != RT_ERROR_NONE) {
-      GELOGE(RT_FAILED, "Call rt api failed, ret: 0x%X", rt_ret);
-      return RT_FAILED;
-    }
-  }
-
+  GE_CHK_STATUS_RET(arena.Reserve(output_descs.data(), sizeof(opTensor_t) * output_descs.size(),
+                                  arena_blocks_.output_descs), "Reserve output descs failed.");
   // outputAddrs
-  rt_ret = rtMalloc(&custom_info_.output_addrs, sizeof(opTensor_t) * output_size, RT_MEMORY_HBM);
-  if (rt_ret != RT_ERROR_NONE) {
-    GELOGE(RT_FAILED, "Call rt api failed, ret: 0x%X", rt_ret);
-    return RT_FAILED;
-  }
-
-  if (!output_data_addrs.empty()) {
-    rt_ret = rtMemcpy(custom_info_.output_addrs, sizeof(void *) * output_size, &output_data_addrs[0],
-                      sizeof(void *) * output_size, RT_MEMCPY_HOST_TO_DEVICE);
-    if (rt_ret != RT_ERROR_NONE) {
-      GELOGE(RT_FAILED, "Call rt api failed, ret: 0x%X", rt_ret);
-      return RT_FAILED;
-    }
-  }
-
+  GE_CHK_STATUS_RET(arena.Reserve(output_data_addrs.data(), sizeof(void *) * output_data_addrs.size(),
+                                  arena_blocks_.output_addrs), "Reserve output addrs failed.");
   return SUCCESS;
 }
 
@@ -624,18 +552,6 @@ Status KernelTaskInfo::SetContext(const domi::KernelDef &kernel_def) {
   return SUCCESS;
 }
 
-void KernelTaskInfo::FreeRtMem(void **ptr) {
-  if (ptr == nullptr || *ptr == nullptr) {
-    return;
-  }
-  rtError_t ret = rtFree(*ptr);
-  if (ret != RT_ERROR_NONE) {
-    GELOGE(RT_FAILED, "Call rt api failed, ret: 0x%X", ret);
-  }
-
-  *ptr = nullptr;
-}
-
 Status KernelTaskInfo::UpdateCceArgs(std::string &sm_desc, std::string &flowtable, DavinciModel *davinci_model,
                                      const domi::KernelDef &kernel_def) {
   GE_CHECK_NOTNULL(davinci_model);
@@ -672,21 +588,6 @@ Status KernelTaskInfo::UpdateCceArgs(std::string &sm_desc, std::string &flowtabl
 Status KernelTaskInfo::SetFlowtable(std::string &flowtable, const domi::KernelDef &kernel_def) {
   const domi::KernelContext &context = kernel_def.context();
   if (context.is_flowtable()) {
-    rtError_t rt_ret = rtMalloc(&flowtable_, flowtable.size(), RT_MEMORY_HBM);
-    if (rt_ret != RT_ERROR_NONE) {
-      GELOGE(RT_FAILED, "Call rt api failed, ret: 0x%X", rt_ret);
-      return RT_FAILED;
-    }
-
-    rt_ret = rtMemcpy(flowtable_, flowtable.size(), flowtable.data(), flowtable.size(), RT_MEMCPY_HOST_TO_DEVICE);
-    if (rt_ret != RT_ERROR_NONE) {
-      GELOGE(RT_FAILED, "Call rt api failed, ret: 0x%X", rt_ret);
-      return RT_FAILED;
-    }
-
-    // modify flowtable addr in args
-    char *args = const_cast<char *>(kernel_def.args().data());
-
     if (kernel_def.args().size() <
         ((reinterpret_cast<uint16_t *>(const_cast<char *>(context.args_offset().data())))[0] + sizeof(uint64_t))) {
       GELOGE(FAILED, "(context.args_offset().data()))[0]:%u + sizeof(uint64_t):%zu > kernelDef.args().size():%zu",
@@ -695,9 +596,11 @@ Status KernelTaskInfo::SetFlowtable(std::string &flowtable, const domi::KernelDe
       return FAILED;
     }
 
-    *(reinterpret_cast<uint64_t *>(
-        args + (reinterpret_cast<uint16_t *>(const_cast<char *>(context.args_offset().data())))[0])) =
-        reinterpret_cast<uint64_t>(flowtable_);
+    // the flowtable addr in args is set when the args are reserved
+    GE_CHECK_NOTNULL(davinci_model_);
+    GE_CHK_STATUS_RET(davinci_model_->GetArgsArena().Reserve(flowtable.data(), flowtable.size(),
+                                                             arena_blocks_.flowtable),
+                      "Reserve flowtable failed.");
   }
   return SUCCESS;
 }
@@ -17,9 +17,11 @@
 #ifndef GE_GRAPH_LOAD_NEW_MODEL_MANAGER_TASK_INFO_KERNEL_TASK_INFO_H_
 #define GE_GRAPH_LOAD_NEW_MODEL_MANAGER_TASK_INFO_KERNEL_TASK_INFO_H_
 
+#include <cstdint>
 #include <map>
 #include <memory>
 #include <string>
+#include <utility>
 #include <vector>
 
 #include "graph/load/new_model_manager/task_info/task_info.h"
@@ -29,6 +31,9 @@ class KernelTaskInfo : public TaskInfo {
  public:
   friend class DavinciModel;
 
+  // Offset of a block that is not reserved in the args arena
+  static constexpr size_t kNotReserved = SIZE_MAX;
+
   KernelTaskInfo()
       : ctx_(),
         stub_func_(nullptr),
@@ -56,6 +61,8 @@ class KernelTaskInfo : public TaskInfo {
 
   Status Init(const domi::TaskDef &task_def, DavinciModel *davinci_model) override;
 
+  Status UpdateArgsAddr() override;
+
   Status Distribute() override;
 
   Status Release() override;
@@ -94,8 +101,6 @@ class KernelTaskInfo : public TaskInfo {
 
   Status SetFlowtable(std::string &flowtable, const domi::KernelDef &kernel_def);
 
-  static void FreeRtMem(void **ptr);
-
   void *stub_func_;
   void *args_;
   void *sm_desc_;
@@ -118,6 +123,22 @@ class KernelTaskInfo : public TaskInfo {
     void *output_addrs = nullptr;
     void *attr_handle = nullptr;
   } custom_info_;
+
+  // Device memory of the task lives in the args arenas of the model, the pointers above are resolved from
+  // these offsets once the arenas are on device
+  struct ArenaBlocks {
+    size_t args = kNotReserved;
+    size_t sm_desc = kNotReserved;
+    size_t flowtable = kNotReserved;
+    size_t dump_args = kNotReserved;
+    size_t input_descs = kNotReserved;
+    size_t input_addrs = kNotReserved;
+    size_t output_descs = kNotReserved;
+    size_t output_addrs = kNotReserved;
+    size_t attr_handle = kNotReserved;
+  } arena_blocks_;
+  // Addresses patched by zero copy, with the arena offset of their first slot
+  std::vector<std::pair<std::vector<void *>, size_t>> zero_copy_args_;
 };
 }  // namespace ge
 #endif  // GE_GRAPH_LOAD_NEW_MODEL_MANAGER_TASK_INFO_KERNEL_TASK_INFO_H_
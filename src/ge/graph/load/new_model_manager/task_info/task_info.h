@@ -52,6 +52,9 @@ class TaskInfo {
 
   virtual Status Init(const domi::TaskDef &task_def, DavinciModel *davinci_model) = 0;
 
+  // Called once the args arena of the model is on device, after all tasks are initialized
+  virtual Status UpdateArgsAddr() { return SUCCESS; }
+
   virtual Status Distribute() = 0;
 
   virtual Status Release() { return SUCCESS; }
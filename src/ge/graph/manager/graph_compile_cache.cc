@@ -0,0 +1,341 @@
+/**
+ * Copyright 2019-2020 Huawei Technologies Co., Ltd
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "graph/manager/graph_compile_cache.h"
+
+#include <dirent.h>
+#include <dlfcn.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include <algorithm>
+#include <atomic>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+
+#include <google/protobuf/io/coded_stream.h>
+#include <google/protobuf/io/zero_copy_stream_impl_lite.h>
+
+#include "common/ge/plugin_manager.h"
+#include "common/helper/model_helper.h"
+#include "common/model_parser/base.h"
+#include "common/util.h"
+#include "framework/common/debug/ge_log.h"
+#include "framework/common/debug/log.h"
+#include "ge/ge_api_types.h"
+#include "graph/detail/model_serialize_imp.h"
+#include "graph/ge_global_options.h"
+#include "init/gelib.h"
+#include "proto/ge_ir.pb.h"
+
+namespace ge {
+namespace {
+const char *const kModelSuffix = ".om";
+const char *const kEnginePathEnv = "ASCEND_ENGINE_PATH";
+const char *const kPluginDirs[] = {"plugin/opskernel/", "plugin/nnengine/"};
+
+const uint64_t kSeedA = 0x9E3779B97F4A7C15ULL;
+const uint64_t kSeedB = 0xC2B2AE3D27D4EB4FULL;
+const uint64_t kPrime1 = 0x87C37B91114253D5ULL;
+const uint64_t kPrime2 = 0x4CF5AD432745937FULL;
+const uint64_t kPrime3 = 0x165667B19E3779F9ULL;
+
+inline uint64_t Rotl(uint64_t value, int shift) { return (value << shift) | (value >> (64 - shift)); }
+
+inline uint64_t FinalMix(uint64_t value) {
+  value ^= value >> 33;
+  value *= 0xFF51AFD7ED558CCDULL;
+  value ^= value >> 33;
+  value *= 0xC4CEB9FE1A85EC53ULL;
+  value ^= value >> 33;
+  return value;
+}
+
+// 128 bit hash over a byte stream, two independently mixed 64 bit lanes
+class KeyHasher {
+ public:
+  void Update(const void *data, size_t size) {
+    auto bytes = static_cast<const uint8_t *>(data);
+    length_ += size;
+    while (size > 0) {
+      size_t copy_size = std::min(size, sizeof(uint64_t) - tail_size_);
+      (void)memcpy(tail_ + tail_size_, bytes, copy_size);
+      tail_size_ += copy_size;
+      bytes += copy_size;
+      size -= copy_size;
+      if (tail_size_ == sizeof(uint64_t)) {
+        uint64_t word = 0;
+        (void)memcpy(&word, tail_, sizeof(word));
+        Mix(word);
+        tail_size_ = 0;
+      }
+    }
+  }
+
+  void Update(uint64_t value) { Update(&value, sizeof(value)); }
+
+  // The length goes first so that adjacent strings can not shift into each other
+  void Update(const std::string &str) {
+    Update(static_cast<uint64_t>(str.size()));
+    Update(str.data(), str.size());
+  }
+
+  std::string HexDigest() const {
+    KeyHasher final_state = *this;
+    uint64_t word = 0;
+    (void)memcpy(&word, final_state.tail_, final_state.tail_size_);
+    final_state.Mix(word);
+    final_state.Mix(length_);
+    uint64_t high = FinalMix(final_state.lane_a_ + final_state.lane_b_);
+    uint64_t low = FinalMix(final_state.lane_b_ ^ Rotl(final_state.lane_a_, 17));
+    char digest[33] = {0};
+    (void)snprintf(digest, sizeof(digest), "%016llx%016llx", static_cast<unsigned long long>(high),
+                   static_cast<unsigned long long>(low));
+    return digest;
+  }
+
+ private:
+  void Mix(uint64_t word) {
+    lane_a_ = Rotl(lane_a_ ^ (word * kPrime1), 31) * kPrime2;
+    lane_b_ = Rotl(lane_b_ + word * kPrime2, 27) * kPrime3 + kPrime1;
+  }
+
+  uint64_t lane_a_ = kSeedA;
+  uint64_t lane_b_ = kSeedB;
+  uint64_t length_ = 0;
+  uint8_t tail_[sizeof(uint64_t)] = {0};
+  size_t tail_size_ = 0;
+};
+
+void HashOptions(const std::map<std::string, std::string> &options, KeyHasher &hasher) {
+  hasher.Update(static_cast<uint64_t>(options.size()));
+  for (const auto &option : options) {
+    if (option.first == GRAPH_COMPILE_CACHE_DIR) {
+      continue;
+    }
+    hasher.Update(option.first);
+    hasher.Update(option.second);
+  }
+}
+
+// A rebuilt library changes size or mtime, that is what tells one version of GE or an engine from another
+void HashFile(const std::string &path, KeyHasher &hasher) {
+  struct stat file_stat;
+  if (stat(path.c_str(), &file_stat) != 0) {
+    return;
+  }
+  hasher.Update(path);
+  hasher.Update(static_cast<uint64_t>(file_stat.st_size));
+  hasher.Update(static_cast<uint64_t>(file_stat.st_mtime));
+}
+
+void HashPluginDir(const std::string &dir_path, KeyHasher &hasher) {
+  DIR *dir = opendir(dir_path.c_str());
+  if (dir == nullptr) {
+    return;
+  }
+  std::vector<std::string> files;
+  struct dirent *entry = nullptr;
+  while ((entry = readdir(dir)) != nullptr) {
+    std::string name = entry->d_name;
+    if (name.size() > 3 && name.compare(name.size() - 3, 3, ".so") == 0) {
+      files.emplace_back(dir_path + name);
+    }
+  }
+  (void)closedir(dir);
+  std::sort(files.begin(), files.end());
+  for (const auto &file : files) {
+    HashFile(file, hasher);
+  }
+}
+
+void HashLibraries(KeyHasher &hasher) {
+  Dl_info dl_info;
+  if (dladdr(reinterpret_cast<void *>(&HashLibraries), &dl_info) != 0 && dl_info.dli_fname != nullptr) {
+    HashFile(dl_info.dli_fname, hasher);
+  }
+
+  const char *engine_path = std::getenv(kEnginePathEnv);
+  if (engine_path != nullptr) {
+    PluginManager plugin_manager;
+    std::vector<std::string> paths;
+    plugin_manager.SplitPath(engine_path, paths);
+    for (const auto &path : paths) {
+      HashFile(path, hasher);
+    }
+  } else {
+    std::string path_base = PluginManager::GetPath();
+    for (const char *plugin_dir : kPluginDirs) {
+      HashPluginDir(path_base + plugin_dir, hasher);
+    }
+  }
+
+  std::shared_ptr<GELib> instance = GELib::GetInstance();
+  if (instance == nullptr || !instance->InitFlag()) {
+    return;
+  }
+  for (const auto &op_infos : instance->OpsKernelManagerObj().GetAllOpsKernelInfo()) {
+    hasher.Update(op_infos.first);
+    for (const auto &op_info : op_infos.second) {
+      hasher.Update(op_info.engine);
+      hasher.Update(op_info.opKernelLib);
+      hasher.Update(static_cast<uint64_t>(op_info.computeCost));
+      hasher.Update(static_cast<uint64_t>((op_info.flagPartial ? 1U : 0U) | (op_info.flagAsync ? 2U : 0U) |
+                                          (op_info.isAtomic ? 4U : 0U)));
+      hasher.Update(op_info.opFileName);
+      hasher.Update(op_info.opFuncName);
+    }
+  }
+}
+}  // namespace
+
+Status GraphCompileCache::Initialize(const std::map<std::string, std::string> &options) {
+  cache_dir_.clear();
+  auto iter = options.find(GRAPH_COMPILE_CACHE_DIR);
+  if (iter == options.end()) {
+    const auto &global_options = GetMutableGlobalOptions();
+    iter = global_options.find(GRAPH_COMPILE_CACHE_DIR);
+    if (iter == global_options.end()) {
+      return SUCCESS;
+    }
+  }
+  if (iter->second.empty()) {
+    return SUCCESS;
+  }
+
+  if (CreateDirectory(iter->second) != 0) {
+    GELOGE(PARAM_INVALID, "Can not create compile cache dir %s.", iter->second.c_str());
+    return PARAM_INVALID;
+  }
+  cache_dir_ = RealPath(iter->second.c_str());
+  if (cache_dir_.empty()) {
+    GELOGE(PARAM_INVALID, "Compile cache dir %s is invalid.", iter->second.c_str());
+    return PARAM_INVALID;
+  }
+
+  KeyHasher hasher;
+  hasher.Update(static_cast<uint64_t>(MODEL_VERSION));
+  HashOptions(GetMutableGlobalOptions(), hasher);
+  HashOptions(options, hasher);
+  HashLibraries(hasher);
+  env_key_ = hasher.HexDigest();
+  GELOGI("Graph compile cache enabled, dir: %s, env key: %s.", cache_dir_.c_str(), env_key_.c_str());
+  return SUCCESS;
+}
+
+Status GraphCompileCache::GenerateKey(const ComputeGraphPtr &graph, const std::vector<GeTensor> &inputs,
+                                      std::string &key) const {
+  GE_CHECK_NOTNULL(graph);
+  proto::GraphDef graph_def;
+  ModelSerializeImp serialize_imp;
+  if (!serialize_imp.SerializeGraph(graph, &graph_def)) {
+    GELOGE(FAILED, "Serialize graph %s failed.", graph->GetName().c_str());
+    return FAILED;
+  }
+  // Node names are unique in a graph and edges refer to them, ids only reflect the order nodes were added in
+  auto ops = graph_def.mutable_op();
+  for (auto &op : *ops) {
+    op.set_id(0);
+  }
+  std::sort(ops->pointer_begin(), ops->pointer_end(),
+            [](const proto::OpDef *lhs, const proto::OpDef *rhs) { return lhs->name() < rhs->name(); });
+
+  std::string graph_bytes;
+  {
+    google::protobuf::io::StringOutputStream string_stream(&graph_bytes);
+    google::protobuf::io::CodedOutputStream coded_stream(&string_stream);
+    // attributes are proto maps, their order is only fixed with deterministic serialization
+    coded_stream.SetSerializationDeterministic(true);
+    if (!graph_def.SerializeToCodedStream(&coded_stream)) {
+      GELOGE(FAILED, "Serialize graph %s failed.", graph->GetName().c_str());
+      return FAILED;
+    }
+  }
+
+  KeyHasher hasher;
+  hasher.Update(env_key_);
+  hasher.Update(graph_bytes);
+  hasher.Update(static_cast<uint64_t>(inputs.size()));
+  for (const auto &input : inputs) {
+    const GeTensorDesc &tensor_desc = input.GetTensorDesc();
+    const std::vector<int64_t> dims = tensor_desc.GetShape().GetDims();
+    hasher.Update(static_cast<uint64_t>(dims.size()));
+    for (int64_t dim : dims) {
+      hasher.Update(static_cast<uint64_t>(dim));
+    }
+    hasher.Update(static_cast<uint64_t>(tensor_desc.GetFormat()));
+    hasher.Update(static_cast<uint64_t>(tensor_desc.GetDataType()));
+  }
+  key = hasher.HexDigest();
+  return SUCCESS;
+}
+
+Status GraphCompileCache::Load(const std::string &key, GeModelPtr &ge_model) const {
+  std::string model_path = GetModelPath(key);
+  if (access(model_path.c_str(), R_OK) != 0) {
+    GELOGI("Compile cache miss, key: %s.", key.c_str());
+    return FAILED;
+  }
+
+  ModelData model_data;
+  Status ret = ModelParserBase::LoadFromFile(model_path.c_str(), "", 0, model_data);
+  if (ret != SUCCESS) {
+    GELOGW("Read cached model %s failed.", model_path.c_str());
+    ModelParserBase::ReleaseModelData(model_data);
+    return ret;
+  }
+  // weights are copied out of a heap buffer, so the file data can go right after
+  ModelHelper model_helper;
+  ret = model_helper.LoadModel(model_data);
+  ModelParserBase::ReleaseModelData(model_data);
+  if (ret != SUCCESS) {
+    GELOGW("Load cached model %s failed.", model_path.c_str());
+    return ret;
+  }
+  ge_model = model_helper.GetGeModel();
+  GE_CHECK_NOTNULL(ge_model);
+  GELOGI("Compile cache hit, key: %s.", key.c_str());
+  return SUCCESS;
+}
+
+Status GraphCompileCache::Save(const std::string &key, const GeModelPtr &ge_model) const {
+  GE_CHECK_NOTNULL(ge_model);
+  static std::atomic<uint64_t> save_seq(0);
+  std::string model_path = GetModelPath(key);
+  std::string tmp_path = model_path + "." + std::to_string(getpid()) + "_" + std::to_string(save_seq++) + ".tmp";
+
+  SaveParam save_param{};
+  ModelHelper model_helper;
+  Status ret = model_helper.SaveToOmModel(ge_model, save_param, tmp_path);
+  if (ret != SUCCESS) {
+    GELOGW("Save model to compile cache failed, path: %s.", tmp_path.c_str());
+    (void)remove(tmp_path.c_str());
+    return ret;
+  }
+  if (rename(tmp_path.c_str(), model_path.c_str()) != 0) {
+    GELOGW("Rename %s to %s failed, errno: %d.", tmp_path.c_str(), model_path.c_str(), errno);
+    (void)remove(tmp_path.c_str());
+    return FAILED;
+  }
+  GELOGI("Model saved to compile cache, path: %s.", model_path.c_str());
+  return SUCCESS;
+}
+
+std::string GraphCompileCache::GetModelPath(const std::string &key) const {
+  return cache_dir_ + "/" + key + kModelSuffix;
+}
+}  // namespace ge
@@ -0,0 +1,86 @@
+/**
+ * Copyright 2019-2020 Huawei Technologies Co., Ltd
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef GE_GRAPH_MANAGER_GRAPH_COMPILE_CACHE_H_
+#define GE_GRAPH_MANAGER_GRAPH_COMPILE_CACHE_H_
+
+#include <map>
+#include <string>
+#include <vector>
+
+#include "common/ge_inner_error_codes.h"
+#include "graph/compute_graph.h"
+#include "graph/ge_tensor.h"
+#include "model/ge_model.h"
+
+namespace ge {
+///
+/// @ingroup ge_graph
+/// @brief On disk cache of built models, enabled by the option ge.graphCompileCacheDir.
+/// A model is stored as an om file named after a key hashed from the graph (nodes, attributes and edges in node
+/// name order), the input descs, the global and session options and the GE and engine plugin libraries.
+///
+class GraphCompileCache {
+ public:
+  GraphCompileCache() = default;
+  ~GraphCompileCache() = default;
+  GraphCompileCache(const GraphCompileCache &) = delete;
+  GraphCompileCache &operator=(const GraphCompileCache &) = delete;
+
+  ///
+  /// @ingroup ge_graph
+  /// @brief Read the cache dir and fingerprint the options and libraries of this process
+  /// @param [in] options: session options, the global options are read from the process
+  /// @return Status result of function
+  ///
+  Status Initialize(const std::map<std::string, std::string> &options);
+
+  bool IsEnabled() const { return !cache_dir_.empty(); }
+
+  ///
+  /// @ingroup ge_graph
+  /// @brief Hash the graph as given by the user, before it is prepared
+  /// @param [in] graph: graph to build
+  /// @param [in] inputs: inputs the graph is built with
+  /// @param [out] key: hex string, also the file name of the model
+  /// @return Status result of function
+  ///
+  Status GenerateKey(const ComputeGraphPtr &graph, const std::vector<GeTensor> &inputs, std::string &key) const;
+
+  ///
+  /// @ingroup ge_graph
+  /// @brief Load the model stored under key
+  /// @return SUCCESS / FAILED when there is none or it can not be read
+  ///
+  Status Load(const std::string &key, GeModelPtr &ge_model) const;
+
+  ///
+  /// @ingroup ge_graph
+  /// @brief Store a built model under key, the file is renamed into place so readers never see half of it
+  /// @return Status result of function
+  ///
+  Status Save(const std::string &key, const GeModelPtr &ge_model) const;
+
+ private:
+  std::string GetModelPath(const std::string &key) const;
+
+  std::string cache_dir_;
+  // Key of the options and libraries, mixed into every graph key
+  std::string env_key_;
+};
+}  // namespace ge
+
+#endif  // GE_GRAPH_MANAGER_GRAPH_COMPILE_CACHE_H_
@@ -18,7 +18,6 @@
 
 #include <pthread.h>
 #include <algorithm>
-#include <future>
 #include <set>
 #include <sstream>
 #include <string>
@@ -27,12 +26,13 @@
 
 #include "common/ge/ge_util.h"
 #include "common/math/math_util.h"
-#include "common/thread_pool.h"
+#include "common/task_executor.h"
 #include "common/util.h"
 #include "external/graph/types.h"
 #include "framework/common/debug/ge_log.h"
 #include "framework/common/ge_inner_error_codes.h"
 #include "framework/common/ge_types.h"
+#include "graph/build/memory/graph_mem_assigner.h"
 #include "graph/common/transop_util.h"
 #include "graph/ge_context.h"
 #include "graph/ge_global_options.h"
@@ -71,7 +71,8 @@ const char *const kRecv = "Recv";
 }  // namespace
 
 namespace ge {
-GraphManager::GraphManager() : thread_run_flag_(false), graph_run_listener_(nullptr), init_flag_(false) {}
+GraphManager::GraphManager()
+    : thread_run_flag_(false), graph_run_listener_(nullptr), init_flag_(false), omg_context_(domi::GetContext()) {}
 
 Status GraphManager::Initialize(const std::map<string, string> &options) {
   if (init_flag_) {
@@ -112,6 +113,12 @@ Status GraphManager::Initialize(const std::map<string, string> &options) {
   }
   graph_preparer_.SetOptions(options_);
 
+  ret = compile_cache_.Initialize(options);
+  if (ret != SUCCESS) {
+    GELOGE(ret, "[Initialize] Graph compile cache initialize failed.");
+    return ret;
+  }
+
   ret = graph_context_->Initialize(options);
   if (ret != SUCCESS) {
     GELOGE(ret, "[Initialize] GraphContext initialize failed.");
@@ -134,8 +141,6 @@ Status GraphManager::Finalize() {
     return SUCCESS;
   }
 
-  GE_CHK_STATUS_RET(graph_executor_.FreeExecuteMemory());
-
   StopQueue(this);
 
   if (prerun_thread_.joinable()) {
@@ -262,6 +267,7 @@ Status GraphManager::PreRun(const GraphNodePtr &graph_node, const std::vector<Ge
                             vector<GeModelPtr> &ge_models, GeModelPtr &ge_model, uint64_t session_id) {
   GELOGI("Ready For PreRun Start session_id = %lu.", session_id);
   GE_TIMESTAMP_START(PreRun);
+  BuildStageTimer stage_timer;
   GE_CHECK_NOTNULL(graph_node);
   // it will not execute graph preprocess, optimize, parition, build if the graph has built successful.
   GE_CHECK_NOTNULL(graph_node->GetGraph());
@@ -274,6 +280,21 @@ Status GraphManager::PreRun(const GraphNodePtr &graph_node, const std::vector<Ge
   auto ret = graph_optimize_.HandleSummaryOp(compute_graph);
   GE_TIMESTAMP_END(HandleSummaryOp, "GraphManager::HandleSummaryOp");
   GE_CHK_BOOL_EXEC(ret == SUCCESS, return ret, "[RunTrainGraph] HandleSummaryOp failed.");
+  stage_timer.Finish("HandleSummaryOp");
+  // a graph built before with the same inputs, options and engines skips the whole pipeline
+  std::string cache_key;
+  if (compile_cache_.IsEnabled() && (compile_cache_.GenerateKey(compute_graph, inputs, cache_key) == SUCCESS) &&
+      (LoadFromCompileCache(graph_node, cache_key, session_id, ge_model) == SUCCESS)) {
+    ge_models.push_back(ge_model);
+    stage_timer.Finish("LoadFromCompileCache");
+    graph_node->SetBuildStageCosts(stage_timer.GetCosts());
+    GE_TIMESTAMP_END(PreRun, "GraphManager::PreRun");
+    GEEVENT("[GEPERFTRACE] GE PreRun End, model taken from compile cache");
+    return SUCCESS;
+  }
+  if (compile_cache_.IsEnabled()) {
+    stage_timer.Finish("CompileCacheLookup");
+  }
   GE_TIMESTAMP_START(GraphPrepare);
   ret = graph_preparer_.Prepare(graph_node->GetGraph(), inputs, compute_graph, session_id);
   if (ret != SUCCESS) {
@@ -281,6 +302,7 @@ Status GraphManager::PreRun(const GraphNodePtr &graph_node, const std::vector<Ge
     return ret;
   }
   GE_TIMESTAMP_END(GraphPrepare, "GraphPrepare::Prepare");
+  stage_timer.Finish("GraphPrepare");
   compute_graph->SetSessionID(session_id);
   GraphUtils::DumpGEGraph(compute_graph, "OptimizeOriginalGraphAfter");
   GraphUtils::DumpGEGraphToOnnx(*compute_graph, "OptimizeOriginalGraphAfter");
@@ -291,6 +313,7 @@ Status GraphManager::PreRun(const GraphNodePtr &graph_node, const std::vector<Ge
                      GELOGE(GE_GRAPH_INFERSHAPE_FAILED, " OriginGraph infershape failed");
                      return GE_GRAPH_INFERSHAPE_FAILED;)
   GE_TIMESTAMP_END(InferShape, "ComputeGraph::InferShapeInNeed");
+  stage_timer.Finish("InferShape");
   // graph partition
   std::vector<SubGraphInfoPtr> sub_graph_list;
   GE_TIMESTAMP_START(GraphPartition);
@@ -300,24 +323,38 @@ Status GraphManager::PreRun(const GraphNodePtr &graph_node, const std::vector<Ge
     return ret;
   }
   GE_TIMESTAMP_END(GraphPartition, "GraphPartitioner::Partition1");
+  stage_timer.Finish("GraphPartition");
   GE_TIMESTAMP_START(SetSubgraph);
-  // use default 16 multi thread
-  const uint32_t thread_num = 16;
-  ThreadPool executor(thread_num);
-  size_t sub_graph_list_size = sub_graph_list.size();
-  std::vector<std::future<Status>> vector_future(sub_graph_list_size);
-  for (size_t i = 0; i < sub_graph_list_size; ++i) {
-    vector_future[i] = executor.commit(GraphManager::ProcessSubGraphWithMultiThreads, this, sub_graph_list[i],
-                                       session_id, GetThreadLocalContext());
-  }
-  for (size_t i = 0; i < vector_future.size(); ++i) {
-    Status ret_status = vector_future[i].get();
-    if (ret_status != SUCCESS) {
-      GELOGE(ret_status, "subgraph %zu optimize failed", i);
-      return ret_status;
-    }
+  // subgraphs are optimized on the shared task executor, as many of one engine at a time as its build budget
+  // allows, the first failure skips the ones not started yet
+  const GEThreadLocalContext ge_context = GetThreadLocalContext();
+  TaskGraph sub_graph_tasks;
+  for (const auto &engine_parallel : options_.build_max_parallel_num) {
+    sub_graph_tasks.SetBudget(engine_parallel.first, static_cast<uint32_t>(engine_parallel.second));
+  }
+  for (size_t i = 0; i < sub_graph_list.size(); ++i) {
+    GE_CHECK_NOTNULL(sub_graph_list[i]);
+    ComputeGraphPtr sub_graph = sub_graph_list[i]->GetSubGraph();
+    std::string task_name = "OptimizeSubGraph:" + ((sub_graph == nullptr) ? std::to_string(i) : sub_graph->GetName());
+    (void)sub_graph_tasks.AddTask(task_name,
+                                  [this, &sub_graph_list, &ge_context, session_id, i]() -> Status {
+                                    Status ret_status = ProcessSubGraphWithMultiThreads(this, sub_graph_list[i],
+                                                                                        session_id, ge_context);
+                                    if (ret_status != SUCCESS) {
+                                      GELOGE(ret_status, "subgraph %zu optimize failed", i);
+                                    }
+                                    return ret_status;
+                                  },
+                                  {}, sub_graph_list[i]->GetEngineName());
+  }
+  uint64_t sub_graph_start_us = GetCurrentTimestap();
+  ret = sub_graph_tasks.Run();
+  if (ret != SUCCESS) {
+    return ret;
   }
   GE_TIMESTAMP_END(SetSubgraph, "SetSubGraph");
+  stage_timer.AddTasks(sub_graph_tasks.GetCosts(), sub_graph_start_us);
+  stage_timer.Finish("OptimizeSubGraphs");
 
   ComputeGraphPtr merged_compute_graph = nullptr;
 
@@ -330,6 +367,7 @@ Status GraphManager::PreRun(const GraphNodePtr &graph_node, const std::vector<Ge
   merged_compute_graph->SetSessionID(session_id);
   merged_compute_graph->SetGraphID(graph_node->GetGraphId());
   GE_TIMESTAMP_END(MergeSubgraph, "GraphManager::MergeSubGraph");
+  stage_timer.Finish("MergeSubGraph");
 
   GraphUtils::DumpGEGraph(merged_compute_graph, "mergedComputeGraph");
   GraphUtils::DumpGEGraphToOnnx(*merged_compute_graph, "mergedComputeGraph");
@@ -344,6 +382,7 @@ Status GraphManager::PreRun(const GraphNodePtr &graph_node, const std::vector<Ge
       return ret;
     }
     GE_TIMESTAMP_END(OptimizeAfterMergeSubgraph, "GraphManager::OptimizeAfterMergeSubGraph");
+    stage_timer.Finish("OptimizeAfterMergeSubGraph");
   }
 
   GraphUtils::DumpGEGraph(merged_compute_graph, "OptimizeMergeSubGraphAfter");
@@ -361,6 +400,7 @@ Status GraphManager::PreRun(const GraphNodePtr &graph_node, const std::vector<Ge
     GELOGE(ret, "SubGraph build Failed.");
     return ret;
   }
+  stage_timer.Finish("Build");
 
   bool is_always_dump = false;
   if (!PropertiesManager::Instance().GetDumpOutputPath().empty()) {
@@ -376,12 +416,21 @@ Status GraphManager::PreRun(const GraphNodePtr &graph_node, const std::vector<Ge
   }
 
   ge_models.push_back(ge_model);
+  if (!cache_key.empty()) {
+    SaveToCompileCache(cache_key, merged_compute_graph, ge_model);
+    stage_timer.Finish("SaveToCompileCache");
+  }
 
   GE_IF_BOOL_EXEC(sub_graph_list.empty(), GELOGE(FAILED, "Input graph must have at least one calculation op Node");
                   return FAILED;);
   sub_graph_list[0]->SetSubGraph(merged_compute_graph);
   // set subgraphlist to graphnode
   graph_node->SetSubGraph(sub_graph_list);
+  graph_node->SetBuildStageCosts(stage_timer.GetCosts());
+  for (const auto &stage_cost : stage_timer.GetCosts()) {
+    GEEVENT("[GEPERFTRACE] Build stage %s of graph %u started at [%lu] and took [%lu] micro second.",
+            stage_cost.name.c_str(), graph_node->GetGraphId(), stage_cost.start_us, stage_cost.cost_us);
+  }
   GE_TIMESTAMP_END(PreRun, "GraphManager::PreRun");
   GEEVENT("[GEPERFTRACE] GE PreRun End");
   return ret;
@@ -448,6 +497,85 @@ Status GraphManager::LoadGraph(const GeModelPtr &ge_model, const GraphNodePtr &g
   return SUCCESS;
 }
 
+Status GraphManager::LoadFromCompileCache(const GraphNodePtr &graph_node, const std::string &cache_key,
+                                          uint64_t session_id, GeModelPtr &ge_model) {
+  GeModelPtr cached_model = nullptr;
+  if (compile_cache_.Load(cache_key, cached_model) != SUCCESS) {
+    return FAILED;
+  }
+  ComputeGraphPtr cached_graph = GraphUtils::GetComputeGraph(cached_model->GetGraph());
+  GE_CHECK_NOTNULL(cached_graph);
+  cached_graph->SetSessionID(session_id);
+  cached_graph->SetGraphID(graph_node->GetGraphId());
+
+  // Variables live in the session, the cached model only fits when they get the addresses it was built with
+  std::map<std::string, std::pair<std::vector<int64_t>, std::vector<int64_t>>> cached_offsets;
+  // Vars the cached graph adds to the session are deleted again when the model does not fit
+  std::vector<std::string> new_var_names;
+  for (const auto &node : cached_graph->GetDirectNode()) {
+    GE_CHECK_NOTNULL(node->GetOpDesc());
+    cached_offsets[node->GetName()] = {node->GetOpDesc()->GetInputOffset(), node->GetOpDesc()->GetOutputOffset()};
+    if (((node->GetType() == VARIABLE) || (node->GetType() == CONSTANTOP)) &&
+        !VarManager::Instance(session_id)->IsVarExist(node->GetName())) {
+      new_var_names.emplace_back(node->GetName());
+    }
+  }
+  auto rollback_vars = [&new_var_names, session_id]() {
+    for (const auto &var_name : new_var_names) {
+      (void)VarManager::Instance(session_id)->FreeVarMem(var_name);
+    }
+  };
+  VariableMemoryAssigner var_assigner(cached_graph);
+  if ((var_assigner.Assign() != SUCCESS) || (var_assigner.AssignVarAttr2Nodes() != SUCCESS)) {
+    GELOGW("Assign variable memory of cached graph failed, build graph %u again.", graph_node->GetGraphId());
+    rollback_vars();
+    return FAILED;
+  }
+  for (const auto &node : cached_graph->GetDirectNode()) {
+    const auto &offsets = cached_offsets[node->GetName()];
+    if ((node->GetOpDesc()->GetInputOffset() != offsets.first) ||
+        (node->GetOpDesc()->GetOutputOffset() != offsets.second)) {
+      GELOGW("Variable memory of node %s differs from the cached model, build graph %u again.",
+             node->GetName().c_str(), graph_node->GetGraphId());
+      rollback_vars();
+      return FAILED;
+    }
+  }
+
+  uint64_t var_size = (VarManager::Instance(session_id)->GetVarMemSize(RT_MEMORY_HBM) > 0)
+                          ? VarManager::Instance(0)->GetVarMemMaxSize()
+                          : 0;
+  GE_CHK_BOOL_RET_STATUS(AttrUtils::SetInt(cached_model, MODEL_ATTR_SESSION_ID, session_id) &&
+                             AttrUtils::SetInt(cached_model, ATTR_MODEL_VAR_SIZE, var_size),
+                         FAILED, "Set session attr of cached model failed.");
+
+  auto sub_graph_info = MakeShared<SubGraphInfo>();
+  GE_CHECK_NOTNULL(sub_graph_info);
+  sub_graph_info->SetSubGraph(cached_graph);
+  sub_graph_info->SetGeModelPtr(cached_model);
+  std::vector<SubGraphInfoPtr> sub_graph_list{sub_graph_info};
+  graph_node->SetSubGraph(sub_graph_list);
+  ge_model = cached_model;
+  GELOGI("Graph %u is taken from compile cache, key: %s.", graph_node->GetGraphId(), cache_key.c_str());
+  return SUCCESS;
+}
+
+void GraphManager::SaveToCompileCache(const std::string &cache_key, const ComputeGraphPtr &compute_graph,
+                                      const GeModelPtr &ge_model) {
+  // Format changes of variables are recorded in the session while building, a later hit would not redo them
+  for (const auto &node : compute_graph->GetDirectNode()) {
+    if ((node->GetType() == VARIABLE) &&
+        (VarManager::Instance(compute_graph->GetSessionID())->GetTransRoad(node->GetName()) != nullptr)) {
+      GELOGI("Variable %s of graph %s changes format, it is not put into compile cache.", node->GetName().c_str(),
+             compute_graph->GetName().c_str());
+      return;
+    }
+  }
+  GE_TIMESTAMP_START(SaveToCompileCache);
+  (void)compile_cache_.Save(cache_key, ge_model);
+  GE_TIMESTAMP_END(SaveToCompileCache, "GraphManager::SaveToCompileCache");
+}
+
 Status GraphManager::InnerRunGraph(GraphNodePtr &graph_node, const GraphId &graph_id,
                                    const std::vector<GeTensor> &inputs, std::vector<GeTensor> &outputs) {
   Status ret = graph_executor_.SetCondition(&sync_run_mutex_, &condition_, graph_run_listener_);
@@ -716,6 +844,26 @@ Status GraphManager::ParseOptions(const std::map<std::string, std::string> &opti
     return GE_GRAPH_OPTIONS_INVALID;
   }
 
+  // parse build max parallel num per engine
+  ret = ParseOption(options, BUILD_MAX_PARALLEL_NUM, options_.build_max_parallel_num);
+  if (ret != SUCCESS) {
+    GELOGE(GE_GRAPH_OPTIONS_INVALID,
+           "parse Key:%s value failed, it must be same format as "
+           "AIcoreEngine:8,DNN_VM_AICPU:2",
+           BUILD_MAX_PARALLEL_NUM.c_str());
+    return GE_GRAPH_OPTIONS_INVALID;
+  }
+
+  // parse estimated op costs to assign streams by
+  ret = ParseOpCostOption(options, STREAM_OP_COST, options_.stream_op_cost);
+  if (ret != SUCCESS) {
+    GELOGE(GE_GRAPH_OPTIONS_INVALID,
+           "parse Key:%s value failed, it must be same format as "
+           "Conv2D:120,Relu:5",
+           STREAM_OP_COST.c_str());
+    return GE_GRAPH_OPTIONS_INVALID;
+  }
+
   // get stream num
   ret = ParseOption(options, STREAM_NUM, options_.stream_num);
   if ((ret != SUCCESS) || (options_.stream_num == 0)) {
@@ -1008,6 +1156,75 @@ Status GraphManager::ParseParallelNum(const std::string &parallel_num, const std
   return SUCCESS;
 }
 
+Status GraphManager::ParseOpCostOption(const std::map<std::string, std::string> &options, const std::string &key,
+                                       std::map<std::string, int> &option) {
+  auto iter = options.find(key);
+  if (iter == options.end()) {
+    return SUCCESS;
+  }
+  GELOGI("Start to parse %s", key.c_str());
+  option.clear();
+
+  // split string by ',', op types are not engines, so they are not checked against the engine list
+  std::istringstream f(iter->second);
+  std::string op_type_cost;
+  while (getline(f, op_type_cost, ',')) {
+    size_t pos = op_type_cost.find(':');
+    if (pos == string::npos) {
+      GELOGE(GE_GRAPH_OPTIONS_INVALID, "op type and cost must be connected by :, while your input is %s",
+             op_type_cost.c_str());
+      return GE_GRAPH_OPTIONS_INVALID;
+    }
+    std::string op_type = op_type_cost.substr(0, pos);
+    std::string cost = op_type_cost.substr(pos + 1);
+    Trim(op_type);
+    Trim(cost);
+
+    if (op_type.empty()) {
+      GELOGE(GE_GRAPH_OPTIONS_INVALID, "op type of %s is empty", key.c_str());
+      return GE_GRAPH_OPTIONS_INVALID;
+    }
+    if (option.find(op_type) != option.end()) {
+      GELOGE(GE_GRAPH_OPTIONS_INVALID, "op type : %s of %s is repeated", op_type.c_str(), key.c_str());
+      return GE_GRAPH_OPTIONS_INVALID;
+    }
+
+    int num = 0;
+    if (ParseOpCost(cost, key, num) != SUCCESS) {
+      GELOGE(GE_GRAPH_OPTIONS_INVALID, "parse cost of op type %s failed", op_type.c_str());
+      return GE_GRAPH_OPTIONS_INVALID;
+    }
+    option.insert(std::make_pair(op_type, num));
+  }
+  GELOGI("Parse %s successfully", key.c_str());
+  return SUCCESS;
+}
+
+Status GraphManager::ParseOpCost(const std::string &cost, const std::string &key, int &num) {
+  if (cost.empty()) {
+    GELOGE(GE_GRAPH_OPTIONS_INVALID, "cost of %s is empty", key.c_str());
+    return GE_GRAPH_OPTIONS_INVALID;
+  }
+  // an op type may cost nothing, e.g. ops which are only views of their inputs
+  for (char c : cost) {
+    if (!isdigit(c)) {
+      GELOGE(GE_GRAPH_OPTIONS_INVALID, "cost : %s of %s is invalid", cost.c_str(), key.c_str());
+      return GE_GRAPH_OPTIONS_INVALID;
+    }
+  }
+
+  try {
+    num = std::stoi(cost);
+  } catch (std::out_of_range &) {
+    GELOGE(GE_GRAPH_OPTIONS_INVALID, "cost : %s of %s is out of range", cost.c_str(), key.c_str());
+    return GE_GRAPH_OPTIONS_INVALID;
+  } catch (...) {
+    GELOGE(GE_GRAPH_OPTIONS_INVALID, "cost : %s of %s is invalid argument", cost.c_str(), key.c_str());
+    return GE_GRAPH_OPTIONS_INVALID;
+  }
+  return SUCCESS;
+}
+
 Status GraphManager::GetGraphNode(const GraphId &graph_id, GraphNodePtr &out) {
   auto iter = graph_map_.find(graph_id);
   if (iter == graph_map_.end()) {
@@ -1306,16 +1523,27 @@ void GraphManager::ResetConstType(ge::ComputeGraphPtr &compute_graph) {
 Status GraphManager::OptimizeAfterMergeSubGraph(ge::ComputeGraphPtr &compute_graph) {
   GELOGI("Start optimize after merge sub graph.");
 
+  // IdentifyReferencePass only marks the node it runs on, it is run alone so large graphs are passed in parallel
+  GEPass ge_passes_for_reference(compute_graph);
+  NamesToPass names_to_passes_for_reference;
+  IdentifyReferencePass identify_reference_pass;
+  names_to_passes_for_reference.emplace_back("IdentifyReferencePass", &identify_reference_pass);
+  GE_TIMESTAMP_START(ge_passes_for_reference);
+  Status ret = ge_passes_for_reference.Run(names_to_passes_for_reference);
+  GE_TIMESTAMP_END(ge_passes_for_reference, "GraphManager::GePassesForReference");
+  if (ret != SUCCESS) {
+    GELOGE(ret, "Run ge_passes_for_reference optimize for OptimizeAfterMergeSubGraph failed, ret:%d.", ret);
+    return ret;
+  }
+
   GEPass ge_passes_for_shape(compute_graph);
   NamesToPass names_to_passes_for_shape;
-  IdentifyReferencePass identify_reference_pass;
-  names_to_passes_for_shape.emplace_back("IdentifyReferencePass", &identify_reference_pass);
   NoReshapeOpRemovePass no_reshape_op_remove_pass;
   names_to_passes_for_shape.emplace_back("NoReshapeOpRemovePass", &no_reshape_op_remove_pass);
   TransposeTransDataPass transpose_transdata_pass;
   names_to_passes_for_shape.emplace_back("TransposeTransDataPass", &transpose_transdata_pass);
   GE_TIMESTAMP_START(ge_passes_for_shape);
-  Status ret = ge_passes_for_shape.Run(names_to_passes_for_shape);
+  ret = ge_passes_for_shape.Run(names_to_passes_for_shape);
   GE_TIMESTAMP_END(ge_passes_for_shape, "GraphManager::GePassesForShape");
   if (ret != SUCCESS) {
     GELOGE(ret, "Run ge_passes_for_shape optimize for OptimizeAfterMergeSubGraph failed, ret:%d.", ret);
@@ -1500,6 +1728,8 @@ Status GraphManager::ProcessSubGraphWithMultiThreads(GraphManager *graph_manager
   Status ret = SUCCESS;
   GetThreadLocalContext() = ge_context;
   if (sub_graph_info_ptr != nullptr && graph_manager != nullptr) {
+    // Workers of the task executor are shared, give the omg context back once the task is done
+    domi::OmgContextScope omg_context_scope(&graph_manager->omg_context_);
     ComputeGraphPtr compute_graph_tmp = sub_graph_info_ptr->GetSubGraph();
     const std::string &engine_name = sub_graph_info_ptr->GetEngineName();
     GELOGI("ProcessSubGraphWithMultiThreads start, graph name is %s, engine_name is %s, thread id is %lu",
@@ -1551,6 +1781,7 @@ void GraphManager::PreRunThread(GraphManager *graph_manager) {
   if (prctl(PR_SET_NAME, ("GE_PreRun")) != 0) {
     GELOGW("Set thread name failed.");
   }
+  (void)domi::SetThreadContext(&graph_manager->omg_context_);
   PreRunArgs args;
   while (graph_manager->thread_run_flag_) {
     bool pop_status = graph_manager->prerun_args_q_.Pop(args);
@@ -1648,6 +1879,7 @@ void GraphManager::RunThread(GraphManager *graph_manager) {
   if (prctl(PR_SET_NAME, ("GE_Run")) != 0) {
     GELOGW("Set thread name failed.");
   }
+  (void)domi::SetThreadContext(&graph_manager->omg_context_);
   RunArgs args;
   while (graph_manager->thread_run_flag_) {
     bool pop_status = graph_manager->run_args_q_.Pop(args);
@@ -28,11 +28,13 @@
 #include "common/blocking_queue.h"
 #include "common/ge_inner_error_codes.h"
 #include "external/graph/types.h"
+#include "framework/omg/omg_inner_types.h"
 #include "ge/ge_api_types.h"
 #include "graph/build/graph_build.h"
 #include "graph/execute/graph_execute.h"
 #include "graph/ge_local_context.h"
 #include "graph/load/graph_loader.h"
+#include "graph/manager/graph_compile_cache.h"
 #include "graph/manager/graph_manager_utils.h"
 #include "graph/manager/util/variable_accelerate_ctrl.h"
 #include "graph/optimize/graph_optimize.h"
@@ -150,6 +152,13 @@ class GraphManager {
 
   bool IsGraphNeedRebuild(uint32_t graph_id);
 
+  ///
+  /// @ingroup ge_graph
+  /// @brief omg context of this graph manager, bind it by domi::SetThreadContext before building or running
+  /// @return OmgContext context
+  ///
+  OmgContext &GetOmgContext() { return omg_context_; }
+
  private:
   struct PreRunArgs {
     GraphId graph_id;
@@ -204,6 +213,11 @@ class GraphManager {
 
   static Status ParseParallelNum(const std::string &parallel_num, const std::string &key, int &num);
 
+  static Status ParseOpCostOption(const std::map<std::string, std::string> &options, const std::string &key,
+                                  std::map<std::string, int> &option);
+
+  static Status ParseOpCost(const std::string &cost, const std::string &key, int &num);
+
   static Status ParseTrainGraphFlag(bool &options, bool &option);
 
   static bool IsPerfLevelInvalid(int32_t perf_level);
@@ -255,6 +269,17 @@ class GraphManager {
 
   Status LoadGraph(const GeModelPtr &ge_model, const GraphNodePtr &graph_node);
 
+  ///
+  /// @ingroup ge_graph
+  /// @brief Take the model built earlier for the same graph from the compile cache
+  /// @return SUCCESS / FAILED on a miss, the model does not fit the variables of this session either
+  ///
+  Status LoadFromCompileCache(const GraphNodePtr &graph_node, const std::string &cache_key, uint64_t session_id,
+                              GeModelPtr &ge_model);
+
+  void SaveToCompileCache(const std::string &cache_key, const ComputeGraphPtr &compute_graph,
+                          const GeModelPtr &ge_model);
+
   bool IsGraphNeedBuild(const GraphNodePtr &graph_node);
 
   static void PreRunThread(GraphManager *graph_manager);
@@ -294,7 +319,12 @@ class GraphManager {
 
   VarAccelerateCtrl var_acc_ctrl_;
 
+  GraphCompileCache compile_cache_;
+
   std::mutex run_mutex_;
+
+  // Copy of the process wide omg context, out nodes and formats parsed for one session do not leak into another
+  OmgContext omg_context_;
 };
 };  // namespace ge
 
@@ -39,6 +39,7 @@ GraphNode::GraphNode(GraphId graph_id)
       build_flag_(false),
       load_flag_(false),
       ge_model_(nullptr),
+      build_stage_costs_(),
       sem_(1) {
   graph_run_async_listener_ = MakeShared<RunAsyncListener>();
   if (graph_run_async_listener_ == nullptr) {
@@ -57,6 +58,20 @@ void GraphNode::Unlock() {
   sem_.Pop(unused);
 }
 
+BuildStageTimer::BuildStageTimer() : start_us_(GetCurrentTimestap()), stage_start_us_(start_us_) {}
+
+void BuildStageTimer::Finish(const std::string &stage_name) {
+  uint64_t end_us = GetCurrentTimestap();
+  costs_.push_back({stage_name, stage_start_us_ - start_us_, end_us - stage_start_us_});
+  stage_start_us_ = end_us;
+}
+
+void BuildStageTimer::AddTasks(const std::vector<TaskGraph::TaskCost> &costs, uint64_t run_start_us) {
+  for (const auto &cost : costs) {
+    costs_.push_back({cost.name, run_start_us - start_us_ + cost.start_us, cost.cost_us});
+  }
+}
+
 SubGraphInfo::SubGraphInfo() : subgraph_ptr_(nullptr), ge_model_ptr_(nullptr), malloc_flag_(false) {}
 
 SubGraphInfo::~SubGraphInfo() {
@@ -28,6 +28,7 @@
 
 #include "common/blocking_queue.h"
 #include "common/ge_types.h"
+#include "common/task_executor.h"
 #include "common/types.h"
 #include "common/util.h"
 #include "framework/common/debug/ge_log.h"
@@ -131,6 +132,34 @@ class RunAsyncListener : public ge::ModelListener {
   BlockingQueue<uint8_t> sem_;
 };
 
+///
+/// @ingroup ge_graph
+/// @brief Wall-clock of the stages building a graph, Finish closes the stage running since the previous one.
+///
+class BuildStageTimer {
+ public:
+  BuildStageTimer();
+  ~BuildStageTimer() = default;
+
+  void Finish(const std::string &stage_name);
+
+  ///
+  /// @ingroup ge_graph
+  /// @brief Add the tasks run in parallel by a task graph, they do not close the current stage
+  /// @param [in] costs: costs of the task graph
+  /// @param [in] run_start_us: time the task graph was run at
+  ///
+  void AddTasks(const std::vector<TaskGraph::TaskCost> &costs, uint64_t run_start_us);
+
+  // start_us of every stage is relative to the construction of the timer
+  const std::vector<TaskGraph::TaskCost> &GetCosts() const { return costs_; }
+
+ private:
+  uint64_t start_us_;
+  uint64_t stage_start_us_;
+  std::vector<TaskGraph::TaskCost> costs_;
+};
+
 // single graph node info
 class GraphNode {
  public:
@@ -157,6 +186,8 @@ class GraphNode {
   void SetLoadFlag(bool load_flag) { load_flag_ = load_flag; }
   void SetGeModel(const GeModelPtr &ge_model) { ge_model_ = ge_model; }
   GeModelPtr GetGeModel() const { return ge_model_; }
+  void SetBuildStageCosts(const std::vector<TaskGraph::TaskCost> &costs) { build_stage_costs_ = costs; }
+  const std::vector<TaskGraph::TaskCost> &GetBuildStageCosts() const { return build_stage_costs_; }
   void Lock();
   void Unlock();
 
@@ -173,6 +204,8 @@ class GraphNode {
   bool build_flag_;
   bool load_flag_;
   GeModelPtr ge_model_;
+  // stages of the last build, PreRun stages and the subgraph optimizations run in parallel
+  std::vector<TaskGraph::TaskCost> build_stage_costs_;
   BlockingQueue<uint8_t> sem_;
 };
 
@@ -232,6 +265,8 @@ struct GraphManagerOptions {
   bool local_fmk_op_flag;
   bool hcom_parallel;
   std::map<std::string, int> stream_max_parallel_num;
+  std::map<std::string, int> build_max_parallel_num;
+  std::map<std::string, int> stream_op_cost;
   std::string output_datatype;
   std::string original_model_file;
   bool save_original_model;
@@ -16,6 +16,8 @@
 
 #include "graph/manager/graph_var_manager.h"
 
+#include <algorithm>
+#include <iterator>
 #include <utility>
 
 #include "common/l2_cache_optimize.h"
@@ -257,7 +259,57 @@ Status VarResource::SetAllocatedGraphId(const std::string &var_name, uint32_t gr
   return SUCCESS;
 }
 
-MemResource::MemResource() : total_size_(0), var_mem_base_(nullptr), var_mem_size_(0) {}
+void VarResource::RemoveVar(const std::string &var_name) {
+  std::unordered_set<uint8_t *> removed_addrs;
+  for (auto iter = var_addr_mgr_map_.begin(); iter != var_addr_mgr_map_.end();) {
+    if (iter->first == VarKey(var_name, iter->second.tensor_desc)) {
+      (void)removed_addrs.insert(iter->second.address);
+      iter = var_addr_mgr_map_.erase(iter);
+    } else {
+      ++iter;
+    }
+  }
+  // An fp32 alias shares the address of its source var, keep the offset while one of them is left
+  for (const auto &var_addr_mgr : var_addr_mgr_map_) {
+    (void)removed_addrs.erase(var_addr_mgr.second.address);
+  }
+  for (uint8_t *address : removed_addrs) {
+    (void)var_offset_set_.erase(reinterpret_cast<uint64_t>(reinterpret_cast<std::uintptr_t>(address)));
+  }
+  (void)cur_var_tensor_desc_map_.erase(var_name);
+  (void)var_to_trans_road_.erase(var_name);
+  (void)var_names_to_changed_graph_id_.erase(var_name);
+  (void)var_names_to_allocated_graph_id_.erase(var_name);
+}
+
+Status VarResource::RemoveVarAddr(const std::string &var_name, const ge::GeTensorDesc &tensor_desc,
+                                  VarAddrMgr &var_addr_mgr, bool &is_shared) {
+  std::string var_key = VarKey(var_name, tensor_desc);
+  auto iter = var_addr_mgr_map_.find(var_key);
+  if (iter == var_addr_mgr_map_.end()) {
+    GELOGW("VarResource::RemoveVarAddr, var_key %s not found.", var_key.c_str());
+    return FAILED;
+  }
+  auto cur_iter = cur_var_tensor_desc_map_.find(var_name);
+  if ((cur_iter != cur_var_tensor_desc_map_.end()) && (VarKey(var_name, cur_iter->second) == var_key)) {
+    GELOGW("VarResource::RemoveVarAddr, var_key %s is the current layout of the var.", var_key.c_str());
+    return FAILED;
+  }
+
+  var_addr_mgr = iter->second;
+  (void)var_addr_mgr_map_.erase(iter);
+  // An fp32 alias shares the address of its source var, keep the offset and the memory while one of them is left
+  is_shared = std::any_of(var_addr_mgr_map_.begin(), var_addr_mgr_map_.end(),
+                          [&var_addr_mgr](const std::pair<const std::string, VarAddrMgr> &item) {
+                            return item.second.address == var_addr_mgr.address;
+                          });
+  if (!is_shared) {
+    (void)var_offset_set_.erase(reinterpret_cast<uint64_t>(reinterpret_cast<std::uintptr_t>(var_addr_mgr.address)));
+  }
+  return SUCCESS;
+}
+
+MemResource::MemResource() : total_size_(0), var_mem_base_(nullptr), var_mem_size_(0), var_mem_used_(0) {}
 
 Status MemResource::AssignVarMem(const std::string &var_name, uint64_t size, uint64_t session_id, size_t &mem_offset) {
   size = (size + kSessionMemAlignSize - 1) / kSessionMemAlignSize * kSessionMemAlignSize;
@@ -267,21 +319,122 @@ Status MemResource::AssignVarMem(const std::string &var_name, uint64_t size, uin
     GELOGE(PARAM_INVALID, "total_size_: %lu is smaller than var_mem_size_: %lu", total_size_, var_mem_size_);
     return PARAM_INVALID;
   }
-  uint64_t free_size = total_size_ - var_mem_size_;
-  if (free_size < (size + kSessionMemAlignSize * 2)) {
-    GELOGE(PARAM_INVALID, "malloc var mem, size[%lu] > free_size[%lu]", size, free_size);
-    return PARAM_INVALID;
+  // Every var keeps 512 BYTE in front of the next one and the block end aligned to 512 BYTE
+  uint64_t block_size = size + kSessionMemAlignSize * 2;
+
+  // Best fit among the holes left by deleted vars before growing the arena, lowest offset on a tie
+  auto best_iter = free_blocks_by_size_.lower_bound(std::make_pair(block_size, static_cast<uint64_t>(0)));
+  if (best_iter != free_blocks_by_size_.end()) {
+    uint64_t free_size = best_iter->first;
+    mem_offset = best_iter->second;
+    (void)RemoveFreeBlock(free_blocks_.find(mem_offset));
+    if (free_size > block_size) {
+      AddFreeBlock(mem_offset + block_size, free_size - block_size);
+    }
+  } else {
+    uint64_t free_size = total_size_ - var_mem_size_;
+    if (free_size < block_size) {
+      GELOGE(PARAM_INVALID, "malloc var mem, size[%lu] > free_size[%lu]", size, free_size);
+      return PARAM_INVALID;
+    }
+    mem_offset = var_mem_size_;
+    var_mem_size_ = var_mem_size_ + block_size;
   }
 
-  mem_offset = var_mem_size_;
+  var_mem_used_ += block_size;
+  var_blocks_[var_name].emplace_back(mem_offset, block_size);
+  return SUCCESS;
+}
 
-  // offset for next, align 512 BYTE
-  size = size + kSessionMemAlignSize;
-  var_mem_size_ = var_mem_size_ + size;
+void MemResource::FreeVarMem(const std::string &var_name) {
+  auto var_iter = var_blocks_.find(var_name);
+  if (var_iter == var_blocks_.end()) {
+    return;
+  }
 
-  // align 512 BYTE
-  var_mem_size_ = var_mem_size_ + kSessionMemAlignSize;
-  return SUCCESS;
+  for (const auto &block : var_iter->second) {
+    ReleaseBlock(block.first, block.second);
+  }
+  GELOGI("Free var %s memory, %zu blocks, var mem size %lu, used %lu.", var_name.c_str(), var_iter->second.size(),
+         var_mem_size_, var_mem_used_);
+  var_blocks_.erase(var_iter);
+}
+
+void MemResource::FreeVarMem(const std::string &var_name, uint64_t offset) {
+  auto var_iter = var_blocks_.find(var_name);
+  if (var_iter == var_blocks_.end()) {
+    return;
+  }
+
+  auto &blocks = var_iter->second;
+  auto block_iter = std::find_if(blocks.begin(), blocks.end(),
+                                 [offset](const std::pair<uint64_t, uint64_t> &block) { return block.first == offset; });
+  if (block_iter == blocks.end()) {
+    GELOGW("Var %s has no block at offset %lu.", var_name.c_str(), offset);
+    return;
+  }
+  ReleaseBlock(block_iter->first, block_iter->second);
+  (void)blocks.erase(block_iter);
+  GELOGI("Free var %s memory at offset %lu, var mem size %lu, used %lu.", var_name.c_str(), offset, var_mem_size_,
+         var_mem_used_);
+  if (blocks.empty()) {
+    var_blocks_.erase(var_iter);
+  }
+}
+
+void MemResource::ReleaseBlock(uint64_t offset, uint64_t size) {
+  var_mem_used_ -= size;
+
+  auto next_iter = free_blocks_.lower_bound(offset);
+  if ((next_iter != free_blocks_.end()) && (offset + size == next_iter->first)) {
+    size += next_iter->second;
+    next_iter = RemoveFreeBlock(next_iter);
+  }
+  if (next_iter != free_blocks_.begin()) {
+    auto prev_iter = std::prev(next_iter);
+    if (prev_iter->first + prev_iter->second == offset) {
+      offset = prev_iter->first;
+      size += prev_iter->second;
+      (void)RemoveFreeBlock(prev_iter);
+    }
+  }
+
+  // A hole reaching the top of the arena just lowers the high water mark
+  if (offset + size == var_mem_size_) {
+    var_mem_size_ = offset;
+  } else {
+    AddFreeBlock(offset, size);
+  }
+}
+
+void MemResource::AddFreeBlock(uint64_t offset, uint64_t size) {
+  free_blocks_[offset] = size;
+  (void)free_blocks_by_size_.emplace(size, offset);
+}
+
+std::map<uint64_t, uint64_t>::iterator MemResource::RemoveFreeBlock(std::map<uint64_t, uint64_t>::iterator iter) {
+  (void)free_blocks_by_size_.erase(std::make_pair(iter->second, iter->first));
+  return free_blocks_.erase(iter);
+}
+
+void MemResource::GetVarMemStatistics(VarMemStatistics &statistics) const {
+  statistics.total_size = total_size_;
+  statistics.var_mem_size = var_mem_size_;
+  statistics.used_size = var_mem_used_;
+  statistics.free_block_num = free_blocks_.size();
+  statistics.free_size = 0;
+  statistics.max_free_block_size = 0;
+  for (const auto &free_block : free_blocks_) {
+    statistics.free_size += free_block.second;
+    statistics.max_free_block_size = std::max(statistics.max_free_block_size, free_block.second);
+  }
+
+  // The space above the high water mark is one more free block
+  uint64_t tail_size = (total_size_ > var_mem_size_) ? (total_size_ - var_mem_size_) : 0;
+  uint64_t all_free_size = statistics.free_size + tail_size;
+  uint64_t max_free_size = std::max(statistics.max_free_block_size, tail_size);
+  statistics.fragmentation =
+      (all_free_size == 0) ? 0.0 : (1.0 - static_cast<double>(max_free_size) / static_cast<double>(all_free_size));
 }
 
 int64_t MemResource::GetVarMemSize() const { return var_mem_size_; }
@@ -486,6 +639,65 @@ ge::Status VarManager::AssignVarMem(const std::string &var_name, const ge::GeTen
   return SUCCESS;
 }
 
+Status VarManager::FreeVarMem(const std::string &var_name) {
+  std::lock_guard<std::recursive_mutex> lock(mutex_);
+  if (var_resource_ == nullptr) {
+    GELOGW("VarManager has not been init.");
+    return INTERNAL_ERROR;
+  }
+  var_resource_->RemoveVar(var_name);
+  for (auto &memory_resource : mem_resource_map_) {
+    if (memory_resource.second == nullptr) {
+      continue;
+    }
+    memory_resource.second->FreeVarMem(var_name);
+    VarMemStatistics statistics;
+    memory_resource.second->GetVarMemStatistics(statistics);
+    GELOGI(
+        "Var %s deleted, memory_type %u: var mem size %lu, used %lu, %lu free blocks of %lu bytes, "
+        "max free block %lu, fragmentation %.3f.",
+        var_name.c_str(), memory_resource.first, statistics.var_mem_size, statistics.used_size,
+        statistics.free_block_num, statistics.free_size, statistics.max_free_block_size, statistics.fragmentation);
+  }
+  return SUCCESS;
+}
+
+Status VarManager::FreeVarLayout(const std::string &var_name, const ge::GeTensorDesc &tensor_desc) {
+  std::lock_guard<std::recursive_mutex> lock(mutex_);
+  if (var_resource_ == nullptr) {
+    GELOGW("VarManager has not been init.");
+    return INTERNAL_ERROR;
+  }
+  VarAddrMgr var_addr_mgr;
+  bool is_shared = false;
+  Status ret = var_resource_->RemoveVarAddr(var_name, tensor_desc, var_addr_mgr, is_shared);
+  if (ret != SUCCESS) {
+    return ret;
+  }
+  if (is_shared) {
+    GELOGI("Layout of var %s dropped, its memory is still shared.", var_name.c_str());
+    return SUCCESS;
+  }
+  auto iter = mem_resource_map_.find(var_addr_mgr.memory_type);
+  if ((iter == mem_resource_map_.end()) || (iter->second == nullptr)) {
+    GELOGW("MemResource of memory_type %u has not been created.", var_addr_mgr.memory_type);
+    return INTERNAL_ERROR;
+  }
+  iter->second->FreeVarMem(var_name, var_addr_mgr.offset);
+  return SUCCESS;
+}
+
+Status VarManager::GetVarMemStatistics(rtMemType_t memory_type, VarMemStatistics &statistics) {
+  std::lock_guard<std::recursive_mutex> lock(mutex_);
+  auto iter = mem_resource_map_.find(memory_type);
+  if ((iter == mem_resource_map_.end()) || (iter->second == nullptr)) {
+    GELOGW("MemResource of memory_type %u has not been created.", memory_type);
+    return INTERNAL_ERROR;
+  }
+  iter->second->GetVarMemStatistics(statistics);
+  return SUCCESS;
+}
+
 bool VarManager::IsVarExist(const std::string &var_name, const ge::GeTensorDesc &tensor_desc) {
   std::lock_guard<std::recursive_mutex> lock(mutex_);
   GELOGD("VarManager::IsVarExist var_name = %s, data_type = %s, data_format = %s", var_name.c_str(),
@@ -20,9 +20,11 @@
 #include <atomic>
 #include <map>
 #include <memory>
+#include <set>
 #include <string>
 #include <unordered_map>
 #include <unordered_set>
+#include <utility>
 #include <vector>
 
 #include "framework/common/ge_inner_error_codes.h"
@@ -61,6 +63,24 @@ struct MemResourceCfg {
   MemResourceCfg() : mem_status(0), mem_res_size(0) {}
 };
 
+struct VarMemStatistics {
+  uint64_t total_size;
+  uint64_t var_mem_size;
+  uint64_t used_size;
+  uint64_t free_size;
+  uint64_t free_block_num;
+  uint64_t max_free_block_size;
+  double fragmentation;
+  VarMemStatistics()
+      : total_size(0),
+        var_mem_size(0),
+        used_size(0),
+        free_size(0),
+        free_block_num(0),
+        max_free_block_size(0),
+        fragmentation(0.0) {}
+};
+
 struct VarAddrMgr {
   ge::GeTensorDesc tensor_desc;
   uint8_t *address;
@@ -153,6 +173,25 @@ class VarResource {
 
   bool IsVarAddr(const int64_t &offset);
 
+  ///
+  /// @ingroup ge_graph
+  /// @brief drop every layout and record of var_name
+  /// @param [in] var_name variable name
+  ///
+  void RemoveVar(const std::string &var_name);
+
+  ///
+  /// @ingroup ge_graph
+  /// @brief drop one layout of var_name which is not its current one
+  /// @param [in] var_name variable name
+  /// @param [in] tensor_desc tensor desc of the layout
+  /// @param [out] var_addr_mgr address record of the dropped layout
+  /// @param [out] is_shared whether another layout still uses the same memory
+  /// @return Status result of function
+  ///
+  Status RemoveVarAddr(const std::string &var_name, const ge::GeTensorDesc &tensor_desc, VarAddrMgr &var_addr_mgr,
+                       bool &is_shared);
+
  private:
   std::string VarKey(const std::string &var_name, const ge::GeTensorDesc &tensor_desc);
 
@@ -173,12 +212,40 @@ class MemResource {
 
   Status AssignVarMem(const std::string &var_name, uint64_t size, uint64_t session_id, size_t &mem_offset);
 
+  ///
+  /// @ingroup ge_graph
+  /// @brief give every block of var_name back to the free list, merging adjacent free blocks
+  /// @param [in] var_name variable name
+  ///
+  void FreeVarMem(const std::string &var_name);
+
+  ///
+  /// @ingroup ge_graph
+  /// @brief give the block of var_name at offset back to the free list
+  /// @param [in] var_name variable name
+  /// @param [in] offset offset of the block
+  ///
+  void FreeVarMem(const std::string &var_name, uint64_t offset);
+
   int64_t GetVarMemSize() const;
 
+  void GetVarMemStatistics(VarMemStatistics &statistics) const;
+
  private:
+  void ReleaseBlock(uint64_t offset, uint64_t size);
+  void AddFreeBlock(uint64_t offset, uint64_t size);
+  std::map<uint64_t, uint64_t>::iterator RemoveFreeBlock(std::map<uint64_t, uint64_t>::iterator iter);
+
   uint64_t total_size_;
   uint8_t *var_mem_base_;
+  // high water mark of the arena, blocks below it are either used or in free_blocks_
   uint64_t var_mem_size_;
+  uint64_t var_mem_used_;
+  // offset -> size, sorted by offset so neighbours can be merged
+  std::map<uint64_t, uint64_t> free_blocks_;
+  // (size, offset) of the same blocks, sorted by size for the best fit lookup
+  std::set<std::pair<uint64_t, uint64_t>> free_blocks_by_size_;
+  std::unordered_map<std::string, std::vector<std::pair<uint64_t, uint64_t>>> var_blocks_;
 };
 
 class FMK_FUNC_HOST_VISIBILITY FMK_FUNC_DEV_VISIBILITY VarManager {
@@ -244,6 +311,25 @@ class FMK_FUNC_HOST_VISIBILITY FMK_FUNC_DEV_VISIBILITY VarManager {
 
   void RemoveAllocatedGraphId(const std::string &var_name);
 
+  ///
+  /// @ingroup ge_graph
+  /// @brief delete var_name from the session and give its memory back for reuse
+  /// @param [in] var_name variable name
+  /// @return Status result of function
+  ///
+  Status FreeVarMem(const std::string &var_name);
+
+  ///
+  /// @ingroup ge_graph
+  /// @brief release a layout of var_name once its data has been moved to the current layout
+  /// @param [in] var_name variable name
+  /// @param [in] tensor_desc tensor desc of the old layout
+  /// @return Status result of function
+  ///
+  Status FreeVarLayout(const std::string &var_name, const ge::GeTensorDesc &tensor_desc);
+
+  Status GetVarMemStatistics(rtMemType_t memory_type, VarMemStatistics &statistics);
+
   const uint64_t &SessionId() const;
 
   const uint32_t &DeviceId() const;
@@ -505,8 +505,11 @@ Status ge::GraphPartitioner::Initialize(ge::ComputeGraphPtr compute_graph) {
     return FAILED;
   }
   const NodeEngineMap *node_engine_map = engine_placer_.GetNodeEngineMap();
+  // A cluster is indexed by the id of its node in the snapshot
+  auto direct_nodes = compute_graph->GetDirectNode();
+  CompactGraph compact_graph(std::vector<NodePtr>(direct_nodes.begin(), direct_nodes.end()));
   size_t temp_index = 0;
-  for (const auto &node : compute_graph->GetDirectNode()) {
+  for (const auto &node : compact_graph.GetNodes()) {
     std::string temp_stream;
     // node opdesc has been checked before
     (void)AttrUtils::GetStr(node->GetOpDesc(), ATTR_NAME_STREAM_LABEL, temp_stream);
@@ -526,9 +529,18 @@ Status ge::GraphPartitioner::Initialize(ge::ComputeGraphPtr compute_graph) {
     }
     new_cluster->nodes_.push_back(node);
     if (!HasNoInput(node)) {
-      for (const auto &parent : node->GetInAllNodes()) {
-        new_cluster->in_clu_.insert(node_2_cluster_.at(parent)->index_);
-        node_2_cluster_.at(parent)->out_clu_.insert(temp_index);
+      // The in nodes of Node::GetInAllNodes
+      auto id = static_cast<uint32_t>(temp_index);
+      for (const auto &parent_ids : {compact_graph.GetInDataNodes(id), compact_graph.GetInControlNodes(id)}) {
+        for (uint32_t parent_id : parent_ids) {
+          if (parent_id >= id) {
+            GELOGE(FAILED, "[GraphPartitioner]: node %s is placed before its input %s.", node->GetName().c_str(),
+                   compact_graph.GetNode(parent_id)->GetName().c_str());
+            return FAILED;
+          }
+          new_cluster->in_clu_.insert(parent_id);
+          clusters_[parent_id]->out_clu_.insert(temp_index);
+        }
       }
     }
     node_2_cluster_[node] = new_cluster;
@@ -620,6 +632,7 @@ bool ge::GraphPartitioner::IsMergeable(size_t parent_cluster, size_t child_clust
 }
 
 void ge::GraphPartitioner::MergeTwoClusters(size_t parent_cluster, size_t &child_cluster) {
+  UpdateRankBeforeMerge(parent_cluster, child_cluster);
   // check which index is bigger
   size_t big_cluster, small_cluster;
   size_t child_cluster_original = child_cluster;
@@ -677,6 +690,8 @@ void ge::GraphPartitioner::InsertEdge(size_t from, size_t to) {
 void ge::GraphPartitioner::MarkClusters() {
   GELOGI("MarkClusters starts. cluster size is %zu", clusters_.size());
   size_t cluster_size = clusters_.size();
+  visit_marks_.assign(cluster_size, 0);
+  visit_epoch_ = 0;
   for (size_t child_cluster = 0; child_cluster < cluster_size; child_cluster++) {
     auto found_child_cluster = clusters_[child_cluster];
     if (found_child_cluster == nullptr) {
@@ -780,23 +795,23 @@ bool ge::GraphPartitioner::HasSecondPath(size_t src, size_t dst, size_t upper_bo
   if (clusters_.at(src)->out_clu_.empty() || clusters_.at(dst)->in_clu_.empty()) {
     return false;
   }
-  /// Avoid recursion since stack space might be limited.
+  /// Every cluster on a path to dst is ranked before dst, so only the clusters ranked between src and dst are
+  /// searched. Avoid recursion since stack space might be limited.
   /// We instead keep a stack of nodes to visit.
+  size_t dst_rank = clusters_.at(dst)->rank_;
+  StartVisit();
   std::vector<size_t> temp_stack;
-  std::unordered_set<size_t> visited;
   temp_stack.push_back(src);
+  visit_marks_[src] = visit_epoch_;
   while (!temp_stack.empty()) {
     size_t cluster = temp_stack.back();
     temp_stack.pop_back();
-    ClusterPtr cur_cluster = clusters_[cluster];
-    if (!visited.insert(cluster).second) {
-      continue;
-    }
-    for (auto out : cur_cluster->out_clu_) {
+    for (auto out : clusters_[cluster]->out_clu_) {
       if (out == dst) {
         return true;  // There is cycle
       }
-      if (out < upper_bound) {
+      if ((out < upper_bound) && (clusters_[out]->rank_ < dst_rank) && (visit_marks_[out] != visit_epoch_)) {
+        visit_marks_[out] = visit_epoch_;
         temp_stack.push_back(out);
       }
     }
@@ -804,6 +819,71 @@ bool ge::GraphPartitioner::HasSecondPath(size_t src, size_t dst, size_t upper_bo
   return false;
 }
 
+void ge::GraphPartitioner::StartVisit() {
+  if (++visit_epoch_ == 0) {
+    std::fill(visit_marks_.begin(), visit_marks_.end(), 0);
+    visit_epoch_ = 1;
+  }
+}
+
+void ge::GraphPartitioner::CollectClustersInRank(size_t start, bool forward, size_t low_rank, size_t high_rank,
+                                                 std::vector<size_t> &clusters) {
+  StartVisit();
+  std::vector<size_t> temp_stack;
+  temp_stack.push_back(start);
+  visit_marks_[start] = visit_epoch_;
+  while (!temp_stack.empty()) {
+    size_t cluster = temp_stack.back();
+    temp_stack.pop_back();
+    const ClusterSet &next_clusters = forward ? clusters_[cluster]->out_clu_ : clusters_[cluster]->in_clu_;
+    for (auto next : next_clusters) {
+      size_t rank = clusters_[next]->rank_;
+      if ((rank > low_rank) && (rank < high_rank) && (visit_marks_[next] != visit_epoch_)) {
+        visit_marks_[next] = visit_epoch_;
+        clusters.emplace_back(next);
+        temp_stack.push_back(next);
+      }
+    }
+  }
+}
+
+/// Same as the reordering of a dynamic topological sort when an edge is added backwards: the clusters ranked
+/// between parent and child that reach child keep their order and move before the merged cluster, the ones reached
+/// from parent move after it, and together they take the ranks these clusters had. The other clusters keep theirs.
+/// Nothing reached from parent reaches child, as there is no second path.
+void ge::GraphPartitioner::UpdateRankBeforeMerge(size_t parent_cluster, size_t child_cluster) {
+  size_t parent_rank = clusters_[parent_cluster]->rank_;
+  size_t child_rank = clusters_[child_cluster]->rank_;
+  std::vector<size_t> forward_clusters;
+  std::vector<size_t> backward_clusters;
+  CollectClustersInRank(parent_cluster, true, parent_rank, child_rank, forward_clusters);
+  CollectClustersInRank(child_cluster, false, parent_rank, child_rank, backward_clusters);
+
+  auto comp_func = [this](size_t cluster1, size_t cluster2) -> bool {
+    return clusters_[cluster1]->rank_ < clusters_[cluster2]->rank_;
+  };
+  std::sort(forward_clusters.begin(), forward_clusters.end(), comp_func);
+  std::sort(backward_clusters.begin(), backward_clusters.end(), comp_func);
+  std::vector<size_t> ranks = {parent_rank, child_rank};
+  for (auto cluster : forward_clusters) {
+    ranks.emplace_back(clusters_[cluster]->rank_);
+  }
+  for (auto cluster : backward_clusters) {
+    ranks.emplace_back(clusters_[cluster]->rank_);
+  }
+  std::sort(ranks.begin(), ranks.end());
+
+  size_t rank_index = 0;
+  for (auto cluster : backward_clusters) {
+    clusters_[cluster]->rank_ = ranks[rank_index++];
+  }
+  clusters_[parent_cluster]->rank_ = ranks[rank_index];
+  clusters_[child_cluster]->rank_ = ranks[rank_index++];
+  for (auto cluster : forward_clusters) {
+    clusters_[cluster]->rank_ = ranks[rank_index++];
+  }
+}
+
 Status ge::GraphPartitioner::Partition(ge::ComputeGraphPtr compute_graph, vector<ge::SubGraphInfoPtr> &output_subgraphs,
                                        Mode mode) {
   ClearAllPartitionData(mode);
@@ -41,13 +41,14 @@ using ClusterSet = std::unordered_set<size_t>;
 class Cluster {
  public:
   size_t index_;            // corresponding to rank of node
+  size_t rank_;               // position in a topological order of the clusters, kept valid across merges
   ClusterSet in_clu_;         // inClusters index
   ClusterSet out_clu_;        // outClusters index
   std::list<NodePtr> nodes_;  // including node of this cluster
   std::string engine_name_;   // data like must be a specific engine
   std::string stream_label_;
   explicit Cluster(size_t index, std::string engine, std::string stream)
-      : index_(index), engine_name_(std::move(engine)), stream_label_(std::move(stream)) {}
+      : index_(index), rank_(index), engine_name_(std::move(engine)), stream_label_(std::move(stream)) {}
   ~Cluster() = default;
 };
 using ClusterPtr = std::shared_ptr<Cluster>;
@@ -117,6 +118,17 @@ class GraphPartitioner {
   // Check if there's a second path between two clusters. The max path length is upper_bound
   bool HasSecondPath(size_t src, size_t dst, size_t upper_bound);
 
+  /// Before parent is merged into child, reorder the clusters ranked between them so that the merged cluster gets
+  /// a rank after everything reaching child and before everything reached from parent
+  void UpdateRankBeforeMerge(size_t parent_cluster, size_t child_cluster);
+
+  // Start a new cluster search, clusters visited by former searches count as unvisited
+  void StartVisit();
+
+  // Clusters reachable from start, in or out as given by forward, ranked strictly between low_rank and high_rank
+  void CollectClustersInRank(size_t start, bool forward, size_t low_rank, size_t high_rank,
+                             std::vector<size_t> &clusters);
+
   // Mark all clusters
   void MarkClusters();
 
@@ -149,6 +161,9 @@ class GraphPartitioner {
   std::unordered_map<size_t, ClusterPtr> clusters_;                     // index to cluster ptr, contains all nodes
   std::unordered_map<NodePtr, std::shared_ptr<Cluster>> node_2_cluster_;  // node map to cluster
   std::unordered_map<std::shared_ptr<Cluster>, ComputeGraphPtr> cluster_2_partition_;  // cluster map to subgraph
+  // visited marks of the cluster searches by cluster index, a cluster is visited when its mark equals visit_epoch_
+  std::vector<uint32_t> visit_marks_;
+  uint32_t visit_epoch_ = 0;
 };
 }  // namespace ge
 
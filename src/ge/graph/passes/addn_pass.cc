@@ -23,6 +23,8 @@ namespace {
 const size_t kInputSizeSingle = 1;
 }  // namespace
 
+std::vector<std::string> AddNPass::GetInterestedTypes() const { return {ADDN}; }
+
 Status AddNPass::Run(NodePtr &node) {
   GELOGD("AddNPass running");
   if (node == nullptr) {
@@ -29,6 +29,7 @@ namespace ge {
 class AddNPass : public BaseNodePass {
  public:
   Status Run(ge::NodePtr &node) override;
+  std::vector<std::string> GetInterestedTypes() const override;
 };
 }  // namespace ge
 
@@ -27,6 +27,8 @@
 
 namespace ge {
 // aicpu not support string type, so current implemention is Upward traversal
+std::vector<std::string> AssertPass::GetInterestedTypes() const { return {ASSERT}; }
+
 Status AssertPass::Run(NodePtr &node) {
   GELOGD("AssertPass running");
   if (node == nullptr) {
@@ -25,6 +25,7 @@ namespace ge {
 class AssertPass : public BaseNodePass {
  public:
   Status Run(NodePtr& node) override;
+  std::vector<std::string> GetInterestedTypes() const override;
 
  private:
   ///
@@ -87,7 +87,7 @@ Status AtomicAddrCleanPass::HandleLoopGraph(ComputeGraphPtr &graph, const vector
     std::ostringstream oss;
     oss << node_name << index;
     node_name = oss.str();
-    clean_addr_node->GetOpDesc()->SetName(node_name);  // [Cascade Pointer]
+    GE_CHK_STATUS_RET(graph->RenameNode(clean_addr_node, node_name), "Rename node %s failed.", node_name.c_str());
     GELOGD("Inserted atomic clean node name is %s", node_name.c_str());
 
     auto ret = LinkToAtomicNode(node, clean_addr_node);
@@ -16,10 +16,13 @@
 
 #include "graph/passes/base_pass.h"
 
+#include <algorithm>
 #include <queue>
 #include <unordered_set>
 
 #include "common/debug/log.h"
+#include "common/task_executor.h"
+#include "common/types.h"
 #include "framework/common/debug/ge_log.h"
 #include "graph/compute_graph.h"
 #include "graph/utils/graph_utils.h"
@@ -28,6 +31,37 @@ namespace ge {
 namespace {
 const int kMaxRePassTimes = 1000;
 const size_t kMaxOneInNodes = 1000;
+const size_t kParallelMinNodes = 1024;
+const uint32_t kMaxPassThreadNum = 16;
+
+using InterestedTypes = std::vector<std::unordered_set<std::string>>;
+
+void GetInterestedTypes(const NamesToPass &names_to_passes, InterestedTypes &interested_types) {
+  interested_types.clear();
+  for (const auto &name_to_pass : names_to_passes) {
+    std::unordered_set<std::string> types;
+    if (name_to_pass.second != nullptr) {
+      for (auto &type : name_to_pass.second->GetInterestedTypes()) {
+        types.insert(type);
+      }
+    }
+    interested_types.emplace_back(std::move(types));
+  }
+}
+
+bool IsInterested(const InterestedTypes &interested_types, size_t pass_index, const NodePtr &node) {
+  const auto &types = interested_types[pass_index];
+  return types.empty() || (types.count(node->GetType()) > 0);
+}
+
+bool IsAllPassesNodeLocal(const NamesToPass &names_to_passes) {
+  for (const auto &name_to_pass : names_to_passes) {
+    if ((name_to_pass.second == nullptr) || !name_to_pass.second->IsNodeLocal()) {
+      return false;
+    }
+  }
+  return true;
+}
 
 void GetAllNodesNoInputEdge(const ComputeGraphPtr &graph, std::queue<NodePtr> &input_edge_nodes,
                             std::unordered_set<Node *> &nodes_seen, std::unordered_set<NodePtr> &nodes_last) {
@@ -63,18 +97,23 @@ void AddNextIterNodes(const Node::Vistor<NodePtr> &nodes, std::queue<NodePtr> &n
   }
 }
 
-Status RunPasses(NodePtr &node, const NamesToPass &names_to_passes, std::unordered_set<NodePtr> &nodes_re_pass,
-                 std::unordered_set<Node *> &nodes_deleted, std::unordered_set<Node *> &nodes_seen) {
+Status RunPasses(NodePtr &node, const NamesToPass &names_to_passes, const InterestedTypes &interested_types,
+                 std::unordered_set<NodePtr> &nodes_re_pass, std::unordered_set<Node *> &nodes_deleted,
+                 std::unordered_set<Node *> &nodes_seen) {
   if (node == nullptr) {
     GELOGE(FAILED, "parameter is null.");
     return FAILED;
   }
   GELOGD("Begin to run pass for node %s", node->GetName().c_str());
-  for (const auto &name_to_pass : names_to_passes) {
+  for (size_t i = 0; i < names_to_passes.size(); ++i) {
+    const auto &name_to_pass = names_to_passes[i];
     if (name_to_pass.second == nullptr) {
       GELOGE(INTERNAL_ERROR, "There is null pointer in passes(%s), skip it", name_to_pass.first.c_str());
       continue;
     }
+    if (!IsInterested(interested_types, i, node)) {
+      continue;
+    }
 
     GELOGD("Begin to run pass %s", name_to_pass.first.c_str());
     name_to_pass.second->init();
@@ -87,7 +126,7 @@ Status RunPasses(NodePtr &node, const NamesToPass &names_to_passes, std::unorder
       return result;
     }
 
-    auto nodes_to_re_pass = name_to_pass.second->GetNodesNeedRePass();
+    const auto &nodes_to_re_pass = name_to_pass.second->GetNodesNeedRePass();
     for (const auto &node_to_re_pass : nodes_to_re_pass) {
       if (node_to_re_pass == nullptr) {
         GELOGW("Found null re-pass node when executing %s on node %s type %s", name_to_pass.first.c_str(),
@@ -102,7 +141,7 @@ Status RunPasses(NodePtr &node, const NamesToPass &names_to_passes, std::unorder
       }
     }
 
-    auto nodes_deleted_by_pass = name_to_pass.second->GetNodesDeleted();
+    const auto &nodes_deleted_by_pass = name_to_pass.second->GetNodesDeleted();
     nodes_deleted.insert(nodes_deleted_by_pass.begin(), nodes_deleted_by_pass.end());
     if (nodes_deleted_by_pass.count(node.get()) > 0) {
       GELOGD("The node %s was deleted by pass %s, stop the remain passes", node->GetName().c_str(),
@@ -113,6 +152,27 @@ Status RunPasses(NodePtr &node, const NamesToPass &names_to_passes, std::unorder
 
   return SUCCESS;
 }
+
+Status RunNodeLocalPasses(const std::vector<NodePtr> &nodes, size_t begin, size_t end,
+                          const NamesToPass &names_to_passes, const InterestedTypes &interested_types) {
+  for (size_t index = begin; index < end; ++index) {
+    NodePtr node = nodes[index];
+    for (size_t i = 0; i < names_to_passes.size(); ++i) {
+      if (!IsInterested(interested_types, i, node)) {
+        continue;
+      }
+      auto result = names_to_passes[i].second->Run(node);
+      if (result != SUCCESS) {
+        GELOGE(INTERNAL_ERROR,
+               "Failed to process pass %s on node %s, result "
+               "%u, the passes will be terminated immediately.",
+               names_to_passes[i].first.c_str(), node->GetName().c_str(), result);
+        return result;
+      }
+    }
+  }
+  return SUCCESS;
+}
 }  // namespace
 
 Status BaseNodePass::IsolateAndDeleteNode(NodePtr &node, const std::vector<int> &io_map) {
@@ -154,7 +214,13 @@ Status GEPass::Run(const NamesToPass &names_to_passes) {
     return INTERNAL_ERROR;
   }
 
+  if (IsAllPassesNodeLocal(names_to_passes) && (graph_->GetAllNodes().size() >= kParallelMinNodes)) {
+    return RunParallel(names_to_passes);
+  }
+
   GELOGD("Begin to run pass on graph, passes count %zu", names_to_passes.size());
+  InterestedTypes interested_types;
+  GetInterestedTypes(names_to_passes, interested_types);
   std::queue<NodePtr> nodes;
   std::unordered_set<Node *> nodes_seen;
   std::unordered_set<Node *> nodes_deleted;
@@ -184,7 +250,7 @@ Status GEPass::Run(const NamesToPass &names_to_passes) {
 
       AddNextIterNodes(node->GetOutNodes(), nodes, nodes_seen, nodes_last);
 
-      auto ret = RunPasses(node, names_to_passes, nodes_re_pass, nodes_deleted, nodes_seen);
+      auto ret = RunPasses(node, names_to_passes, interested_types, nodes_re_pass, nodes_deleted, nodes_seen);
       if (ret != SUCCESS) {
         GELOGE(INTERNAL_ERROR,
                "Failed to process passes on node %s type %s,"
@@ -210,4 +276,29 @@ Status GEPass::Run(const NamesToPass &names_to_passes) {
 
   return SUCCESS;
 }
+
+Status GEPass::RunParallel(const NamesToPass &names_to_passes) {
+  GELOGD("Begin to run node local passes on graph in parallel, passes count %zu", names_to_passes.size());
+  InterestedTypes interested_types;
+  GetInterestedTypes(names_to_passes, interested_types);
+
+  // Node local passes do not depend on the order the nodes are passed in, so the nodes are shared out as they
+  // are listed, whatever the depth of the graph and the while loops or other cycles in it
+  std::vector<NodePtr> nodes;
+  for (auto &node : graph_->GetAllNodes()) {
+    if (node != nullptr) {
+      nodes.emplace_back(node);
+    }
+  }
+
+  uint32_t thread_num = std::min(TaskExecutor::Instance().GetWorkerNum(), kMaxPassThreadNum);
+  size_t chunk_size = (nodes.size() + thread_num - 1) / thread_num;
+  Status ret = TaskExecutor::Instance().ParallelFor(
+      0, nodes.size(), chunk_size, [&nodes, &names_to_passes, &interested_types](size_t begin, size_t end) {
+        return RunNodeLocalPasses(nodes, begin, end, names_to_passes, interested_types);
+      });
+  GE_CHK_STATUS_RET(ret, "Run node local passes in parallel failed.");
+  GELOGD("All node local passes runs end, %zu nodes passed", nodes.size());
+  return SUCCESS;
+}
 }  // namespace ge
@@ -41,9 +41,23 @@ class BaseNodePass {
 
   virtual ~BaseNodePass() = default;
 
-  std::unordered_set<NodePtr> GetNodesNeedRePass() { return nodes_need_re_pass_; }
+  const std::unordered_set<NodePtr> &GetNodesNeedRePass() const { return nodes_need_re_pass_; }
 
-  std::unordered_set<Node *> GetNodesDeleted() { return nodes_deleted_; }
+  const std::unordered_set<Node *> &GetNodesDeleted() const { return nodes_deleted_; }
+
+  ///
+  /// Node types the pass works on, GEPass does not call Run for nodes of other types.
+  /// An empty list means the pass is interested in all types.
+  /// @return
+  ///
+  virtual std::vector<std::string> GetInterestedTypes() const { return {}; }
+
+  ///
+  /// A node local pass only reads and updates the op desc of the node it runs on. It never changes
+  /// the graph, other nodes or its own members, so GEPass may run it on independent nodes concurrently.
+  /// @return
+  ///
+  virtual bool IsNodeLocal() const { return false; }
 
   void init() {
     nodes_need_re_pass_.clear();
@@ -105,6 +119,14 @@ class GEPass {
   Status Run(const NamesToPass &names_to_passes);
 
  private:
+  ///
+  /// Run node local passes on all nodes of the graph, the nodes are shared out to the task executor
+  /// in one go as the passes do not depend on the order of the nodes.
+  /// @param names_to_passes
+  /// @return
+  ///
+  Status RunParallel(const NamesToPass &names_to_passes);
+
   ComputeGraphPtr graph_;
 };
 }  // namespace ge
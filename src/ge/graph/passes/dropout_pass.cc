@@ -28,6 +28,8 @@ namespace ge {
 /// @param [in] node node to be optimized
 /// @return Status
 ///
+std::vector<std::string> DropOutPass::GetInterestedTypes() const { return {DROPOUT}; }
+
 Status DropOutPass::Run(NodePtr &node) {
   GELOGD("DropOutPass running");
   if (node == nullptr) {
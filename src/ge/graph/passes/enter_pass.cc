@@ -24,6 +24,8 @@
 #include "graph/utils/graph_utils.h"
 
 namespace ge {
+std::vector<std::string> EnterPass::GetInterestedTypes() const { return {ENTER, REFENTER}; }
+
 Status EnterPass::Run(NodePtr &node) {
   GELOGD("EnterPass running");
   if (node == nullptr) {
@@ -23,6 +23,9 @@ namespace ge {
 class IdentifyReferencePass : public BaseNodePass {
  public:
   Status Run(NodePtr &node) override;
+
+  /// only sets an attribute on the node itself
+  bool IsNodeLocal() const override { return true; }
 };
 }  // namespace ge
 
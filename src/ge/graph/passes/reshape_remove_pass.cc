@@ -24,6 +24,8 @@ const int kReshapeDataIndex = 0;
 const int kReshapeShapeIndex = 1;
 }  // namespace
 
+std::vector<std::string> ReshapeRemovePass::GetInterestedTypes() const { return {RESHAPE}; }
+
 Status ReshapeRemovePass::Run(NodePtr &node) {
   if (node == nullptr) {
     GELOGE(FAILED, "parameter is null.");
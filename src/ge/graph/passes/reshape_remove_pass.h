@@ -23,6 +23,7 @@ namespace ge {
 class ReshapeRemovePass : public BaseNodePass {
  public:
   Status Run(NodePtr &node) override;
+  std::vector<std::string> GetInterestedTypes() const override;
 };
 }  // namespace ge
 
@@ -371,7 +371,9 @@ Status SwitchOpPass::CombineSwitchNode(ComputeGraphPtr &graph) {
       NodePtr stream_switch = switch_list.front();
       OpDescPtr switch_desc = stream_switch->GetOpDesc();
       GE_CHECK_NOTNULL(switch_desc);
-      switch_desc->SetName(cond_group + "/" + STREAMSWITCH + (true_branch_flag ? "_t" : "_f"));
+      std::string switch_name = cond_group + "/" + STREAMSWITCH + (true_branch_flag ? "_t" : "_f");
+      GE_CHK_STATUS_RET(graph->RenameNode(stream_switch, switch_name), "Rename node %s failed.",
+                        stream_switch->GetName().c_str());
       stream_switch_nodes_.emplace_back(stream_switch);
       need_label_nodes_.emplace_back(stream_switch);
 
@@ -69,6 +69,12 @@ Status TransposeTransDataPass::Run(NodePtr &node) {
     if (!FusionIfNeed(op_desc, out_op_desc)) {
       continue;
     }
+    // rename through the owner graph so that it still finds the fused TransData by name
+    ComputeGraphPtr graph = out_node->GetOwnerComputeGraph();
+    GE_CHECK_NOTNULL(graph);
+    GE_CHK_STATUS_RET(graph->RenameNode(out_node, op_desc->GetName() + out_op_desc->GetName()),
+                      "Rename fused node %s failed.", out_node->GetName().c_str());
+    GELOGI("TransposeTransDataPass, fuse to be node %s.", out_node->GetName().c_str());
     CopyInputEdges(node, out_node);
     is_add_flag = true;
   }
@@ -173,15 +179,12 @@ bool TransposeTransDataPass::FusionIfNeed(OpDescPtr &op_desc, OpDescPtr &transda
   }
 
   // add attr to fused TransData, then will be rebuild
-  string new_node_name = op_desc->GetName() + transdata_op_desc->GetName();
-  transdata_op_desc->SetName(new_node_name);
   GE_IF_BOOL_EXEC(!AttrUtils::SetBool(transdata_op_desc, ATTR_NEED_COMPILE, true),
                   GELOGW("set ext attr failed"); return false);
 
   string format_val = TypeUtils::FormatToSerialString(src_format);
   GE_IF_BOOL_EXEC(!AttrUtils::SetStr(transdata_op_desc, kAttrNameSrcFormat, format_val),
                   GELOGW("set kAttrNameSrcFormat failed"); return false);
-  GELOGI("TransposeTransDataPass, fuse to be node %s.", transdata_op_desc->GetName().c_str());
   return true;
 }
 
@@ -27,6 +27,8 @@ namespace ge {
 /// @param [in] node node to be deleted
 /// @return Status
 ///
+std::vector<std::string> UnusedConstPass::GetInterestedTypes() const { return {UNUSEDCONST}; }
+
 Status UnusedConstPass::Run(NodePtr &node) {
   if (node == nullptr) {
     GELOGE(FAILED, "parameter is null.");
@@ -23,6 +23,7 @@ namespace ge {
 class UnusedConstPass : public BaseNodePass {
  public:
   Status Run(NodePtr &node) override;
+  std::vector<std::string> GetInterestedTypes() const override;
 };
 }  // namespace ge
 #endif  // GE_GRAPH_PASSES_UNUSED_CONST_PASS_H_
@@ -41,6 +41,8 @@ class GE_FUNC_DEV_VISIBILITY GE_FUNC_HOST_VISIBILITY GeModel : public AttrHolder
   std::shared_ptr<domi::ModelTaskDef> GetModelTaskDefPtr() const;
   const TBEKernelStore &GetTBEKernelStore() const;
   Buffer GetWeight() const;
+  const uint8_t *GetWeightData() const;
+  size_t GetWeightSize() const;
 
   std::string GetName() const;
   uint32_t GetVersion() const;
@@ -51,6 +53,10 @@ class GE_FUNC_DEV_VISIBILITY GE_FUNC_HOST_VISIBILITY GeModel : public AttrHolder
   void SetModelTaskDef(const std::shared_ptr<domi::ModelTaskDef> &task);
   void SetTBEKernelStore(const TBEKernelStore &tbe_kernal_store);
   void SetWeight(const Buffer &weights_buffer);
+  // Reference weights in place instead of owning a copy, the caller keeps them alive while the model is loaded
+  void SetWeightDataAddr(const uint8_t *data, size_t size);
+  // Drop weights referenced in place once they are no longer needed, owned weights are kept
+  void ReleaseWeightDataAddr();
 
   void SetName(const std::string &name);
   void SetVersion(uint32_t version);
@@ -80,6 +86,8 @@ class GE_FUNC_DEV_VISIBILITY GE_FUNC_HOST_VISIBILITY GeModel : public AttrHolder
   std::shared_ptr<domi::ModelTaskDef> task_;
   TBEKernelStore tbe_kernal_store_;
   Buffer weights_buffer_;
+  const uint8_t *weights_data_addr_ = nullptr;
+  size_t weights_data_size_ = 0;
 
   std::string name_;
   uint32_t version_ = {0};
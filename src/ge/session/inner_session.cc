@@ -31,8 +31,6 @@
 #include "runtime/mem.h"
 
 namespace ge {
-static std::mutex mutex_;  // BuildGraph and RunGraph use
-
 InnerSession::InnerSession(uint64_t session_id, const std::map<string, string> &options)
     : init_flag_(false), session_id_(session_id), options_(options) {}
 
@@ -41,6 +39,7 @@ Status InnerSession::Initialize() {
     GELOGW("[InnerSession:%lu] session already initialize.", session_id_);
     return SUCCESS;
   }
+  domi::OmgContextScope omg_context_scope(&graph_manager_.GetOmgContext());
   UpdateThreadContext();
 
   GE_CHK_RT_RET(rtSetDevice(GetContext().DeviceId()));
@@ -68,6 +67,7 @@ Status InnerSession::Finalize() {
     GELOGW("[InnerSession:%lu] session does not initialize.", session_id_);
     return SUCCESS;
   }
+  domi::OmgContextScope omg_context_scope(&graph_manager_.GetOmgContext());
   UpdateThreadContext();
   Status ret = graph_manager_.Finalize();
   if (ret != SUCCESS) {
@@ -86,6 +86,7 @@ Status InnerSession::Finalize() {
 }
 
 Status InnerSession::GetVariable(const std::string &name, Tensor &val) {
+  domi::OmgContextScope omg_context_scope(&graph_manager_.GetOmgContext());
   UpdateThreadContext();
   return graph_manager_.GetVariable(name, val);
 }
@@ -96,6 +97,7 @@ Status InnerSession::AddGraph(uint32_t graph_id, const Graph &graph) {
     GELOGE(GE_SESS_INIT_FAILED, "[InnerSession:%lu] initialize failed.", session_id_);
     return GE_SESS_INIT_FAILED;
   }
+  domi::OmgContextScope omg_context_scope(&graph_manager_.GetOmgContext());
   UpdateThreadContext();
   Status ret = graph_manager_.AddGraph(graph_id, graph);
   if (ret != SUCCESS) {
@@ -109,12 +111,13 @@ Status InnerSession::AddGraph(uint32_t graph_id, const Graph &graph) {
 
 Status InnerSession::RunGraph(uint32_t graph_id, const std::vector<Tensor> &inputs, std::vector<Tensor> &outputs) {
   GELOGI("[InnerSession:%lu] run graph on session, graph_id=%u.", session_id_, graph_id);
-  if (mutex_.try_lock()) {
-    std::lock_guard<std::mutex> lock(mutex_, std::adopt_lock);
+  if (run_mutex_.try_lock()) {
+    std::lock_guard<std::mutex> lock(run_mutex_, std::adopt_lock);
     if (!init_flag_) {
       GELOGE(GE_SESS_INIT_FAILED, "[InnerSession:%lu] initialize failed.", session_id_);
       return GE_SESS_INIT_FAILED;
     }
+    domi::OmgContextScope omg_context_scope(&graph_manager_.GetOmgContext());
     UpdateThreadContext();
     vector<GeTensor> geInputs;
     for (auto &item : inputs) {
@@ -147,6 +150,7 @@ Status InnerSession::RemoveGraph(uint32_t graph_id) {
     GELOGE(GE_SESS_INIT_FAILED, "[InnerSession:%lu] initialize failed.", session_id_);
     return GE_SESS_INIT_FAILED;
   }
+  domi::OmgContextScope omg_context_scope(&graph_manager_.GetOmgContext());
   UpdateThreadContext();
   Status ret = graph_manager_.RemoveGraph(graph_id);
   if (ret != SUCCESS) {
@@ -166,6 +170,7 @@ Status InnerSession::RegisterCallBackFunc(
     GELOGE(GE_SESS_INIT_FAILED, "[InnerSession:%lu] initialize failed.", session_id_);
     return GE_SESS_INIT_FAILED;
   }
+  domi::OmgContextScope omg_context_scope(&graph_manager_.GetOmgContext());
   UpdateThreadContext();
   Status ret = graph_manager_.RegisterCallBackFunc(key, callback);
   if (ret != SUCCESS) {
@@ -179,6 +184,7 @@ Status InnerSession::RegisterCallBackFunc(
 
 Status InnerSession::RunGraphAsync(uint32_t graph_id, const std::vector<TensorInfo> &inputs,
                                    std::vector<TensorInfo> &outputs, std::function<void(Status)> callback) {
+  domi::OmgContextScope omg_context_scope(&graph_manager_.GetOmgContext());
   UpdateThreadContext();
   GELOGI("[InnerSession:%lu] run graph on session, graph_id=%u.", session_id_, graph_id);
   Status ret = graph_manager_.RunGraphAsync(graph_id, inputs, outputs, session_id_, callback);
@@ -197,6 +203,7 @@ void InnerSession::UpdateThreadContext() {
   GetThreadLocalContext().SetSessionOption(options_);
 }
 bool InnerSession::IsGraphNeedRebuild(uint32_t graph_id) {
+  domi::OmgContextScope omg_context_scope(&graph_manager_.GetOmgContext());
   UpdateThreadContext();
   return graph_manager_.IsGraphNeedRebuild(graph_id);
 }
@@ -61,6 +61,7 @@ class InnerSession {
   std::map<string, string> options_;
   GraphManager graph_manager_;
   std::mutex resource_mutex_;  // AddGraph, RemoveGraph and Finalize use
+  std::mutex run_mutex_;       // RunGraph use, other sessions run concurrently
   void UpdateThreadContext();
 };
 }  // namespace ge
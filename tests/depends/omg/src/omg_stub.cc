@@ -431,9 +431,17 @@ struct OmgContext {
 }  // namespace ge
 
 namespace domi {
+thread_local ge::OmgContext *thread_context = nullptr;
+
 ge::OmgContext &GetContext() {
   static ge::OmgContext tmp;
-  return tmp;
+  return (thread_context != nullptr) ? *thread_context : tmp;
+}
+
+ge::OmgContext *SetThreadContext(ge::OmgContext *context) {
+  ge::OmgContext *prev_context = thread_context;
+  thread_context = context;
+  return prev_context;
 }
 }  // namespace domi
 
@@ -17,80 +17,277 @@
 #include <cce/dnn.h>
 #include <securec.h>
 
+#include <algorithm>
+#include <chrono>
+#include <mutex>
+
+#include "runtime_stub.h"
+
 #define EVENT_LENTH 10
 
-rtError_t rtCtxSetCurrent(rtContext_t ctx) { return RT_ERROR_NONE; }
+namespace {
+class RuntimeRecorder {
+ public:
+  static RuntimeRecorder &Instance() {
+    // never destroyed, runtime apis are still called while other singletons are destroyed
+    static RuntimeRecorder *instance = new RuntimeRecorder();
+    return *instance;
+  }
+
+  void Record(const char *api, uint64_t bytes) {
+    uint64_t latency_ns = 0;
+    {
+      std::lock_guard<std::mutex> lock(mutex_);
+      ++call_counts_[api];
+      auto it = latencies_.find(api);
+      if (it != latencies_.end()) {
+        latency_ns = it->second.fixed_ns + it->second.ns_per_kb * bytes / 1024;
+        injected_ns_ += latency_ns;
+      }
+    }
+    if (latency_ns > 0) {
+      auto end = std::chrono::steady_clock::now() + std::chrono::nanoseconds(latency_ns);
+      while (std::chrono::steady_clock::now() < end) {
+      }
+    }
+  }
+
+  void Malloc(const void *dev_ptr, uint64_t size) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    device_mem_[dev_ptr] = size;
+    mem_in_use_ += size;
+    mem_peak_ = std::max(mem_peak_, mem_in_use_);
+  }
+
+  void MallocHost(const void *host_ptr, uint64_t size) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    host_mem_[host_ptr] = size;
+  }
+
+  void FreeHost(const void *host_ptr) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    host_mem_.erase(host_ptr);
+  }
+
+  // whether size bytes at ptr lie in one block taken by rtMalloc or rtMallocHost
+  bool IsStubMemory(const void *ptr, uint64_t size) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return InBlock(device_mem_, ptr, size) || InBlock(host_mem_, ptr, size);
+  }
+
+  void Free(const void *dev_ptr) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    auto it = device_mem_.find(dev_ptr);
+    if (it != device_mem_.end()) {
+      mem_in_use_ -= it->second;
+      device_mem_.erase(it);
+    }
+  }
+
+  void Reset() {
+    std::lock_guard<std::mutex> lock(mutex_);
+    call_counts_.clear();
+    latencies_.clear();
+    injected_ns_ = 0;
+  }
+
+  void SetLatency(const std::string &api, const runtime_stub::LatencyModel &latency) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    latencies_[api] = latency;
+  }
+
+  std::map<std::string, uint64_t> GetCallCounts() {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return call_counts_;
+  }
+
+  uint64_t GetInjectedLatency() {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return injected_ns_;
+  }
+
+  uint64_t GetDeviceMemoryInUse() {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return mem_in_use_;
+  }
+
+  uint64_t GetDeviceMemoryPeak() {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return mem_peak_;
+  }
+
+  void ResetDeviceMemoryPeak() {
+    std::lock_guard<std::mutex> lock(mutex_);
+    mem_peak_ = mem_in_use_;
+  }
+
+ private:
+  RuntimeRecorder() = default;
+
+  static bool InBlock(const std::map<const void *, uint64_t> &blocks, const void *ptr, uint64_t size) {
+    auto it = blocks.upper_bound(ptr);
+    if (it == blocks.begin()) {
+      return false;
+    }
+    --it;
+    auto offset = static_cast<uint64_t>(static_cast<const uint8_t *>(ptr) - static_cast<const uint8_t *>(it->first));
+    return (offset <= it->second) && (size <= it->second - offset);
+  }
+
+  std::mutex mutex_;
+  std::map<std::string, uint64_t> call_counts_;
+  std::map<std::string, runtime_stub::LatencyModel> latencies_;
+  std::map<const void *, uint64_t> device_mem_;
+  std::map<const void *, uint64_t> host_mem_;
+  uint64_t injected_ns_ = 0;
+  uint64_t mem_in_use_ = 0;
+  uint64_t mem_peak_ = 0;
+};
+}  // namespace
+
+#define RT_STUB_RECORD(bytes) RuntimeRecorder::Instance().Record(__func__, (bytes))
+
+namespace runtime_stub {
+void Reset() { RuntimeRecorder::Instance().Reset(); }
+
+void SetLatency(const std::string &api, const LatencyModel &latency) {
+  RuntimeRecorder::Instance().SetLatency(api, latency);
+}
+
+uint64_t GetCallCount(const std::string &api) {
+  auto call_counts = RuntimeRecorder::Instance().GetCallCounts();
+  auto it = call_counts.find(api);
+  return (it == call_counts.end()) ? 0 : it->second;
+}
+
+std::map<std::string, uint64_t> GetCallCounts() { return RuntimeRecorder::Instance().GetCallCounts(); }
+
+uint64_t GetTotalCallCount() {
+  uint64_t total = 0;
+  for (const auto &call_count : RuntimeRecorder::Instance().GetCallCounts()) {
+    total += call_count.second;
+  }
+  return total;
+}
+
+uint64_t GetInjectedLatency() { return RuntimeRecorder::Instance().GetInjectedLatency(); }
+
+uint64_t GetDeviceMemoryInUse() { return RuntimeRecorder::Instance().GetDeviceMemoryInUse(); }
+
+uint64_t GetDeviceMemoryPeak() { return RuntimeRecorder::Instance().GetDeviceMemoryPeak(); }
+
+void ResetDeviceMemoryPeak() { RuntimeRecorder::Instance().ResetDeviceMemoryPeak(); }
+}  // namespace runtime_stub
+
+rtError_t rtCtxSetCurrent(rtContext_t ctx) {
+  RT_STUB_RECORD(0);
+  return RT_ERROR_NONE;
+}
 
 rtError_t rtGetStreamId(rtStream_t stream, int32_t *stream_id) {
+  RT_STUB_RECORD(0);
   *stream_id = 0;
   return RT_ERROR_NONE;
 }
 
 rtError_t rtCtxGetCurrent(rtContext_t *ctx) {
+  RT_STUB_RECORD(0);
   int x = 1;
   *ctx = (void *)x;
   return RT_ERROR_NONE;
 }
 
-rtError_t rtCtxSetDryRun(rtContext_t ctx, rtDryRunFlag_t enable, uint32_t flag) { return RT_ERROR_NONE; }
+rtError_t rtCtxSetDryRun(rtContext_t ctx, rtDryRunFlag_t enable, uint32_t flag) {
+  RT_STUB_RECORD(0);
+  return RT_ERROR_NONE;
+}
 
 rtError_t rtEventGetTimeStamp(uint64_t *time, rtEvent_t event) {
+  RT_STUB_RECORD(0);
   *time = 12345;
   return RT_ERROR_NONE;
 }
 
 rtError_t rtEventCreate(rtEvent_t *event) {
+  RT_STUB_RECORD(0);
   *event = new int[EVENT_LENTH];
   return RT_ERROR_NONE;
 }
-rtError_t rtEventRecord(rtEvent_t event, rtStream_t stream) { return RT_ERROR_NONE; }
+rtError_t rtEventRecord(rtEvent_t event, rtStream_t stream) {
+  RT_STUB_RECORD(0);
+  return RT_ERROR_NONE;
+}
 
-rtError_t rtEventSynchronize(rtEvent_t event) { return RT_ERROR_NONE; }
+rtError_t rtEventSynchronize(rtEvent_t event) {
+  RT_STUB_RECORD(0);
+  return RT_ERROR_NONE;
+}
 
 rtError_t rtEventDestroy(rtEvent_t event) {
+  RT_STUB_RECORD(0);
   delete[](int *) event;
   return RT_ERROR_NONE;
 }
 
 rtError_t rtMalloc(void **dev_ptr, uint64_t size, rtMemType_t type) {
+  RT_STUB_RECORD(size);
   *dev_ptr = new uint8_t[size];
+  RuntimeRecorder::Instance().Malloc(*dev_ptr, size);
   return RT_ERROR_NONE;
 }
 
-rtError_t rtMemset(void *dev_ptr, uint64_t dest_max, uint32_t value, uint64_t count) { return RT_ERROR_NONE; }
+rtError_t rtMemset(void *dev_ptr, uint64_t dest_max, uint32_t value, uint64_t count) {
+  RT_STUB_RECORD(count);
+  return RT_ERROR_NONE;
+}
 
 rtError_t rtFree(void *dev_ptr) {
+  RT_STUB_RECORD(0);
+  RuntimeRecorder::Instance().Free(dev_ptr);
   delete[](uint8_t *) dev_ptr;
   return RT_ERROR_NONE;
 }
 
 rtError_t rtMallocHost(void **host_ptr, uint64_t size) {
+  RT_STUB_RECORD(size);
   *host_ptr = new uint8_t[size];
+  RuntimeRecorder::Instance().MallocHost(*host_ptr, size);
   return RT_ERROR_NONE;
 }
 
 rtError_t rtFreeHost(void *host_ptr) {
+  RT_STUB_RECORD(0);
+  RuntimeRecorder::Instance().FreeHost(host_ptr);
   delete[](uint8_t *) host_ptr;
   return RT_ERROR_NONE;
 }
 
 rtError_t rtStreamCreate(rtStream_t *stream, int32_t priority) {
+  RT_STUB_RECORD(0);
   *stream = new uint32_t;
   return RT_ERROR_NONE;
 }
 
 rtError_t rtStreamDestroy(rtStream_t stream) {
+  RT_STUB_RECORD(0);
   if (stream != nullptr) {
     delete (uint32_t *)stream;
   }
   return RT_ERROR_NONE;
 }
 
-rtError_t rtSetDevice(int32_t device) { return RT_ERROR_NONE; }
+rtError_t rtSetDevice(int32_t device) {
+  RT_STUB_RECORD(0);
+  return RT_ERROR_NONE;
+}
 
-rtError_t rtStreamSynchronize(rtStream_t stream) { return RT_ERROR_NONE; }
+rtError_t rtStreamSynchronize(rtStream_t stream) {
+  RT_STUB_RECORD(0);
+  return RT_ERROR_NONE;
+}
 
 rtError_t rtMemcpy(void *dst, uint64_t dest_max, const void *src, uint64_t count, rtMemcpyKind_t kind) {
+  RT_STUB_RECORD(count);
 #ifdef OTQT_UT
   if (dest_max == 12 && count == 12) {  // UTEST_kernelinfo_manager.all_success special treatment
     memcpy_s(dst, dest_max, src, count);
@@ -100,51 +297,96 @@ rtError_t rtMemcpy(void *dst, uint64_t dest_max, const void *src, uint64_t count
 }
 rtError_t rtMemcpyAsync(void *dst, uint64_t dest_max, const void *src, uint64_t count, rtMemcpyKind_t kind,
                         rtStream_t stream) {
+  RT_STUB_RECORD(count);
+  // streams are not simulated, copies between memory of the stub are done at once
+  if ((count > 0) && (count <= dest_max) && RuntimeRecorder::Instance().IsStubMemory(dst, count) &&
+      RuntimeRecorder::Instance().IsStubMemory(src, count)) {
+    (void)memcpy_s(dst, dest_max, src, count);
+  }
   return RT_ERROR_NONE;
 }
 
-rtError_t rtStreamWaitEvent(rtStream_t stream, rtEvent_t event) { return RT_ERROR_NONE; }
+rtError_t rtStreamWaitEvent(rtStream_t stream, rtEvent_t event) {
+  RT_STUB_RECORD(0);
+  return RT_ERROR_NONE;
+}
 
 rtError_t rtGetDeviceCount(int32_t *count) {
+  RT_STUB_RECORD(0);
   *count = 1;
   return RT_ERROR_NONE;
 }
 
-rtError_t rtDeviceReset(int32_t device) { return RT_ERROR_NONE; }
+rtError_t rtDeviceReset(int32_t device) {
+  RT_STUB_RECORD(0);
+  return RT_ERROR_NONE;
+}
 
 rtError_t rtEventElapsedTime(float *time, rtEvent_t start, rtEvent_t end) {
+  RT_STUB_RECORD(0);
   *time = 10.0f;
   return RT_ERROR_NONE;
 }
 rtError_t rtFunctionRegister(void *bin_handle, const void *stub_func, const char *stub_name, const void *dev_func) {
+  RT_STUB_RECORD(0);
   return RT_ERROR_NONE;
 }
 
 rtError_t rtFunctionRegister(void *bin_handle, const void *stub_func, const char *stub_name, const void *dev_func,
                              uint32_t func_mode) {
+  RT_STUB_RECORD(0);
   return RT_ERROR_NONE;
 }
 
-rtError_t rtDevBinaryRegister(const rtDevBinary_t *bin, void **handle) { return RT_ERROR_NONE; }
+rtError_t rtDevBinaryRegister(const rtDevBinary_t *bin, void **handle) {
+  RT_STUB_RECORD(0);
+  return RT_ERROR_NONE;
+}
 
-rtError_t rtKernelConfigTransArg(const void *ptr, uint64_t size, uint32_t flag, void **arg) { return RT_ERROR_NONE; }
+rtError_t rtKernelConfigTransArg(const void *ptr, uint64_t size, uint32_t flag, void **arg) {
+  RT_STUB_RECORD(0);
+  return RT_ERROR_NONE;
+}
 
 rtError_t rtKernelLaunch(const void *stub_func, uint32_t block_dim, void *args, uint32_t args_size, rtSmDesc_t *sm_desc,
                          rtStream_t stream) {
+  RT_STUB_RECORD(0);
+  return RT_ERROR_NONE;
+}
+rtError_t rtSetupArgument(const void *arg, uint32_t size, uint32_t offset) {
+  RT_STUB_RECORD(0);
+  return RT_ERROR_NONE;
+}
+rtError_t rtLaunch(const void *stub_func) {
+  RT_STUB_RECORD(0);
+  return RT_ERROR_NONE;
+}
+rtError_t rtDevBinaryUnRegister(void *handle) {
+  RT_STUB_RECORD(0);
+  return RT_ERROR_NONE;
+}
+rtError_t rtConfigureCall(uint32_t num_blocks, rtSmDesc_t *sm_desc, rtStream_t stream) {
+  RT_STUB_RECORD(0);
   return RT_ERROR_NONE;
 }
-rtError_t rtSetupArgument(const void *arg, uint32_t size, uint32_t offset) { return RT_ERROR_NONE; }
-rtError_t rtLaunch(const void *stub_func) { return RT_ERROR_NONE; }
-rtError_t rtDevBinaryUnRegister(void *handle) { return RT_ERROR_NONE; }
-rtError_t rtConfigureCall(uint32_t num_blocks, rtSmDesc_t *sm_desc, rtStream_t stream) { return RT_ERROR_NONE; }
 
-rtError_t rtSetProfDir(char *prof_dir) { return RT_ERROR_NONE; }
+rtError_t rtSetProfDir(char *prof_dir) {
+  RT_STUB_RECORD(0);
+  return RT_ERROR_NONE;
+}
 
-rtError_t rtSetProfDirEx(char *prof_dir, char *address, char *job_ctx) { return RT_ERROR_NONE; }
+rtError_t rtSetProfDirEx(char *prof_dir, char *address, char *job_ctx) {
+  RT_STUB_RECORD(0);
+  return RT_ERROR_NONE;
+}
 
-rtError_t rtAiCoreMemorySizes(rtAiCoreMemorySize_t *aicore_memory_size) { return RT_ERROR_NONE; }
+rtError_t rtAiCoreMemorySizes(rtAiCoreMemorySize_t *aicore_memory_size) {
+  RT_STUB_RECORD(0);
+  return RT_ERROR_NONE;
+}
 
 rtError_t rtSetKernelReportCallback(rtKernelReportCallback callback) {
+  RT_STUB_RECORD(0);
   rtKernelInfo rt_kernel_info = {0};
   rt_kernel_info.arg_size = 12;
   rt_kernel_info.task_offset = 100;
@@ -157,131 +399,251 @@ rtError_t rtSetKernelReportCallback(rtKernelReportCallback callback) {
   return RT_ERROR_NONE;
 }
 
-rtError_t rtMemAdvise(void *ptr, uint64_t size, uint32_t advise) { return RT_ERROR_NONE; }
+rtError_t rtMemAdvise(void *ptr, uint64_t size, uint32_t advise) {
+  RT_STUB_RECORD(0);
+  return RT_ERROR_NONE;
+}
 
 /// @ingroup rt_kernel
 /// @brief start fusion kernels.
 /// @param [in] stream   stream for fusion kernels
 /// @return RT_ERROR_NONE for ok, errno for failed
-rtError_t rtKernelFusionStart(rtStream_t stream) { return RT_ERROR_NONE; }
+rtError_t rtKernelFusionStart(rtStream_t stream) {
+  RT_STUB_RECORD(0);
+  return RT_ERROR_NONE;
+}
 
 /// @ingroup rt_kernel
 /// @brief end fusion kernels.
 /// @param [in] stream   stream for fusion kernels
 /// @return RT_ERROR_NONE for ok, errno for failed
-rtError_t rtKernelFusionEnd(rtStream_t stream) { return RT_ERROR_NONE; }
+rtError_t rtKernelFusionEnd(rtStream_t stream) {
+  RT_STUB_RECORD(0);
+  return RT_ERROR_NONE;
+}
 rtError_t rtMemGetInfo(size_t *free, size_t *total) {
+  RT_STUB_RECORD(0);
   *free = 512UL * 1024UL * 1024UL;
   *total = 1024UL * 1024UL * 1024UL;
   return RT_ERROR_NONE;
 }
 
-rtError_t rtMemAllocManaged(void **ptr, uint64_t size, uint32_t flag) { return RT_ERROR_NONE; }
+rtError_t rtMemAllocManaged(void **ptr, uint64_t size, uint32_t flag) {
+  RT_STUB_RECORD(0);
+  return RT_ERROR_NONE;
+}
 
-rtError_t rtMemFreeManaged(void *ptr) { return RT_ERROR_NONE; }
+rtError_t rtMemFreeManaged(void *ptr) {
+  RT_STUB_RECORD(0);
+  return RT_ERROR_NONE;
+}
 
-rtError_t rtMetadataRegister(void *handle, const char *meta_data) { return RT_ERROR_NONE; }
-rtError_t rtSetTaskGenCallback(rtTaskGenCallback callback) { return RT_ERROR_NONE; }
+rtError_t rtMetadataRegister(void *handle, const char *meta_data) {
+  RT_STUB_RECORD(0);
+  return RT_ERROR_NONE;
+}
+rtError_t rtSetTaskGenCallback(rtTaskGenCallback callback) {
+  RT_STUB_RECORD(0);
+  return RT_ERROR_NONE;
+}
 
 rtError_t rtModelCreate(rtModel_t *model, uint32_t flag) {
+  RT_STUB_RECORD(0);
   *model = new uint32_t;
   return RT_ERROR_NONE;
 }
 
 rtError_t rtModelDestroy(rtModel_t model) {
+  RT_STUB_RECORD(0);
   delete model;
   return RT_ERROR_NONE;
 }
 
-rtError_t rtModelBindStream(rtModel_t model, rtStream_t stream, uint32_t flag) { return RT_ERROR_NONE; }
-rtError_t rtModelUnbindStream(rtModel_t model, rtStream_t stream) { return RT_ERROR_NONE; }
-rtError_t rtModelExecute(rtModel_t model, rtStream_t stream, uint32_t flag) { return RT_ERROR_NONE; }
+rtError_t rtModelBindStream(rtModel_t model, rtStream_t stream, uint32_t flag) {
+  RT_STUB_RECORD(0);
+  return RT_ERROR_NONE;
+}
+rtError_t rtModelUnbindStream(rtModel_t model, rtStream_t stream) {
+  RT_STUB_RECORD(0);
+  return RT_ERROR_NONE;
+}
+rtError_t rtModelExecute(rtModel_t model, rtStream_t stream, uint32_t flag) {
+  RT_STUB_RECORD(0);
+  return RT_ERROR_NONE;
+}
 
 rtError_t rtGetFunctionByName(const char *stub_name, void **stub_func) {
+  RT_STUB_RECORD(0);
   *(char **)stub_func = "func";
   return RT_ERROR_NONE;
 }
 
-rtError_t rtQueryFunctionRegistered(const char *stub_name) { return RT_ERROR_NONE; }
+rtError_t rtQueryFunctionRegistered(const char *stub_name) {
+  RT_STUB_RECORD(0);
+  return RT_ERROR_NONE;
+}
 
-rtError_t rtCtxCreate(rtContext_t *ctx, uint32_t flags, int32_t device) { return RT_ERROR_NONE; }
+rtError_t rtCtxCreate(rtContext_t *ctx, uint32_t flags, int32_t device) {
+  RT_STUB_RECORD(0);
+  return RT_ERROR_NONE;
+}
 
-rtError_t rtKernelLaunchEx(void *args, uint32_t args_size, uint32_t flags, rtStream_t stream_) { return RT_ERROR_NONE; }
+rtError_t rtKernelLaunchEx(void *args, uint32_t args_size, uint32_t flags, rtStream_t stream_) {
+  RT_STUB_RECORD(0);
+  return RT_ERROR_NONE;
+}
 
 rtError_t rtCpuKernelLaunch(const void *so_name, const void *kernel_name, uint32_t block_dim, const void *args,
                             uint32_t args_size, rtSmDesc_t *sm_desc, rtStream_t stream) {
+  RT_STUB_RECORD(0);
   return RT_ERROR_NONE;
 }
 
 rtError_t rtModelGetTaskId(void *handle, uint32_t *task_id) {
+  RT_STUB_RECORD(0);
   *task_id = 0;
   return RT_ERROR_NONE;
 }
-rtError_t rtEndGraph(rtModel_t model, rtStream_t stream) { return RT_ERROR_NONE; }
-rtError_t rtProfilerStop(void) { return RT_ERROR_NONE; }
+rtError_t rtEndGraph(rtModel_t model, rtStream_t stream) {
+  RT_STUB_RECORD(0);
+  return RT_ERROR_NONE;
+}
+rtError_t rtProfilerStop(void) {
+  RT_STUB_RECORD(0);
+  return RT_ERROR_NONE;
+}
 
-rtError_t rtSetDvfsProfile(DvfsProfileMode mode) { return RT_ERROR_NONE; }
+rtError_t rtSetDvfsProfile(DvfsProfileMode mode) {
+  RT_STUB_RECORD(0);
+  return RT_ERROR_NONE;
+}
 
-rtError_t rtUnsetDvfsProfile() { return RT_ERROR_NONE; }
+rtError_t rtUnsetDvfsProfile() {
+  RT_STUB_RECORD(0);
+  return RT_ERROR_NONE;
+}
 
-rtError_t rtGetDvfsProfile(DvfsProfileMode *pmode) { return RT_ERROR_NONE; }
+rtError_t rtGetDvfsProfile(DvfsProfileMode *pmode) {
+  RT_STUB_RECORD(0);
+  return RT_ERROR_NONE;
+}
 
-rtError_t rtCtxDestroy(rtContext_t ctx) { return RT_ERROR_NONE; }
+rtError_t rtCtxDestroy(rtContext_t ctx) {
+  RT_STUB_RECORD(0);
+  return RT_ERROR_NONE;
+}
 
-rtError_t rtProfilerInit(const char *prof_dir, const char *address, const char *job_ctx) { return RT_ERROR_NONE; }
+rtError_t rtProfilerInit(const char *prof_dir, const char *address, const char *job_ctx) {
+  RT_STUB_RECORD(0);
+  return RT_ERROR_NONE;
+}
 
-rtError_t rtProfilerStart(void) { return RT_ERROR_NONE; }
+rtError_t rtProfilerStart(void) {
+  RT_STUB_RECORD(0);
+  return RT_ERROR_NONE;
+}
 
-rtError_t rtLabelCreate(rtLabel_t *label) { return RT_ERROR_NONE; }
+rtError_t rtLabelCreate(rtLabel_t *label) {
+  RT_STUB_RECORD(0);
+  return RT_ERROR_NONE;
+}
 
-rtError_t rtLabelDestroy(rtLabel_t label) { return RT_ERROR_NONE; }
+rtError_t rtLabelDestroy(rtLabel_t label) {
+  RT_STUB_RECORD(0);
+  return RT_ERROR_NONE;
+}
 
-rtError_t rtLabelSet(rtLabel_t label, rtStream_t stream) { return RT_ERROR_NONE; }
+rtError_t rtLabelSet(rtLabel_t label, rtStream_t stream) {
+  RT_STUB_RECORD(0);
+  return RT_ERROR_NONE;
+}
 
 rtError_t rtLabelSwitch(void *ptr, rtCondition_t condition, uint32_t value, rtLabel_t true_label, rtStream_t stream) {
+  RT_STUB_RECORD(0);
   return RT_ERROR_NONE;
 }
 
-rtError_t rtLabelGoto(rtLabel_t label, rtStream_t stream) { return RT_ERROR_NONE; }
+rtError_t rtLabelGoto(rtLabel_t label, rtStream_t stream) {
+  RT_STUB_RECORD(0);
+  return RT_ERROR_NONE;
+}
 
-rtError_t rtInvalidCache(uint64_t base, uint32_t len) { return RT_ERROR_NONE; }
+rtError_t rtInvalidCache(uint64_t base, uint32_t len) {
+  RT_STUB_RECORD(0);
+  return RT_ERROR_NONE;
+}
 
-rtError_t rtModelLoadComplete(rtModel_t model) { return RT_ERROR_NONE; }
+rtError_t rtModelLoadComplete(rtModel_t model) {
+  RT_STUB_RECORD(0);
+  return RT_ERROR_NONE;
+}
 
 rtError_t rtStreamCreateWithFlags(rtStream_t *stream, int32_t priority, uint32_t flags) {
+  RT_STUB_RECORD(0);
   *stream = new uint32_t;
   return RT_ERROR_NONE;
 }
 
-rtError_t rtFlushCache(uint64_t base, uint32_t len) { return RT_ERROR_NONE; }
+rtError_t rtFlushCache(uint64_t base, uint32_t len) {
+  RT_STUB_RECORD(0);
+  return RT_ERROR_NONE;
+}
 
-rtError_t rtProfilerTrace(uint64_t id, bool notify, uint32_t flags, rtStream_t stream_) { return RT_ERROR_NONE; }
+rtError_t rtProfilerTrace(uint64_t id, bool notify, uint32_t flags, rtStream_t stream_) {
+  RT_STUB_RECORD(0);
+  return RT_ERROR_NONE;
+}
 
-rtError_t rtMemSetRC(const void *dev_ptr, uint64_t size, uint32_t read_count) { return RT_ERROR_NONE; }
+rtError_t rtMemSetRC(const void *dev_ptr, uint64_t size, uint32_t read_count) {
+  RT_STUB_RECORD(0);
+  return RT_ERROR_NONE;
+}
 
 rtError_t rtStreamSwitch(void *ptr, rtCondition_t condition, int64_t value, rtStream_t true_stream, rtStream_t stream) {
+  RT_STUB_RECORD(0);
   return RT_ERROR_NONE;
 }
 
 rtError_t rtStreamSwitchEx(void *ptr, rtCondition_t condition, void *value_ptr, rtStream_t true_stream,
                            rtStream_t stream, rtSwitchDataType_t data_type) {
+  RT_STUB_RECORD(0);
   return RT_ERROR_NONE;
 }
 
-rtError_t rtStreamActive(rtStream_t active_stream, rtStream_t stream) { return RT_ERROR_NONE; }
+rtError_t rtStreamActive(rtStream_t active_stream, rtStream_t stream) {
+  RT_STUB_RECORD(0);
+  return RT_ERROR_NONE;
+}
 
-rtError_t rtEventReset(rtEvent_t event, rtStream_t stream) { return RT_ERROR_NONE; }
+rtError_t rtEventReset(rtEvent_t event, rtStream_t stream) {
+  RT_STUB_RECORD(0);
+  return RT_ERROR_NONE;
+}
 
-rtError_t rtGetDevice(int32_t *device) { return RT_ERROR_NONE; }
+rtError_t rtGetDevice(int32_t *device) {
+  RT_STUB_RECORD(0);
+  return RT_ERROR_NONE;
+}
 
-rtError_t rtDatadumpInfoLoad(const void *dump_info, uint32_t length) { return RT_ERROR_NONE; }
+rtError_t rtGetDeviceIndexByPhyId(uint32_t phy_id, uint32_t *dev_index) {
+  RT_STUB_RECORD(0);
+  *dev_index = phy_id;
+  return RT_ERROR_NONE;
+}
+
+rtError_t rtDatadumpInfoLoad(const void *dump_info, uint32_t length) {
+  RT_STUB_RECORD(0);
+  return RT_ERROR_NONE;
+}
 
 rtError_t rtKernelLaunchWithFlag(const void *stub_func, uint32_t block_dim, void *args, uint32_t args_size,
                                  rtSmDesc_t *sm_desc, rtStream_t stream_, uint32_t flags) {
+  RT_STUB_RECORD(0);
   return RT_ERROR_NONE;
 }
 
 rtError_t rtCpuKernelLaunchWithFlag(const void *so_name, const void *kernel_name, uint32_t core_dim, const void *args,
                                     uint32_t args_size, rtL2Ctrl_t *l2ctrl, rtStream_t stream_, uint32_t flags) {
+  RT_STUB_RECORD(0);
   return RT_ERROR_NONE;
 }
\ No newline at end of file
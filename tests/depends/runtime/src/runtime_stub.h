@@ -0,0 +1,84 @@
+/**
+ * Copyright 2019-2020 Huawei Technologies Co., Ltd
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef TESTS_DEPENDS_RUNTIME_SRC_RUNTIME_STUB_H_
+#define TESTS_DEPENDS_RUNTIME_SRC_RUNTIME_STUB_H_
+
+#include <cstdint>
+#include <map>
+#include <string>
+
+///
+/// Control interface of the simulated runtime. Every rt* api of the stub is counted by name,
+/// device memory taken by rtMalloc is tracked until rtFree, and an api can be given a latency
+/// which the stub spins for before returning, so host side overhead can be measured without hardware.
+/// rtMemcpyAsync copies at once when both buffers were taken by rtMalloc or rtMallocHost.
+///
+namespace runtime_stub {
+struct LatencyModel {
+  // latency of every call
+  uint64_t fixed_ns = 0;
+  // extra latency for every KB moved or allocated by apis taking a size
+  uint64_t ns_per_kb = 0;
+};
+
+///
+/// clear call counts, latency models and injected time, memory still allocated is kept.
+///
+void Reset();
+
+///
+/// set the latency model of one api, e.g. "rtModelExecute".
+///
+void SetLatency(const std::string &api, const LatencyModel &latency);
+
+///
+/// number of calls of one api since last Reset.
+///
+uint64_t GetCallCount(const std::string &api);
+
+///
+/// api name to number of calls since last Reset, apis not called are not in it.
+///
+std::map<std::string, uint64_t> GetCallCounts();
+
+///
+/// number of calls of all apis since last Reset.
+///
+uint64_t GetTotalCallCount();
+
+///
+/// total latency injected since last Reset, in ns.
+///
+uint64_t GetInjectedLatency();
+
+///
+/// bytes of device memory taken by rtMalloc and not freed yet.
+///
+uint64_t GetDeviceMemoryInUse();
+
+///
+/// high-water mark of device memory in use, since last ResetDeviceMemoryPeak.
+///
+uint64_t GetDeviceMemoryPeak();
+
+///
+/// restart the high-water mark from memory in use now.
+///
+void ResetDeviceMemoryPeak();
+}  // namespace runtime_stub
+
+#endif  // TESTS_DEPENDS_RUNTIME_SRC_RUNTIME_STUB_H_
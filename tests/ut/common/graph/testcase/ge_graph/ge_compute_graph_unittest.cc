@@ -0,0 +1,297 @@
+/**
+ * Copyright 2019-2020 Huawei Technologies Co., Ltd
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <gtest/gtest.h>
+#include <string>
+#include <vector>
+
+#include "graph/compute_graph.h"
+#include "graph/utils/graph_utils.h"
+
+using namespace std;
+using namespace ge;
+
+class UtestGeComputeGraph : public testing::Test {
+ protected:
+  void SetUp() {}
+
+  void TearDown() {}
+};
+
+namespace {
+ComputeGraphPtr CreateGraphWithNodes(const string &name, size_t node_num, vector<NodePtr> &nodes) {
+  ComputeGraphPtr graph = std::make_shared<ComputeGraph>(name);
+  for (size_t i = 0; i < node_num; ++i) {
+    OpDescPtr op_desc = std::make_shared<OpDesc>("node_" + std::to_string(i), "Relu");
+    nodes.push_back(graph->AddNode(op_desc));
+  }
+  return graph;
+}
+
+vector<NodePtr> GetDirectNodes(const ComputeGraphPtr &graph) {
+  auto direct_nodes = graph->GetDirectNode();
+  return vector<NodePtr>(direct_nodes.begin(), direct_nodes.end());
+}
+
+vector<string> GetDirectNodeNames(const ComputeGraphPtr &graph) {
+  vector<string> names;
+  for (const auto &node : graph->GetDirectNode()) {
+    names.push_back(node->GetName());
+  }
+  return names;
+}
+
+void CheckLargeNodeList(size_t node_num) {
+  vector<NodePtr> nodes;
+  ComputeGraphPtr graph = CreateGraphWithNodes("large", node_num, nodes);
+  for (size_t i = 0; i < node_num; ++i) {
+    EXPECT_EQ(graph->FindNode("node_" + std::to_string(i)), nodes[i]);
+  }
+  // Remove every other node from the middle out, the worst case for a vector
+  for (size_t i = 0; i < node_num; i += 2) {
+    EXPECT_EQ(graph->RemoveNode(nodes[(i + node_num / 2) % node_num]), GRAPH_SUCCESS);
+  }
+  EXPECT_EQ(graph->GetDirectNodesSize(), node_num - (node_num + 1) / 2);
+  size_t found_num = 0;
+  for (size_t i = 0; i < node_num; ++i) {
+    found_num += (graph->FindNode("node_" + std::to_string(i)) != nullptr) ? 1 : 0;
+  }
+  EXPECT_EQ(found_num, graph->GetDirectNodesSize());
+}
+
+NodePtr AddNodeWithAnchors(const ComputeGraphPtr &graph, const string &name, const string &type, size_t in_num,
+                           size_t out_num) {
+  OpDescPtr op_desc = std::make_shared<OpDesc>(name, type);
+  for (size_t i = 0; i < in_num; ++i) {
+    op_desc->AddInputDesc(GeTensorDesc());
+  }
+  for (size_t i = 0; i < out_num; ++i) {
+    op_desc->AddOutputDesc(GeTensorDesc());
+  }
+  return graph->AddNode(op_desc);
+}
+
+vector<uint32_t> ToVector(const CompactGraph::IdRange &ids) { return vector<uint32_t>(ids.begin(), ids.end()); }
+}  // namespace
+
+TEST_F(UtestGeComputeGraph, find_and_remove_keep_order) {
+  vector<NodePtr> nodes;
+  ComputeGraphPtr graph = CreateGraphWithNodes("graph", 5, nodes);
+  EXPECT_EQ(graph->FindNode("node_3"), nodes[3]);
+  EXPECT_EQ(graph->FindNode("not_exist"), nullptr);
+
+  EXPECT_EQ(graph->RemoveNode(nodes[1]), GRAPH_SUCCESS);
+  EXPECT_EQ(graph->RemoveNode(nodes[1]), GRAPH_FAILED);
+  EXPECT_EQ(graph->FindNode("node_1"), nullptr);
+  EXPECT_EQ(GraphUtils::RemoveJustNode(graph, nodes[3]), GRAPH_SUCCESS);
+  EXPECT_EQ(graph->FindNode("node_3"), nullptr);
+  EXPECT_EQ(GetDirectNodeNames(graph), vector<string>({"node_0", "node_2", "node_4"}));
+
+  OpDescPtr data_desc = std::make_shared<OpDesc>("data", "Data");
+  OpDescPtr front_desc = std::make_shared<OpDesc>("front", "Relu");
+  graph->AddNodeFront(data_desc);
+  graph->AddNodeFront(front_desc);
+  EXPECT_EQ(GetDirectNodeNames(graph), vector<string>({"data", "front", "node_0", "node_2", "node_4"}));
+  EXPECT_EQ(graph->FindNode("front")->GetOpDesc(), front_desc);
+}
+
+TEST_F(UtestGeComputeGraph, find_renamed_and_duplicate_name) {
+  vector<NodePtr> nodes;
+  ComputeGraphPtr graph = CreateGraphWithNodes("graph", 3, nodes);
+  EXPECT_EQ(graph->RenameNode(nodes[0], "renamed"), GRAPH_SUCCESS);
+  EXPECT_EQ(nodes[0]->GetName(), "renamed");
+  EXPECT_EQ(graph->FindNode("renamed"), nodes[0]);
+  EXPECT_EQ(graph->FindNode("node_0"), nullptr);
+
+  // Renamed behind the graph's back, found by its new name only
+  nodes[2]->GetOpDesc()->SetName("silent");
+  EXPECT_EQ(graph->FindNode("node_2"), nullptr);
+  EXPECT_EQ(graph->FindNode("silent"), nodes[2]);
+  EXPECT_EQ(graph->FindNode("silent"), nodes[2]);
+  nodes[2]->GetOpDesc()->SetName("node_2");
+  EXPECT_EQ(graph->FindNode("silent"), nullptr);
+  EXPECT_EQ(graph->FindNode("node_2"), nodes[2]);
+  EXPECT_EQ(graph->RemoveNode(nodes[2]), GRAPH_SUCCESS);
+  EXPECT_EQ(graph->FindNode("node_2"), nullptr);
+
+  OpDescPtr dup_desc = std::make_shared<OpDesc>("node_1", "Relu");
+  NodePtr dup_node = graph->AddNode(dup_desc);
+  EXPECT_EQ(graph->FindNode("node_1"), nodes[1]);
+  EXPECT_EQ(graph->RemoveNode(nodes[1]), GRAPH_SUCCESS);
+  EXPECT_EQ(graph->FindNode("node_1"), dup_node);
+  EXPECT_EQ(graph->RenameNode(nodes[1], "removed"), GRAPH_FAILED);
+}
+
+TEST_F(UtestGeComputeGraph, assign_rebuilds_node_index) {
+  vector<NodePtr> nodes;
+  ComputeGraphPtr src_graph = CreateGraphWithNodes("src", 3, nodes);
+  ComputeGraphPtr dst_graph = std::make_shared<ComputeGraph>("dst");
+  *dst_graph = *src_graph;
+  EXPECT_EQ(dst_graph->FindNode("node_1"), nodes[1]);
+
+  // The copy owns its own list positions, removing from it leaves the source alone
+  EXPECT_EQ(dst_graph->RemoveNode(nodes[1]), GRAPH_SUCCESS);
+  EXPECT_EQ(dst_graph->FindNode("node_1"), nullptr);
+  EXPECT_EQ(GetDirectNodeNames(dst_graph), vector<string>({"node_0", "node_2"}));
+  EXPECT_EQ(src_graph->FindNode("node_1"), nodes[1]);
+  EXPECT_EQ(GetDirectNodeNames(src_graph), vector<string>({"node_0", "node_1", "node_2"}));
+  src_graph.reset();
+  EXPECT_EQ(dst_graph->FindNode("node_2"), nodes[2]);
+  EXPECT_EQ(dst_graph->RemoveNode(nodes[2]), GRAPH_SUCCESS);
+  EXPECT_EQ(GetDirectNodeNames(dst_graph), vector<string>({"node_0"}));
+}
+
+TEST_F(UtestGeComputeGraph, removed_nodes_leave_no_holes) {
+  vector<NodePtr> nodes;
+  ComputeGraphPtr graph = CreateGraphWithNodes("graph", 8, nodes);
+  // Less than half removed, the holes stay in the vector but are never visible
+  EXPECT_EQ(graph->RemoveNode(nodes[1]), GRAPH_SUCCESS);
+  EXPECT_EQ(graph->RemoveNode(nodes[6]), GRAPH_SUCCESS);
+  EXPECT_EQ(graph->GetDirectNodesSize(), 6);
+  EXPECT_EQ(graph->GetAllNodesSize(), 6);
+  EXPECT_EQ(graph->GetAllNodes().size(), 6);
+  EXPECT_EQ(GetDirectNodeNames(graph), vector<string>({"node_0", "node_2", "node_3", "node_4", "node_5", "node_7"}));
+
+  // Appended behind the holes, inserted at the front once they are squeezed out
+  OpDescPtr back_desc = std::make_shared<OpDesc>("back", "Relu");
+  NodePtr back = graph->AddNode(back_desc);
+  EXPECT_EQ(back_desc->GetId(), 6);
+  OpDescPtr front_desc = std::make_shared<OpDesc>("front", "Relu");
+  NodePtr front = graph->AddNodeFront(front_desc);
+  EXPECT_EQ(GetDirectNodeNames(graph),
+            vector<string>({"front", "node_0", "node_2", "node_3", "node_4", "node_5", "node_7", "back"}));
+  EXPECT_EQ(graph->FindNode("back"), back);
+  EXPECT_EQ(graph->RemoveNode(back), GRAPH_SUCCESS);
+  EXPECT_EQ(graph->RemoveNode(nodes[7]), GRAPH_SUCCESS);
+  EXPECT_EQ(graph->FindNode("front"), front);
+  EXPECT_EQ(graph->FindNode("node_5"), nodes[5]);
+
+  EXPECT_EQ(graph->TopologicalSorting(), GRAPH_SUCCESS);
+  EXPECT_EQ(graph->GetDirectNodesSize(), 6);
+  EXPECT_EQ(graph->RemoveNode(nodes[0]), GRAPH_SUCCESS);
+  EXPECT_EQ(graph->RemoveNode(nodes[2]), GRAPH_SUCCESS);
+  EXPECT_EQ(graph->RemoveNode(nodes[3]), GRAPH_SUCCESS);
+  EXPECT_EQ(graph->RemoveNode(nodes[4]), GRAPH_SUCCESS);
+  EXPECT_EQ(GetDirectNodeNames(graph), vector<string>({"front", "node_5"}));
+}
+
+TEST_F(UtestGeComputeGraph, large_node_list) {
+  CheckLargeNodeList(10000);
+  CheckLargeNodeList(100000);
+}
+
+TEST_F(UtestGeComputeGraph, compact_graph_edges_and_snapshot) {
+  ComputeGraphPtr graph = std::make_shared<ComputeGraph>("graph");
+  NodePtr data = AddNodeWithAnchors(graph, "data", "Data", 0, 1);
+  NodePtr node_a = AddNodeWithAnchors(graph, "a", "Relu", 1, 2);
+  NodePtr node_b = AddNodeWithAnchors(graph, "b", "Relu", 1, 1);
+  NodePtr node_c = AddNodeWithAnchors(graph, "c", "Relu", 1, 1);
+  EXPECT_EQ(GraphUtils::AddEdge(data->GetOutDataAnchor(0), node_a->GetInDataAnchor(0)), GRAPH_SUCCESS);
+  EXPECT_EQ(GraphUtils::AddEdge(data->GetOutDataAnchor(0), node_b->GetInControlAnchor()), GRAPH_SUCCESS);
+  EXPECT_EQ(GraphUtils::AddEdge(node_a->GetOutDataAnchor(0), node_b->GetInDataAnchor(0)), GRAPH_SUCCESS);
+  EXPECT_EQ(GraphUtils::AddEdge(node_a->GetOutDataAnchor(1), node_c->GetInDataAnchor(0)), GRAPH_SUCCESS);
+  EXPECT_EQ(GraphUtils::AddEdge(node_a->GetOutControlAnchor(), node_c->GetInControlAnchor()), GRAPH_SUCCESS);
+
+  CompactGraph compact_graph(GetDirectNodes(graph));
+  EXPECT_EQ(compact_graph.GetNodesSize(), 4);
+  EXPECT_EQ(compact_graph.GetEdgesSize(), 5);
+  EXPECT_EQ(compact_graph.GetNode(1), node_a);
+  EXPECT_EQ(compact_graph.GetNodeId(node_c.get()), 3);
+  NodePtr other = AddNodeWithAnchors(std::make_shared<ComputeGraph>("other"), "other", "Relu", 0, 0);
+  EXPECT_EQ(compact_graph.GetNodeId(other.get()), CompactGraph::kInvalidNodeId);
+
+  EXPECT_EQ(ToVector(compact_graph.GetOutAllNodes(0)), vector<uint32_t>({1, 2}));
+  EXPECT_EQ(ToVector(compact_graph.GetOutDataNodes(0)), vector<uint32_t>({1}));
+  EXPECT_TRUE(compact_graph.GetOutControlNodes(0).empty());
+  EXPECT_EQ(ToVector(compact_graph.GetOutAllNodes(1)), vector<uint32_t>({2, 3, 3}));
+  EXPECT_EQ(ToVector(compact_graph.GetOutControlNodes(1)), vector<uint32_t>({3}));
+  EXPECT_EQ(ToVector(compact_graph.GetInAllNodes(2)), vector<uint32_t>({1, 0}));
+  EXPECT_EQ(ToVector(compact_graph.GetInDataNodes(2)), vector<uint32_t>({1}));
+  EXPECT_TRUE(compact_graph.GetInControlNodes(2).empty());
+  EXPECT_EQ(ToVector(compact_graph.GetInControlNodes(3)), vector<uint32_t>({1}));
+  EXPECT_TRUE(compact_graph.GetInAllNodes(0).empty());
+
+  // A snapshot stays as it was taken, a new one sees the changed edges and nodes
+  EXPECT_EQ(GraphUtils::RemoveEdge(node_a->GetOutControlAnchor(), node_c->GetInControlAnchor()), GRAPH_SUCCESS);
+  EXPECT_EQ(ToVector(compact_graph.GetOutAllNodes(1)), vector<uint32_t>({2, 3, 3}));
+  CompactGraph unlinked_graph(GetDirectNodes(graph));
+  EXPECT_EQ(ToVector(unlinked_graph.GetOutAllNodes(1)), vector<uint32_t>({2, 3}));
+
+  (void)AddNodeWithAnchors(graph, "d", "Relu", 0, 0);
+  EXPECT_EQ(graph->RemoveNode(node_c), GRAPH_SUCCESS);
+  CompactGraph removed_graph(GetDirectNodes(graph));
+  EXPECT_EQ(removed_graph.GetNodesSize(), 4);
+  EXPECT_EQ(removed_graph.GetNodeId(node_c.get()), CompactGraph::kInvalidNodeId);
+  EXPECT_EQ(removed_graph.GetEdgesSize(), 3);
+}
+
+TEST_F(UtestGeComputeGraph, topological_sorting_order) {
+  ComputeGraphPtr graph = std::make_shared<ComputeGraph>("graph");
+  NodePtr node_c = AddNodeWithAnchors(graph, "c", "Add", 2, 1);
+  NodePtr node_b = AddNodeWithAnchors(graph, "b", "Relu", 1, 1);
+  NodePtr node_a = AddNodeWithAnchors(graph, "a", "Relu", 1, 1);
+  NodePtr data = AddNodeWithAnchors(graph, "data", "Data", 0, 1);
+  NodePtr node_d = AddNodeWithAnchors(graph, "d", "Relu", 0, 1);
+  EXPECT_EQ(GraphUtils::AddEdge(data->GetOutDataAnchor(0), node_a->GetInDataAnchor(0)), GRAPH_SUCCESS);
+  EXPECT_EQ(GraphUtils::AddEdge(data->GetOutDataAnchor(0), node_b->GetInDataAnchor(0)), GRAPH_SUCCESS);
+  EXPECT_EQ(GraphUtils::AddEdge(node_a->GetOutDataAnchor(0), node_c->GetInDataAnchor(0)), GRAPH_SUCCESS);
+  EXPECT_EQ(GraphUtils::AddEdge(node_b->GetOutDataAnchor(0), node_c->GetInDataAnchor(1)), GRAPH_SUCCESS);
+  EXPECT_EQ(GraphUtils::AddEdge(node_d->GetOutControlAnchor(), node_a->GetInControlAnchor()), GRAPH_SUCCESS);
+
+  // Depth first from the data nodes, other nodes without input are taken after them
+  EXPECT_EQ(graph->TopologicalSorting(), GRAPH_SUCCESS);
+  EXPECT_EQ(GetDirectNodeNames(graph), vector<string>({"data", "b", "d", "a", "c"}));
+  EXPECT_EQ(node_c->GetOpDesc()->GetId(), 4);
+
+  // A loop leaves nodes unsorted
+  EXPECT_EQ(GraphUtils::AddEdge(node_c->GetOutControlAnchor(), node_b->GetInControlAnchor()), GRAPH_SUCCESS);
+  EXPECT_EQ(graph->TopologicalSorting(), GRAPH_FAILED);
+}
+
+TEST_F(UtestGeComputeGraph, large_compact_graph) {
+  // Every node feeds the next two nodes by data and the fifth next by control
+  const size_t kNodeNum = 100000;
+  ComputeGraphPtr graph = std::make_shared<ComputeGraph>("large");
+  vector<NodePtr> nodes;
+  for (size_t i = 0; i < kNodeNum; ++i) {
+    nodes.push_back(AddNodeWithAnchors(graph, "node_" + std::to_string(i), (i == 0) ? "Data" : "Relu", 2, 1));
+  }
+  for (size_t i = 0; i < kNodeNum; ++i) {
+    for (size_t j = 1; (j <= 2) && (i + j < kNodeNum); ++j) {
+      EXPECT_EQ(GraphUtils::AddEdge(nodes[i]->GetOutDataAnchor(0), nodes[i + j]->GetInDataAnchor(j - 1)),
+                GRAPH_SUCCESS);
+    }
+    if (i + 5 < kNodeNum) {
+      EXPECT_EQ(GraphUtils::AddEdge(nodes[i]->GetOutControlAnchor(), nodes[i + 5]->GetInControlAnchor()),
+                GRAPH_SUCCESS);
+    }
+  }
+
+  size_t node_edge_num = 0;
+  for (const auto &node : graph->GetDirectNode()) {
+    node_edge_num += node->GetOutAllNodes().size() + node->GetInAllNodes().size();
+  }
+  CompactGraph compact_graph(GetDirectNodes(graph));
+  size_t compact_edge_num = 0;
+  for (uint32_t id = 0; id < compact_graph.GetNodesSize(); ++id) {
+    compact_edge_num += compact_graph.GetOutAllNodes(id).size() + compact_graph.GetInAllNodes(id).size();
+  }
+  EXPECT_EQ(compact_edge_num, node_edge_num);
+  EXPECT_EQ(compact_graph.GetEdgesSize(), 3 * kNodeNum - 8);
+
+  EXPECT_EQ(graph->TopologicalSorting(), GRAPH_SUCCESS);
+  EXPECT_EQ(graph->GetDirectNode().at(kNodeNum - 1), nodes[kNodeNum - 1]);
+}
@@ -23,7 +23,10 @@
 #include "graph/ge_tensor.h"
 
 #include "graph/ge_attr_value.h"
+#include "graph/op_desc.h"
 #include "graph/tensor.h"
+#include "graph/utils/attr_utils.h"
+#include "graph/utils/tensor_adapter.h"
 #include "graph/utils/tensor_utils.h"
 #undef private
 #undef protected
@@ -162,14 +165,16 @@ TEST_F(UtestGeTensor, tensor) {
   EXPECT_EQ(c.MutableData().GetData()[2], uint8_t(3));
   EXPECT_EQ(c.MutableData().GetData()[3], uint8_t(4));
 
+  // The tensor takes over the storage of moved data
   GeTensor e(std::move(tensor_desc), std::move(data));
-  EXPECT_EQ(e.GetData().GetSize(), data.size());
+  EXPECT_TRUE(data.empty());
+  EXPECT_EQ(e.GetData().GetSize(), 4);
   EXPECT_EQ(e.GetData()[2], uint8_t(3));
 
   GeTensor f = e.Clone();
   e.MutableData().data()[2] = 5;
   EXPECT_EQ(e.GetData().data()[2], uint8_t(5));
-  EXPECT_EQ(f.GetData().GetSize(), data.size());
+  EXPECT_EQ(f.GetData().GetSize(), 4);
   EXPECT_EQ(f.GetData()[2], uint8_t(3));
 }
 
@@ -197,9 +202,10 @@ TEST_F(UtestGeTensor, test_shape_copy_move) {
 }
 
 TEST_F(UtestGeTensor, test_tensor_desc_invalid_null) {
+  // Without a proto message to view the desc keeps its own fields
   GeTensorDesc tensor_desc(nullptr, nullptr);
-  EXPECT_EQ(tensor_desc.GetDataType(), DT_UNDEFINED);
-  EXPECT_EQ(tensor_desc.GetFormat(), FORMAT_RESERVED);
+  EXPECT_EQ(tensor_desc.GetDataType(), DT_FLOAT);
+  EXPECT_EQ(tensor_desc.GetFormat(), FORMAT_ND);
   EXPECT_EQ(tensor_desc.MutableShape().shape_def_.GetProtoMsg(), nullptr);
 
   GeTensorDesc tensor_desc2;
@@ -222,25 +228,26 @@ TEST_F(UtestGeTensor, test_tensor_desc_invalid_null) {
   EXPECT_TRUE(TensorUtils::HasAlloffsetQuantizeInfo(tensor_desc2));
 
   TensorUtils::SetWeightSize(tensor_desc, 100);
-  EXPECT_EQ(TensorUtils::GetWeightSize(tensor_desc), 0);
+  EXPECT_EQ(TensorUtils::GetWeightSize(tensor_desc), 100);
 }
 
 TEST_F(UtestGeTensor, test_tensor_invalid_null) {
   ProtoMsgOwner msg_owner;
+  // Without a proto message to view the tensor holds its own desc and data
   GeTensor tensor(msg_owner, nullptr);
   EXPECT_EQ(tensor.GetData().size(), 0);
   EXPECT_EQ(tensor.MutableData().size(), 0);
-  EXPECT_EQ(tensor.SetData(Buffer(100)), ge::GRAPH_PARAM_INVALID);
+  EXPECT_EQ(tensor.SetData(Buffer(100)), GRAPH_SUCCESS);
 
   TensorUtils::SetWeightSize(tensor.MutableTensorDesc(), 100);
-  EXPECT_EQ(TensorUtils::GetWeightSize(tensor), 0);
+  EXPECT_EQ(TensorUtils::GetWeightSize(tensor), 100);
 
   auto tensor_ptr = std::make_shared<GeTensor>(msg_owner, nullptr);
   TensorUtils::SetWeightSize(tensor_ptr->MutableTensorDesc(), 100);
-  EXPECT_EQ(TensorUtils::GetWeightSize(tensor_ptr), 0);
+  EXPECT_EQ(TensorUtils::GetWeightSize(tensor_ptr), 100);
 
   GeTensor tensor1 = tensor;
-  EXPECT_EQ(TensorUtils::GetWeightSize(tensor1), 0);
+  EXPECT_EQ(TensorUtils::GetWeightSize(tensor1), 100);
 }
 
 TEST_F(UtestGeTensor, test_tensor_utils_weight_size) {
@@ -376,3 +383,160 @@ TEST_F(UtestGeTensor, test_tensor_invalid) {
   Tensor tensor6(tensor_desc6, &data6, 1);
   EXPECT_EQ(tensor6.IsValid(), GRAPH_SUCCESS);
 }
+
+TEST_F(UtestGeTensor, resize_data_in_place) {
+  GeTensor tensor(GeTensorDesc(GeShape({4, 256}), FORMAT_ND, DT_FLOAT));
+  EXPECT_EQ(tensor.ResizeData(4 * 256 * sizeof(float)), GRAPH_SUCCESS);
+  EXPECT_EQ(tensor.GetData().size(), 4 * 256 * sizeof(float));
+  uint8_t *addr = tensor.MutableData().data();
+  addr[7] = 7;
+
+  // Copies and the external tensor share the storage the producer wrote
+  GeTensor shared = tensor;
+  EXPECT_EQ(shared.GetData().data(), addr);
+  Tensor out_tensor = TensorAdapter::AsTensor(tensor);
+  EXPECT_EQ(out_tensor.GetData(), addr);
+  EXPECT_EQ(out_tensor.GetData()[7], 7);
+}
+
+TEST_F(UtestGeTensor, native_desc_copy_and_round_trip) {
+  GeTensorDesc desc(GeShape({1, 16, 8, 8}), FORMAT_NCHW, DT_QINT8);
+  desc.SetOriginShape(GeShape({1, 8, 8, 16}));
+  desc.SetOriginFormat(FORMAT_NHWC);
+  desc.SetOriginDataType(DT_FLOAT);
+  TensorUtils::SetSize(desc, 1024);
+  TensorUtils::SetDataOffset(desc, 512);
+  TensorUtils::SetRealDimCnt(desc, 4);
+  TensorUtils::SetDeviceType(desc, DeviceType::CPU);
+  EXPECT_TRUE(AttrUtils::SetInt(&desc, "custom", 7));
+  EXPECT_EQ(desc.tensor_descriptor_.GetProtoMsg(), nullptr);
+
+  // Copies own their fields and attributes
+  GeTensorDesc copy = desc;
+  copy.MutableShape().SetDim(0, 2);
+  copy.SetDataType(DT_INT32);
+  TensorUtils::SetSize(copy, 2048);
+  EXPECT_TRUE(AttrUtils::SetInt(&copy, "custom", 8));
+  EXPECT_EQ(desc.GetShape().GetDim(0), 1);
+  EXPECT_EQ(desc.GetDataType(), DT_QINT8);
+  uint32_t size = 0;
+  EXPECT_EQ(TensorUtils::GetSize(desc, size), GRAPH_SUCCESS);
+  EXPECT_EQ(size, 1024);
+  int64_t custom = 0;
+  EXPECT_TRUE(AttrUtils::GetInt(&desc, "custom", custom));
+  EXPECT_EQ(custom, 7);
+
+  // Protobuf is produced at serialization time and parsed back into typed fields
+  auto op_desc = std::make_shared<OpDesc>("op", "Conv2D");
+  EXPECT_TRUE(AttrUtils::SetTensorDesc(op_desc, "desc", desc));
+  GeTensorDesc parsed;
+  EXPECT_TRUE(AttrUtils::GetTensorDesc(op_desc, "desc", parsed));
+  EXPECT_EQ(parsed.tensor_descriptor_.GetProtoMsg(), nullptr);
+  EXPECT_TRUE(parsed == desc);
+  EXPECT_EQ(parsed.GetShape().GetDims(), vector<int64_t>({1, 16, 8, 8}));
+  EXPECT_EQ(parsed.GetFormat(), FORMAT_NCHW);
+  EXPECT_EQ(parsed.GetDataType(), DT_QINT8);
+  EXPECT_EQ(parsed.GetOriginShape().GetDims(), vector<int64_t>({1, 8, 8, 16}));
+  EXPECT_EQ(parsed.GetOriginFormat(), FORMAT_NHWC);
+  EXPECT_EQ(parsed.GetOriginDataType(), DT_FLOAT);
+  int64_t data_offset = 0;
+  EXPECT_EQ(TensorUtils::GetDataOffset(parsed, data_offset), GRAPH_SUCCESS);
+  EXPECT_EQ(data_offset, 512);
+  DeviceType device_type = DeviceType::NPU;
+  EXPECT_EQ(TensorUtils::GetDeviceType(parsed, device_type), GRAPH_SUCCESS);
+  EXPECT_EQ(device_type, DeviceType::CPU);
+  EXPECT_TRUE(AttrUtils::GetInt(&parsed, "custom", custom));
+  EXPECT_EQ(custom, 7);
+  // The typed fields are not exposed as attributes
+  EXPECT_FALSE(parsed.HasAttr("origin_format"));
+}
+
+TEST_F(UtestGeTensor, attr_weight_stays_proto_view) {
+  auto op_desc = std::make_shared<OpDesc>("const", "Const");
+  GeTensor weight(GeTensorDesc(GeShape({4}), FORMAT_ND, DT_INT8), vector<uint8_t>({1, 2, 3, 4}));
+  EXPECT_TRUE(AttrUtils::SetTensor(op_desc, "value", weight));
+
+  // Mutations through the tensor held by the attribute persist in the attribute
+  GeTensorPtr view = nullptr;
+  EXPECT_TRUE(AttrUtils::MutableTensor(op_desc, "value", view));
+  ASSERT_NE(view, nullptr);
+  TensorUtils::SetDataOffset(view->MutableTensorDesc(), 64);
+  view->MutableTensorDesc().SetOriginFormat(FORMAT_NCHW);
+
+  ConstGeTensorPtr again = nullptr;
+  EXPECT_TRUE(AttrUtils::GetTensor(op_desc, "value", again));
+  ASSERT_NE(again, nullptr);
+  int64_t data_offset = 0;
+  EXPECT_EQ(TensorUtils::GetDataOffset(again->GetTensorDesc(), data_offset), GRAPH_SUCCESS);
+  EXPECT_EQ(data_offset, 64);
+  EXPECT_EQ(again->GetTensorDesc().GetOriginFormat(), FORMAT_NCHW);
+  EXPECT_EQ(again->GetData().size(), 4);
+  EXPECT_EQ(again->GetData()[3], 4);
+
+  // A clone of the view is a native tensor
+  GeTensor clone = again->Clone();
+  EXPECT_EQ(clone.tensor_def_.GetProtoMsg(), nullptr);
+  EXPECT_EQ(clone.GetTensorDesc().GetOriginFormat(), FORMAT_NCHW);
+  EXPECT_EQ(clone.GetData()[3], 4);
+}
+
+TEST_F(UtestGeTensor, native_data_adopt_and_align) {
+  vector<uint8_t> data(4096, 3);
+  const uint8_t *data_addr = data.data();
+  GeTensor adopted(GeTensorDesc(GeShape({4096}), FORMAT_ND, DT_UINT8));
+  EXPECT_EQ(adopted.SetData(std::move(data)), GRAPH_SUCCESS);
+  EXPECT_EQ(adopted.GetData().data(), data_addr);
+  EXPECT_EQ(adopted.GetData().size(), 4096);
+
+  GeTensor copied(GeTensorDesc(GeShape({4096}), FORMAT_ND, DT_UINT8), data_addr, 4096);
+  EXPECT_NE(copied.GetData().data(), data_addr);
+  EXPECT_EQ(reinterpret_cast<uintptr_t>(copied.GetData().data()) % TensorData::kAlignment, 0);
+  EXPECT_EQ(copied.GetData()[4095], 3);
+
+  // Growing keeps the old bytes and zero fills, shrinking stays in place
+  EXPECT_EQ(copied.ResizeData(8192), GRAPH_SUCCESS);
+  EXPECT_EQ(copied.GetData()[4095], 3);
+  EXPECT_EQ(copied.GetData()[8191], 0);
+  const uint8_t *grown_addr = copied.GetData().data();
+  EXPECT_EQ(copied.ResizeData(16), GRAPH_SUCCESS);
+  EXPECT_EQ(copied.GetData().data(), grown_addr);
+
+  Buffer alias = copied.MutableData();
+  alias.clear();
+  EXPECT_EQ(copied.GetData().size(), 0);
+}
+TEST_F(UtestGeTensor, desc_accessor_and_copy) {
+  GeTensorDesc desc(GeShape({32, 3, 224, 224}), FORMAT_NCHW, DT_FLOAT16);
+  TensorUtils::SetSize(desc, 32 * 3 * 224 * 224 * 2);
+  EXPECT_TRUE(AttrUtils::SetInt(&desc, "custom", 7));
+
+  uint32_t size = 0;
+  EXPECT_EQ(TensorUtils::GetSize(desc, size), GRAPH_SUCCESS);
+  EXPECT_EQ(size, 32 * 3 * 224 * 224 * 2);
+  EXPECT_EQ(desc.GetDataType(), DT_FLOAT16);
+  EXPECT_EQ(desc.GetFormat(), FORMAT_NCHW);
+  EXPECT_EQ(desc.GetShape().GetDim(1), 3);
+
+  // A copy carries every field and is independent of its source
+  GeTensorDesc copy = desc;
+  EXPECT_EQ(copy.GetShape().GetDims(), desc.GetShape().GetDims());
+  EXPECT_EQ(copy.GetDataType(), DT_FLOAT16);
+  size = 0;
+  EXPECT_EQ(TensorUtils::GetSize(copy, size), GRAPH_SUCCESS);
+  EXPECT_EQ(size, 32 * 3 * 224 * 224 * 2);
+  int64_t custom = 0;
+  EXPECT_TRUE(AttrUtils::GetInt(&copy, "custom", custom));
+  EXPECT_EQ(custom, 7);
+
+  copy.SetShape(GeShape({1, 3}));
+  copy.SetDataType(DT_FLOAT);
+  TensorUtils::SetSize(copy, 24);
+  EXPECT_TRUE(AttrUtils::SetInt(&copy, "custom", 8));
+  EXPECT_EQ(desc.GetShape().GetDimNum(), 4);
+  EXPECT_EQ(desc.GetDataType(), DT_FLOAT16);
+  size = 0;
+  EXPECT_EQ(TensorUtils::GetSize(desc, size), GRAPH_SUCCESS);
+  EXPECT_EQ(size, 32 * 3 * 224 * 224 * 2);
+  EXPECT_TRUE(AttrUtils::GetInt(&desc, "custom", custom));
+  EXPECT_EQ(custom, 7);
+}
@@ -15,10 +15,12 @@
  */
 
 #include <gtest/gtest.h>
+#include <vector>
 
 #include "common/formats/format_transfers/format_transfer_nchw_nc1hwc0.h"
 
 #include "common/formats/format_transfers/format_transfer.h"
+#include "common/formats/formats.h"
 #include "common/formats/utils/formats_trans_utils.h"
 
 namespace ge {
@@ -30,6 +32,63 @@ class UtestFormatTransfer : public testing::Test {
   void TearDown() {}
 };
 
+namespace {
+const int64_t kN = 4;
+const int64_t kC = 35;
+const int64_t kH = 64;
+const int64_t kW = 64;
+const int64_t kC0 = 16;
+const int64_t kC1 = (kC - 1) / kC0 + 1;
+
+int64_t Nc1hwc0Index(int64_t n, int64_t c, int64_t h, int64_t w) {
+  return (((n * kC1 + c / kC0) * kH + h) * kW + w) * kC0 + c % kC0;
+}
+
+int64_t NchwIndex(int64_t n, int64_t c, int64_t h, int64_t w) { return ((n * kC + c) * kH + h) * kW + w; }
+
+int64_t NhwcIndex(int64_t n, int64_t c, int64_t h, int64_t w) { return ((n * kH + h) * kW + w) * kC + c; }
+
+template <typename IndexFunc>
+void CheckNc1hwc0(const TransResult &result, const std::vector<uint16_t> &src, IndexFunc src_index) {
+  ASSERT_EQ(result.length, static_cast<size_t>(kN * kC1 * kH * kW * kC0 * 2));
+  auto dst = reinterpret_cast<const uint16_t *>(result.data.get());
+  for (int64_t n = 0; n < kN; n++) {
+    for (int64_t c = 0; c < kC1 * kC0; c++) {
+      for (int64_t h = 0; h < kH; h++) {
+        for (int64_t w = 0; w < kW; w++) {
+          uint16_t expect = (c < kC) ? src[src_index(n, c, h, w)] : 0;
+          ASSERT_EQ(dst[Nc1hwc0Index(n, c, h, w)], expect);
+        }
+      }
+    }
+  }
+}
+
+template <typename IndexFunc>
+void Check4d(const TransResult &result, const std::vector<uint16_t> &src, IndexFunc dst_index) {
+  ASSERT_EQ(result.length, static_cast<size_t>(kN * kC * kH * kW * 2));
+  auto dst = reinterpret_cast<const uint16_t *>(result.data.get());
+  for (int64_t n = 0; n < kN; n++) {
+    for (int64_t c = 0; c < kC; c++) {
+      for (int64_t h = 0; h < kH; h++) {
+        for (int64_t w = 0; w < kW; w++) {
+          ASSERT_EQ(dst[dst_index(n, c, h, w)], src[Nc1hwc0Index(n, c, h, w)]);
+        }
+      }
+    }
+  }
+}
+
+std::vector<uint16_t> CreateData(int64_t num) {
+  std::vector<uint16_t> data(num);
+  for (int64_t i = 0; i < num; i++) {
+    data[i] = static_cast<uint16_t>(i * 7 + 1);
+  }
+  return data;
+}
+
+}  // namespace
+
 TEST_F(UtestFormatTransfer, build_transfer_success) {
   uint8_t data[1 * 3 * 224 * 224 * 2];
   TransArgs args{data, FORMAT_NCHW, FORMAT_NC1HWC0, {1, 3, 224, 224}, {1, 1, 224, 224, 16}, DT_FLOAT16};
@@ -77,5 +136,48 @@ TEST_F(UtestFormatTransfer, get_size_by_data_type) {
   EXPECT_EQ(GetSizeByDataType(DT_UNDEFINED), -1);
   EXPECT_EQ(DT_UNDEFINED, 26);
 }
+
+TEST_F(UtestFormatTransfer, parallel_trans_with_c0_padding) {
+  // Large enough to be split across the thread pool, C is not a multiple of C0
+  std::vector<uint16_t> nchw = CreateData(kN * kC * kH * kW);
+  TransResult result;
+  TransArgs nchw_args{reinterpret_cast<uint8_t *>(nchw.data()), FORMAT_NCHW, FORMAT_NC1HWC0, {kN, kC, kH, kW},
+                      {kN, kC1, kH, kW, kC0}, DT_FLOAT16};
+  EXPECT_EQ(TransFormat(nchw_args, result), SUCCESS);
+  CheckNc1hwc0(result, nchw, NchwIndex);
+
+  std::vector<uint16_t> nhwc = CreateData(kN * kC * kH * kW);
+  TransArgs nhwc_args{reinterpret_cast<uint8_t *>(nhwc.data()), FORMAT_NHWC, FORMAT_NC1HWC0, {kN, kH, kW, kC},
+                      {kN, kC1, kH, kW, kC0}, DT_FLOAT16};
+  EXPECT_EQ(TransFormat(nhwc_args, result), SUCCESS);
+  CheckNc1hwc0(result, nhwc, NhwcIndex);
+
+  std::vector<uint16_t> nc1hwc0 = CreateData(kN * kC1 * kH * kW * kC0);
+  TransArgs to_nchw_args{reinterpret_cast<uint8_t *>(nc1hwc0.data()), FORMAT_NC1HWC0, FORMAT_NCHW,
+                         {kN, kC1, kH, kW, kC0}, {kN, kC, kH, kW}, DT_FLOAT16};
+  EXPECT_EQ(TransFormat(to_nchw_args, result), SUCCESS);
+  Check4d(result, nc1hwc0, NchwIndex);
+
+  TransArgs to_nhwc_args{reinterpret_cast<uint8_t *>(nc1hwc0.data()), FORMAT_NC1HWC0, FORMAT_NHWC,
+                         {kN, kC1, kH, kW, kC0}, {kN, kH, kW, kC}, DT_FLOAT16};
+  EXPECT_EQ(TransFormat(to_nhwc_args, result), SUCCESS);
+  Check4d(result, nc1hwc0, NhwcIndex);
+}
+
+TEST_F(UtestFormatTransfer, parallel_trans_data_type) {
+  const int64_t num = 1024 * 1024 + 3;
+  std::vector<int32_t> src(num);
+  for (int64_t i = 0; i < num; i++) {
+    src[i] = static_cast<int32_t>(i - num / 2);
+  }
+  CastArgs args{reinterpret_cast<uint8_t *>(src.data()), static_cast<size_t>(num), DT_INT32, DT_FLOAT};
+  TransResult result;
+  EXPECT_EQ(TransDataType(args, result), SUCCESS);
+  ASSERT_EQ(result.length, static_cast<size_t>(num * sizeof(float)));
+  auto dst = reinterpret_cast<const float *>(result.data.get());
+  for (int64_t i = 0; i < num; i++) {
+    ASSERT_EQ(dst[i], static_cast<float>(src[i]));
+  }
+}
 }  // namespace formats
 }  // namespace ge
\ No newline at end of file
@@ -0,0 +1,140 @@
+/**
+ * Copyright 2019-2020 Huawei Technologies Co., Ltd
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <gtest/gtest.h>
+#include <string.h>
+
+#include <random>
+#include <vector>
+
+#include "common/fp16_t.h"
+
+namespace ge {
+namespace {
+const size_t kFp16ValueNum = 65536;
+
+uint32_t FloatBits(float f_val) {
+  uint32_t bits;
+  memcpy(&bits, &f_val, sizeof(bits));
+  return bits;
+}
+
+float BitsFloat(uint32_t bits) {
+  float f_val;
+  memcpy(&f_val, &bits, sizeof(f_val));
+  return f_val;
+}
+
+// Every fp16 value, its float neighbours and the midpoints to the next fp16 value with their neighbours, so every
+// rounding decision of the conversion is hit, plus out of range, inf, nan and fp32 denormal values
+std::vector<float> BuildFloatInputs() {
+  std::vector<float> inputs;
+  for (size_t i = 0; i < kFp16ValueNum; ++i) {
+    float value = Fp16ToFloat(static_cast<uint16_t>(i));
+    float next_value = Fp16ToFloat(static_cast<uint16_t>(i + 1));
+    uint32_t bits = FloatBits(value);
+    uint32_t next_bits = FloatBits(next_value);
+    uint32_t mid_bits = FloatBits((value + next_value) / 2);
+    for (uint32_t near_bits : {bits, next_bits, mid_bits}) {
+      inputs.emplace_back(BitsFloat(near_bits));
+      inputs.emplace_back(BitsFloat(near_bits + 1));
+      inputs.emplace_back(BitsFloat(near_bits - 1));
+    }
+  }
+  for (uint32_t bits : {0x477FE000u, 0x477FEFFFu, 0x477FF000u, 0x477FF001u, 0x47800000u, 0x7F7FFFFFu, 0x7F800000u,
+                        0x7FC00000u, 0x7F800001u, 0x33000000u, 0x33000001u, 0x32FFFFFFu, 0x387FE000u, 0x387FF000u,
+                        0x00000001u, 0x007FFFFFu, 0x00800000u}) {
+    inputs.emplace_back(BitsFloat(bits));
+    inputs.emplace_back(BitsFloat(bits | 0x80000000u));
+  }
+  std::mt19937 gen(2020);
+  for (int i = 0; i < 1000000; ++i) {
+    inputs.emplace_back(BitsFloat(static_cast<uint32_t>(gen())));
+  }
+  return inputs;
+}
+}  // namespace
+
+class UtestFp16 : public testing::Test {
+ protected:
+  void SetUp() {}
+  void TearDown() {}
+};
+
+TEST_F(UtestFp16, fp16_to_float_exhaustive) {
+  std::vector<uint16_t> src(kFp16ValueNum);
+  for (size_t i = 0; i < kFp16ValueNum; ++i) {
+    src[i] = static_cast<uint16_t>(i);
+  }
+  // a whole array takes the vector path where the cpu has one, a single value the table
+  std::vector<float> dst(kFp16ValueNum);
+  Fp16ToFloatArray(src.data(), dst.data(), dst.size());
+  for (size_t i = 0; i < kFp16ValueNum; ++i) {
+    uint32_t expect = FloatBits(Fp16ToFloat(src[i]));
+    ASSERT_EQ(FloatBits(dst[i]), expect) << "fp16 " << i;
+    float single = 0;
+    Fp16ToFloatArray(&src[i], &single, 1);
+    ASSERT_EQ(FloatBits(single), expect) << "fp16 " << i;
+    ASSERT_EQ(FloatBits(fp16_t(src[i]).toFloat()), expect) << "fp16 " << i;
+  }
+}
+
+TEST_F(UtestFp16, float_to_fp16_bit_exact) {
+  std::vector<float> src = BuildFloatInputs();
+  std::vector<uint16_t> dst(src.size());
+  FloatToFp16Array(src.data(), dst.data(), dst.size());
+  for (size_t i = 0; i < src.size(); ++i) {
+    uint16_t expect = FloatToFp16(src[i]);
+    ASSERT_EQ(dst[i], expect) << "float bits " << std::hex << FloatBits(src[i]);
+    uint16_t single = 0;
+    FloatToFp16Array(&src[i], &single, 1);
+    ASSERT_EQ(single, expect) << "float bits " << std::hex << FloatBits(src[i]);
+    fp16_t fp16_data;
+    fp16_data = src[i];
+    ASSERT_EQ(fp16_data.val, expect) << "float bits " << std::hex << FloatBits(src[i]);
+  }
+  // saturated instead of inf, round to nearest even
+  EXPECT_EQ(FloatToFp16(BitsFloat(0x7F800000u)), FP16_MAX);
+  EXPECT_EQ(FloatToFp16(65520.0f), FP16_MAX);
+  EXPECT_EQ(FloatToFp16(65519.0f), FP16_MAX);
+  EXPECT_EQ(FloatToFp16(1.0f + 1.0f / 2048), 0x3C00);
+}
+
+TEST_F(UtestFp16, array_conversion_large_input) {
+  const size_t kNum = 1 << 22;
+  std::vector<float> src(kNum);
+  std::mt19937 gen(2020);
+  std::uniform_real_distribution<float> dist(-100.0f, 100.0f);
+  for (auto &value : src) {
+    value = dist(gen);
+  }
+  std::vector<uint16_t> reference(kNum);
+  for (size_t i = 0; i < kNum; ++i) {
+    reference[i] = FloatToFp16(src[i]);
+  }
+  std::vector<uint16_t> dst(kNum);
+  FloatToFp16Array(src.data(), dst.data(), kNum);
+  EXPECT_EQ(dst, reference);
+
+  std::vector<float> back_reference(kNum);
+  for (size_t i = 0; i < kNum; ++i) {
+    back_reference[i] = Fp16ToFloat(dst[i]);
+  }
+  std::vector<float> back(kNum);
+  Fp16ToFloatArray(dst.data(), back.data(), kNum);
+  EXPECT_EQ(back, back_reference);
+}
+}  // namespace ge
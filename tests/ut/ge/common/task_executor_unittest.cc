@@ -0,0 +1,209 @@
+/**
+ * Copyright 2019-2020 Huawei Technologies Co., Ltd
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <gtest/gtest.h>
+
+#include <atomic>
+#include <chrono>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "common/task_executor.h"
+
+namespace ge {
+class UtestTaskExecutor : public testing::Test {
+ protected:
+  void SetUp() {}
+
+  void TearDown() {}
+};
+
+TEST_F(UtestTaskExecutor, parallel_for_covers_range) {
+  TaskExecutor executor(4);
+  const size_t kNum = 10001;
+  std::vector<std::atomic<int>> hits(kNum);
+  for (auto &hit : hits) {
+    hit.store(0);
+  }
+  Status ret = executor.ParallelFor(0, kNum, 7, [&hits](size_t begin, size_t end) -> Status {
+    for (size_t i = begin; i < end; ++i) {
+      ++hits[i];
+    }
+    return SUCCESS;
+  });
+  EXPECT_EQ(ret, SUCCESS);
+  for (auto &hit : hits) {
+    EXPECT_EQ(hit.load(), 1);
+  }
+
+  // empty and single chunk ranges run inline
+  EXPECT_EQ(executor.ParallelFor(5, 5, 1, [](size_t, size_t) -> Status { return FAILED; }), SUCCESS);
+  EXPECT_EQ(executor.ParallelFor(0, 3, 10, [](size_t begin, size_t end) -> Status {
+    return (begin == 0 && end == 3) ? SUCCESS : FAILED;
+  }),
+            SUCCESS);
+}
+
+TEST_F(UtestTaskExecutor, first_failure_cancels_group) {
+  TaskExecutor executor(2);
+  std::atomic<int> run_num(0);
+  TaskGroup group(executor);
+  group.Submit([]() -> Status { return PARAM_INVALID; });
+  EXPECT_EQ(group.Wait(), PARAM_INVALID);
+  EXPECT_TRUE(group.IsCancelled());
+
+  // tasks submitted after the failure are skipped
+  for (int i = 0; i < 100; ++i) {
+    group.Submit([&run_num]() -> Status {
+      ++run_num;
+      return SUCCESS;
+    });
+  }
+  EXPECT_EQ(group.Wait(), PARAM_INVALID);
+  EXPECT_EQ(run_num.load(), 0);
+
+  TaskGroup throw_group(executor);
+  throw_group.Submit([]() -> Status { throw std::runtime_error("task failed"); });
+  EXPECT_EQ(throw_group.Wait(), FAILED);
+}
+
+TEST_F(UtestTaskExecutor, nested_wait_not_deadlock) {
+  // more nested groups than workers, the waiting tasks must run their children themselves
+  TaskExecutor executor(2);
+  std::atomic<int> leaf_num(0);
+  TaskGroup group(executor);
+  for (int i = 0; i < 8; ++i) {
+    group.Submit([&executor, &leaf_num]() -> Status {
+      TaskGroup inner(executor);
+      for (int j = 0; j < 16; ++j) {
+        inner.Submit([&leaf_num]() -> Status {
+          ++leaf_num;
+          return SUCCESS;
+        });
+      }
+      return inner.Wait();
+    });
+  }
+  EXPECT_EQ(group.Wait(), SUCCESS);
+  EXPECT_EQ(leaf_num.load(), 8 * 16);
+}
+
+TEST_F(UtestTaskExecutor, many_groups_share_executor) {
+  const int kGroupNum = 200;
+  const int kTaskNum = 64;
+  std::atomic<int64_t> sum(0);
+  auto task = [&sum]() -> Status {
+    ++sum;
+    return SUCCESS;
+  };
+
+  for (int i = 0; i < kGroupNum; ++i) {
+    TaskGroup group;
+    for (int j = 0; j < kTaskNum; ++j) {
+      group.Submit(task);
+    }
+    EXPECT_EQ(group.Wait(), SUCCESS);
+  }
+  EXPECT_EQ(sum.load(), kGroupNum * kTaskNum);
+}
+
+TEST_F(UtestTaskExecutor, task_graph_follows_deps_and_budget) {
+  TaskExecutor executor(8);
+  TaskGraph task_graph(executor);
+  task_graph.SetBudget("engine_a", 2);
+
+  std::mutex mutex;
+  std::vector<std::string> done;
+  std::atomic<int> running_a(0);
+  std::atomic<int> max_running_a(0);
+  auto record = [&mutex, &done](const std::string &name) {
+    std::lock_guard<std::mutex> lock(mutex);
+    done.emplace_back(name);
+  };
+  auto engine_a_task = [&](const std::string &name) {
+    return [&, name]() -> Status {
+      int running = ++running_a;
+      int max_running = max_running_a.load();
+      while ((running > max_running) && !max_running_a.compare_exchange_weak(max_running, running)) {
+      }
+      std::this_thread::sleep_for(std::chrono::milliseconds(5));
+      --running_a;
+      record(name);
+      return SUCCESS;
+    };
+  };
+
+  // partition -> 6 subgraphs of engine_a and one of engine_b -> merge
+  size_t partition = task_graph.AddTask("partition", [&record]() -> Status {
+    record("partition");
+    return SUCCESS;
+  });
+  std::vector<size_t> sub_graphs;
+  for (int i = 0; i < 6; ++i) {
+    std::string name = "a" + std::to_string(i);
+    sub_graphs.emplace_back(task_graph.AddTask(name, engine_a_task(name), {partition}, "engine_a"));
+  }
+  sub_graphs.emplace_back(task_graph.AddTask("b", [&record]() -> Status {
+    record("b");
+    return SUCCESS;
+  }, {partition}, "engine_b"));
+  (void)task_graph.AddTask("merge", [&record]() -> Status {
+    record("merge");
+    return SUCCESS;
+  }, sub_graphs);
+
+  EXPECT_EQ(task_graph.Run(), SUCCESS);
+  ASSERT_EQ(done.size(), 9);
+  EXPECT_EQ(done.front(), "partition");
+  EXPECT_EQ(done.back(), "merge");
+  EXPECT_LE(max_running_a.load(), 2);
+  EXPECT_GE(max_running_a.load(), 1);
+
+  auto costs = task_graph.GetCosts();
+  ASSERT_EQ(costs.size(), 9);
+  EXPECT_EQ(costs[1].name, "a0");
+  EXPECT_GE(costs[1].cost_us, 5000);
+  // merge starts after the slowest subgraph is done
+  for (size_t i = 1; i < 8; ++i) {
+    EXPECT_GE(costs[8].start_us, costs[i].start_us + costs[i].cost_us);
+  }
+}
+
+TEST_F(UtestTaskExecutor, task_graph_failure_skips_successors) {
+  TaskExecutor executor(2);
+  TaskGraph task_graph(executor);
+  std::atomic<int> run_num(0);
+  size_t first = task_graph.AddTask("first", [&run_num]() -> Status {
+    ++run_num;
+    return SUCCESS;
+  });
+  size_t failed = task_graph.AddTask("failed", []() -> Status { return PARAM_INVALID; }, {first});
+  (void)task_graph.AddTask("after_failed", [&run_num]() -> Status {
+    ++run_num;
+    return SUCCESS;
+  }, {failed});
+  EXPECT_EQ(task_graph.Run(), PARAM_INVALID);
+  EXPECT_EQ(run_num.load(), 1);
+  EXPECT_EQ(task_graph.GetCosts().size(), 2);
+
+  TaskGraph invalid_graph(executor);
+  (void)invalid_graph.AddTask("self", []() -> Status { return SUCCESS; }, {0});
+  EXPECT_EQ(invalid_graph.Run(), PARAM_INVALID);
+}
+}  // namespace ge
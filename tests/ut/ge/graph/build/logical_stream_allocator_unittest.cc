@@ -866,4 +866,52 @@ TEST_F(UtestLogicalStreamAllocator, test_all_reduce_parallel_pass) {
   EXPECT_EQ(ret, SUCCESS);
 }
 
+/// Costs: src 1, long 100, short 1, sink 1
+///        --> long  --
+///       /            \
+///    src              sink
+///       \            /
+///        --> short --
+TEST_F(UtestLogicalStreamAllocator, test_assign_by_cost_pass) {
+  SubGraphInfoPtr src = CreateSubgraphWithNodeName("src", "src", "aicore", "", 1, 2);
+  SubGraphInfoPtr short_branch = CreateSubgraphWithNodeName("short", "short", "aicore");
+  SubGraphInfoPtr long_branch = CreateSubgraphWithNodeName("long", "long", "aicore");
+  SubGraphInfoPtr sink = CreateSubgraphWithNodeName("sink", "sink", "aicore", "", 2, 1);
+  long_branch->GetSubGraph()->FindNode("long")->GetOpDesc()->SetType("MatMul");
+  LinkSubGraph(src, "end1", short_branch, "placeholder");
+  LinkSubGraph(src, "end2", long_branch, "placeholder");
+  LinkSubGraph(short_branch, "end", sink, "placeholder1");
+  LinkSubGraph(long_branch, "end", sink, "placeholder2");
+
+  EngineConf conf;
+  conf.id = "aicore";
+  for (int64_t parallel_num : {2, 1}) {
+    vector<LogicalStreamPass::SubgraphPtr> subgraphs;
+    for (const auto &subgraph_info : {src, short_branch, long_branch, sink}) {
+      auto subgraph = make_shared<LogicalStreamPass::Subgraph>(*subgraph_info, conf);
+      subgraph->max_parallel_num = parallel_num;
+      subgraphs.emplace_back(subgraph);
+    }
+
+    LogicalStreamPass::Context context;
+    AssignByCostPass cost_pass;
+    EXPECT_EQ(cost_pass.Run(nullptr, subgraphs, context), NOT_CHANGED);
+
+    context.op_costs = {{"MatMul", 100}};
+    EXPECT_EQ(cost_pass.Run(nullptr, subgraphs, context), SUCCESS);
+    EXPECT_EQ(subgraphs[0]->stream_id, subgraphs[2]->stream_id);
+    EXPECT_EQ(subgraphs[2]->stream_id, subgraphs[3]->stream_id);
+    if (parallel_num == 2) {
+      // the short branch runs beside the long one
+      EXPECT_NE(subgraphs[1]->stream_id, subgraphs[2]->stream_id);
+      EXPECT_EQ(context.next_stream, 2);
+      EXPECT_EQ(context.makespan, 102);
+    } else {
+      EXPECT_EQ(subgraphs[1]->stream_id, subgraphs[2]->stream_id);
+      EXPECT_EQ(context.next_stream, 1);
+      EXPECT_EQ(context.makespan, 103);
+    }
+  }
+}
+
 }  // namespace ge
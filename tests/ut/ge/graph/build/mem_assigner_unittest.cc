@@ -30,6 +30,7 @@
 #define private public
 #include "graph/build/memory/binary_block_mem_assigner.h"
 #include "graph/build/memory/hybrid_mem_assigner.h"
+#include "graph/build/memory/lifetime_block_mem_assigner.h"
 #include "graph/build/memory/max_block_mem_assigner.h"
 #undef protected
 #undef private
@@ -141,6 +142,120 @@ class UtestMemoryAssignerTest : public testing::Test {
     graph->TopologicalSorting();
   }
 
+  ge::OpDescPtr createOpWithOutSize(const string &name, uint32_t input_num, uint32_t out_size, int64_t ws_byte,
+                                    const string &type = "some") {
+    ge::OpDescPtr op_def = make_shared<ge::OpDesc>(name, type);
+    for (uint32_t i = 0; i < input_num; ++i) {
+      ge::GeTensorDesc desc_input;
+      TensorUtils::SetSize(desc_input, out_size);
+      op_def->AddInputDesc(desc_input);
+    }
+    ge::GeTensorDesc desc_output;
+    TensorUtils::SetSize(desc_output, out_size);
+    op_def->AddOutputDesc(desc_output);
+    if (ws_byte > 0) {
+      op_def->SetWorkspaceBytes({ws_byte});
+    }
+    op_def->SetStreamId(0);
+    return op_def;
+  }
+
+  // Residual network shaped like resnet50: 4 stages of bottleneck blocks, feature map halves per stage
+  void make_resnet_graph(ge::ComputeGraphPtr graph) {
+    const uint32_t kStageBlocks[] = {3, 4, 6, 3};
+    uint32_t fm_size = 64 * 56 * 56 * 2;
+    ge::NodePtr prev = graph->AddNode(createOpWithOutSize("data", 0, 3 * 224 * 224 * 2, 0, DATA_TYPE));
+    int index = 0;
+    for (uint32_t stage = 0; stage < 4; ++stage) {
+      for (uint32_t block = 0; block < kStageBlocks[stage]; ++block) {
+        string prefix = "res" + std::to_string(index++) + "_";
+        ge::NodePtr conv1 = graph->AddNode(createOpWithOutSize(prefix + "conv1", 1, fm_size / 4, 4096));
+        ge::NodePtr relu1 = graph->AddNode(createOpWithOutSize(prefix + "relu1", 1, fm_size / 4, 0));
+        ge::NodePtr conv2 = graph->AddNode(createOpWithOutSize(prefix + "conv2", 1, fm_size / 4, 8192));
+        ge::NodePtr relu2 = graph->AddNode(createOpWithOutSize(prefix + "relu2", 1, fm_size / 4, 0));
+        ge::NodePtr conv3 = graph->AddNode(createOpWithOutSize(prefix + "conv3", 1, fm_size, 4096));
+        ge::NodePtr add = graph->AddNode(createOpWithOutSize(prefix + "add", 2, fm_size, 0));
+        ge::NodePtr relu3 = graph->AddNode(createOpWithOutSize(prefix + "relu3", 1, fm_size, 0));
+        ge::GraphUtils::AddEdge(prev->GetOutDataAnchor(0), conv1->GetInDataAnchor(0));
+        ge::GraphUtils::AddEdge(conv1->GetOutDataAnchor(0), relu1->GetInDataAnchor(0));
+        ge::GraphUtils::AddEdge(relu1->GetOutDataAnchor(0), conv2->GetInDataAnchor(0));
+        ge::GraphUtils::AddEdge(conv2->GetOutDataAnchor(0), relu2->GetInDataAnchor(0));
+        ge::GraphUtils::AddEdge(relu2->GetOutDataAnchor(0), conv3->GetInDataAnchor(0));
+        ge::GraphUtils::AddEdge(conv3->GetOutDataAnchor(0), add->GetInDataAnchor(0));
+        ge::GraphUtils::AddEdge(prev->GetOutDataAnchor(0), add->GetInDataAnchor(1));
+        ge::GraphUtils::AddEdge(add->GetOutDataAnchor(0), relu3->GetInDataAnchor(0));
+        prev = relu3;
+      }
+      fm_size /= 2;
+    }
+    ge::NodePtr output = graph->AddNode(createOpWithOutSize("output", 1, fm_size * 2, 0, NETOUTPUT));
+    ge::GraphUtils::AddEdge(prev->GetOutDataAnchor(0), output->GetInDataAnchor(0));
+    graph->TopologicalSorting();
+  }
+
+  // Two streams without head/tail dependency, ordered by the events of the edges A->C, C->J and J->K:
+  // stream 0: A -> B -> J, stream 1: C -> K -> L -> output
+  void make_multi_stream_graph(ge::ComputeGraphPtr graph) {
+    const uint32_t kSize = 1024;
+    ge::NodePtr node_a = graph->AddNode(createOpWithOutSize("A", 0, kSize, 0));
+    ge::NodePtr node_b = graph->AddNode(createOpWithOutSize("B", 1, kSize, 0));
+    ge::NodePtr node_c = graph->AddNode(createOpWithOutSize("C", 1, kSize, 0));
+    ge::NodePtr node_j = graph->AddNode(createOpWithOutSize("J", 2, kSize, 0));
+    ge::NodePtr node_k = graph->AddNode(createOpWithOutSize("K", 1, kSize, 0));
+    ge::NodePtr node_l = graph->AddNode(createOpWithOutSize("L", 1, kSize, 0));
+    ge::NodePtr output = graph->AddNode(createOpWithOutSize("output", 1, kSize, 0, NETOUTPUT));
+    for (const auto &node : {node_c, node_k, node_l, output}) {
+      node->GetOpDesc()->SetStreamId(1);
+    }
+    ge::GraphUtils::AddEdge(node_a->GetOutDataAnchor(0), node_b->GetInDataAnchor(0));
+    ge::GraphUtils::AddEdge(node_a->GetOutDataAnchor(0), node_c->GetInDataAnchor(0));
+    ge::GraphUtils::AddEdge(node_b->GetOutDataAnchor(0), node_j->GetInDataAnchor(0));
+    ge::GraphUtils::AddEdge(node_c->GetOutDataAnchor(0), node_j->GetInDataAnchor(1));
+    ge::GraphUtils::AddEdge(node_j->GetOutDataAnchor(0), node_k->GetInDataAnchor(0));
+    ge::GraphUtils::AddEdge(node_k->GetOutDataAnchor(0), node_l->GetInDataAnchor(0));
+    ge::GraphUtils::AddEdge(node_l->GetOutDataAnchor(0), output->GetInDataAnchor(0));
+    graph->TopologicalSorting();
+  }
+
+  size_t plan_memory(std::unique_ptr<BlockMemAssigner> &assigner, const string &name) {
+    std::vector<int64_t> ranges;
+    EXPECT_EQ(assigner->GetMemoryRanges(ranges), SUCCESS);
+    assigner->AssignMemoryWithReuse(ranges);
+    RecordProperty(name + "_footprint", std::to_string(assigner->GetMemOffset()));
+    return assigner->GetMemOffset();
+  }
+
+  // Pinned blocks, overlapping live ranges and streams not known to run in order conflict
+  bool is_conflict(LifetimeBlockMemAssigner &lifetime_assigner, const LifetimeBlockMemAssigner::TensorLifetime &left,
+                   const LifetimeBlockMemAssigner::TensorLifetime &right) {
+    if (left.pinned || right.pinned) {
+      return true;
+    }
+    if ((left.first <= right.last) && (right.first <= left.last)) {
+      return true;
+    }
+    const LifetimeBlockMemAssigner::TensorLifetime &early = (left.last < right.first) ? left : right;
+    const LifetimeBlockMemAssigner::TensorLifetime &late = (left.last < right.first) ? right : left;
+    return (early.stream_id != late.stream_id) &&
+           !lifetime_assigner.IsReusableStream(late.stream_id, early.stream_id);
+  }
+
+  // Blocks in conflict never share an address
+  void check_lifetimes_disjoint(LifetimeBlockMemAssigner &lifetime_assigner) {
+    auto &lifetimes = lifetime_assigner.lifetimes_;
+    for (size_t i = 0; i < lifetimes.size(); ++i) {
+      for (size_t j = i + 1; j < lifetimes.size(); ++j) {
+        if (!is_conflict(lifetime_assigner, lifetimes[i], lifetimes[j])) {
+          continue;
+        }
+        MemoryBlock *left = lifetimes[i].block;
+        MemoryBlock *right = lifetimes[j].block;
+        bool disjoint = (left->TailOffset() < right->HeadOffset()) || (right->TailOffset() < left->HeadOffset());
+        EXPECT_TRUE(disjoint) << left->String() << " overlaps " << right->String();
+      }
+    }
+  }
+
  protected:
   void SetUp() {}
 
@@ -182,3 +297,114 @@ TEST_F(UtestMemoryAssignerTest, Mock_block_mem_assigner_failed) {
 
   EXPECT_EQ(mock_assigner.Assign(), FAILED);
 }
+
+TEST_F(UtestMemoryAssignerTest, lifetime_block_mem_assigner_no_overlap) {
+  ge::ComputeGraphPtr graph = make_shared<ge::ComputeGraph>("");
+  make_graph(graph);
+  LifetimeBlockMemAssigner lifetime_assigner(graph);
+
+  EXPECT_EQ(lifetime_assigner.Assign(), SUCCESS);
+  EXPECT_GT(lifetime_assigner.GetMemOffset(), 0);
+  check_lifetimes_disjoint(lifetime_assigner);
+}
+
+TEST_F(UtestMemoryAssignerTest, lifetime_block_mem_assigner_no_overlap_across_streams) {
+  ge::ComputeGraphPtr resnet_graph = make_shared<ge::ComputeGraph>("resnet");
+  make_resnet_graph(resnet_graph);
+  LifetimeBlockMemAssigner resnet_assigner(resnet_graph);
+  EXPECT_EQ(resnet_assigner.Assign(), SUCCESS);
+  check_lifetimes_disjoint(resnet_assigner);
+
+  // stream 1 only follows stream 0 by the head/tail dependency, which the two streams here do not have
+  ge::ComputeGraphPtr graph = make_shared<ge::ComputeGraph>("multi_stream");
+  make_multi_stream_graph(graph);
+  LifetimeBlockMemAssigner lifetime_assigner(graph);
+  EXPECT_EQ(lifetime_assigner.Assign(), SUCCESS);
+  check_lifetimes_disjoint(lifetime_assigner);
+  EXPECT_NE(graph->FindNode("B")->GetOpDesc()->GetOutputOffset().at(0),
+            graph->FindNode("K")->GetOpDesc()->GetOutputOffset().at(0));
+}
+
+TEST_F(UtestMemoryAssignerTest, lifetime_block_mem_assigner_reuse_input) {
+  ge::ComputeGraphPtr graph = make_shared<ge::ComputeGraph>("");
+  make_reuse_graph(graph);
+  LifetimeBlockMemAssigner lifetime_assigner(graph);
+
+  EXPECT_EQ(lifetime_assigner.Assign(), SUCCESS);
+  ge::NodePtr node_a = graph->FindNode("A");
+  ge::NodePtr node_c = graph->FindNode("C");
+  EXPECT_EQ(node_a->GetOpDesc()->GetOutputOffset().at(0), node_c->GetOpDesc()->GetOutputOffset().at(0));
+}
+
+TEST_F(UtestMemoryAssignerTest, benchmark_feature_map_planners) {
+  ge::ComputeGraphPtr graph = make_shared<ge::ComputeGraph>("resnet");
+  make_resnet_graph(graph);
+
+  std::unique_ptr<BlockMemAssigner> binary_assigner(new BinaryBlockMemAssigner(graph));
+  std::unique_ptr<BlockMemAssigner> max_assigner(new MaxBlockMemAssigner(graph));
+  std::unique_ptr<BlockMemAssigner> lifetime_assigner(new LifetimeBlockMemAssigner(graph));
+  size_t bin_mem_size = plan_memory(binary_assigner, "binary-block");
+  size_t max_mem_size = plan_memory(max_assigner, "max-block");
+  size_t lifetime_mem_size = plan_memory(lifetime_assigner, "lifetime");
+  EXPECT_LE(lifetime_mem_size, bin_mem_size);
+  EXPECT_LE(lifetime_mem_size, max_mem_size);
+
+  HybridMemAssigner hybrid_assigner(graph);
+  EXPECT_EQ(hybrid_assigner.Assign(), SUCCESS);
+  EXPECT_EQ(hybrid_assigner.GetMemOffset(), std::min(std::min(bin_mem_size, max_mem_size), lifetime_mem_size));
+}
+
+TEST_F(UtestMemoryAssignerTest, stream_order_index_follows_events) {
+  ge::ComputeGraphPtr graph = make_shared<ge::ComputeGraph>("multi_stream");
+  make_multi_stream_graph(graph);
+  StreamOrderIndex index;
+  index.Build(graph);
+  ASSERT_TRUE(index.IsValid());
+
+  auto node = [&graph](const string &name) { return graph->FindNode(name).get(); };
+  EXPECT_TRUE(index.HappensBefore(node("A"), node("B")));
+  EXPECT_TRUE(index.HappensBefore(node("A"), node("C")));
+  EXPECT_TRUE(index.HappensBefore(node("B"), node("K")));
+  EXPECT_TRUE(index.HappensBefore(node("C"), node("output")));
+  EXPECT_FALSE(index.HappensBefore(node("B"), node("C")));
+  EXPECT_FALSE(index.HappensBefore(node("C"), node("B")));
+  EXPECT_FALSE(index.HappensBefore(node("K"), node("J")));
+  EXPECT_FALSE(index.HappensBefore(node("J"), node("J")));
+
+  // streams activated at runtime may loop, their order is not known at build time
+  (void)AttrUtils::SetStr(graph->FindNode("K")->GetOpDesc(), ATTR_NAME_STREAM_LABEL, "loop");
+  index.Build(graph);
+  EXPECT_FALSE(index.IsValid());
+  EXPECT_FALSE(index.HappensBefore(node("A"), node("B")));
+}
+
+TEST_F(UtestMemoryAssignerTest, block_mem_assigner_reuse_across_ordered_streams) {
+  ge::ComputeGraphPtr graph = make_shared<ge::ComputeGraph>("multi_stream");
+  make_multi_stream_graph(graph);
+  BinaryBlockMemAssigner assigner(graph);
+  EXPECT_EQ(assigner.Assign(), SUCCESS);
+  EXPECT_TRUE(assigner.stream_order_.IsValid());
+
+  auto out_offset = [&graph](const string &name) {
+    return graph->FindNode(name)->GetOpDesc()->GetOutputOffset().at(0);
+  };
+  // A is read by B and C, J runs after both
+  EXPECT_EQ(out_offset("J"), out_offset("A"));
+  // K on stream 1 takes over a block freed by J on stream 0
+  EXPECT_TRUE((out_offset("K") == out_offset("B")) || (out_offset("K") == out_offset("C")));
+  // blocks alive at the same time never share memory
+  EXPECT_NE(out_offset("B"), out_offset("C"));
+  EXPECT_NE(out_offset("J"), out_offset("K"));
+  EXPECT_NE(out_offset("K"), out_offset("L"));
+
+  // without the index only the head/tail stream dependency is known and no block crosses the streams
+  ge::ComputeGraphPtr label_graph = make_shared<ge::ComputeGraph>("multi_stream_label");
+  make_multi_stream_graph(label_graph);
+  (void)AttrUtils::SetStr(label_graph->FindNode("output")->GetOpDesc(), ATTR_NAME_STREAM_LABEL, "label");
+  BinaryBlockMemAssigner label_assigner(label_graph);
+  EXPECT_EQ(label_assigner.Assign(), SUCCESS);
+  EXPECT_FALSE(label_assigner.stream_order_.IsValid());
+  EXPECT_LT(assigner.GetMemOffset(), label_assigner.GetMemOffset());
+  RecordProperty("stream_order_index_footprint", std::to_string(assigner.GetMemOffset()));
+  RecordProperty("stream_map_footprint", std::to_string(label_assigner.GetMemOffset()));
+}
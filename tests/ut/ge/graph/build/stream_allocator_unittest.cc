@@ -0,0 +1,137 @@
+/**
+ * Copyright 2019-2020 Huawei Technologies Co., Ltd
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <algorithm>
+#include <string>
+#include <vector>
+#include <gtest/gtest.h>
+
+#define protected public
+#define private public
+#include "graph/build/stream_allocator.h"
+#undef protected
+#undef private
+
+#include "graph/compute_graph.h"
+#include "graph/utils/graph_utils.h"
+
+using namespace std;
+
+namespace ge {
+class UtestStreamAllocator : public testing::Test {
+ protected:
+  void SetUp() { graph_ = make_shared<ComputeGraph>("stream_graph"); }
+
+  void TearDown() {}
+
+  NodePtr AddNode(const string &name, int64_t stream_id) {
+    OpDescPtr op_desc = make_shared<OpDesc>(name, "Relu");
+    op_desc->AddInputDesc(GeTensorDesc());
+    op_desc->AddInputDesc(GeTensorDesc());
+    op_desc->AddOutputDesc(GeTensorDesc());
+    op_desc->SetStreamId(stream_id);
+    op_desc->SetId(static_cast<int64_t>(graph_->GetDirectNodesSize()));
+    return graph_->AddNode(op_desc);
+  }
+
+  static size_t GetEventNum(const StreamAllocator &allocator) {
+    size_t event_num = 0;
+    for (const auto &one_pair : allocator.node_to_send_events_) {
+      event_num += one_pair.second.size();
+    }
+    return event_num;
+  }
+
+  static bool HasEvent(const StreamAllocator &allocator, const NodePtr &send_node, const NodePtr &recv_node) {
+    vector<uint32_t> send_events;
+    vector<uint32_t> recv_events;
+    allocator.GetSendEventIdList(send_node, send_events);
+    allocator.GetRecvEventIdList(recv_node, recv_events);
+    for (uint32_t event_id : send_events) {
+      if (find(recv_events.begin(), recv_events.end(), event_id) != recv_events.end()) {
+        return true;
+      }
+    }
+    return false;
+  }
+
+  ComputeGraphPtr graph_;
+  vector<SubGraphInfoPtr> subgraphs_;
+};
+
+/// Stream0            Stream1            Stream2
+///   a1 - - - - - - - > b1
+///   |                  |
+///   |                  b2 - - - - - - - > c1
+///   |                                     |
+///    - - - - - - - - - - - - - - - - - -> c2
+TEST_F(UtestStreamAllocator, remove_event_implied_through_third_stream) {
+  NodePtr a1 = AddNode("a1", 0);
+  NodePtr b1 = AddNode("b1", 1);
+  NodePtr b2 = AddNode("b2", 1);
+  NodePtr c1 = AddNode("c1", 2);
+  NodePtr c2 = AddNode("c2", 2);
+  (void)GraphUtils::AddEdge(a1->GetOutDataAnchor(0), b1->GetInDataAnchor(0));
+  (void)GraphUtils::AddEdge(b1->GetOutDataAnchor(0), b2->GetInDataAnchor(0));
+  (void)GraphUtils::AddEdge(b2->GetOutDataAnchor(0), c1->GetInDataAnchor(0));
+  (void)GraphUtils::AddEdge(c1->GetOutDataAnchor(0), c2->GetInDataAnchor(0));
+  (void)GraphUtils::AddEdge(a1->GetOutControlAnchor(), c2->GetInControlAnchor());
+
+  StreamAllocator allocator(graph_, subgraphs_);
+  EXPECT_EQ(allocator.InsertSyncEvents(), SUCCESS);
+  EXPECT_EQ(GetEventNum(allocator), 3);
+  EXPECT_EQ(allocator.OptimizeSyncEvents(), SUCCESS);
+  EXPECT_EQ(GetEventNum(allocator), 2);
+  EXPECT_TRUE(HasEvent(allocator, a1, b1));
+  EXPECT_TRUE(HasEvent(allocator, b2, c1));
+  EXPECT_FALSE(HasEvent(allocator, a1, c2));
+}
+
+/// Stream0            Stream1
+///   a1 - - - - - - - > b1
+///   | \                |
+///   |  - - - - - - - > b2
+///   a2 - - - - - - - > b3
+///   |                  ^
+///   a3 - - - - - - - - |    (a3 is after b3 in graph order, its event is kept)
+TEST_F(UtestStreamAllocator, remove_event_by_stream_order) {
+  NodePtr a1 = AddNode("a1", 0);
+  NodePtr b1 = AddNode("b1", 1);
+  NodePtr b2 = AddNode("b2", 1);
+  NodePtr a2 = AddNode("a2", 0);
+  NodePtr b3 = AddNode("b3", 1);
+  NodePtr a3 = AddNode("a3", 0);
+  (void)GraphUtils::AddEdge(a1->GetOutDataAnchor(0), b1->GetInDataAnchor(0));
+  (void)GraphUtils::AddEdge(a1->GetOutDataAnchor(0), b2->GetInDataAnchor(0));
+  (void)GraphUtils::AddEdge(b1->GetOutControlAnchor(), b2->GetInControlAnchor());
+  (void)GraphUtils::AddEdge(a1->GetOutControlAnchor(), a2->GetInControlAnchor());
+  (void)GraphUtils::AddEdge(a1->GetOutControlAnchor(), b3->GetInControlAnchor());
+  (void)GraphUtils::AddEdge(a2->GetOutDataAnchor(0), b3->GetInDataAnchor(0));
+  (void)GraphUtils::AddEdge(a2->GetOutControlAnchor(), a3->GetInControlAnchor());
+  (void)GraphUtils::AddEdge(a3->GetOutDataAnchor(0), b3->GetInDataAnchor(1));
+
+  StreamAllocator allocator(graph_, subgraphs_);
+  EXPECT_EQ(allocator.InsertSyncEvents(), SUCCESS);
+  EXPECT_EQ(GetEventNum(allocator), 5);
+  EXPECT_EQ(allocator.OptimizeSyncEvents(), SUCCESS);
+  EXPECT_EQ(GetEventNum(allocator), 3);
+  EXPECT_TRUE(HasEvent(allocator, a1, b1));
+  EXPECT_FALSE(HasEvent(allocator, a1, b2));
+  EXPECT_FALSE(HasEvent(allocator, a1, b3));
+  EXPECT_TRUE(HasEvent(allocator, a2, b3));
+  EXPECT_TRUE(HasEvent(allocator, a3, b3));
+}
+}  // namespace ge
@@ -0,0 +1,209 @@
+/**
+ * Copyright 2019-2020 Huawei Technologies Co., Ltd
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdlib>
+#include <map>
+#include <string>
+#include <thread>
+#include <vector>
+#include <gtest/gtest.h>
+
+#define protected public
+#define private public
+#include "graph/build/task_generator.h"
+#undef protected
+#undef private
+
+#include "graph/compute_graph.h"
+#include "graph/utils/graph_utils.h"
+
+using namespace std;
+
+namespace ge {
+namespace {
+const char *const kStubKernelLib = "StubKernelLib";
+const char *const kStubEngine = "StubEngine";
+
+// Generates (id % 3 + 1) kernel tasks per node, later nodes finish first to shuffle the completion order
+class StubKernelInfoStore : public OpsKernelInfoStore {
+ public:
+  Status Initialize(const map<string, string> &options) override { return SUCCESS; }
+  Status Finalize() override { return SUCCESS; }
+  void GetAllOpsKernelInfo(map<string, OpInfo> &infos) const override {}
+  bool CheckSupported(const OpDescPtr &op_desc, std::string &un_supported_reason) const override { return true; }
+  Status CalcOpRunningParam(Node &node) override { return SUCCESS; }
+
+  Status GenerateTask(const Node &node, RunContext &context, std::vector<domi::TaskDef> &tasks) override {
+    int running = ++running_;
+    int max_running = max_running_.load();
+    while ((running > max_running) && !max_running_.compare_exchange_weak(max_running, running)) {
+    }
+
+    int64_t id = node.GetOpDesc()->GetId();
+    std::this_thread::sleep_for(std::chrono::microseconds((kNodeNum - id) * 20));
+    for (int64_t i = 0; i <= id % 3; ++i) {
+      domi::TaskDef task_def;
+      task_def.set_type(RT_MODEL_TASK_KERNEL);
+      task_def.mutable_kernel()->set_kernel_name(node.GetName() + "_" + std::to_string(i));
+      // the stream the engine was given, checked against the stream id of the node
+      task_def.mutable_kernel()->set_block_dim(
+          static_cast<uint32_t>(reinterpret_cast<uintptr_t>(context.stream)));
+      tasks.emplace_back(task_def);
+    }
+    --running_;
+    return SUCCESS;
+  }
+
+  static const int64_t kNodeNum = 48;
+  std::atomic<int> running_{0};
+  std::atomic<int> max_running_{0};
+};
+const int64_t StubKernelInfoStore::kNodeNum;
+}  // namespace
+
+class UtestTaskGenerator : public testing::Test {
+ protected:
+  void SetUp() {
+    graph_ = make_shared<ComputeGraph>("task_graph");
+    NodePtr pre_node;
+    for (int64_t i = 0; i < StubKernelInfoStore::kNodeNum; ++i) {
+      string type = (i == StubKernelInfoStore::kNodeNum - 1) ? NETOUTPUT : ((i % 10 == 5) ? HCOMALLREDUCE : "Relu");
+      OpDescPtr op_desc = make_shared<OpDesc>("node" + to_string(i), type);
+      op_desc->AddInputDesc(GeTensorDesc());
+      op_desc->AddOutputDesc(GeTensorDesc());
+      op_desc->SetId(i);
+      op_desc->SetStreamId(i % kStreamNum);
+      op_desc->SetOpKernelLibName(kStubKernelLib);
+      op_desc->SetOpEngineName(kStubEngine);
+      NodePtr node = graph_->AddNode(op_desc);
+      if (pre_node != nullptr) {
+        (void)GraphUtils::AddEdge(pre_node->GetOutDataAnchor(0), node->GetInDataAnchor(0));
+      }
+      pre_node = node;
+    }
+    for (int64_t i = 0; i < kStreamNum; ++i) {
+      run_context_.graphStreamList.emplace_back(reinterpret_cast<rtStream_t>(static_cast<uintptr_t>(i + 1)));
+    }
+    (void)setenv("PROFILING_MODE", "true", 1);
+  }
+
+  void TearDown() { (void)unsetenv("PROFILING_MODE"); }
+
+  Status Generate(const map<string, int> &budgets, const shared_ptr<StubKernelInfoStore> &store,
+                  vector<domi::TaskDef> &task_def_list, map<uint32_t, string> &op_name_map) {
+    vector<NodeTaskList> node_task_lists;
+    uint32_t node_index = 0;
+    for (auto &node : graph_->GetAllNodes()) {
+      NodeTaskList node_task_list;
+      node_task_list.node = node;
+      node_task_list.kernel_info_store = store;
+      node_task_list.node_index = ++node_index;
+      node_task_lists.emplace_back(std::move(node_task_list));
+    }
+
+    // fp at node 3, bp at node 40, end at the NetOutput, allreduce profiling around every HcomAllReduce
+    ProfilingPoint ppoint;
+    ppoint.fp_index = 3;
+    ppoint.bp_index = 40;
+    ppoint.end_index = static_cast<uint32_t>(StubKernelInfoStore::kNodeNum);
+    vector<uint32_t> ar_ppoint;
+    for (uint32_t i = 6; i <= StubKernelInfoStore::kNodeNum; i += 10) {
+      ar_ppoint.emplace_back(i);
+    }
+
+    TaskGenerator task_generator;
+    task_generator.SetBuildMaxParallelNum(budgets);
+    return task_generator.GenerateNodeTasks(run_context_, ppoint, ar_ppoint, node_task_lists, task_def_list,
+                                            op_name_map);
+  }
+
+  static vector<size_t> GetProfilingTaskPositions(const vector<domi::TaskDef> &task_def_list) {
+    vector<size_t> positions;
+    for (size_t i = 0; i < task_def_list.size(); ++i) {
+      if (task_def_list[i].type() == RT_MODEL_TASK_PROFILER_TRACE) {
+        positions.emplace_back(i);
+      }
+    }
+    return positions;
+  }
+
+  static void ExpectSameTasks(const vector<domi::TaskDef> &expected, const vector<domi::TaskDef> &actual) {
+    ASSERT_EQ(expected.size(), actual.size());
+    for (size_t i = 0; i < expected.size(); ++i) {
+      EXPECT_EQ(expected[i].type(), actual[i].type());
+      EXPECT_EQ(expected[i].stream_id(), actual[i].stream_id());
+      EXPECT_EQ(expected[i].kernel().kernel_name(), actual[i].kernel().kernel_name());
+      EXPECT_EQ(expected[i].log_timestamp().logid(), actual[i].log_timestamp().logid());
+    }
+  }
+
+  static const int64_t kStreamNum = 3;
+  ComputeGraphPtr graph_;
+  RunContext run_context_;
+};
+const int64_t UtestTaskGenerator::kStreamNum;
+
+TEST_F(UtestTaskGenerator, parallel_generate_keeps_sequential_order) {
+  auto sequential_store = make_shared<StubKernelInfoStore>();
+  vector<domi::TaskDef> sequential_tasks;
+  map<uint32_t, string> sequential_names;
+  ASSERT_EQ(Generate({}, sequential_store, sequential_tasks, sequential_names), SUCCESS);
+  EXPECT_EQ(sequential_store->max_running_.load(), 1);
+
+  auto parallel_store = make_shared<StubKernelInfoStore>();
+  vector<domi::TaskDef> parallel_tasks;
+  map<uint32_t, string> parallel_names;
+  ASSERT_EQ(Generate({{kStubEngine, 4}}, parallel_store, parallel_tasks, parallel_names), SUCCESS);
+  EXPECT_LE(parallel_store->max_running_.load(), 4);
+
+  ExpectSameTasks(sequential_tasks, parallel_tasks);
+  EXPECT_EQ(sequential_names, parallel_names);
+  vector<size_t> profiling_positions = GetProfilingTaskPositions(parallel_tasks);
+  EXPECT_EQ(GetProfilingTaskPositions(sequential_tasks), profiling_positions);
+  // job and fp before node 3, bp after node 40, end after the NetOutput, two around each of 5 allreduce
+  EXPECT_EQ(profiling_positions.size(), 14);
+
+  // every node keeps its own tasks in order, on its own stream, and engines saw the stream of the node
+  size_t kernel_num = 0;
+  for (size_t i = 0; i < parallel_tasks.size(); ++i) {
+    const domi::TaskDef &task_def = parallel_tasks[i];
+    if (task_def.type() != RT_MODEL_TASK_KERNEL) {
+      continue;
+    }
+    kernel_num++;
+    NodePtr node = graph_->FindNode(parallel_names[static_cast<uint32_t>(i)]);
+    ASSERT_NE(node, nullptr);
+    int64_t stream_id = node->GetOpDesc()->GetStreamId();
+    EXPECT_EQ(task_def.stream_id(), static_cast<uint32_t>(stream_id));
+    EXPECT_EQ(task_def.kernel().block_dim(), static_cast<uint32_t>(stream_id + 1));
+    EXPECT_EQ(task_def.kernel().kernel_name().find(node->GetName() + "_"), 0);
+    EXPECT_EQ(task_def.ops_kernel_store_ptr(), reinterpret_cast<uintptr_t>(parallel_store.get()));
+  }
+  EXPECT_EQ(kernel_num + profiling_positions.size(), parallel_tasks.size());
+}
+
+TEST_F(UtestTaskGenerator, negative_budget_generates_one_node_at_a_time) {
+  auto store = make_shared<StubKernelInfoStore>();
+  vector<domi::TaskDef> task_def_list;
+  map<uint32_t, string> op_name_map;
+  ASSERT_EQ(Generate({{kStubEngine, -3}}, store, task_def_list, op_name_map), SUCCESS);
+  EXPECT_EQ(store->max_running_.load(), 1);
+  EXPECT_EQ(task_def_list.size(), op_name_map.size());
+}
+}  // namespace ge
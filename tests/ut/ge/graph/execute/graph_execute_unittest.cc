@@ -0,0 +1,75 @@
+/**
+ * Copyright 2019-2020 Huawei Technologies Co., Ltd
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <gtest/gtest.h>
+#include <vector>
+
+#define private public
+#include "graph/execute/graph_execute.h"
+#undef private
+
+namespace ge {
+class UtestGraphExecute : public testing::Test {
+ protected:
+  void SetUp() {}
+  void TearDown() {}
+};
+
+TEST_F(UtestGraphExecute, prepare_data_without_staging_copy) {
+  std::vector<GeTensor> input_tensor;
+  input_tensor.emplace_back(GeTensorDesc(GeShape({2, 3}), FORMAT_ND, DT_FLOAT), std::vector<uint8_t>(24, 1));
+  input_tensor.emplace_back(GeTensorDesc(GeShape({8}), FORMAT_ND, DT_INT8), std::vector<uint8_t>(8, 2));
+
+  InputOutputDescInfo out_desc;
+  out_desc.size = 64;
+  out_desc.data_type = DT_INT32;
+  out_desc.shape_info.dims = {4, 4};
+  std::vector<InputOutputDescInfo> output_desc = {out_desc};
+
+  GraphExecutor graph_executor;
+  InputData input_data;
+  OutputData output_data;
+  std::vector<GeTensor> output_tensor;
+  EXPECT_EQ(graph_executor.PrepareInputData(input_tensor, input_data, output_data, output_desc, output_tensor),
+            SUCCESS);
+
+  // The model reads the caller's tensors in place
+  ASSERT_EQ(input_data.blobs.size(), input_tensor.size());
+  for (size_t i = 0; i < input_tensor.size(); ++i) {
+    EXPECT_EQ(input_data.blobs[i].data, input_tensor[i].GetData().data());
+    EXPECT_EQ(input_data.blobs[i].length, input_tensor[i].GetData().size());
+  }
+
+  // and writes its results straight into the returned tensors
+  ASSERT_EQ(output_data.blobs.size(), 1);
+  ASSERT_EQ(output_tensor.size(), 1);
+  EXPECT_EQ(output_data.blobs[0].data, output_tensor[0].GetData().data());
+  EXPECT_EQ(output_data.blobs[0].length, 64);
+  EXPECT_EQ(output_tensor[0].GetData().size(), 64);
+  EXPECT_EQ(output_tensor[0].GetTensorDesc().GetShape().GetDims(), std::vector<int64_t>({4, 4}));
+  EXPECT_EQ(output_tensor[0].GetTensorDesc().GetDataType(), DT_INT32);
+  static_cast<uint8_t *>(output_data.blobs[0].data)[63] = 9;
+  EXPECT_EQ(output_tensor[0].GetData()[63], 9);
+
+  // Zero sized outputs are still rejected
+  output_desc[0].size = 0;
+  InputData input_data2;
+  OutputData output_data2;
+  std::vector<GeTensor> output_tensor2;
+  EXPECT_NE(graph_executor.PrepareInputData(input_tensor, input_data2, output_data2, output_desc, output_tensor2),
+            SUCCESS);
+}
+}  // namespace ge
@@ -0,0 +1,203 @@
+/**
+ * Copyright 2019-2020 Huawei Technologies Co., Ltd
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <gtest/gtest.h>
+#include <stdlib.h>
+#include <unistd.h>
+
+#include <string>
+#include <vector>
+
+#include "common/types.h"
+#include "ge/ge_api_types.h"
+#include "graph/debug/ge_attr_define.h"
+#include "graph/utils/attr_utils.h"
+#include "graph/utils/graph_utils.h"
+#include "graph/utils/tensor_utils.h"
+#include "proto/task.pb.h"
+
+#define private public
+#include "graph/manager/graph_compile_cache.h"
+#include "graph/manager/graph_manager.h"
+#include "graph/manager/graph_var_manager.h"
+#undef private
+
+namespace ge {
+namespace {
+// data -> relu -> netoutput, nodes added in the given order
+ComputeGraphPtr BuildGraph(bool relu_first, int64_t relu_attr = 0) {
+  ComputeGraphPtr graph = std::make_shared<ComputeGraph>("cache_graph");
+  GeTensorDesc tensor_desc(GeShape({1, 3, 8, 8}), FORMAT_NCHW, DT_FLOAT);
+  auto data_desc = std::make_shared<OpDesc>("data", DATA);
+  data_desc->AddOutputDesc(tensor_desc);
+  auto relu_desc = std::make_shared<OpDesc>("relu", RELU);
+  relu_desc->AddInputDesc(tensor_desc);
+  relu_desc->AddOutputDesc(tensor_desc);
+  (void)AttrUtils::SetInt(relu_desc, "mode", relu_attr);
+  auto output_desc = std::make_shared<OpDesc>("output", NETOUTPUT);
+  output_desc->AddInputDesc(tensor_desc);
+
+  NodePtr relu = relu_first ? graph->AddNode(relu_desc) : nullptr;
+  NodePtr data = graph->AddNode(data_desc);
+  NodePtr output = graph->AddNode(output_desc);
+  if (!relu_first) {
+    relu = graph->AddNode(relu_desc);
+  }
+  (void)GraphUtils::AddEdge(data->GetOutDataAnchor(0), relu->GetInDataAnchor(0));
+  (void)GraphUtils::AddEdge(relu->GetOutDataAnchor(0), output->GetInDataAnchor(0));
+  return graph;
+}
+
+// var -> netoutput, the var output offset is the address the model was built with
+GeModelPtr BuildVarModel(int64_t var_addr) {
+  ComputeGraphPtr graph = std::make_shared<ComputeGraph>("var_graph");
+  GeTensorDesc tensor_desc(GeShape({16}), FORMAT_ND, DT_FLOAT);
+  TensorUtils::SetSize(tensor_desc, 64);
+  auto var_desc = std::make_shared<OpDesc>("var", VARIABLE);
+  var_desc->AddOutputDesc(tensor_desc);
+  var_desc->SetOutputOffset({var_addr});
+  auto output_desc = std::make_shared<OpDesc>("output", NETOUTPUT);
+  output_desc->AddInputDesc(tensor_desc);
+  output_desc->SetInputOffset({var_addr});
+  NodePtr var = graph->AddNode(var_desc);
+  NodePtr output = graph->AddNode(output_desc);
+  (void)GraphUtils::AddEdge(var->GetOutDataAnchor(0), output->GetInDataAnchor(0));
+
+  GeModelPtr ge_model = std::make_shared<GeModel>();
+  ge_model->SetName("var_model");
+  ge_model->SetGraph(GraphUtils::CreateGraphFromComputeGraph(graph));
+  auto model_task_def = std::make_shared<domi::ModelTaskDef>();
+  model_task_def->set_stream_num(1);
+  ge_model->SetModelTaskDef(model_task_def);
+  uint8_t weights[16] = {0};
+  ge_model->SetWeight(Buffer::CopyFrom(weights, sizeof(weights)));
+  return ge_model;
+}
+
+std::vector<GeTensor> BuildInputs(int64_t batch) {
+  return {GeTensor(GeTensorDesc(GeShape({batch, 3, 8, 8}), FORMAT_NCHW, DT_FLOAT))};
+}
+}  // namespace
+
+class UtestGraphCompileCache : public testing::Test {
+ protected:
+  void SetUp() {
+    char dir_template[] = "/tmp/ge_compile_cache_XXXXXX";
+    ASSERT_NE(mkdtemp(dir_template), nullptr);
+    cache_dir_ = dir_template;
+  }
+
+  void TearDown() { (void)system(("rm -rf " + cache_dir_).c_str()); }
+
+  std::string cache_dir_;
+};
+
+TEST_F(UtestGraphCompileCache, disabled_without_option) {
+  GraphCompileCache cache;
+  EXPECT_EQ(cache.Initialize({}), SUCCESS);
+  EXPECT_FALSE(cache.IsEnabled());
+}
+
+TEST_F(UtestGraphCompileCache, key_is_canonical) {
+  GraphCompileCache cache;
+  EXPECT_EQ(cache.Initialize({{GRAPH_COMPILE_CACHE_DIR, cache_dir_}}), SUCCESS);
+  EXPECT_TRUE(cache.IsEnabled());
+
+  std::string key;
+  std::string reordered_key;
+  EXPECT_EQ(cache.GenerateKey(BuildGraph(false), BuildInputs(1), key), SUCCESS);
+  EXPECT_EQ(cache.GenerateKey(BuildGraph(true), BuildInputs(1), reordered_key), SUCCESS);
+  EXPECT_EQ(key.size(), 32);
+  EXPECT_EQ(key, reordered_key);
+
+  std::string other_key;
+  EXPECT_EQ(cache.GenerateKey(BuildGraph(false, 1), BuildInputs(1), other_key), SUCCESS);
+  EXPECT_NE(key, other_key);
+  EXPECT_EQ(cache.GenerateKey(BuildGraph(false), BuildInputs(2), other_key), SUCCESS);
+  EXPECT_NE(key, other_key);
+
+  // another option set must not share models
+  GraphCompileCache other_cache;
+  EXPECT_EQ(other_cache.Initialize({{GRAPH_COMPILE_CACHE_DIR, cache_dir_}, {STREAM_NUM, "2"}}), SUCCESS);
+  EXPECT_EQ(other_cache.GenerateKey(BuildGraph(false), BuildInputs(1), other_key), SUCCESS);
+  EXPECT_NE(key, other_key);
+}
+
+TEST_F(UtestGraphCompileCache, save_and_load_model) {
+  GraphCompileCache cache;
+  EXPECT_EQ(cache.Initialize({{GRAPH_COMPILE_CACHE_DIR, cache_dir_}}), SUCCESS);
+  std::string key;
+  EXPECT_EQ(cache.GenerateKey(BuildGraph(false), BuildInputs(1), key), SUCCESS);
+
+  GeModelPtr loaded_model = nullptr;
+  EXPECT_NE(cache.Load(key, loaded_model), SUCCESS);
+
+  GeModelPtr ge_model = std::make_shared<GeModel>();
+  ge_model->SetName("cache_model");
+  ge_model->SetGraph(GraphUtils::CreateGraphFromComputeGraph(BuildGraph(false)));
+  auto model_task_def = std::make_shared<domi::ModelTaskDef>();
+  model_task_def->set_stream_num(1);
+  ge_model->SetModelTaskDef(model_task_def);
+  uint8_t weights[16] = {1, 2, 3, 4};
+  ge_model->SetWeight(Buffer::CopyFrom(weights, sizeof(weights)));
+  (void)AttrUtils::SetInt(ge_model, ATTR_MODEL_STREAM_NUM, 1);
+  EXPECT_EQ(cache.Save(key, ge_model), SUCCESS);
+  EXPECT_EQ(access(cache.GetModelPath(key).c_str(), R_OK), 0);
+
+  EXPECT_EQ(cache.Load(key, loaded_model), SUCCESS);
+  ASSERT_NE(loaded_model, nullptr);
+  EXPECT_EQ(loaded_model->GetName(), "cache_model");
+  EXPECT_EQ(loaded_model->GetWeightSize(), sizeof(weights));
+  EXPECT_EQ(loaded_model->GetWeightData()[3], 4);
+  ComputeGraphPtr loaded_graph = GraphUtils::GetComputeGraph(loaded_model->GetGraph());
+  ASSERT_NE(loaded_graph, nullptr);
+  EXPECT_NE(loaded_graph->FindNode("relu"), nullptr);
+  int64_t stream_num = 0;
+  EXPECT_TRUE(AttrUtils::GetInt(loaded_model, ATTR_MODEL_STREAM_NUM, stream_num));
+  EXPECT_EQ(stream_num, 1);
+}
+
+TEST_F(UtestGraphCompileCache, load_mismatch_rolls_back_vars) {
+  const uint64_t session_id = 200;
+  VarManager *var_manager = VarManager::Instance(session_id);
+  ASSERT_NE(var_manager, nullptr);
+  EXPECT_EQ(var_manager->Init(0, session_id, 0, 0), SUCCESS);
+
+  GraphManager graph_manager;
+  EXPECT_EQ(graph_manager.compile_cache_.Initialize({{GRAPH_COMPILE_CACHE_DIR, cache_dir_}}), SUCCESS);
+  auto graph_node = std::make_shared<GraphNode>(1);
+  EXPECT_EQ(graph_manager.compile_cache_.Save("stale_key", BuildVarModel(1)), SUCCESS);
+
+  // The session would give var another address, nothing the cached graph assigned is left behind
+  GeModelPtr ge_model = nullptr;
+  EXPECT_NE(graph_manager.LoadFromCompileCache(graph_node, "stale_key", session_id, ge_model), SUCCESS);
+  EXPECT_EQ(ge_model, nullptr);
+  EXPECT_FALSE(var_manager->IsVarExist("var"));
+  EXPECT_EQ(var_manager->GetVarMemSize(RT_MEMORY_HBM), 0);
+
+  // A var already in the session at the cached address is a hit and is kept
+  GeTensorDesc tensor_desc(GeShape({16}), FORMAT_ND, DT_FLOAT);
+  TensorUtils::SetSize(tensor_desc, 64);
+  EXPECT_EQ(var_manager->AssignVarMem("var", tensor_desc, RT_MEMORY_HBM), SUCCESS);
+  uint8_t *var_addr = nullptr;
+  EXPECT_EQ(var_manager->GetVarAddr("var", tensor_desc, &var_addr), SUCCESS);
+  EXPECT_EQ(graph_manager.compile_cache_.Save("hit_key", BuildVarModel(reinterpret_cast<int64_t>(var_addr))), SUCCESS);
+  EXPECT_EQ(graph_manager.LoadFromCompileCache(graph_node, "hit_key", session_id, ge_model), SUCCESS);
+  EXPECT_NE(ge_model, nullptr);
+  EXPECT_TRUE(var_manager->IsVarExist("var"));
+  var_manager->Destroy();
+}
+}  // namespace ge
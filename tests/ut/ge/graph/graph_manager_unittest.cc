@@ -0,0 +1,57 @@
+/**
+ * Copyright 2019-2020 Huawei Technologies Co., Ltd
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <gtest/gtest.h>
+
+#include <map>
+#include <string>
+
+#include "ge/ge_api_types.h"
+
+#define private public
+#include "graph/manager/graph_manager.h"
+#undef private
+
+namespace ge {
+class UtestGraphManager : public testing::Test {
+ protected:
+  void SetUp() {}
+
+  void TearDown() {}
+};
+
+TEST_F(UtestGraphManager, parse_stream_op_cost) {
+  std::map<std::string, int> op_costs;
+  EXPECT_EQ(GraphManager::ParseOpCostOption({}, STREAM_OP_COST, op_costs), SUCCESS);
+  EXPECT_TRUE(op_costs.empty());
+
+  // op types are not engine names, a cost may be 0
+  std::map<std::string, std::string> options = {{STREAM_OP_COST, "Conv2D:120, Relu : 5,Reshape:0"}};
+  EXPECT_EQ(GraphManager::ParseOpCostOption(options, STREAM_OP_COST, op_costs), SUCCESS);
+  std::map<std::string, int> expected_costs = {{"Conv2D", 120}, {"Relu", 5}, {"Reshape", 0}};
+  EXPECT_EQ(op_costs, expected_costs);
+}
+
+TEST_F(UtestGraphManager, parse_invalid_stream_op_cost) {
+  std::map<std::string, int> op_costs;
+  for (const std::string &value : {"Conv2D", "Conv2D:", ":3", "Conv2D:-1", "Conv2D:1x", "Conv2D:99999999999",
+                                   "Conv2D:1,Conv2D:2"}) {
+    std::map<std::string, std::string> options = {{STREAM_OP_COST, value}};
+    EXPECT_EQ(GraphManager::ParseOpCostOption(options, STREAM_OP_COST, op_costs), GE_GRAPH_OPTIONS_INVALID)
+        << value;
+  }
+}
+}  // namespace ge
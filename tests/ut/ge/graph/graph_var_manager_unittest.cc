@@ -0,0 +1,194 @@
+/**
+ * Copyright 2019-2020 Huawei Technologies Co., Ltd
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <gtest/gtest.h>
+
+#include "graph/utils/tensor_utils.h"
+
+#define private public
+#include "graph/manager/graph_var_manager.h"
+#undef private
+
+namespace ge {
+namespace {
+const uint64_t kTestSessionId = 100;
+
+GeTensorDesc CreateVarDesc(uint32_t size, Format format = FORMAT_NCHW) {
+  GeTensorDesc tensor_desc(GeShape({1}), format, DT_FLOAT);
+  TensorUtils::SetSize(tensor_desc, size);
+  return tensor_desc;
+}
+
+uint64_t GetVarOffset(VarManager *var_manager, const std::string &var_name, const GeTensorDesc &tensor_desc) {
+  uint8_t *logic_addr = nullptr;
+  EXPECT_EQ(var_manager->GetVarAddr(var_name, tensor_desc, &logic_addr), SUCCESS);
+  return reinterpret_cast<uint64_t>(logic_addr) - var_manager->GetVarMemLogicBase();
+}
+}  // namespace
+
+class UtestGraphVarManager : public testing::Test {
+ protected:
+  void SetUp() {
+    var_manager_ = VarManager::Instance(kTestSessionId);
+    ASSERT_NE(var_manager_, nullptr);
+    EXPECT_EQ(var_manager_->Init(0, kTestSessionId, 0, 0), SUCCESS);
+  }
+  void TearDown() { var_manager_->Destroy(); }
+
+  VarManager *var_manager_ = nullptr;
+};
+
+TEST_F(UtestGraphVarManager, mem_resource_best_fit_and_coalesce) {
+  MemResource mem_resource;
+  size_t offset_a = 0;
+  size_t offset_b = 0;
+  size_t offset_c = 0;
+  size_t offset_d = 0;
+  EXPECT_EQ(mem_resource.AssignVarMem("a", 1024, kTestSessionId, offset_a), SUCCESS);
+  EXPECT_EQ(mem_resource.AssignVarMem("b", 4096, kTestSessionId, offset_b), SUCCESS);
+  EXPECT_EQ(mem_resource.AssignVarMem("c", 512, kTestSessionId, offset_c), SUCCESS);
+  EXPECT_EQ(mem_resource.AssignVarMem("d", 1024, kTestSessionId, offset_d), SUCCESS);
+  int64_t high_water = mem_resource.GetVarMemSize();
+
+  // Holes of 2048 and 1536 bytes, the smaller one fits a 512 BYTE var
+  mem_resource.FreeVarMem("a");
+  mem_resource.FreeVarMem("c");
+  VarMemStatistics statistics;
+  mem_resource.GetVarMemStatistics(statistics);
+  EXPECT_EQ(statistics.free_block_num, 2);
+  EXPECT_EQ(statistics.free_size, 2048 + 1536);
+  EXPECT_GT(statistics.fragmentation, 0.0);
+
+  size_t offset_e = 0;
+  EXPECT_EQ(mem_resource.AssignVarMem("e", 100, kTestSessionId, offset_e), SUCCESS);
+  EXPECT_EQ(offset_e, offset_c);
+  EXPECT_EQ(mem_resource.GetVarMemSize(), high_water);
+
+  // Freeing b merges it with the hole left by a
+  mem_resource.FreeVarMem("b");
+  mem_resource.GetVarMemStatistics(statistics);
+  EXPECT_EQ(statistics.free_block_num, 1);
+  EXPECT_EQ(statistics.max_free_block_size, 2048 + 5120);
+
+  // Freeing the top var lowers the high water mark down to e
+  mem_resource.FreeVarMem("d");
+  EXPECT_EQ(mem_resource.GetVarMemSize(), offset_d);
+  mem_resource.FreeVarMem("e");
+  mem_resource.GetVarMemStatistics(statistics);
+  EXPECT_EQ(mem_resource.GetVarMemSize(), 0);
+  EXPECT_EQ(statistics.used_size, 0);
+  EXPECT_EQ(statistics.free_block_num, 0);
+}
+
+TEST_F(UtestGraphVarManager, mem_resource_best_fit_prefers_smallest_hole) {
+  MemResource mem_resource;
+  std::vector<size_t> offsets(5, 0);
+  std::vector<uint64_t> sizes = {8192, 512, 2048, 512, 1024};
+  for (size_t i = 0; i < sizes.size(); ++i) {
+    EXPECT_EQ(mem_resource.AssignVarMem("var_" + std::to_string(i), sizes[i], kTestSessionId, offsets[i]), SUCCESS);
+  }
+  mem_resource.FreeVarMem("var_0");
+  mem_resource.FreeVarMem("var_2");
+
+  // Holes of 9216 and 3072 bytes, a 1536 BYTE var goes to the smaller one and leaves the rest free
+  size_t offset = 0;
+  EXPECT_EQ(mem_resource.AssignVarMem("fit", 512, kTestSessionId, offset), SUCCESS);
+  EXPECT_EQ(offset, offsets[2]);
+  EXPECT_EQ(mem_resource.AssignVarMem("fit_rest", 512, kTestSessionId, offset), SUCCESS);
+  EXPECT_EQ(offset, offsets[2] + 1536);
+
+  // Only the 9216 BYTE hole fits a 5120 BYTE block
+  EXPECT_EQ(mem_resource.AssignVarMem("big", 4096, kTestSessionId, offset), SUCCESS);
+  EXPECT_EQ(offset, offsets[0]);
+  VarMemStatistics statistics;
+  mem_resource.GetVarMemStatistics(statistics);
+  EXPECT_EQ(statistics.free_block_num, 1);
+  EXPECT_EQ(statistics.free_size, 9216 - 5120);
+}
+
+TEST_F(UtestGraphVarManager, free_var_mem_reuses_deleted_var) {
+  GeTensorDesc desc = CreateVarDesc(2048);
+  EXPECT_EQ(var_manager_->AssignVarMem("kept", desc, RT_MEMORY_HBM), SUCCESS);
+  EXPECT_EQ(var_manager_->AssignVarMem("deleted", desc, RT_MEMORY_HBM), SUCCESS);
+  EXPECT_EQ(var_manager_->AssignVarMem("top", desc, RT_MEMORY_HBM), SUCCESS);
+  uint64_t deleted_offset = GetVarOffset(var_manager_, "deleted", desc);
+
+  EXPECT_EQ(var_manager_->FreeVarMem("deleted"), SUCCESS);
+  EXPECT_TRUE(var_manager_->IsVarExist("kept", desc));
+  EXPECT_FALSE(var_manager_->IsVarExist("deleted", desc));
+
+  // The released block is reused by the next var instead of growing the arena
+  int64_t var_mem_size = var_manager_->GetVarMemSize(RT_MEMORY_HBM);
+  EXPECT_EQ(var_manager_->AssignVarMem("new_var", desc, RT_MEMORY_HBM), SUCCESS);
+  EXPECT_EQ(GetVarOffset(var_manager_, "new_var", desc), deleted_offset);
+  EXPECT_EQ(var_manager_->GetVarMemSize(RT_MEMORY_HBM), var_mem_size);
+
+  VarMemStatistics statistics;
+  EXPECT_EQ(var_manager_->GetVarMemStatistics(RT_MEMORY_HBM, statistics), SUCCESS);
+  EXPECT_EQ(statistics.used_size, 3 * (2048 + 1024));
+}
+
+TEST_F(UtestGraphVarManager, add_delete_var_loop_no_leak) {
+  GeTensorDesc desc = CreateVarDesc(1024 * 1024);
+  int64_t first_size = 0;
+  for (uint32_t i = 0; i < 100; ++i) {
+    std::string var_name = "var_" + std::to_string(i);
+    EXPECT_EQ(var_manager_->AssignVarMem(var_name, desc, RT_MEMORY_HBM), SUCCESS);
+    EXPECT_EQ(var_manager_->AssignVarMem(var_name, CreateVarDesc(1024 * 1024, FORMAT_NC1HWC0), RT_MEMORY_HBM),
+              SUCCESS);
+    if (i == 0) {
+      first_size = var_manager_->GetVarMemSize(RT_MEMORY_HBM);
+    }
+    EXPECT_EQ(var_manager_->GetVarMemSize(RT_MEMORY_HBM), first_size);
+    EXPECT_EQ(var_manager_->FreeVarMem(var_name), SUCCESS);
+  }
+  EXPECT_EQ(var_manager_->GetVarMemSize(RT_MEMORY_HBM), 0);
+}
+
+TEST_F(UtestGraphVarManager, add_remove_graphs_var_mem_stays_flat) {
+  const std::vector<std::string> var_names = {"w0", "w1", "w2"};
+  GeTensorDesc nchw_desc = CreateVarDesc(64 * 1024);
+  GeTensorDesc nc1hwc0_desc = CreateVarDesc(64 * 1024, FORMAT_NC1HWC0);
+  for (const auto &var_name : var_names) {
+    EXPECT_EQ(var_manager_->AssignVarMem(var_name, nchw_desc, RT_MEMORY_HBM), SUCCESS);
+  }
+  VarMemStatistics statistics;
+  EXPECT_EQ(var_manager_->GetVarMemStatistics(RT_MEMORY_HBM, statistics), SUCCESS);
+  uint64_t used_size = statistics.used_size;
+  int64_t max_var_mem_size = 0;
+
+  // Every graph lays the vars out again when it is built and moves their data to the new layout when it is loaded
+  for (uint32_t graph_id = 1; graph_id <= 100; ++graph_id) {
+    const GeTensorDesc &old_desc = (graph_id % 2 == 1) ? nchw_desc : nc1hwc0_desc;
+    const GeTensorDesc &new_desc = (graph_id % 2 == 1) ? nc1hwc0_desc : nchw_desc;
+    for (const auto &var_name : var_names) {
+      ASSERT_FALSE(var_manager_->IsVarExist(var_name, new_desc));
+      EXPECT_EQ(var_manager_->AssignVarMem(var_name, new_desc, RT_MEMORY_HBM), SUCCESS);
+      EXPECT_NE(var_manager_->FreeVarLayout(var_name, new_desc), SUCCESS);
+      EXPECT_EQ(var_manager_->FreeVarLayout(var_name, old_desc), SUCCESS);
+      EXPECT_FALSE(var_manager_->IsVarExist(var_name, old_desc));
+      EXPECT_TRUE(var_manager_->IsVarExist(var_name, new_desc));
+    }
+
+    EXPECT_EQ(var_manager_->GetVarMemStatistics(RT_MEMORY_HBM, statistics), SUCCESS);
+    EXPECT_EQ(statistics.used_size, used_size);
+    if (graph_id == 1) {
+      max_var_mem_size = var_manager_->GetVarMemSize(RT_MEMORY_HBM);
+    }
+    EXPECT_LE(var_manager_->GetVarMemSize(RT_MEMORY_HBM), max_var_mem_size);
+  }
+}
+}  // namespace ge
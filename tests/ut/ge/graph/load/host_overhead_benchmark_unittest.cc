@@ -0,0 +1,250 @@
+/**
+ * Copyright 2019-2020 Huawei Technologies Co., Ltd
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <gtest/gtest.h>
+#include <unistd.h>
+#include <chrono>
+#include <map>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "common/helper/model_helper.h"
+#include "common/types.h"
+#include "executor/ge_executor.h"
+#include "graph/debug/ge_attr_define.h"
+#include "graph/load/new_model_manager/davinci_model.h"
+#include "graph/manager/graph_mem_allocator.h"
+#include "graph/utils/attr_utils.h"
+#include "graph/utils/graph_utils.h"
+#include "graph/utils/tensor_utils.h"
+#include "proto/task.pb.h"
+#include "runtime/mem.h"
+#include "runtime_stub.h"
+
+using namespace std;
+using namespace ge;
+
+namespace {
+// a chain of memcpy layers over one feature map, every layer is one task
+const int64_t kLayerNum = 64;
+const int64_t kTensorSize = 1 * 64 * 56 * 56 * 4;
+const uint32_t kRequestNum = 200;
+const char *const kModelFile = "host_overhead_benchmark.om";
+
+class Stopwatch {
+ public:
+  Stopwatch() : start_(chrono::steady_clock::now()), injected_start_(runtime_stub::GetInjectedLatency()) {}
+
+  // wall time since start, in us
+  double Elapsed() const {
+    return chrono::duration<double, micro>(chrono::steady_clock::now() - start_).count();
+  }
+
+  // wall time since start without the latency injected by the runtime, in us
+  double HostElapsed() const {
+    return Elapsed() - static_cast<double>(runtime_stub::GetInjectedLatency() - injected_start_) / 1000;
+  }
+
+ private:
+  chrono::steady_clock::time_point start_;
+  uint64_t injected_start_;
+};
+}  // namespace
+
+class UtestHostOverheadBenchmark : public testing::Test {
+ protected:
+  void SetUp() {
+    runtime_stub::Reset();
+    // latency of a small device, host overhead is measured without it
+    runtime_stub::SetLatency("rtModelExecute", {50000, 0});
+    runtime_stub::SetLatency("rtMalloc", {10000, 0});
+    runtime_stub::SetLatency("rtMemcpy", {2000, 100});
+  }
+
+  void TearDown() {
+    runtime_stub::Reset();
+    (void)unlink(kModelFile);
+  }
+
+  static GeModelPtr BuildModel() {
+    ComputeGraphPtr graph = make_shared<ComputeGraph>("host_overhead_benchmark");
+    GeTensorDesc tensor_desc(GeShape({1, 64, 56, 56}), FORMAT_NCHW, DT_FLOAT);
+    TensorUtils::SetSize(tensor_desc, kTensorSize);
+    GeTensorDesc output_desc = tensor_desc;
+    TensorUtils::SetOutputTensor(output_desc, true);
+
+    auto model_task_def = make_shared<domi::ModelTaskDef>();
+    OpDescPtr data = make_shared<OpDesc>("data", DATA);
+    data->AddInputDesc(tensor_desc);
+    data->AddOutputDesc(tensor_desc);
+    data->SetInputOffset({0});
+    data->SetOutputOffset({0});
+    NodePtr prev = graph->AddNode(data);
+    for (int64_t i = 0; i < kLayerNum; ++i) {
+      OpDescPtr layer = make_shared<OpDesc>("layer_" + to_string(i), MEMCPYASYNC);
+      layer->AddInputDesc(tensor_desc);
+      layer->AddOutputDesc(tensor_desc);
+      layer->SetInputOffset({i * kTensorSize});
+      layer->SetOutputOffset({(i + 1) * kTensorSize});
+      layer->SetStreamId(0);
+      NodePtr node = graph->AddNode(layer);
+      (void)GraphUtils::AddEdge(prev->GetOutDataAnchor(0), node->GetInDataAnchor(0));
+      prev = node;
+
+      domi::TaskDef *task_def = model_task_def->add_task();
+      task_def->set_type(RT_MODEL_TASK_MEMCPY_ASYNC);
+      task_def->set_stream_id(0);
+      domi::MemcpyAsyncDef *memcpy_async = task_def->mutable_memcpy_async();
+      memcpy_async->set_src(i * kTensorSize);
+      memcpy_async->set_dst((i + 1) * kTensorSize);
+      memcpy_async->set_dst_max(kTensorSize);
+      memcpy_async->set_count(kTensorSize);
+      memcpy_async->set_kind(RT_MEMCPY_DEVICE_TO_DEVICE);
+    }
+    OpDescPtr net_output = make_shared<OpDesc>("net_output", NETOUTPUT);
+    net_output->AddInputDesc(tensor_desc);
+    net_output->AddOutputDesc(output_desc);
+    net_output->SetInputOffset({kLayerNum * kTensorSize});
+    NodePtr output = graph->AddNode(net_output);
+    (void)GraphUtils::AddEdge(prev->GetOutDataAnchor(0), output->GetInDataAnchor(0));
+
+    GeModelPtr ge_model = make_shared<GeModel>();
+    ge_model->SetName(graph->GetName());
+    ge_model->SetGraph(GraphUtils::CreateGraphFromComputeGraph(graph));
+    ge_model->SetModelTaskDef(model_task_def);
+    ge_model->SetWeight(Buffer(kTensorSize));
+    (void)AttrUtils::SetInt(ge_model, ATTR_MODEL_MEMORY_SIZE, (kLayerNum + 1) * kTensorSize);
+    (void)AttrUtils::SetInt(ge_model, ATTR_MODEL_WEIGHT_SIZE, kTensorSize);
+    (void)AttrUtils::SetInt(ge_model, ATTR_MODEL_STREAM_NUM, 1);
+    (void)AttrUtils::SetInt(ge_model, ATTR_MODEL_EVENT_NUM, 0);
+    return ge_model;
+  }
+
+  // measurements go to the test properties, e.g. the xml of --gtest_output, instead of stdout
+  static void Report(const string &phase, double host_us, uint64_t calls, uint32_t times = 1) {
+    RecordProperty(phase + "_host_us", to_string(host_us / times));
+    RecordProperty(phase + "_runtime_calls", to_string(static_cast<double>(calls) / times));
+  }
+};
+
+/// load the model through GeExecutor, ModelManager and DavinciModel and run it request by request,
+/// the runtime calls of every request must be the same and no device memory is left after unload.
+TEST_F(UtestHostOverheadBenchmark, load_and_run_through_ge_executor) {
+  GeExecutor ge_executor;
+  ASSERT_EQ(ge_executor.Initialize(), SUCCESS);
+  ModelHelper model_helper;
+  ASSERT_EQ(model_helper.SaveToOmModel(BuildModel(), SaveParam(), kModelFile), SUCCESS);
+  uint64_t base_memory = runtime_stub::GetDeviceMemoryInUse();
+  runtime_stub::ResetDeviceMemoryPeak();
+
+  ModelData model_data;
+  uint32_t model_id = 0;
+  {
+    uint64_t calls = runtime_stub::GetTotalCallCount();
+    Stopwatch stopwatch;
+    ASSERT_EQ(ge_executor.LoadDataFromFile(kModelFile, model_data), SUCCESS);
+    Report("read_model_file", stopwatch.HostElapsed(), runtime_stub::GetTotalCallCount() - calls);
+  }
+  {
+    uint64_t calls = runtime_stub::GetTotalCallCount();
+    Stopwatch stopwatch;
+    ASSERT_EQ(ge_executor.LoadModelFromData(model_id, model_data, nullptr, 0, nullptr, 0), SUCCESS);
+    Report("load_model", stopwatch.HostElapsed(), runtime_stub::GetTotalCallCount() - calls);
+  }
+  uint64_t loaded_memory = runtime_stub::GetDeviceMemoryInUse();
+  EXPECT_GE(loaded_memory - base_memory, static_cast<uint64_t>((kLayerNum + 1) * kTensorSize));
+  EXPECT_GE(runtime_stub::GetDeviceMemoryPeak(), loaded_memory);
+  RecordProperty("device_memory_after_load", to_string(loaded_memory - base_memory));
+  RecordProperty("device_memory_peak", to_string(runtime_stub::GetDeviceMemoryPeak() - base_memory));
+
+  vector<uint8_t> input(kTensorSize);
+  vector<uint8_t> output(kTensorSize);
+  RunModelData input_data;
+  input_data.index = 0;
+  input_data.model_id = model_id;
+  input_data.blobs.emplace_back(input.data(), kTensorSize, false);
+  RunModelData output_data;
+  output_data.index = 0;
+  output_data.model_id = model_id;
+  output_data.blobs.emplace_back(output.data(), kTensorSize, false);
+
+  // first request may initialize lazily, it is not part of the steady state
+  uint64_t calls = runtime_stub::GetTotalCallCount();
+  Stopwatch first_stopwatch;
+  ASSERT_EQ(ge_executor.ExecModel(model_id, nullptr, input_data, output_data), SUCCESS);
+  uint64_t first_request_calls = runtime_stub::GetTotalCallCount() - calls;
+  Report("first_request", first_stopwatch.HostElapsed(), first_request_calls);
+
+  auto call_counts = runtime_stub::GetCallCounts();
+  calls = runtime_stub::GetTotalCallCount();
+  Stopwatch stopwatch;
+  for (uint32_t i = 0; i < kRequestNum; ++i) {
+    uint64_t request_calls = runtime_stub::GetTotalCallCount();
+    ASSERT_EQ(ge_executor.ExecModel(model_id, nullptr, input_data, output_data), SUCCESS);
+    EXPECT_LE(runtime_stub::GetTotalCallCount() - request_calls, first_request_calls);
+  }
+  double host_us = stopwatch.HostElapsed();
+  uint64_t steady_calls = runtime_stub::GetTotalCallCount() - calls;
+  Report("steady_request", host_us, steady_calls, kRequestNum);
+  EXPECT_EQ(steady_calls % kRequestNum, 0);
+  for (const auto &call_count : runtime_stub::GetCallCounts()) {
+    uint64_t request_calls = call_count.second - call_counts[call_count.first];
+    // every request makes the same calls of each api
+    EXPECT_EQ(request_calls % kRequestNum, 0) << call_count.first;
+    if (request_calls != 0) {
+      RecordProperty(call_count.first + "_per_request", to_string(request_calls / kRequestNum));
+    }
+  }
+  EXPECT_EQ(runtime_stub::GetCallCount("rtModelExecute") - call_counts["rtModelExecute"], kRequestNum);
+  EXPECT_EQ(runtime_stub::GetDeviceMemoryInUse(), loaded_memory);
+
+  EXPECT_EQ(ge_executor.UnloadModel(model_id), SUCCESS);
+  EXPECT_EQ(runtime_stub::GetDeviceMemoryInUse(), base_memory);
+  EXPECT_EQ(ge_executor.ReleaseModelData(model_data), SUCCESS);
+}
+
+/// time the load phases one by one, parsing the om and each step of DavinciModel::Init are recorded.
+TEST_F(UtestHostOverheadBenchmark, load_time_breakdown) {
+  ASSERT_EQ(MemManager::Instance().Initialize(vector<rtMemType_t>({RT_MEMORY_HBM})), SUCCESS);
+  ModelHelper save_helper;
+  ASSERT_EQ(save_helper.SaveToOmModel(BuildModel(), SaveParam(), kModelFile), SUCCESS);
+  GeExecutor ge_executor;
+  ModelData model_data;
+  ASSERT_EQ(ge_executor.LoadDataFromFile(kModelFile, model_data), SUCCESS);
+
+  ModelHelper model_helper;
+  uint64_t calls = runtime_stub::GetTotalCallCount();
+  Stopwatch parse_stopwatch;
+  ASSERT_EQ(model_helper.LoadModel(model_data), SUCCESS);
+  Report("parse_om", parse_stopwatch.HostElapsed(), runtime_stub::GetTotalCallCount() - calls);
+
+  DavinciModel davinci_model(0, nullptr);
+  calls = runtime_stub::GetTotalCallCount();
+  Stopwatch assign_stopwatch;
+  ASSERT_EQ(davinci_model.Assign(model_helper.GetGeModel()), SUCCESS);
+  Report("assign", assign_stopwatch.HostElapsed(), runtime_stub::GetTotalCallCount() - calls);
+
+  uint64_t malloc_calls = runtime_stub::GetCallCount("rtMalloc");
+  calls = runtime_stub::GetTotalCallCount();
+  Stopwatch init_stopwatch;
+  ASSERT_EQ(davinci_model.Init(), SUCCESS);
+  Report("init", init_stopwatch.HostElapsed(), runtime_stub::GetTotalCallCount() - calls);
+  RecordProperty("init_rtMalloc", to_string(runtime_stub::GetCallCount("rtMalloc") - malloc_calls));
+  EXPECT_EQ(davinci_model.GetTaskList().size(), static_cast<size_t>(kLayerNum));
+
+  EXPECT_EQ(ge_executor.ReleaseModelData(model_data), SUCCESS);
+}
@@ -0,0 +1,111 @@
+/**
+ * Copyright 2019-2020 Huawei Technologies Co., Ltd
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <gtest/gtest.h>
+
+#include <thread>
+#include <vector>
+
+#define private public
+#include "graph/load/new_model_manager/args_arena.h"
+#undef private
+
+using namespace std;
+
+namespace ge {
+class UtestModelManagerArgsArena : public testing::Test {
+ protected:
+  void SetUp() {}
+
+  void TearDown() {}
+};
+
+TEST_F(UtestModelManagerArgsArena, reserve_aligned_blocks) {
+  ArgsArena arena(RT_MEMORY_HBM);
+  EXPECT_EQ(arena.GetDevAddr(0), nullptr);
+
+  uint8_t args[10] = {1, 2, 3, 4, 5, 6, 7, 8, 9, 10};
+  size_t first = 1;
+  size_t second = 0;
+  EXPECT_EQ(arena.Reserve(args, sizeof(args), first), SUCCESS);
+  EXPECT_EQ(arena.Reserve(nullptr, 16, second), SUCCESS);
+  EXPECT_EQ(first, 0);
+  EXPECT_EQ(second, ArgsArena::kAlignment);
+  EXPECT_EQ(arena.GetSize(), ArgsArena::kAlignment + 16);
+  EXPECT_EQ(arena.host_image_[9], 10);
+  EXPECT_EQ(arena.host_image_[10], 0);
+  EXPECT_EQ(arena.host_image_[second], 0);
+
+  // The pointer must lie in the arena
+  EXPECT_EQ(arena.AddReloc(second + 12, first), PARAM_INVALID);
+  EXPECT_EQ(arena.AddReloc(second, first), SUCCESS);
+
+  EXPECT_EQ(arena.Commit(), SUCCESS);
+  uint8_t *base = static_cast<uint8_t *>(arena.GetDevAddr(first));
+  ASSERT_NE(base, nullptr);
+  EXPECT_EQ(arena.GetDevAddr(second), base + second);
+  EXPECT_EQ(arena.GetSize(), ArgsArena::kAlignment + 16);
+  EXPECT_TRUE(arena.host_image_.empty());
+
+  // Nothing can be added once the arena is on device
+  size_t offset = 0;
+  EXPECT_EQ(arena.Reserve(args, sizeof(args), offset), PARAM_INVALID);
+
+  arena.Release();
+  EXPECT_EQ(arena.GetDevAddr(first), nullptr);
+  EXPECT_EQ(arena.GetSize(), 0);
+  EXPECT_EQ(arena.Reserve(args, sizeof(args), offset), SUCCESS);
+  EXPECT_EQ(offset, 0);
+}
+
+TEST_F(UtestModelManagerArgsArena, empty_arena_commit) {
+  ArgsArena arena(RT_MEMORY_SPM);
+  EXPECT_EQ(arena.Commit(), SUCCESS);
+  EXPECT_EQ(arena.GetDevAddr(0), nullptr);
+}
+
+TEST_F(UtestModelManagerArgsArena, reserve_from_threads) {
+  const size_t kThreadNum = 8;
+  const size_t kBlockNum = 1000;
+  ArgsArena arena(RT_MEMORY_HBM);
+  vector<vector<size_t>> offsets(kThreadNum, vector<size_t>(kBlockNum));
+  vector<thread> threads;
+  for (size_t i = 0; i < kThreadNum; ++i) {
+    threads.emplace_back([&arena, &offsets, i]() {
+      vector<uint8_t> block(i + 1, static_cast<uint8_t>(i + 1));
+      for (size_t j = 0; j < kBlockNum; ++j) {
+        EXPECT_EQ(arena.Reserve(block.data(), block.size(), offsets[i][j]), SUCCESS);
+      }
+    });
+  }
+  for (auto &t : threads) {
+    t.join();
+  }
+
+  // Every block keeps its own content
+  for (size_t i = 0; i < kThreadNum; ++i) {
+    for (size_t offset : offsets[i]) {
+      EXPECT_EQ(offset % ArgsArena::kAlignment, 0);
+      for (size_t k = 0; k <= i; ++k) {
+        EXPECT_EQ(arena.host_image_[offset + k], i + 1);
+      }
+    }
+  }
+  EXPECT_GT(arena.GetSize(), (kThreadNum * kBlockNum - 1) * ArgsArena::kAlignment);
+  EXPECT_LE(arena.GetSize(), kThreadNum * kBlockNum * ArgsArena::kAlignment);
+  EXPECT_EQ(arena.Commit(), SUCCESS);
+}
+}  // namespace ge
@@ -17,6 +17,8 @@
 
 #include <gtest/gtest.h>
 
+#include <thread>
+
 #include "graph/load/new_model_manager/data_inputer.h"
 
 #include "common/debug/log.h"
@@ -61,4 +63,98 @@ TEST_F(UtestModelManagerDataInputer, success_inputdatawrapper_init) {
   input_data_wrapper = NULL;
 }
 
+/// DataInputer
+/// slots are reused only after release
+TEST_F(UtestModelManagerDataInputer, ring_push_pop_release) {
+  DataInputer data_inputer(3);
+  InputData input_data;
+  OutputData output_data;
+  for (uint32_t i = 0; i < 4; ++i) {
+    input_data.index = i;
+    EXPECT_EQ(data_inputer.Push(input_data, output_data), SUCCESS);
+  }
+  EXPECT_TRUE(data_inputer.IsDataFull());
+  EXPECT_EQ(data_inputer.Push(input_data, output_data), domi::INTERNAL_ERROR);
+
+  InputDataWrapper *data = nullptr;
+  EXPECT_EQ(data_inputer.Pop(data), SUCCESS);
+  ASSERT_NE(data, nullptr);
+  EXPECT_EQ(data->GetInput().index, 0);
+  // popped but not released, still full
+  EXPECT_EQ(data_inputer.Push(input_data, output_data), domi::INTERNAL_ERROR);
+  data_inputer.Release(data);
+  input_data.index = 4;
+  EXPECT_EQ(data_inputer.Push(input_data, output_data), SUCCESS);
+
+  std::vector<InputDataWrapper *> batch;
+  EXPECT_EQ(data_inputer.PopBatch(batch, 8), SUCCESS);
+  ASSERT_EQ(batch.size(), 4);
+  for (uint32_t i = 0; i < batch.size(); ++i) {
+    EXPECT_EQ(batch[i]->GetInput().index, i + 1);
+  }
+  for (auto it = batch.rbegin(); it != batch.rend(); ++it) {
+    data_inputer.Release(*it);
+  }
+  EXPECT_FALSE(data_inputer.IsDataFull());
+
+  data_inputer.Stop();
+  EXPECT_EQ(data_inputer.Pop(data), domi::INTERNAL_ERROR);
+  EXPECT_EQ(data_inputer.Push(input_data, output_data), domi::INTERNAL_ERROR);
+}
+
+/// DataInputer
+/// concurrent producers, every request is popped once and in per producer order
+TEST_F(UtestModelManagerDataInputer, ring_multi_producer) {
+  const uint32_t producer_num = 4;
+  const uint32_t request_num = 20000;
+  DataInputer data_inputer(64);
+
+  std::vector<std::thread> producers;
+  for (uint32_t producer = 0; producer < producer_num; ++producer) {
+    producers.emplace_back([&data_inputer, producer, request_num]() {
+      InputData input_data;
+      OutputData output_data;
+      input_data.model_id = producer;
+      for (uint32_t i = 0; i < request_num; ++i) {
+        input_data.index = i;
+        EXPECT_EQ(data_inputer.Push(input_data, output_data, true), SUCCESS);
+      }
+    });
+  }
+
+  std::vector<uint32_t> next_index(producer_num, 0);
+  uint32_t popped_num = 0;
+  std::vector<InputDataWrapper *> batch;
+  while (popped_num < producer_num * request_num) {
+    ASSERT_EQ(data_inputer.PopBatch(batch, 16), SUCCESS);
+    for (auto data : batch) {
+      const InputData &input_data = data->GetInput();
+      ASSERT_LT(input_data.model_id, producer_num);
+      EXPECT_EQ(input_data.index, next_index[input_data.model_id]);
+      next_index[input_data.model_id] = input_data.index + 1;
+      data_inputer.Release(data);
+    }
+    popped_num += batch.size();
+  }
+  for (auto &producer : producers) {
+    producer.join();
+  }
+  for (auto index : next_index) {
+    EXPECT_EQ(index, request_num);
+  }
+}
+
+/// DataInputer
+/// Stop wakes up the blocked consumer
+TEST_F(UtestModelManagerDataInputer, ring_stop_wakeup) {
+  DataInputer data_inputer;
+  std::thread consumer([&data_inputer]() {
+    InputDataWrapper *data = nullptr;
+    EXPECT_EQ(data_inputer.Pop(data), domi::INTERNAL_ERROR);
+    EXPECT_EQ(data, nullptr);
+  });
+  std::this_thread::sleep_for(std::chrono::milliseconds(20));
+  data_inputer.Stop();
+  consumer.join();
+}
 }  // namespace ge
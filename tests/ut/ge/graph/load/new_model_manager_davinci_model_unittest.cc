@@ -54,6 +54,9 @@
 
 #include "new_op_test_utils.h"
 #include "graph/debug/ge_attr_define.h"
+#include "graph/ge_local_context.h"
+#include "ge/ge_api_types.h"
+#include "runtime_stub.h"
 
 using namespace std;
 using namespace testing;
@@ -84,6 +87,27 @@ class DModelListener : public ge::ModelListener {
 
 shared_ptr<ge::ModelListener> g_label_call_back(new DModelListener());
 
+class CountModelListener : public ge::ModelListener {
+ public:
+  uint32_t OnComputeDone(uint32_t model_id, uint32_t data_index, uint32_t result_code) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    data_indexes_.push_back(data_index);
+    result_codes_.push_back(result_code);
+    cond_.notify_all();
+    return 0;
+  }
+
+  bool WaitDone(size_t count) {
+    std::unique_lock<std::mutex> lock(mutex_);
+    return cond_.wait_for(lock, std::chrono::seconds(5), [&] { return data_indexes_.size() >= count; });
+  }
+
+  std::mutex mutex_;
+  std::condition_variable cond_;
+  vector<uint32_t> data_indexes_;
+  vector<uint32_t> result_codes_;
+};
+
 static ge::OpDescPtr CreateOpDesc(string name = "", string type = "") {
   auto op_desc = std::make_shared<ge::OpDesc>(name, type);
   op_desc->SetStreamId(0);
@@ -751,8 +775,20 @@ TEST_F(UtestModelManagerDavinciModel, success_store_input_output_tensor) {
   input_descs.push_back(input_desc);
   output_descs.push_back(output_desc);
 
+  kernel_task_info->davinci_model_ = &model;
   Status ret = kernel_task_info->StoreInputOutputTensor(input_data_addrs, output_data_addrs, input_descs, output_descs);
   EXPECT_EQ(SUCCESS, ret);
+
+  // the descs and addrs share one device allocation of the model
+  EXPECT_EQ(model.GetArgsArena().Commit(), SUCCESS);
+  EXPECT_EQ(kernel_task_info->UpdateArgsAddr(), SUCCESS);
+  char *base = static_cast<char *>(model.GetArgsArena().GetDevAddr(0));
+  ASSERT_NE(base, nullptr);
+  EXPECT_EQ(kernel_task_info->custom_info_.input_descs, base);
+  EXPECT_EQ(kernel_task_info->custom_info_.input_addrs, base + kernel_task_info->arena_blocks_.input_addrs);
+  EXPECT_EQ(kernel_task_info->custom_info_.output_descs, base + kernel_task_info->arena_blocks_.output_descs);
+  EXPECT_EQ(kernel_task_info->custom_info_.output_addrs, base + kernel_task_info->arena_blocks_.output_addrs);
+  EXPECT_EQ(kernel_task_info->args_, nullptr);
   ret = kernel_task_info->Release();
   EXPECT_EQ(SUCCESS, ret);
   delete kernel_task_info;
@@ -1438,4 +1474,277 @@ TEST_F(UtestModelManagerDavinciModel, init_tbe_handle_ge_registered) {
   EXPECT_EQ(it->second, 3);
   DavinciModel::tvm_bin_kernel_.clear();
 }
+
+TEST_F(UtestModelManagerDavinciModel, pipelined_run_success) {
+  auto listener = make_shared<CountModelListener>();
+  DavinciModel model(0, listener);
+  model.runtime_param_.mem_size = 64;
+  // copies of the stub are only done between its own memory
+  ASSERT_EQ(rtMalloc(reinterpret_cast<void **>(&model.mem_base_), 64, RT_MEMORY_HBM), RT_ERROR_NONE);
+
+  auto data_op = CreateOpDesc("data", "Data");
+  {
+    ge::GeTensorDesc desc(ge::GeShape({1, 1, 1, 4}), ge::FORMAT_NCHW, ge::DT_FLOAT);
+    ge::TensorUtils::SetSize(desc, 16);
+    data_op->AddInputDesc(desc);
+    data_op->AddOutputDesc(desc);
+  }
+  data_op->SetOutputOffset({0});
+  model.data_op_list_.push_back(data_op);
+
+  auto output_op = CreateOpDesc("output", "NetOutput");
+  {
+    ge::GeTensorDesc desc(ge::GeShape({1, 1, 1, 4}), ge::FORMAT_NCHW, ge::DT_FLOAT);
+    ge::TensorUtils::SetSize(desc, 16);
+    output_op->AddInputDesc(desc);
+  }
+  // the stub model does not compute, output the input tensor so every request gets its own input back
+  output_op->SetInputOffset({0});
+  model.output_op_list_.push_back(output_op);
+  model.data_inputer_ = new DataInputer();
+
+  GetThreadLocalContext().SetGlobalOption({{OPTION_EXEC_PIPELINE_DEPTH, "3"}});
+  EXPECT_EQ(model.ModelRunStart(), SUCCESS);
+  EXPECT_EQ(model.PipelineDepth(), 3);
+  EXPECT_EQ(model.pipeline_input_addrs_.size(), 1);
+  EXPECT_EQ(model.pipeline_output_addrs_.size(), 1);
+  EXPECT_NE(model.pipeline_input_stream_, nullptr);
+  EXPECT_NE(model.pipeline_output_stream_, nullptr);
+
+  const uint32_t request_num = 8;
+  vector<float> inputs(request_num * 4, 0.0f);
+  vector<float> outputs(request_num * 4, 0.0f);
+  for (size_t i = 0; i < inputs.size(); ++i) {
+    inputs[i] = static_cast<float>(i + 1);
+  }
+  for (uint32_t i = 0; i < request_num; ++i) {
+    InputData input_data;
+    input_data.index = i;
+    input_data.blobs.push_back({&inputs[i * 4], 16, false});
+    OutputData output_data;
+    output_data.blobs.push_back({&outputs[i * 4], 16, false});
+    auto data_wrapper = make_shared<InputDataWrapper>();
+    EXPECT_EQ(data_wrapper->Init(input_data, output_data), SUCCESS);
+    EXPECT_EQ(model.data_inputer_->Push(data_wrapper), SUCCESS);
+  }
+
+  EXPECT_TRUE(listener->WaitDone(request_num));
+  EXPECT_EQ(model.ModelRunStop(), SUCCESS);
+  EXPECT_EQ(model.PipelineDepth(), 1);
+  EXPECT_TRUE(model.pipeline_slots_.empty());
+
+  EXPECT_EQ(model.pipeline_input_stream_, nullptr);
+  EXPECT_EQ(model.pipeline_output_stream_, nullptr);
+
+  // results are returned in launch order
+  ASSERT_EQ(listener->data_indexes_.size(), request_num);
+  for (uint32_t i = 0; i < request_num; ++i) {
+    EXPECT_EQ(listener->data_indexes_[i], i);
+    EXPECT_EQ(listener->result_codes_[i], SUCCESS);
+  }
+  EXPECT_EQ(outputs, inputs);
+
+  GetThreadLocalContext().SetGlobalOption({});
+  rtFree(model.mem_base_);
+  model.mem_base_ = nullptr;
+}
+
+TEST_F(UtestModelManagerDavinciModel, pipelined_run_stop_returns_inflight) {
+  auto listener = make_shared<CountModelListener>();
+  DavinciModel model(0, listener);
+  model.runtime_param_.mem_size = 64;
+  ASSERT_EQ(rtMalloc(reinterpret_cast<void **>(&model.mem_base_), 64, RT_MEMORY_HBM), RT_ERROR_NONE);
+
+  auto data_op = CreateOpDesc("data", "Data");
+  {
+    ge::GeTensorDesc desc(ge::GeShape({1, 1, 1, 4}), ge::FORMAT_NCHW, ge::DT_FLOAT);
+    ge::TensorUtils::SetSize(desc, 16);
+    data_op->AddInputDesc(desc);
+    data_op->AddOutputDesc(desc);
+  }
+  data_op->SetOutputOffset({0});
+  model.data_op_list_.push_back(data_op);
+  auto output_op = CreateOpDesc("output", "NetOutput");
+  {
+    ge::GeTensorDesc desc(ge::GeShape({1, 1, 1, 4}), ge::FORMAT_NCHW, ge::DT_FLOAT);
+    ge::TensorUtils::SetSize(desc, 16);
+    output_op->AddInputDesc(desc);
+  }
+  output_op->SetInputOffset({0});
+  model.output_op_list_.push_back(output_op);
+  model.data_inputer_ = new DataInputer();
+
+  // slow device, requests are still in flight when the model stops
+  runtime_stub::Reset();
+  runtime_stub::SetLatency("rtEventSynchronize", {2000000, 0});
+  GetThreadLocalContext().SetGlobalOption({{OPTION_EXEC_PIPELINE_DEPTH, "4"}});
+  EXPECT_EQ(model.ModelRunStart(), SUCCESS);
+  EXPECT_EQ(model.PipelineDepth(), 4);
+
+  const uint32_t request_num = 4;
+  vector<float> inputs(request_num * 4, 0.0f);
+  vector<float> outputs(request_num * 4, 0.0f);
+  for (size_t i = 0; i < inputs.size(); ++i) {
+    inputs[i] = static_cast<float>(i + 1);
+  }
+  for (uint32_t i = 0; i < request_num; ++i) {
+    InputData input_data;
+    input_data.index = i;
+    input_data.blobs.push_back({&inputs[i * 4], 16, false});
+    OutputData output_data;
+    output_data.blobs.push_back({&outputs[i * 4], 16, false});
+    auto data_wrapper = make_shared<InputDataWrapper>();
+    EXPECT_EQ(data_wrapper->Init(input_data, output_data), SUCCESS);
+    EXPECT_EQ(model.data_inputer_->Push(data_wrapper), SUCCESS);
+  }
+  // wait until the first request is launched
+  for (int i = 0; (i < 1000) && (runtime_stub::GetCallCount("rtModelExecute") == 0); ++i) {
+    std::this_thread::sleep_for(std::chrono::milliseconds(1));
+  }
+  EXPECT_EQ(model.ModelRunStop(), SUCCESS);
+
+  // every launched request is returned with its outputs, none is left in a slot
+  uint64_t launched_num = runtime_stub::GetCallCount("rtModelExecute");
+  EXPECT_GE(launched_num, 1);
+  ASSERT_EQ(listener->data_indexes_.size(), launched_num);
+  for (uint32_t i = 0; i < launched_num; ++i) {
+    EXPECT_EQ(listener->data_indexes_[i], i);
+    EXPECT_EQ(listener->result_codes_[i], SUCCESS);
+    for (uint32_t j = 0; j < 4; ++j) {
+      EXPECT_EQ(outputs[i * 4 + j], inputs[i * 4 + j]);
+    }
+  }
+  EXPECT_TRUE(model.pipeline_slots_.empty());
+
+  runtime_stub::Reset();
+  GetThreadLocalContext().SetGlobalOption({});
+  rtFree(model.mem_base_);
+  model.mem_base_ = nullptr;
+}
+
+TEST_F(UtestModelManagerDavinciModel, pipelined_run_fallback_serial) {
+  DavinciModel model(0, g_label_call_back);
+  auto data_op = CreateOpDesc("data", "Data");
+  model.data_op_list_.push_back(data_op);
+  model.data_inputer_ = new DataInputer();
+
+  // no NetOutput, model can not be pipelined
+  GetThreadLocalContext().SetGlobalOption({{OPTION_EXEC_PIPELINE_DEPTH, "2"}});
+  EXPECT_FALSE(model.IsPipelineSupported());
+  EXPECT_EQ(model.ModelRunStart(), SUCCESS);
+  EXPECT_EQ(model.PipelineDepth(), 1);
+  EXPECT_EQ(model.ModelRunStop(), SUCCESS);
+  GetThreadLocalContext().SetGlobalOption({});
+}
+
+TEST_F(UtestModelManagerDavinciModel, zero_copy_patch_batched) {
+  DavinciModel model(0, g_label_call_back);
+  uint8_t feature_map[64] = {0};
+  void *input_addr = &feature_map[0];
+  void *output_addr = &feature_map[32];
+  void *weight_addr = &feature_map[48];
+  model.SetOutsideAddr({input_addr, output_addr});
+
+  // two kernels consume the input, the first one twice
+  void *args0[4] = {nullptr};
+  void *args1[2] = {nullptr};
+  model.SetZeroCopyAddr({input_addr, weight_addr, input_addr, output_addr}, args0);
+  model.SetZeroCopyAddr({weight_addr, input_addr}, args1);
+  model.SetZeroCopyAddr({weight_addr}, args1);
+  EXPECT_EQ(model.zero_copy_regions_.size(), 2);
+  EXPECT_EQ(model.zero_copy_table_.size(), 5);
+  EXPECT_EQ(model.zero_copy_table_[1], weight_addr);
+
+  uint8_t user_input[16] = {0};
+  uint8_t user_output[16] = {0};
+  DataBuffer input_buf(user_input, sizeof(user_input), false);
+  DataBuffer output_buf(user_output, sizeof(user_output), false);
+  EXPECT_EQ(model.ZeroCopyImpl(input_addr, input_buf), SUCCESS);
+  EXPECT_EQ(model.ZeroCopyImpl(output_addr, output_buf), SUCCESS);
+  EXPECT_EQ(model.ZeroCopyFlush(), SUCCESS);
+  EXPECT_EQ(model.GetZeroCopyPatchCount(), 2);
+  EXPECT_EQ(model.zero_copy_table_[0], user_input);
+  EXPECT_EQ(model.zero_copy_table_[2], user_input);
+  EXPECT_EQ(model.zero_copy_table_[3], user_output);
+  EXPECT_EQ(model.zero_copy_table_[4], user_input);
+
+  // same user buffers, nothing to patch
+  EXPECT_EQ(model.ZeroCopyImpl(input_addr, input_buf), SUCCESS);
+  EXPECT_EQ(model.ZeroCopyImpl(output_addr, output_buf), SUCCESS);
+  EXPECT_EQ(model.ZeroCopyFlush(), SUCCESS);
+  EXPECT_EQ(model.GetZeroCopyPatchCount(), 0);
+
+  // new output buffer only touches the first kernel
+  uint8_t other_output[16] = {0};
+  DataBuffer other_buf(other_output, sizeof(other_output), false);
+  EXPECT_EQ(model.ZeroCopyImpl(output_addr, other_buf), SUCCESS);
+  EXPECT_EQ(model.ZeroCopyFlush(), SUCCESS);
+  EXPECT_EQ(model.GetZeroCopyPatchCount(), 1);
+
+  // after a failed request every region is written again
+  model.ZeroCopyReset();
+  EXPECT_EQ(model.ZeroCopyImpl(input_addr, input_buf), SUCCESS);
+  EXPECT_EQ(model.ZeroCopyImpl(output_addr, other_buf), SUCCESS);
+  EXPECT_EQ(model.ZeroCopyFlush(), SUCCESS);
+  EXPECT_EQ(model.GetZeroCopyPatchCount(), 2);
+}
+
+TEST_F(UtestModelManagerDavinciModel, zero_copy_patch_arena_spans) {
+  DavinciModel model(0, g_label_call_back);
+  uint8_t feature_map[64] = {0};
+  void *input_addr = &feature_map[0];
+  void *output_addr = &feature_map[32];
+  void *weight_addr = &feature_map[48];
+  model.SetOutsideAddr({input_addr, output_addr});
+
+  // args of two kernels next to each other, a third one far behind them
+  void *args0[3] = {input_addr, weight_addr, input_addr};
+  void *args1[1] = {output_addr};
+  void *args2[1] = {input_addr};
+  size_t offsets[3] = {0};
+  size_t pad_offset = 0;
+  EXPECT_EQ(model.args_arena_.Reserve(args0, sizeof(args0), offsets[0]), SUCCESS);
+  EXPECT_EQ(model.args_arena_.Reserve(args1, sizeof(args1), offsets[1]), SUCCESS);
+  EXPECT_EQ(model.args_arena_.Reserve(nullptr, 16384, pad_offset), SUCCESS);
+  EXPECT_EQ(model.args_arena_.Reserve(args2, sizeof(args2), offsets[2]), SUCCESS);
+  EXPECT_EQ(model.args_arena_.Commit(), SUCCESS);
+  model.SetZeroCopyAddr({input_addr, weight_addr, input_addr}, model.args_arena_.GetDevAddr(offsets[0]));
+  model.SetZeroCopyAddr({output_addr}, model.args_arena_.GetDevAddr(offsets[1]));
+  model.SetZeroCopyAddr({input_addr}, model.args_arena_.GetDevAddr(offsets[2]));
+  ASSERT_EQ(model.zero_copy_regions_.size(), 3);
+  for (size_t i = 0; i < model.zero_copy_regions_.size(); ++i) {
+    EXPECT_TRUE(model.zero_copy_regions_[i].in_arena);
+    EXPECT_EQ(model.zero_copy_regions_[i].arena_offset, offsets[i]);
+  }
+
+  uint8_t user_input[16] = {0};
+  uint8_t user_output[16] = {0};
+  DataBuffer input_buf(user_input, sizeof(user_input), false);
+  DataBuffer output_buf(user_output, sizeof(user_output), false);
+  runtime_stub::Reset();
+  EXPECT_EQ(model.ZeroCopyImpl(input_addr, input_buf), SUCCESS);
+  EXPECT_EQ(model.ZeroCopyImpl(output_addr, output_buf), SUCCESS);
+  EXPECT_EQ(model.ZeroCopyFlush(), SUCCESS);
+  EXPECT_EQ(model.GetZeroCopyPatchCount(), 2);
+  EXPECT_EQ(runtime_stub::GetCallCount("rtMemcpy"), 2);
+
+  // the host image holds the patched addresses, the slots between them are kept
+  auto args0_image = reinterpret_cast<void **>(model.args_arena_.GetHostAddr(offsets[0]));
+  EXPECT_EQ(args0_image[0], user_input);
+  EXPECT_EQ(args0_image[1], weight_addr);
+  EXPECT_EQ(args0_image[2], user_input);
+  EXPECT_EQ(*reinterpret_cast<void **>(model.args_arena_.GetHostAddr(offsets[1])), user_output);
+  EXPECT_EQ(*reinterpret_cast<void **>(model.args_arena_.GetHostAddr(offsets[2])), user_input);
+
+  // only the output changes, one region to copy
+  uint8_t other_output[16] = {0};
+  DataBuffer other_buf(other_output, sizeof(other_output), false);
+  runtime_stub::Reset();
+  EXPECT_EQ(model.ZeroCopyImpl(output_addr, other_buf), SUCCESS);
+  EXPECT_EQ(model.ZeroCopyFlush(), SUCCESS);
+  EXPECT_EQ(model.GetZeroCopyPatchCount(), 1);
+  EXPECT_EQ(runtime_stub::GetCallCount("rtMemcpy"), 1);
+  EXPECT_EQ(*reinterpret_cast<void **>(model.args_arena_.GetHostAddr(offsets[1])), other_output);
+  EXPECT_EQ(args0_image[0], user_input);
+}
 }  // namespace ge
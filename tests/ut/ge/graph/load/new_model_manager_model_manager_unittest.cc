@@ -432,6 +432,41 @@ TEST_F(UtestModelManagerModelManager, check_data_len_success) {
   delete[](char *) data_buffer.data;
 }
 
+TEST_F(UtestModelManagerModelManager, map_model_from_file) {
+  ge::ModelData data;
+  GenUnencryptModelData(data);
+  const std::string model_file = "map_model_from_file.om";
+  FILE *fp = fopen(model_file.c_str(), "wb");
+  ASSERT_NE(fp, nullptr);
+  EXPECT_EQ(fwrite(data.model_data, 1, data.model_len, fp), data.model_len);
+  fclose(fp);
+
+  ge::ModelData mapped;
+  EXPECT_EQ(ModelParserBase::MapFromFile(model_file.c_str(), nullptr, 1, mapped), SUCCESS);
+  ASSERT_EQ(mapped.model_len, data.model_len);
+  EXPECT_EQ(mapped.priority, 1);
+  EXPECT_EQ(memcmp(mapped.model_data, data.model_data, data.model_len), 0);
+  uint8_t *content = nullptr;
+  uint32_t content_len = 0;
+  EXPECT_EQ(ModelParserBase::ParseModelContent(mapped, content, content_len), SUCCESS);
+  EXPECT_TRUE(ModelParserBase::IsMappedModelData(content));
+  EXPECT_TRUE(ModelParserBase::IsMappedModelData(content + content_len - 1));
+  EXPECT_FALSE(ModelParserBase::IsMappedModelData(data.model_data));
+
+  ge::ModelData loaded;
+  EXPECT_EQ(ModelParserBase::LoadFromFile(model_file.c_str(), nullptr, 0, loaded), SUCCESS);
+  EXPECT_EQ(memcmp(mapped.model_data, loaded.model_data, data.model_len), 0);
+  EXPECT_FALSE(ModelParserBase::IsMappedModelData(loaded.model_data));
+
+  ModelParserBase::ReleaseModelData(mapped);
+  ModelParserBase::ReleaseModelData(loaded);
+  ModelParserBase::ReleaseModelData(data);
+  EXPECT_EQ(mapped.model_data, nullptr);
+  EXPECT_EQ(loaded.model_data, nullptr);
+  EXPECT_FALSE(ModelParserBase::IsMappedModelData(content));
+  remove(model_file.c_str());
+}
+
 // test LoadModeldef
 TEST_F(UtestModelManagerModelManager, destroy_aicpu_session) {
   ModelManager manager;
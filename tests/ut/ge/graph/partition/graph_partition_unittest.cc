@@ -0,0 +1,120 @@
+/**
+ * Copyright 2019-2020 Huawei Technologies Co., Ltd
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <gtest/gtest.h>
+
+#include <memory>
+#include <random>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "framework/common/types.h"
+#include "graph/compute_graph.h"
+
+#define private public
+#include "graph/partition/graph_partition.h"
+#undef private
+
+namespace ge {
+namespace {
+const char *const kAicoreEngine = "AIcoreEngine";
+const char *const kAicpuEngine = "DNN_VM_AICPU";
+
+// One cluster per node, clusters are indexed in topological order like GraphPartitioner::Initialize does
+void InitClusters(GraphPartitioner &partitioner, const std::vector<std::string> &engines,
+                  const std::vector<std::pair<size_t, size_t>> &edges) {
+  ComputeGraphPtr graph = std::make_shared<ComputeGraph>("partition_graph");
+  for (size_t i = 0; i < engines.size(); ++i) {
+    NodePtr node = graph->AddNode(std::make_shared<OpDesc>("node" + std::to_string(i), RELU));
+    ClusterPtr cluster = std::make_shared<Cluster>(i, engines[i], "");
+    cluster->nodes_.push_back(node);
+    partitioner.clusters_[i] = cluster;
+    partitioner.node_2_cluster_[node] = cluster;
+  }
+  for (const auto &edge : edges) {
+    partitioner.InsertEdge(edge.first, edge.second);
+  }
+}
+
+// The clusters left after merging must still form a dag ranked in topological order
+void CheckClusterDag(GraphPartitioner &partitioner) {
+  for (const auto &iter : partitioner.clusters_) {
+    const ClusterPtr &cluster = iter.second;
+    for (auto out : cluster->out_clu_) {
+      EXPECT_LT(cluster->rank_, partitioner.clusters_[out]->rank_);
+      EXPECT_NE(partitioner.clusters_[out], cluster);
+    }
+  }
+}
+}  // namespace
+
+class UtestGraphPartition : public testing::Test {
+ protected:
+  void SetUp() {}
+
+  void TearDown() {}
+};
+
+TEST_F(UtestGraphPartition, mark_clusters_keeps_second_path) {
+  // 0 -> 1 -> 3, 0 -> 2 -> 3, 2 runs on another engine so 0 and 3 can not merge
+  GraphPartitioner partitioner;
+  InitClusters(partitioner, {kAicoreEngine, kAicoreEngine, kAicpuEngine, kAicoreEngine},
+               {{0, 1}, {0, 2}, {1, 3}, {2, 3}});
+  partitioner.MarkClusters();
+  EXPECT_EQ(partitioner.clusters_[0], partitioner.clusters_[1]);
+  EXPECT_NE(partitioner.clusters_[0], partitioner.clusters_[3]);
+  EXPECT_NE(partitioner.clusters_[0], partitioner.clusters_[2]);
+  CheckClusterDag(partitioner);
+}
+
+TEST_F(UtestGraphPartition, mark_clusters_reorders_ranks) {
+  // 0 -> 2 and 1 -> 3 are independent until 0 -> 3 merges 0 and 3, then 1 has to be ranked before 0 and 2 after 3
+  GraphPartitioner partitioner;
+  InitClusters(partitioner, {kAicoreEngine, kAicpuEngine, kAicpuEngine, kAicoreEngine, kAicpuEngine},
+               {{0, 2}, {1, 3}, {0, 3}, {2, 4}, {3, 4}});
+  partitioner.MarkClusters();
+  EXPECT_EQ(partitioner.clusters_[0], partitioner.clusters_[3]);
+  // 2 -> 4 merge as well, the merged cluster stays ranked after 0 and 3
+  EXPECT_EQ(partitioner.clusters_[2], partitioner.clusters_[4]);
+  EXPECT_LT(partitioner.clusters_[1]->rank_, partitioner.clusters_[0]->rank_);
+  EXPECT_GT(partitioner.clusters_[2]->rank_, partitioner.clusters_[0]->rank_);
+  CheckClusterDag(partitioner);
+}
+
+TEST_F(UtestGraphPartition, mark_clusters_large_graph) {
+  const size_t kNodeNum = 100000;
+  std::mt19937 gen(2020);
+  std::vector<std::string> engines;
+  std::vector<std::pair<size_t, size_t>> edges;
+  for (size_t i = 0; i < kNodeNum; ++i) {
+    engines.emplace_back((gen() % 8 == 0) ? kAicpuEngine : kAicoreEngine);
+    if (i == 0) {
+      continue;
+    }
+    edges.emplace_back(i - 1, i);
+    // skip connections of transformer blocks
+    size_t back = 2 + gen() % 64;
+    if ((gen() % 4 == 0) && (i >= back)) {
+      edges.emplace_back(i - back, i);
+    }
+  }
+  GraphPartitioner partitioner;
+  InitClusters(partitioner, engines, edges);
+  partitioner.MarkClusters();
+  CheckClusterDag(partitioner);
+}
+}  // namespace ge
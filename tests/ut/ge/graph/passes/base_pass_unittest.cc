@@ -14,6 +14,7 @@
  * limitations under the License.
  */
 
+#include <atomic>
 #include <iostream>
 #include <map>
 #include <set>
@@ -93,6 +94,27 @@ class TestDelPass : public BaseNodePass {
   Status Run(NodePtr &node) override { return SUCCESS; }
 };
 
+class TestInterestedPass : public BaseNodePass {
+ public:
+  Status Run(NodePtr &node) override {
+    iter_types_.insert(node->GetType());
+    return SUCCESS;
+  }
+  std::vector<std::string> GetInterestedTypes() const override { return {RESHAPE, ADDN}; }
+  std::set<std::string> iter_types_;
+};
+
+class TestNodeLocalPass : public BaseNodePass {
+ public:
+  Status Run(NodePtr &node) override {
+    ++run_times_;
+    (void)AttrUtils::SetBool(node->GetOpDesc(), "test_node_local", true);
+    return SUCCESS;
+  }
+  bool IsNodeLocal() const override { return true; }
+  std::atomic<uint32_t> run_times_{0};
+};
+
 class UTESTGraphPassesBasePass : public testing::Test {
  protected:
   UTESTGraphPassesBasePass() {
@@ -439,4 +461,90 @@ TEST_F(UTESTGraphPassesBasePass, while_loop) {
   auto ge_pass = GEPass(graph);
   EXPECT_EQ(ge_pass.Run(names_to_pass), SUCCESS);
 }
+
+TEST_F(UTESTGraphPassesBasePass, interested_types) {
+  auto graph = BuildGraph2();
+  TestInterestedPass interested_pass;
+  NamesToPass names_to_pass;
+  names_to_pass.push_back(std::make_pair("TestInterested", &interested_pass));
+  GEPass ge_pass(graph);
+  EXPECT_EQ(ge_pass.Run(names_to_pass), SUCCESS);
+  EXPECT_EQ(interested_pass.iter_types_, std::set<std::string>({RESHAPE, ADDN}));
+}
+
+TEST_F(UTESTGraphPassesBasePass, node_local_run_parallel) {
+  // 4 independent chains of 512 nodes, a deep graph with narrow levels is shared out as well
+  auto builder = ut::GraphBuilder("g_parallel");
+  const int chain_num = 4;
+  const int chain_len = 512;
+  for (int i = 0; i < chain_num; ++i) {
+    auto pre = builder.AddNode("data_" + std::to_string(i), DATA, 0, 1);
+    for (int j = 0; j < chain_len - 1; ++j) {
+      auto node = builder.AddNode("relu_" + std::to_string(i) + "_" + std::to_string(j), RELU, 1, 1);
+      builder.AddDataEdge(pre, 0, node, 0);
+      pre = node;
+    }
+  }
+  auto graph = builder.GetGraph();
+
+  TestNodeLocalPass node_local_pass;
+  NamesToPass names_to_pass;
+  names_to_pass.push_back(std::make_pair("TestNodeLocal", &node_local_pass));
+  GEPass ge_pass(graph);
+  EXPECT_EQ(ge_pass.Run(names_to_pass), SUCCESS);
+  EXPECT_EQ(node_local_pass.run_times_, chain_num * chain_len);
+  for (auto &node : graph->GetAllNodes()) {
+    bool flag = false;
+    EXPECT_TRUE(AttrUtils::GetBool(node->GetOpDesc(), "test_node_local", flag));
+    EXPECT_TRUE(flag);
+  }
+}
+
+TEST_F(UTESTGraphPassesBasePass, node_local_run_parallel_with_cycles) {
+  // 64 while loops, data -> enter -> merge -> switch -> relu * 10 -> nextiteration -> merge, switch -> exit
+  auto builder = ut::GraphBuilder("g_parallel_loop");
+  const int loop_num = 64;
+  const int body_len = 10;
+  for (int i = 0; i < loop_num; ++i) {
+    std::string suffix = "_" + std::to_string(i);
+    auto data = builder.AddNode("data" + suffix, DATA, 0, 1);
+    auto enter = builder.AddNode("enter" + suffix, ENTER, 1, 1);
+    auto merge = builder.AddNode("merge" + suffix, MERGE, 2, 1);
+    auto switch_node = builder.AddNode("switch" + suffix, SWITCH, 1, 2);
+    auto next_iteration = builder.AddNode("next_iteration" + suffix, NEXTITERATION, 1, 1);
+    auto exit = builder.AddNode("exit" + suffix, EXIT, 1, 1);
+    builder.AddDataEdge(data, 0, enter, 0);
+    builder.AddDataEdge(enter, 0, merge, 0);
+    builder.AddDataEdge(merge, 0, switch_node, 0);
+    builder.AddDataEdge(switch_node, 0, exit, 0);
+    auto pre = switch_node;
+    int pre_index = 1;
+    for (int j = 0; j < body_len; ++j) {
+      auto node = builder.AddNode("relu" + suffix + "_" + std::to_string(j), RELU, 1, 1);
+      builder.AddDataEdge(pre, pre_index, node, 0);
+      pre = node;
+      pre_index = 0;
+    }
+    builder.AddDataEdge(pre, 0, next_iteration, 0);
+    builder.AddDataEdge(next_iteration, 0, merge, 1);
+  }
+  // a cycle without NextIteration is still passed
+  auto cycle_a = builder.AddNode("cycle_a", RELU, 1, 1);
+  auto cycle_b = builder.AddNode("cycle_b", RELU, 1, 1);
+  builder.AddDataEdge(cycle_a, 0, cycle_b, 0);
+  builder.AddDataEdge(cycle_b, 0, cycle_a, 0);
+  auto graph = builder.GetGraph();
+
+  TestNodeLocalPass node_local_pass;
+  NamesToPass names_to_pass;
+  names_to_pass.push_back(std::make_pair("TestNodeLocal", &node_local_pass));
+  GEPass ge_pass(graph);
+  EXPECT_EQ(ge_pass.Run(names_to_pass), SUCCESS);
+  EXPECT_EQ(node_local_pass.run_times_, loop_num * (body_len + 6) + 2);
+  for (auto &node : graph->GetAllNodes()) {
+    bool flag = false;
+    EXPECT_TRUE(AttrUtils::GetBool(node->GetOpDesc(), "test_node_local", flag)) << node->GetName();
+    EXPECT_TRUE(flag);
+  }
+}
 }  // namespace ge
@@ -48,6 +48,18 @@ class TestReporter : public Msprof::Engine::Reporter {
   int Flush() { return 0; }
 };
 
+class RecordReporter : public Msprof::Engine::Reporter {
+ public:
+  int Report(const Msprof::Engine::ReporterData *data) {
+    reports_.emplace_back(reinterpret_cast<const char *>(data->data), data->dataLen);
+    return 0;
+  }
+
+  int Flush() { return 0; }
+
+  vector<string> reports_;
+};
+
 class TestPluginIntf : public Msprof::Engine::PluginIntf {
  public:
   TestPluginIntf() {}
@@ -119,6 +131,34 @@ TEST_F(UtestGeProfilinganager, report_profiling_data_success) {
   ProfilingManager::Instance().ReportProfilingData(op_task_id_map);
 }
 
+TEST_F(UtestGeProfilinganager, report_profiling_data_packed) {
+  map<uint32_t, string> op_task_id_map;
+  string expect_data;
+  for (uint32_t i = 0; i < 5000; ++i) {
+    op_task_id_map[i] = "model/layer" + std::to_string(i) + "/conv2d";
+    expect_data += op_task_id_map[i] + ' ' + std::to_string(i) + ';';
+  }
+
+  PluginImpl plugin_impl("FMK");
+  RecordReporter reporter;
+  uint64_t report_epoch = ProfilingManager::Instance().GetReportEpoch();
+  plugin_impl.Init(&reporter);
+  EXPECT_NE(ProfilingManager::Instance().GetReportEpoch(), report_epoch);
+
+  ProfilingManager::Instance().ReportProfilingData(op_task_id_map);
+  plugin_impl.UnInit();
+
+  // records stay whole and in order, but share a few reports instead of one each
+  EXPECT_GT(reporter.reports_.size(), 1);
+  EXPECT_LT(reporter.reports_.size(), 10);
+  string report_data;
+  for (const auto &report : reporter.reports_) {
+    EXPECT_EQ(report.back(), ';');
+    report_data += report;
+  }
+  EXPECT_EQ(report_data, expect_data);
+}
+
 TEST_F(UtestGeProfilinganager, plugin_impl_success) {
   PluginImpl plugin_Impl("FMK");
   TestReporter test_reporter;
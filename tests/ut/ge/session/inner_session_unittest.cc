@@ -0,0 +1,104 @@
+/**
+ * Copyright 2019-2020 Huawei Technologies Co., Ltd
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <gtest/gtest.h>
+#include <atomic>
+#include <memory>
+#include <thread>
+#include <vector>
+
+#include "common/ge_inner_error_codes.h"
+#include "omg/omg_inner_types.h"
+
+#define private public
+#include "session/inner_session.h"
+#undef private
+
+using namespace std;
+
+namespace ge {
+namespace {
+const uint32_t kNotExistGraphId = 100;
+
+// Runs iterations RunGraph calls on every session, one thread per session
+void RunSessionsConcurrently(vector<unique_ptr<InnerSession>> &sessions, size_t iterations,
+                             atomic<size_t> &already_running, atomic<size_t> &context_leaked) {
+  vector<thread> threads;
+  for (size_t i = 0; i < sessions.size(); ++i) {
+    threads.emplace_back([&, i]() {
+      InnerSession &session = *sessions[i];
+      string out_node = "out_" + to_string(i);
+      for (size_t iter = 0; iter < iterations; ++iter) {
+        session.graph_manager_.GetOmgContext().out_nodes_map[out_node] = {static_cast<int32_t>(i)};
+        vector<Tensor> inputs;
+        vector<Tensor> outputs;
+        Status ret = session.RunGraph(kNotExistGraphId, inputs, outputs);
+        if (ret == GE_SESS_ALREADY_RUNNING) {
+          ++already_running;
+        }
+        // RunGraph clears the out nodes of its own session only
+        if (!session.graph_manager_.GetOmgContext().out_nodes_map.empty() ||
+            domi::GetContext().out_nodes_map.count("global") == 0) {
+          ++context_leaked;
+        }
+      }
+    });
+  }
+  for (auto &t : threads) {
+    t.join();
+  }
+}
+}  // namespace
+
+class UtestInnerSession : public testing::Test {
+ protected:
+  void SetUp() { domi::GetContext().out_nodes_map["global"] = {0}; }
+  void TearDown() { domi::GetContext().out_nodes_map.clear(); }
+};
+
+TEST_F(UtestInnerSession, thread_context_binding) {
+  OmgContext session_context;
+  OmgContext *prev = domi::SetThreadContext(&session_context);
+  EXPECT_EQ(prev, nullptr);
+  domi::GetContext().out_nodes_map["session"] = {1};
+  EXPECT_EQ(session_context.out_nodes_map.count("session"), 1);
+
+  // Other threads keep seeing the process wide context
+  thread other([]() { EXPECT_EQ(domi::GetContext().out_nodes_map.count("global"), 1); });
+  other.join();
+
+  EXPECT_EQ(domi::SetThreadContext(prev), &session_context);
+  EXPECT_EQ(domi::GetContext().out_nodes_map.count("session"), 0);
+  EXPECT_EQ(domi::GetContext().out_nodes_map.count("global"), 1);
+}
+
+TEST_F(UtestInnerSession, run_graph_sessions_concurrently) {
+  // Sessions do not share a run lock or an omg context, none of them sees another one running
+  vector<unique_ptr<InnerSession>> sessions;
+  for (size_t i = 0; i < 4; ++i) {
+    sessions.emplace_back(new InnerSession(i, {}));
+    sessions.back()->init_flag_ = true;
+  }
+  atomic<size_t> already_running(0);
+  atomic<size_t> context_leaked(0);
+  RunSessionsConcurrently(sessions, 200, already_running, context_leaked);
+  EXPECT_EQ(already_running, 0);
+  EXPECT_EQ(context_leaked, 0);
+  for (auto &session : sessions) {
+    session->init_flag_ = false;
+  }
+}
+}  // namespace ge